@@ -63,6 +63,28 @@ struct UserCallbacks {
     static constexpr std::size_t NUM_PAGE_TABLE_ENTRIES = 1 << (32 - PAGE_BITS);
     std::array<std::uint8_t*, NUM_PAGE_TABLE_ENTRIES>* page_table = nullptr;
 
+    // Fastmem
+    // If this is not nullptr, it must point to the base of a 4 GiB region of host address space which
+    // mirrors the guest address space. Memory accesses are then emitted as a single host access at
+    // fastmem_pointer + vaddr. Should that access fault (e.g. because the host page is not mapped, or is
+    // protected to trap MMIO), the JIT recovers by calling the MemoryRead*/MemoryWrite* callbacks and
+    // patches that access to always call them in the future.
+    // This is ignored if the host does not support recovering from faults. Takes precedence over page_table.
+    std::uint8_t* fastmem_pointer = nullptr;
+
+    // Code cache
+    // Address space for the entire code cache is reserved when the Jit is constructed, but memory is
+    // only committed as code is emitted into it. Code is split into near code, which occupies the first
+    // far_code_offset bytes, and far code, which holds rarely executed paths and occupies the remainder.
+    // Both near code and far code must be at least 16 MiB in size.
+    std::size_t code_cache_size = 128 * 1024 * 1024;
+    std::size_t far_code_offset = 100 * 1024 * 1024;
+
+    // Tiered compilation
+    // If non-zero, blocks are first compiled with minimal optimization. Once such a block has been entered
+    // this many times, it is recompiled with full optimization. If zero, all blocks are fully optimized.
+    std::uint32_t tiered_compilation_threshold = 0;
+
     // Coprocessors
     std::array<std::shared_ptr<Coprocessor>, 16> coprocessors;
 };
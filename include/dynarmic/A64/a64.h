@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <dynarmic/A64/config.h>
 
@@ -17,10 +18,64 @@ namespace Dynarmic {
 namespace A64 {
 
 struct Context;
+class Jit;
+
+/**
+ * A code cache which can be shared between several Jit instances, such as those emulating the cores of
+ * a single guest. Emitted code, block descriptors and cache invalidation are shared between all attached
+ * Jits, while each Jit retains its own guest state.
+ *
+ * Attached Jits may Run concurrently on different threads. Each attached Jit may supply its own UserCallbacks,
+ * so that callbacks such as CallSVC and AddTicks know which core invoked them. All other options of the cache's
+ * UserConfig are shared, so every set of callbacks must present the same view of guest memory.
+ *
+ * Invalidation takes effect once no attached Jit is executing emitted code. Executing Jits are halted for
+ * this and transparently resume afterwards, so a callback must not block waiting on another attached Jit.
+ * The cache must outlive all Jits attached to it.
+ */
+class SharedCache final {
+public:
+    explicit SharedCache(UserConfig conf);
+    ~SharedCache();
+
+    /// Clears the code cache of all compiled code.
+    void ClearCache();
+
+    /**
+     * Invalidate the code cache at a range of addresses.
+     * @param start_address The starting address of the range to invalidate.
+     * @param length The length (in bytes) of the range to invalidate.
+     */
+    void InvalidateCacheRange(std::uint64_t start_address, std::size_t length);
+
+    /**
+     * Serializes the translation cache, which holds the blocks translated while
+     * UserConfig::enable_translation_cache is set. The result may be stored (e.g. on disk) and
+     * passed to LoadTranslationCache by a later process using the same version of this library.
+     */
+    std::vector<std::uint8_t> SaveTranslationCache() const;
+
+    /**
+     * Adds previously saved blocks to the translation cache. A loaded block is used in place of
+     * translating guest code only if the guest code at its location is unchanged.
+     * @returns false if data is not a valid translation cache, in which case nothing is loaded.
+     */
+    bool LoadTranslationCache(const std::vector<std::uint8_t>& data);
+
+private:
+    friend class Jit;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
 
 class Jit final {
 public:
     explicit Jit(UserConfig conf);
+    /// Constructs a Jit which uses (and shares) the code cache and UserConfig of cache.
+    explicit Jit(SharedCache& cache);
+    /// Constructs a Jit which uses the code cache and UserConfig of cache, but calls callbacks instead of those of the UserConfig.
+    Jit(SharedCache& cache, UserCallbacks* callbacks);
     ~Jit();
 
     /**
@@ -32,6 +87,7 @@ public:
     /**
      * Clears the code cache of all compiled code.
      * Can be called at any time. Halts execution if called within a callback.
+     * If this Jit uses a SharedCache, this clears the shared cache.
      */
     void ClearCache();
 
@@ -42,6 +98,20 @@ public:
      */
     void InvalidateCacheRange(std::uint64_t start_address, std::size_t length);
 
+    /**
+     * Serializes the translation cache of this Jit, which holds the blocks translated while
+     * UserConfig::enable_translation_cache is set. The result may be stored (e.g. on disk) and
+     * passed to LoadTranslationCache by a later process using the same version of this library.
+     */
+    std::vector<std::uint8_t> SaveTranslationCache() const;
+
+    /**
+     * Adds previously saved blocks to the translation cache. A loaded block is used in place of
+     * translating guest code only if the guest code at its location is unchanged.
+     * @returns false if data is not a valid translation cache, in which case nothing is loaded.
+     */
+    bool LoadTranslationCache(const std::vector<std::uint8_t>& data);
+
     /**
      * Reset CPU state to state at startup. Does not clear code cache.
      * Cannot be called from a callback.
@@ -50,7 +120,8 @@ public:
 
     /**
      * Stops execution in Jit::Run.
-     * Can only be called from a callback.
+     * Can be called from a callback, or from another thread. If this Jit is not executing, the halt
+     * takes effect in the next call to Run.
      */
     void HaltExecution();
 
@@ -92,11 +163,22 @@ public:
     /// Modify FPCR.
     void SetFpcr(std::uint32_t value);
 
+    /// View FPSR.
+    std::uint32_t GetFpsr() const;
+    /// Modify FPSR.
+    void SetFpsr(std::uint32_t value);
+
     /// View PSTATE
     std::uint32_t GetPstate() const;
     /// Modify PSTATE
     void SetPstate(std::uint32_t value);
 
+    /**
+     * Clears the exclusive monitor.
+     * Call this when memory covered by a reservation this processor may hold is written to by another agent.
+     */
+    void ClearExclusiveState();
+
     /**
      * Returns true if Jit::Run was called but hasn't returned yet.
      * i.e.: We're in a callback.
@@ -15,6 +15,7 @@ namespace Dynarmic {
 namespace A64 {
 
 using VAddr = std::uint64_t;
+using Vector = std::array<std::uint64_t, 2>;
 
 enum class Exception {
     /// An UndefinedFault occured due to executing instruction with an unallocated encoding
@@ -39,12 +40,17 @@ struct UserCallbacks {
     virtual std::uint16_t MemoryRead16(VAddr vaddr) = 0;
     virtual std::uint32_t MemoryRead32(VAddr vaddr) = 0;
     virtual std::uint64_t MemoryRead64(VAddr vaddr) = 0;
+    virtual Vector MemoryRead128(VAddr vaddr) { return {MemoryRead64(vaddr), MemoryRead64(vaddr + 8)}; }
 
     // Writes through these callbacks may not be aligned.
     virtual void MemoryWrite8(VAddr vaddr, std::uint8_t value) = 0;
     virtual void MemoryWrite16(VAddr vaddr, std::uint16_t value) = 0;
     virtual void MemoryWrite32(VAddr vaddr, std::uint32_t value) = 0;
     virtual void MemoryWrite64(VAddr vaddr, std::uint64_t value) = 0;
+    virtual void MemoryWrite128(VAddr vaddr, Vector value) {
+        MemoryWrite64(vaddr, value[0]);
+        MemoryWrite64(vaddr + 8, value[1]);
+    }
 
     // If this callback returns true, the JIT will assume MemoryRead* callbacks will always
     // return the same value at any point in time for this vaddr. The JIT may use this information
@@ -70,6 +76,50 @@ struct UserCallbacks {
 struct UserConfig {
     UserCallbacks* callbacks;
 
+    // Page Table
+    // The page table is used for faster memory access. If an entry in the table is nullptr,
+    // the JIT will fallback to calling the MemoryRead*/MemoryWrite* callbacks.
+    // The table is flat and covers the lowest 2^page_table_address_space_bits bytes of the address space;
+    // it must have (1 << (page_table_address_space_bits - PAGE_BITS)) entries. Accesses to addresses
+    // outside of this range always go through the callbacks.
+    // Accesses which straddle a page boundary are not detected; the host page following a mapped
+    // page is assumed to be the next guest page.
+    static constexpr std::size_t PAGE_BITS = 12;
+    void** page_table = nullptr;
+    std::size_t page_table_address_space_bits = 36;
+
+    // Fastmem
+    // If this is not nullptr, it must point to the base of a 2^fastmem_address_space_bits byte region of
+    // host address space which mirrors the lowest part of the guest address space. Memory accesses are
+    // then emitted as a single host access at fastmem_pointer + vaddr. Should that access fault (e.g.
+    // because the host page is not mapped, or is protected to trap MMIO), the JIT recovers by calling the
+    // MemoryRead*/MemoryWrite* callbacks and patches that access to always call them in the future.
+    // Accesses to addresses outside of this region always go through the callbacks.
+    // This is ignored if the host does not support recovering from faults. Takes precedence over page_table.
+    void* fastmem_pointer = nullptr;
+    std::size_t fastmem_address_space_bits = 36;
+
+    // Code cache
+    // Address space for the entire code cache is reserved when the Jit is constructed, but memory is
+    // only committed as code is emitted into it. Code is split into near code, which occupies the first
+    // far_code_offset bytes, and far code, which holds rarely executed paths and occupies the remainder.
+    // Both near code and far code must be at least 16 MiB in size.
+    std::size_t code_cache_size = 128 * 1024 * 1024;
+    std::size_t far_code_offset = 100 * 1024 * 1024;
+
+    // Background compilation
+    // If true, blocks are optimized and emitted on a background thread. Until a block is ready, its
+    // instructions are executed one at a time through InterpreterFallback, which must therefore be able
+    // to execute any instruction. Blocks are still decoded on the thread which runs the Jit.
+    bool enable_background_compilation = false;
+
+    // Translation cache
+    // If true, the intermediate representation of every translated block is retained so that it can be
+    // saved with Jit::SaveTranslationCache and loaded by a later process with Jit::LoadTranslationCache,
+    // allowing that process to skip translating unchanged guest code. Loaded blocks are used regardless
+    // of this setting.
+    bool enable_translation_cache = false;
+
     // Determines whether AddTicks and GetTicksRemaining are called.
     // If false, execution will continue until soon after Jit::HaltExecution is called.
     // bool enable_ticks = true; // TODO
@@ -57,7 +57,7 @@ A32::LocationDescriptor A32EmitContext::Location() const {
 }
 
 bool A32EmitContext::FPSCR_RoundTowardsZero() const {
-    return Location().FPSCR().RMode() != A32::FPSCR::RoundingMode::TowardsZero;
+    return Location().FPSCR().RMode() == A32::FPSCR::RoundingMode::TowardsZero;
 }
 
 bool A32EmitContext::FPSCR_FTZ() const {
@@ -73,15 +73,23 @@ A32EmitX64::A32EmitX64(BlockOfCode* code, A32::UserCallbacks cb, A32::Jit* jit_i
 {
     GenMemoryAccessors();
     code->PreludeComplete();
+
+    if (cb.fastmem_pointer && code->SupportsFastmem()) {
+        code->SetFastmemCallback([this](u64 rip) { return FastmemCallback(rip); });
+    }
 }
 
 A32EmitX64::~A32EmitX64() = default;
 
-A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
+A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block, u32 promotion_threshold) {
     code->align();
     const u8* const entrypoint = code->getCurr();
 
     // Start emitting.
+    if (promotion_threshold != 0) {
+        EmitPromotionCounter(block.Location(), promotion_threshold);
+    }
+
     EmitCondPrelude(block);
 
     RegAlloc reg_alloc{code, A32JitState::SpillCount, SpillToOpArg<A32JitState>};
@@ -134,13 +142,67 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
     return block_desc;
 }
 
+bool A32EmitX64::IsHot(IR::LocationDescriptor descriptor) const {
+    return hot_locations.count(descriptor) != 0;
+}
+
 void A32EmitX64::ClearCache() {
     EmitX64::ClearCache();
     block_ranges.ClearCache();
+    execution_counters.clear();
+    hot_locations.clear();
 }
 
 void A32EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges) {
-    InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
+    const auto locations = block_ranges.InvalidateRanges(ranges);
+    InvalidateBasicBlocks(locations);
+    ForgetTieringState(locations);
+}
+
+void A32EmitX64::InvalidateCodeRegion(const CodeRegion& region) {
+    const auto locations = EmitX64::InvalidateCodeRegion(region);
+    block_ranges.RemoveLocations(locations);
+    ForgetTieringState(locations);
+}
+
+void A32EmitX64::ForgetTieringState(const std::unordered_set<IR::LocationDescriptor>& locations) {
+    // The invalidated blocks are never entered again, so nothing still refers to their counters.
+    for (const auto& location : locations) {
+        execution_counters.erase(location);
+        hot_locations.erase(location);
+    }
+}
+
+void A32EmitX64::EmitPromotionCounter(IR::LocationDescriptor descriptor, u32 promotion_threshold) {
+    u32& counter = execution_counters[descriptor];
+    counter = promotion_threshold;
+
+    // Nothing is live at block entry.
+    Xbyak::Label promote;
+    code->mov(rax, reinterpret_cast<u64>(&counter));
+    code->sub(dword[rax], 1);
+    code->jz(promote, Xbyak::CodeGenerator::T_NEAR);
+
+    code->SwitchToFarCode();
+    code->align(16);
+    code->L(promote);
+    code->mov(MJitStateReg(A32::Reg::PC), A32::LocationDescriptor{descriptor}.PC());
+    code->SwitchMxcsrOnExit();
+    code->mov(code->ABI_PARAM1, reinterpret_cast<u64>(this));
+    code->mov(code->ABI_PARAM2, descriptor.Value());
+    code->mov(code->ABI_PARAM3, r15);
+    code->CallFunction(&A32EmitX64::PromoteBlock);
+    code->ReturnFromRunCode(true);
+    code->SwitchToNearCode();
+}
+
+void A32EmitX64::PromoteBlock(A32EmitX64* this_, u64 descriptor, A32JitState* jit_state) {
+    // The invalidated code remains valid until its region is evicted, so it is safe to return through it.
+    const IR::LocationDescriptor location{descriptor};
+    this_->hot_locations.insert(location);
+    this_->InvalidateBasicBlocks({location});
+    jit_state->ResetRSB();
+    jit_state->dispatch_table->Clear();
 }
 
 void A32EmitX64::GenMemoryAccessors() {
@@ -615,8 +677,12 @@ void A32EmitX64::EmitA32GetFpscrNZCV(A32EmitContext& ctx, IR::Inst* inst) {
 
 void A32EmitX64::EmitA32SetFpscrNZCV(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    Xbyak::Reg32 value = ctx.reg_alloc.UseGpr(args[0]).cvt32();
+    Xbyak::Reg32 value = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
 
+    code->and_(value, 0b11000001'00000001);
+    code->imul(value, value, 0b00010000'00100001);
+    code->shl(value, 16);
+    code->and_(value, 0xF0000000);
     code->mov(dword[r15 + offsetof(A32JitState, FPSCR_nzcv)], value);
 }
 
@@ -634,9 +700,43 @@ void A32EmitX64::EmitA32SetExclusive(A32EmitContext& ctx, IR::Inst* inst) {
 }
 
 template <typename RawFn>
-static void ReadMemory(BlockOfCode* code, RegAlloc& reg_alloc, IR::Inst* inst, const A32::UserCallbacks& cb, size_t bit_size, RawFn raw_fn, const CodePtr wrapped_fn) {
+void A32EmitX64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, size_t bit_size, RawFn raw_fn, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
     auto args = reg_alloc.GetArgumentInfo(inst);
 
+    if (cb.fastmem_pointer && code->SupportsFastmem()) {
+        reg_alloc.UseScratch(args[0], ABI_PARAM1);
+
+        Xbyak::Reg64 result = reg_alloc.ScratchGpr({ABI_RETURN});
+        Xbyak::Reg64 vaddr = code->ABI_PARAM1;
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        code->mov(base, reinterpret_cast<u64>(cb.fastmem_pointer));
+        code->mov(vaddr.cvt32(), vaddr.cvt32()); // Zero-extend
+        const CodePtr location = code->getCurr();
+        switch (bit_size) {
+        case 8:
+            code->movzx(result.cvt32(), code->byte[base + vaddr]);
+            break;
+        case 16:
+            code->movzx(result.cvt32(), word[base + vaddr]);
+            break;
+        case 32:
+            code->mov(result.cvt32(), dword[base + vaddr]);
+            break;
+        case 64:
+            code->mov(result, qword[base + vaddr]);
+            break;
+        default:
+            ASSERT_MSG(false, "Invalid bit_size");
+            break;
+        }
+        RegisterFastmemAccess(location, wrapped_fn);
+
+        reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     if (!cb.page_table) {
         reg_alloc.HostCall(inst, args[0]);
         code->CallFunction(raw_fn);
@@ -686,9 +786,43 @@ static void ReadMemory(BlockOfCode* code, RegAlloc& reg_alloc, IR::Inst* inst, c
 }
 
 template <typename RawFn>
-static void WriteMemory(BlockOfCode* code, RegAlloc& reg_alloc, IR::Inst* inst, const A32::UserCallbacks& cb, size_t bit_size, RawFn raw_fn, const CodePtr wrapped_fn) {
+void A32EmitX64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst, size_t bit_size, RawFn raw_fn, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
     auto args = reg_alloc.GetArgumentInfo(inst);
 
+    if (cb.fastmem_pointer && code->SupportsFastmem()) {
+        reg_alloc.ScratchGpr({ABI_RETURN});
+        reg_alloc.UseScratch(args[0], ABI_PARAM1);
+        reg_alloc.UseScratch(args[1], ABI_PARAM2);
+
+        Xbyak::Reg64 vaddr = code->ABI_PARAM1;
+        Xbyak::Reg64 value = code->ABI_PARAM2;
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        code->mov(base, reinterpret_cast<u64>(cb.fastmem_pointer));
+        code->mov(vaddr.cvt32(), vaddr.cvt32()); // Zero-extend
+        const CodePtr location = code->getCurr();
+        switch (bit_size) {
+        case 8:
+            code->mov(code->byte[base + vaddr], value.cvt8());
+            break;
+        case 16:
+            code->mov(word[base + vaddr], value.cvt16());
+            break;
+        case 32:
+            code->mov(dword[base + vaddr], value.cvt32());
+            break;
+        case 64:
+            code->mov(qword[base + vaddr], value);
+            break;
+        default:
+            ASSERT_MSG(false, "Invalid bit_size");
+            break;
+        }
+        RegisterFastmemAccess(location, wrapped_fn);
+        return;
+    }
+
     if (!cb.page_table) {
         reg_alloc.HostCall(nullptr, args[0], args[1]);
         code->CallFunction(raw_fn);
@@ -738,35 +872,35 @@ static void WriteMemory(BlockOfCode* code, RegAlloc& reg_alloc, IR::Inst* inst,
 }
 
 void A32EmitX64::EmitA32ReadMemory8(A32EmitContext& ctx, IR::Inst* inst) {
-    ReadMemory(code, ctx.reg_alloc, inst, cb, 8, cb.memory.Read8, read_memory_8);
+    ReadMemory(ctx, inst, 8, cb.memory.Read8, read_memory_8);
 }
 
 void A32EmitX64::EmitA32ReadMemory16(A32EmitContext& ctx, IR::Inst* inst) {
-    ReadMemory(code, ctx.reg_alloc, inst, cb, 16, cb.memory.Read16, read_memory_16);
+    ReadMemory(ctx, inst, 16, cb.memory.Read16, read_memory_16);
 }
 
 void A32EmitX64::EmitA32ReadMemory32(A32EmitContext& ctx, IR::Inst* inst) {
-    ReadMemory(code, ctx.reg_alloc, inst, cb, 32, cb.memory.Read32, read_memory_32);
+    ReadMemory(ctx, inst, 32, cb.memory.Read32, read_memory_32);
 }
 
 void A32EmitX64::EmitA32ReadMemory64(A32EmitContext& ctx, IR::Inst* inst) {
-    ReadMemory(code, ctx.reg_alloc, inst, cb, 64, cb.memory.Read64, read_memory_64);
+    ReadMemory(ctx, inst, 64, cb.memory.Read64, read_memory_64);
 }
 
 void A32EmitX64::EmitA32WriteMemory8(A32EmitContext& ctx, IR::Inst* inst) {
-    WriteMemory(code, ctx.reg_alloc, inst, cb, 8, cb.memory.Write8, write_memory_8);
+    WriteMemory(ctx, inst, 8, cb.memory.Write8, write_memory_8);
 }
 
 void A32EmitX64::EmitA32WriteMemory16(A32EmitContext& ctx, IR::Inst* inst) {
-    WriteMemory(code, ctx.reg_alloc, inst, cb, 16, cb.memory.Write16, write_memory_16);
+    WriteMemory(ctx, inst, 16, cb.memory.Write16, write_memory_16);
 }
 
 void A32EmitX64::EmitA32WriteMemory32(A32EmitContext& ctx, IR::Inst* inst) {
-    WriteMemory(code, ctx.reg_alloc, inst, cb, 32, cb.memory.Write32, write_memory_32);
+    WriteMemory(ctx, inst, 32, cb.memory.Write32, write_memory_32);
 }
 
 void A32EmitX64::EmitA32WriteMemory64(A32EmitContext& ctx, IR::Inst* inst) {
-    WriteMemory(code, ctx.reg_alloc, inst, cb, 64, cb.memory.Write64, write_memory_64);
+    WriteMemory(ctx, inst, 64, cb.memory.Write64, write_memory_64);
 }
 
 template <typename FunctionPointer>
@@ -1176,7 +1310,7 @@ void A32EmitX64::EmitTerminalImpl(IR::Term::CheckBit, IR::LocationDescriptor) {
 }
 
 void A32EmitX64::EmitTerminalImpl(IR::Term::CheckHalt terminal, IR::LocationDescriptor initial_location) {
-    code->cmp(code->byte[r15 + offsetof(A32JitState, halt_requested)], u8(0));
+    code->cmp(code->dword[r15 + offsetof(A32JitState, halt_requested)], 0);
     code->jne(code->GetForceReturnFromRunCodeAddress());
     EmitTerminal(terminal.else_, initial_location);
 }
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <boost/optional.hpp>
 
 #include "backend_x64/a32_jitstate.h"
@@ -36,19 +39,35 @@ public:
 
     /**
      * Emit host machine code for a basic block with intermediate representation `ir`.
+     * If promotion_threshold is non-zero, the emitted block counts how often it is entered. Once it has been
+     * entered promotion_threshold times, it invalidates itself and its location is marked as hot (See: IsHot).
      * @note ir is modified.
      */
-    BlockDescriptor Emit(IR::Block& ir);
+    BlockDescriptor Emit(IR::Block& ir, u32 promotion_threshold = 0);
+
+    /// Returns true if a block emitted at this location has reached its promotion threshold.
+    bool IsHot(IR::LocationDescriptor descriptor) const;
 
     void ClearCache() override;
 
     void InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges);
 
+    /// Invalidates all basic blocks emitted within region, including their guest address ranges.
+    void InvalidateCodeRegion(const CodeRegion& region);
+
 protected:
     const A32::UserCallbacks cb;
     A32::Jit* jit_interface;
     BlockRangeInformation<u32> block_ranges;
 
+    // Tiered compilation
+    std::unordered_map<IR::LocationDescriptor, u32> execution_counters;
+    std::unordered_set<IR::LocationDescriptor> hot_locations;
+    void EmitPromotionCounter(IR::LocationDescriptor descriptor, u32 promotion_threshold);
+    /// Forgets the execution counts and hotness of locations whose blocks have been invalidated or evicted.
+    void ForgetTieringState(const std::unordered_set<IR::LocationDescriptor>& locations);
+    static void PromoteBlock(A32EmitX64* this_, u64 descriptor, A32JitState* jit_state);
+
     const void* read_memory_8;
     const void* read_memory_16;
     const void* read_memory_32;
@@ -59,6 +78,11 @@ protected:
     const void* write_memory_64;
     void GenMemoryAccessors();
 
+    template <typename RawFn>
+    void ReadMemory(A32EmitContext& ctx, IR::Inst* inst, size_t bit_size, RawFn raw_fn, CodePtr wrapped_fn);
+    template <typename RawFn>
+    void WriteMemory(A32EmitContext& ctx, IR::Inst* inst, size_t bit_size, RawFn raw_fn, CodePtr wrapped_fn);
+
     // Microinstruction emitters
 #define OPCODE(...)
 #define A32OPC(name, type, ...) void EmitA32##name(A32EmitContext& ctx, IR::Inst* inst);
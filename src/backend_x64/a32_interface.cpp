@@ -18,6 +18,7 @@
 #include "backend_x64/a32_jitstate.h"
 #include "backend_x64/block_of_code.h"
 #include "backend_x64/callback.h"
+#include "backend_x64/dispatch_table.h"
 #include "backend_x64/jitstate_info.h"
 #include "common/assert.h"
 #include "common/common_types.h"
@@ -44,13 +45,16 @@ static RunCodeCallbacks GenRunCodeCallbacks(A32::UserCallbacks cb, CodePtr (*Loo
 
 struct Jit::Impl {
     Impl(Jit* jit, A32::UserCallbacks callbacks)
-            : block_of_code(GenRunCodeCallbacks(callbacks, &GetCurrentBlock, this), JitStateInfo{jit_state})
+            : block_of_code(GenRunCodeCallbacks(callbacks, &GetCurrentBlock, this), JitStateInfo{jit_state}, callbacks.code_cache_size, callbacks.far_code_offset)
             , emitter(&block_of_code, callbacks, jit)
             , callbacks(callbacks)
             , jit_interface(jit)
-    {}
+    {
+        jit_state.dispatch_table = &dispatch_table;
+    }
 
     A32JitState jit_state;
+    DispatchTable dispatch_table;
     BlockOfCode block_of_code;
     A32EmitX64 emitter;
     const A32::UserCallbacks callbacks;
@@ -105,6 +109,7 @@ struct Jit::Impl {
     void PerformCacheInvalidation() {
         if (invalidate_entire_cache) {
             jit_state.ResetRSB();
+            dispatch_table.Clear();
             block_of_code.ClearCache();
             emitter.ClearCache();
 
@@ -119,6 +124,7 @@ struct Jit::Impl {
         }
 
         jit_state.ResetRSB();
+        dispatch_table.Clear();
         emitter.InvalidateCacheRanges(invalid_cache_ranges);
         invalid_cache_ranges.clear();
         invalid_cache_generation++;
@@ -126,7 +132,7 @@ struct Jit::Impl {
 
     void RequestCacheInvalidation() {
         if (jit_interface->is_executing) {
-            jit_state.halt_requested = true;
+            jit_state.halt_requested = 1;
             return;
         }
 
@@ -155,18 +161,28 @@ private:
 
         constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
         if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            invalidate_entire_cache = true;
-            PerformCacheInvalidation();
+            // Evict the oldest region of the cache to make space
+            jit_state.ResetRSB();
+            dispatch_table.Clear();
+            emitter.InvalidateCodeRegion(block_of_code.AdvanceRegion());
+            invalid_cache_generation++;
         }
+        block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
+
+        // Blocks start out in a cheaply compiled tier and are fully optimized once they are hot.
+        const u32 threshold = callbacks.tiered_compilation_threshold;
+        const bool optimize = threshold == 0 || emitter.IsHot(descriptor);
 
         IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, callbacks.memory.ReadCode);
-        Optimization::A32GetSetElimination(ir_block);
-        Optimization::DeadCodeElimination(ir_block);
-        Optimization::A32ConstantMemoryReads(ir_block, callbacks.memory);
-        Optimization::ConstantPropagation(ir_block);
+        if (optimize) {
+            Optimization::A32GetSetElimination(ir_block);
+            Optimization::DeadCodeElimination(ir_block);
+            Optimization::A32ConstantMemoryReads(ir_block, callbacks.memory);
+            Optimization::ConstantPropagation(ir_block);
+        }
         Optimization::DeadCodeElimination(ir_block);
         Optimization::VerificationPass(ir_block);
-        return emitter.Emit(ir_block);
+        return emitter.Emit(ir_block, optimize ? 0 : threshold);
     }
 };
 
@@ -179,7 +195,7 @@ void Jit::Run() {
     is_executing = true;
     SCOPE_EXIT({ this->is_executing = false; });
 
-    impl->jit_state.halt_requested = false;
+    impl->jit_state.halt_requested = 0;
 
     impl->Execute();
 
@@ -199,10 +215,11 @@ void Jit::InvalidateCacheRange(std::uint32_t start_address, std::size_t length)
 void Jit::Reset() {
     ASSERT(!is_executing);
     impl->jit_state = {};
+    impl->jit_state.dispatch_table = &impl->dispatch_table;
 }
 
 void Jit::HaltExecution() {
-    impl->jit_state.halt_requested = true;
+    impl->jit_state.halt_requested = 1;
 }
 
 std::array<u32, 16>& Jit::Regs() {
@@ -300,6 +317,7 @@ void TransferJitState(A32JitState& dest, const A32JitState& src, bool reset_rsb)
     dest.guest_MXCSR = src.guest_MXCSR;
     dest.FPSCR_IDC = src.FPSCR_IDC;
     dest.FPSCR_UFC = src.FPSCR_UFC;
+    dest.FPSCR_QC = src.FPSCR_QC;
     dest.FPSCR_mode = src.FPSCR_mode;
     dest.FPSCR_nzcv = src.FPSCR_nzcv;
     if (reset_rsb) {
@@ -158,12 +158,14 @@ u32 A32JitState::Fpscr() const {
     ASSERT((FPSCR_nzcv & ~FPSCR_NZCV_MASK) == 0);
     ASSERT((FPSCR_IDC & ~(1 << 7)) == 0);
     ASSERT((FPSCR_UFC & ~(1 << 3)) == 0);
+    ASSERT((FPSCR_QC & ~1) == 0);
 
     u32 FPSCR = FPSCR_mode | FPSCR_nzcv;
     FPSCR |= (guest_MXCSR & 0b0000000000001);       // IOC = IE
     FPSCR |= (guest_MXCSR & 0b0000000111100) >> 1;  // IXC, UFC, OFC, DZC = PE, UE, OE, ZE
     FPSCR |= FPSCR_IDC;
     FPSCR |= FPSCR_UFC;
+    FPSCR |= FPSCR_QC ? 1 << 27 : 0;
 
     return FPSCR;
 }
@@ -192,6 +194,9 @@ void A32JitState::SetFpscr(u32 FPSCR) {
     FPSCR_IDC = FPSCR & (1 << 7);
     FPSCR_UFC = FPSCR & (1 << 3);
 
+    // Cumulative saturation flag QC
+    FPSCR_QC = Common::Bit<27>(FPSCR) ? 1 : 0;
+
     if (Common::Bit<24>(FPSCR)) {
         // VFP Flush to Zero
         //guest_MXCSR |= (1 << 15); // SSE Flush to Zero
@@ -203,5 +208,16 @@ u64 A32JitState::GetUniqueHash() const {
     return CPSR_et | FPSCR_mode | (static_cast<u64>(Reg[15]) << 32);
 }
 
+void A32JitState::EmitUniqueHash(BlockOfCode* code, Xbyak::Reg64 result, Xbyak::Reg64 scratch) {
+    using namespace Xbyak::util;
+
+    // This calculation has to match up with GetUniqueHash
+    code->mov(scratch.cvt32(), dword[r15 + offsetof(A32JitState, Reg) + 15 * sizeof(u32)]);
+    code->shl(scratch, 32);
+    code->mov(result.cvt32(), dword[r15 + offsetof(A32JitState, FPSCR_mode)]);
+    code->or_(result.cvt32(), dword[r15 + offsetof(A32JitState, CPSR_et)]);
+    code->or_(result, scratch);
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
@@ -10,6 +10,7 @@
 
 #include <xbyak.h>
 
+#include "backend_x64/dispatch_table.h"
 #include "common/common_types.h"
 
 namespace Dynarmic {
@@ -42,10 +43,10 @@ struct A32JitState {
     alignas(u64) std::array<u32, 64> ExtReg{}; // Extension registers.
 
     static constexpr size_t SpillCount = 64;
-    std::array<u64, SpillCount> Spill{}; // Spill.
+    alignas(16) std::array<std::array<u64, 2>, SpillCount> Spill{}; // Spill.
     static Xbyak::Address GetSpillLocationFromIndex(size_t i) {
         using namespace Xbyak::util;
-        return qword[r15 + offsetof(A32JitState, Spill) + i * sizeof(u64)];
+        return Xbyak::Address{128, false, r15 + offsetof(A32JitState, Spill) + i * sizeof(u64) * 2};
     }
 
     // For internal use (See: BlockOfCode::RunCode)
@@ -53,7 +54,8 @@ struct A32JitState {
     u32 save_host_MXCSR = 0;
     s64 cycles_to_run = 0;
     s64 cycles_remaining = 0;
-    bool halt_requested = false;
+    u32 halt_requested = 0;
+    DispatchTable* dispatch_table = nullptr;
 
     // Exclusive state
     static constexpr u32 RESERVATION_GRANULE_MASK = 0xFFFFFFF8;
@@ -69,6 +71,7 @@ struct A32JitState {
 
     u32 FPSCR_IDC = 0;
     u32 FPSCR_UFC = 0;
+    u32 FPSCR_QC = 0; ///< Cumulative saturation flag, set by emitted code.
     u32 FPSCR_mode = 0;
     u32 FPSCR_nzcv = 0;
     u32 old_FPSCR = 0;
@@ -76,6 +79,7 @@ struct A32JitState {
     void SetFpscr(u32 FPSCR);
 
     u64 GetUniqueHash() const;
+    static void EmitUniqueHash(BlockOfCode* code, Xbyak::Reg64 result, Xbyak::Reg64 scratch);
 };
 
 #ifdef _MSC_VER
@@ -4,6 +4,9 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
+#include <mutex>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -32,6 +35,111 @@ namespace BackendX64 {
 
 using namespace Xbyak::util;
 
+// Jits sharing this emitter may have different callbacks, so emitted code calls those of the jit state it is running.
+#define DEVIRT_CALLBACKS(mfp) DEVIRT_JIT_STATE(offsetof(A64JitState, callbacks), mfp)
+
+namespace {
+
+template <typename T>
+T ReadMemoryViaCallbacks(A64::UserCallbacks* cb, u64 vaddr) {
+    if constexpr (sizeof(T) == 1) {
+        return cb->MemoryRead8(vaddr);
+    } else if constexpr (sizeof(T) == 2) {
+        return cb->MemoryRead16(vaddr);
+    } else if constexpr (sizeof(T) == 4) {
+        return cb->MemoryRead32(vaddr);
+    } else {
+        return cb->MemoryRead64(vaddr);
+    }
+}
+
+template <typename T>
+void WriteMemoryViaCallbacks(A64::UserCallbacks* cb, u64 vaddr, T value) {
+    if constexpr (sizeof(T) == 1) {
+        cb->MemoryWrite8(vaddr, value);
+    } else if constexpr (sizeof(T) == 2) {
+        cb->MemoryWrite16(vaddr, value);
+    } else if constexpr (sizeof(T) == 4) {
+        cb->MemoryWrite32(vaddr, value);
+    } else {
+        cb->MemoryWrite64(vaddr, value);
+    }
+}
+
+template <typename T>
+T PerformAtomicOp(A64::AtomicOp op, T old_value, T value) {
+    using S = std::make_signed_t<T>;
+    switch (op) {
+    case A64::AtomicOp::Add:
+        return static_cast<T>(old_value + value);
+    case A64::AtomicOp::Clear:
+        return static_cast<T>(old_value & ~value);
+    case A64::AtomicOp::Eor:
+        return static_cast<T>(old_value ^ value);
+    case A64::AtomicOp::Set:
+        return static_cast<T>(old_value | value);
+    case A64::AtomicOp::SMax:
+        return static_cast<S>(old_value) > static_cast<S>(value) ? old_value : value;
+    case A64::AtomicOp::SMin:
+        return static_cast<S>(old_value) < static_cast<S>(value) ? old_value : value;
+    case A64::AtomicOp::UMax:
+        return old_value > value ? old_value : value;
+    case A64::AtomicOp::UMin:
+        return old_value < value ? old_value : value;
+    case A64::AtomicOp::Swap:
+        return value;
+    }
+    UNREACHABLE();
+    return {};
+}
+
+// 128-bit values are passed to and from these through memory, so that the generated thunks do not
+// depend on how the host ABI passes aggregates.
+
+void ReadMemory128Fallback(A64::UserCallbacks* cb, u64 vaddr, A64::Vector* result) {
+    *result = cb->MemoryRead128(vaddr);
+}
+
+void WriteMemory128Fallback(A64::UserCallbacks* cb, u64 vaddr, const A64::Vector* value) {
+    cb->MemoryWrite128(vaddr, *value);
+}
+
+// These are only used when the guest address is not backed by host memory, either because there is no page
+// table or fastmem region or because the access faulted. They are serialised by a lock shared by all jits, so
+// they are atomic with respect to one another. Atomicity with respect to other accesses made through the memory
+// callbacks is the responsibility of those callbacks.
+
+std::mutex atomic_fallback_mutex;
+
+template <typename T>
+u64 AtomicMemoryFallback(A64::UserCallbacks* cb, u64 vaddr, u64 value, u64 op) {
+    std::lock_guard<std::mutex> lock{atomic_fallback_mutex};
+    const T old_value = ReadMemoryViaCallbacks<T>(cb, vaddr);
+    WriteMemoryViaCallbacks<T>(cb, vaddr, PerformAtomicOp<T>(static_cast<A64::AtomicOp>(op), old_value, static_cast<T>(value)));
+    return old_value;
+}
+
+template <typename T>
+u64 CompareAndSwapMemoryFallback(A64::UserCallbacks* cb, u64 vaddr, u64 expected, u64 desired) {
+    std::lock_guard<std::mutex> lock{atomic_fallback_mutex};
+    const T old_value = ReadMemoryViaCallbacks<T>(cb, vaddr);
+    if (old_value == static_cast<T>(expected)) {
+        WriteMemoryViaCallbacks<T>(cb, vaddr, static_cast<T>(desired));
+    }
+    return old_value;
+}
+
+void CompareAndSwapMemory128Fallback(A64::UserCallbacks* cb, u64 vaddr, A64::Vector* expected_and_result, const A64::Vector* desired) {
+    std::lock_guard<std::mutex> lock{atomic_fallback_mutex};
+    const A64::Vector old_value = cb->MemoryRead128(vaddr);
+    if (old_value == *expected_and_result) {
+        cb->MemoryWrite128(vaddr, *desired);
+    }
+    *expected_and_result = old_value;
+}
+
+} // anonymous namespace
+
 A64EmitContext::A64EmitContext(RegAlloc& reg_alloc, IR::Block& block)
     : EmitContext(reg_alloc, block) {}
 
@@ -40,7 +148,7 @@ A64::LocationDescriptor A64EmitContext::Location() const {
 }
 
 bool A64EmitContext::FPSCR_RoundTowardsZero() const {
-    return Location().FPCR().RMode() != A64::FPCR::RoundingMode::TowardsZero;
+    return Location().FPCR().RMode() == A64::FPCR::RoundingMode::TowardsZero;
 }
 
 bool A64EmitContext::FPSCR_FTZ() const {
@@ -54,7 +162,13 @@ bool A64EmitContext::FPSCR_DN() const {
 A64EmitX64::A64EmitX64(BlockOfCode* code, A64::UserConfig conf)
     : EmitX64(code), conf(conf)
 {
+    GenMemoryAccessors();
+    GenInterpretSingleInstruction();
     code->PreludeComplete();
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        code->SetFastmemCallback([this](u64 rip) { return FastmemCallback(rip); });
+    }
 }
 
 A64EmitX64::~A64EmitX64() = default;
@@ -125,6 +239,144 @@ void A64EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& rang
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
 
+void A64EmitX64::InvalidateCodeRegion(const CodeRegion& region) {
+    block_ranges.RemoveLocations(EmitX64::InvalidateCodeRegion(region));
+}
+
+void A64EmitX64::GenMemoryAccessors() {
+    code->align();
+    read_memory_8 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead8).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    code->align();
+    read_memory_16 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead16).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    code->align();
+    read_memory_32 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead32).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    code->align();
+    read_memory_64 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead64).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    // The address is passed in ABI_PARAM2 and the value is returned in xmm1.
+    code->align();
+    read_memory_128 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::XMM1, 16);
+    code->mov(code->ABI_PARAM1, qword[r15 + offsetof(A64JitState, callbacks)]);
+    code->lea(code->ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
+    code->CallFunction(&ReadMemory128Fallback);
+    code->movaps(xmm1, code->xword[rsp + ABI_SHADOW_SPACE]);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::XMM1, 16);
+    code->ret();
+
+    code->align();
+    write_memory_8 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite8).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    code->align();
+    write_memory_16 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite16).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    code->align();
+    write_memory_32 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite32).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    code->align();
+    write_memory_64 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite64).EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code->ret();
+
+    // The address is passed in ABI_PARAM2 and the value in xmm1.
+    code->align();
+    write_memory_128 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code, 16);
+    code->movaps(code->xword[rsp + ABI_SHADOW_SPACE], xmm1);
+    code->mov(code->ABI_PARAM1, qword[r15 + offsetof(A64JitState, callbacks)]);
+    code->lea(code->ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
+    code->CallFunction(&WriteMemory128Fallback);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code, 16);
+    code->ret();
+
+    // Arguments are passed in ABI_PARAM2 to ABI_PARAM4, the result is returned in ABI_RETURN.
+    // These are fenced on both sides, as the locked instructions they stand in for are.
+    const auto gen_fallback_accessor = [this](auto fn) {
+        code->align();
+        const void* const entrypoint = code->getCurr<const void*>();
+        ABI_PushCallerSaveRegistersAndAdjustStack(code);
+        code->mfence();
+        code->mov(code->ABI_PARAM1, qword[r15 + offsetof(A64JitState, callbacks)]);
+        code->CallFunction(fn);
+        code->mfence();
+        ABI_PopCallerSaveRegistersAndAdjustStack(code);
+        code->ret();
+        return entrypoint;
+    };
+
+    atomic_memory_8 = gen_fallback_accessor(&AtomicMemoryFallback<u8>);
+    atomic_memory_16 = gen_fallback_accessor(&AtomicMemoryFallback<u16>);
+    atomic_memory_32 = gen_fallback_accessor(&AtomicMemoryFallback<u32>);
+    atomic_memory_64 = gen_fallback_accessor(&AtomicMemoryFallback<u64>);
+    compare_and_swap_memory_8 = gen_fallback_accessor(&CompareAndSwapMemoryFallback<u8>);
+    compare_and_swap_memory_16 = gen_fallback_accessor(&CompareAndSwapMemoryFallback<u16>);
+    compare_and_swap_memory_32 = gen_fallback_accessor(&CompareAndSwapMemoryFallback<u32>);
+    compare_and_swap_memory_64 = gen_fallback_accessor(&CompareAndSwapMemoryFallback<u64>);
+
+    // The address is passed in rsi, the expected value in xmm1 and the desired value in xmm2, leaving the registers
+    // used by cmpxchg16b free. The value previously in memory is returned in xmm1.
+    code->align();
+    compare_and_swap_memory_128 = code->getCurr<const void*>();
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::XMM1, 32);
+    code->mfence();
+    code->movaps(code->xword[rsp + ABI_SHADOW_SPACE], xmm1);
+    code->movaps(code->xword[rsp + ABI_SHADOW_SPACE + 16], xmm2);
+    code->mov(code->ABI_PARAM2, rsi);
+    code->mov(code->ABI_PARAM1, qword[r15 + offsetof(A64JitState, callbacks)]);
+    code->lea(code->ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
+    code->lea(code->ABI_PARAM4, ptr[rsp + ABI_SHADOW_SPACE + 16]);
+    code->CallFunction(&CompareAndSwapMemory128Fallback);
+    code->movaps(xmm1, code->xword[rsp + ABI_SHADOW_SPACE]);
+    code->mfence();
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::XMM1, 32);
+    code->ret();
+}
+
+void A64EmitX64::GenInterpretSingleInstruction() {
+    code->align();
+    interpret_single_instruction = code->getCurr<const void*>();
+    code->SwitchMxcsrOnExit();
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::InterpreterFallback).EmitCall(code, [&](Xbyak::Reg64 param1, Xbyak::Reg64 param2) {
+        code->mov(param1, qword[r15 + offsetof(A64JitState, pc)]);
+        code->mov(param2.cvt32(), 1);
+    });
+    code->sub(qword[r15 + offsetof(A64JitState, cycles_remaining)], 1);
+    code->ReturnFromRunCode(true);
+}
+
 void A64EmitX64::EmitA64SetCheckBit(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     Xbyak::Reg8 to_store = ctx.reg_alloc.UseGpr(args[0]).cvt8();
@@ -165,6 +417,15 @@ void A64EmitX64::EmitA64GetX(A64EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void A64EmitX64::EmitA64GetS(A64EmitContext& ctx, IR::Inst* inst) {
+    A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    auto addr = dword[r15 + offsetof(A64JitState, vec) + sizeof(u64) * 2 * static_cast<size_t>(vec)];
+
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    code->movd(result, addr);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void A64EmitX64::EmitA64GetD(A64EmitContext& ctx, IR::Inst* inst) {
     A64::Vec vec = inst->GetArg(0).GetA64VecRef();
     auto addr = qword[r15 + offsetof(A64JitState, vec) + sizeof(u64) * 2 * static_cast<size_t>(vec)];
@@ -218,6 +479,19 @@ void A64EmitX64::EmitA64SetX(A64EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
+void A64EmitX64::EmitA64SetS(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    A64::Vec vec = inst->GetArg(0).GetA64VecRef();
+    auto addr = code->xword[r15 + offsetof(A64JitState, vec) + sizeof(u64) * 2 * static_cast<size_t>(vec)];
+
+    Xbyak::Xmm to_store = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+    // Writes to an S register zero the remainder of the vector register.
+    code->xorps(tmp, tmp);
+    code->movss(tmp, to_store);
+    code->movaps(addr, tmp);
+}
+
 void A64EmitX64::EmitA64SetD(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     A64::Vec vec = inst->GetArg(0).GetA64VecRef();
@@ -270,7 +544,7 @@ void A64EmitX64::EmitA64CallSupervisor(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ASSERT(args[0].IsImmediate());
     u32 imm = args[0].GetImmediateU32();
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::CallSVC).EmitCall(code, [&](Xbyak::Reg64 param1) {
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::CallSVC).EmitCall(code, [&](Xbyak::Reg64 param1) {
         code->mov(param1.cvt32(), imm);
     });
 }
@@ -281,79 +555,941 @@ void A64EmitX64::EmitA64ExceptionRaised(A64EmitContext& ctx, IR::Inst* inst) {
     ASSERT(args[0].IsImmediate() && args[1].IsImmediate());
     u64 pc = args[0].GetImmediateU64();
     u64 exception = args[1].GetImmediateU64();
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::ExceptionRaised).EmitCall(code, [&](Xbyak::Reg64 param1, Xbyak::Reg64 param2) {
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::ExceptionRaised).EmitCall(code, [&](Xbyak::Reg64 param1, Xbyak::Reg64 param2) {
         code->mov(param1, pc);
         code->mov(param2, exception);
     });
 }
 
+// Emits code that places the host pointer corresponding to the guest address vaddr in result.
+// Jumps to abort if vaddr is not backed by the page table.
+static void EmitPageTableLookup(BlockOfCode* code, const A64::UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 result, Xbyak::Reg64 page_index, Xbyak::Reg64 page_offset, Xbyak::Label& abort) {
+    constexpr size_t page_bits = A64::UserConfig::PAGE_BITS;
+    constexpr u64 page_mask = (1ull << page_bits) - 1;
+
+    if (conf.page_table_address_space_bits < 64) {
+        code->mov(page_index, vaddr);
+        code->shr(page_index, static_cast<int>(conf.page_table_address_space_bits));
+        code->jnz(abort, code->T_NEAR);
+    }
+    code->mov(result, reinterpret_cast<u64>(conf.page_table));
+    code->mov(page_index, vaddr);
+    code->shr(page_index, static_cast<int>(page_bits));
+    code->mov(result, qword[result + page_index * 8]);
+    code->test(result, result);
+    code->jz(abort, code->T_NEAR);
+    code->mov(page_offset.cvt32(), vaddr.cvt32());
+    code->and_(page_offset.cvt32(), static_cast<u32>(page_mask));
+    code->add(result, page_offset);
+}
+
+// Emits code that places the base of the fastmem region in base.
+// Jumps to abort if vaddr is outside of the fastmem region.
+static void EmitFastmemAddressCheck(BlockOfCode* code, const A64::UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 base, Xbyak::Label& abort) {
+    if (conf.fastmem_address_space_bits < 64) {
+        code->mov(base, vaddr);
+        code->shr(base, static_cast<int>(conf.fastmem_address_space_bits));
+        code->jnz(abort, code->T_NEAR);
+    }
+    code->mov(base, reinterpret_cast<u64>(conf.fastmem_pointer));
+}
+
+void A64EmitX64::ReadMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, JitStateArgCallback raw_fn, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        reg_alloc.UseScratch(args[0], ABI_PARAM2);
+
+        Xbyak::Reg64 result = reg_alloc.ScratchGpr({ABI_RETURN});
+        Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitFastmemAddressCheck(code, conf, vaddr, base, abort);
+        const CodePtr location = code->getCurr();
+        switch (bit_size) {
+        case 8:
+            code->movzx(result.cvt32(), code->byte[base + vaddr]);
+            break;
+        case 16:
+            code->movzx(result.cvt32(), word[base + vaddr]);
+            break;
+        case 32:
+            code->mov(result.cvt32(), dword[base + vaddr]);
+            break;
+        case 64:
+            code->mov(result, qword[base + vaddr]);
+            break;
+        default:
+            ASSERT_MSG(false, "Invalid bit_size");
+            break;
+        }
+        RegisterFastmemAccess(location, wrapped_fn);
+        code->L(end);
+
+        code->SwitchToFarCode();
+        code->L(abort);
+        code->call(wrapped_fn);
+        code->jmp(end, code->T_NEAR);
+        code->SwitchToNearCode();
+
+        reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (!conf.page_table) {
+        raw_fn.EmitCall(code, [&](Xbyak::Reg64 vaddr) {
+            ASSERT(vaddr == code->ABI_PARAM2);
+            reg_alloc.HostCall(inst, {}, args[0]);
+        });
+        return;
+    }
+
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+
+    Xbyak::Reg64 result = reg_alloc.ScratchGpr({ABI_RETURN});
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+    Xbyak::Label abort, end;
+
+    EmitPageTableLookup(code, conf, vaddr, result, page_index, page_offset, abort);
+    switch (bit_size) {
+    case 8:
+        code->movzx(result.cvt32(), code->byte[result]);
+        break;
+    case 16:
+        code->movzx(result.cvt32(), word[result]);
+        break;
+    case 32:
+        code->mov(result.cvt32(), dword[result]);
+        break;
+    case 64:
+        code->mov(result, qword[result]);
+        break;
+    default:
+        ASSERT_MSG(false, "Invalid bit_size");
+        break;
+    }
+    code->jmp(end);
+    code->L(abort);
+    code->call(wrapped_fn);
+    code->L(end);
+
+    reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitX64::WriteMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, JitStateArgCallback raw_fn, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        reg_alloc.ScratchGpr({ABI_RETURN});
+        reg_alloc.UseScratch(args[0], ABI_PARAM2);
+        reg_alloc.UseScratch(args[1], ABI_PARAM3);
+
+        Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+        Xbyak::Reg64 value = code->ABI_PARAM3;
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitFastmemAddressCheck(code, conf, vaddr, base, abort);
+        const CodePtr location = code->getCurr();
+        switch (bit_size) {
+        case 8:
+            code->mov(code->byte[base + vaddr], value.cvt8());
+            break;
+        case 16:
+            code->mov(word[base + vaddr], value.cvt16());
+            break;
+        case 32:
+            code->mov(dword[base + vaddr], value.cvt32());
+            break;
+        case 64:
+            code->mov(qword[base + vaddr], value);
+            break;
+        default:
+            ASSERT_MSG(false, "Invalid bit_size");
+            break;
+        }
+        RegisterFastmemAccess(location, wrapped_fn);
+        code->L(end);
+
+        code->SwitchToFarCode();
+        code->L(abort);
+        code->call(wrapped_fn);
+        code->jmp(end, code->T_NEAR);
+        code->SwitchToNearCode();
+        return;
+    }
+
+    if (!conf.page_table) {
+        raw_fn.EmitCall(code, [&](Xbyak::Reg64 vaddr, Xbyak::Reg64 value) {
+            ASSERT(vaddr == code->ABI_PARAM2 && value == code->ABI_PARAM3);
+            reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+        });
+        return;
+    }
+
+    reg_alloc.ScratchGpr({ABI_RETURN});
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    reg_alloc.UseScratch(args[1], ABI_PARAM3);
+
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+    Xbyak::Reg64 value = code->ABI_PARAM3;
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+    Xbyak::Label abort, end;
+
+    EmitPageTableLookup(code, conf, vaddr, rax, page_index, page_offset, abort);
+    switch (bit_size) {
+    case 8:
+        code->mov(code->byte[rax], value.cvt8());
+        break;
+    case 16:
+        code->mov(word[rax], value.cvt16());
+        break;
+    case 32:
+        code->mov(dword[rax], value.cvt32());
+        break;
+    case 64:
+        code->mov(qword[rax], value);
+        break;
+    default:
+        ASSERT_MSG(false, "Invalid bit_size");
+        break;
+    }
+    code->jmp(end);
+    code->L(abort);
+    code->call(wrapped_fn);
+    code->L(end);
+}
+
 void A64EmitX64::EmitA64ReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryRead8).EmitCall(code, [&](Xbyak::Reg64 vaddr) {
-        ASSERT(vaddr == code->ABI_PARAM2);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    });
+    ReadMemory(ctx, inst, 8, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead8), read_memory_8);
 }
 
 void A64EmitX64::EmitA64ReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryRead16).EmitCall(code, [&](Xbyak::Reg64 vaddr) {
-        ASSERT(vaddr == code->ABI_PARAM2);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    });
+    ReadMemory(ctx, inst, 16, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead16), read_memory_16);
 }
 
 void A64EmitX64::EmitA64ReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryRead32).EmitCall(code, [&](Xbyak::Reg64 vaddr) {
-        ASSERT(vaddr == code->ABI_PARAM2);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    });
+    ReadMemory(ctx, inst, 32, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead32), read_memory_32);
 }
 
 void A64EmitX64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryRead64).EmitCall(code, [&](Xbyak::Reg64 vaddr) {
-        ASSERT(vaddr == code->ABI_PARAM2);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    });
+    ReadMemory(ctx, inst, 64, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryRead64), read_memory_64);
+}
+
+void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.ScratchGpr({ABI_RETURN});
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+
+    Xbyak::Xmm result = reg_alloc.ScratchXmm({HostLoc::XMM1});
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitFastmemAddressCheck(code, conf, vaddr, base, abort);
+        const CodePtr location = code->getCurr();
+        code->movups(result, code->xword[base + vaddr]);
+        RegisterFastmemAccess(location, read_memory_128);
+        code->L(end);
+
+        code->SwitchToFarCode();
+        code->L(abort);
+        code->call(read_memory_128);
+        code->jmp(end, code->T_NEAR);
+        code->SwitchToNearCode();
+
+        reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (!conf.page_table) {
+        code->call(read_memory_128);
+
+        reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+    Xbyak::Label abort, end;
+
+    EmitPageTableLookup(code, conf, vaddr, host_addr, page_index, page_offset, abort);
+    code->movups(result, code->xword[host_addr]);
+    code->jmp(end);
+    code->L(abort);
+    code->call(read_memory_128);
+    code->L(end);
+
+    reg_alloc.DefineValue(inst, result);
 }
 
 void A64EmitX64::EmitA64WriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryWrite8).EmitCall(code, [&](Xbyak::Reg64 vaddr, Xbyak::Reg64 value) {
-        ASSERT(vaddr == code->ABI_PARAM2 && value == code->ABI_PARAM3);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
-    });
+    WriteMemory(ctx, inst, 8, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite8), write_memory_8);
 }
 
 void A64EmitX64::EmitA64WriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryWrite16).EmitCall(code, [&](Xbyak::Reg64 vaddr, Xbyak::Reg64 value) {
-        ASSERT(vaddr == code->ABI_PARAM2 && value == code->ABI_PARAM3);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
-    });
+    WriteMemory(ctx, inst, 16, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite16), write_memory_16);
 }
 
 void A64EmitX64::EmitA64WriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryWrite32).EmitCall(code, [&](Xbyak::Reg64 vaddr, Xbyak::Reg64 value) {
-        ASSERT(vaddr == code->ABI_PARAM2 && value == code->ABI_PARAM3);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
-    });
+    WriteMemory(ctx, inst, 32, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite32), write_memory_32);
 }
 
 void A64EmitX64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::MemoryWrite64).EmitCall(code, [&](Xbyak::Reg64 vaddr, Xbyak::Reg64 value) {
-        ASSERT(vaddr == code->ABI_PARAM2 && value == code->ABI_PARAM3);
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+    WriteMemory(ctx, inst, 64, DEVIRT_CALLBACKS(&A64::UserCallbacks::MemoryWrite64), write_memory_64);
+}
+
+void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.ScratchGpr({ABI_RETURN});
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    reg_alloc.Use(args[1], HostLoc::XMM1);
+
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+    Xbyak::Xmm value = xmm1;
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitFastmemAddressCheck(code, conf, vaddr, base, abort);
+        const CodePtr location = code->getCurr();
+        code->movups(code->xword[base + vaddr], value);
+        RegisterFastmemAccess(location, write_memory_128);
+        code->L(end);
+
+        code->SwitchToFarCode();
+        code->L(abort);
+        code->call(write_memory_128);
+        code->jmp(end, code->T_NEAR);
+        code->SwitchToNearCode();
+        return;
+    }
+
+    if (!conf.page_table) {
+        code->call(write_memory_128);
+        return;
+    }
+
+    Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+    Xbyak::Label abort, end;
+
+    EmitPageTableLookup(code, conf, vaddr, host_addr, page_index, page_offset, abort);
+    code->movups(code->xword[host_addr], value);
+    code->jmp(end);
+    code->L(abort);
+    code->call(write_memory_128);
+    code->L(end);
+}
+
+void A64EmitX64::EmitA64ClearExclusive(A64EmitContext&, IR::Inst*) {
+    code->mov(code->byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
+}
+
+void A64EmitX64::EmitA64DataMemoryBarrier(A64EmitContext&, IR::Inst*) {
+    code->mfence();
+}
+
+void A64EmitX64::ExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+
+    Xbyak::Reg64 result = reg_alloc.ScratchGpr({ABI_RETURN});
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+
+    code->mov(code->byte[r15 + offsetof(A64JitState, exclusive_state)], u8(1));
+    code->mov(qword[r15 + offsetof(A64JitState, exclusive_address)], vaddr);
+
+    const auto emit_load = [&](Xbyak::RegExp address) {
+        switch (bit_size) {
+        case 8:
+            code->movzx(result.cvt32(), code->byte[address]);
+            break;
+        case 16:
+            code->movzx(result.cvt32(), word[address]);
+            break;
+        case 32:
+            code->mov(result.cvt32(), dword[address]);
+            break;
+        case 64:
+            code->mov(result, qword[address]);
+            break;
+        default:
+            ASSERT_MSG(false, "Invalid bit_size");
+            break;
+        }
+    };
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitFastmemAddressCheck(code, conf, vaddr, base, abort);
+        const CodePtr location = code->getCurr();
+        emit_load(base + vaddr);
+        RegisterFastmemAccess(location, wrapped_fn);
+        code->L(end);
+
+        code->SwitchToFarCode();
+        code->L(abort);
+        code->call(wrapped_fn);
+        code->jmp(end, code->T_NEAR);
+        code->SwitchToNearCode();
+    } else if (conf.page_table) {
+        Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+        Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitPageTableLookup(code, conf, vaddr, result, page_index, page_offset, abort);
+        emit_load(result);
+        code->jmp(end);
+        code->L(abort);
+        code->call(wrapped_fn);
+        code->L(end);
+    } else {
+        code->call(wrapped_fn);
+    }
+
+    // Only the lowest bit_size bits of this are significant to the cmpxchg in ExclusiveWriteMemory.
+    code->mov(qword[r15 + offsetof(A64JitState, exclusive_value)], result);
+
+    reg_alloc.DefineValue(inst, result);
+}
+
+static Xbyak::Reg SizedReg(Xbyak::Reg64 reg, size_t bit_size) {
+    switch (bit_size) {
+    case 8:
+        return reg.cvt8();
+    case 16:
+        return reg.cvt16();
+    case 32:
+        return reg.cvt32();
+    case 64:
+        return reg;
+    default:
+        ASSERT_MSG(false, "Invalid bit_size");
+        return reg;
+    }
+}
+
+static Xbyak::Address SizedPtr(BlockOfCode* code, Xbyak::Reg64 ptr, size_t bit_size) {
+    switch (bit_size) {
+    case 8:
+        return code->byte[ptr];
+    case 16:
+        return word[ptr];
+    case 32:
+        return dword[ptr];
+    case 64:
+        return qword[ptr];
+    default:
+        ASSERT_MSG(false, "Invalid bit_size");
+        return qword[ptr];
+    }
+}
+
+// Places the zero-extended value of reg in reg.
+static void ZeroExtendSized(BlockOfCode* code, Xbyak::Reg64 reg, size_t bit_size) {
+    if (bit_size < 32) {
+        code->movzx(reg.cvt32(), SizedReg(reg, bit_size));
+    }
+}
+
+// Places the lower and upper halves of source in lo and hi.
+static void SplitVector(BlockOfCode* code, Xbyak::Xmm source, Xbyak::Reg64 lo, Xbyak::Reg64 hi, Xbyak::Xmm tmp) {
+    code->movq(lo, source);
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pextrq(hi, source, 1);
+    } else {
+        code->movhlps(tmp, source);
+        code->movq(hi, tmp);
+    }
+}
+
+// Places lo and hi in the lower and upper halves of dest.
+static void JoinVector(BlockOfCode* code, Xbyak::Xmm dest, Xbyak::Reg64 lo, Xbyak::Reg64 hi, Xbyak::Xmm tmp) {
+    code->movq(dest, lo);
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pinsrq(dest, hi, 1);
+    } else {
+        code->movq(tmp, hi);
+        code->punpcklqdq(dest, tmp);
+    }
+}
+
+void A64EmitX64::LockedAccess(size_t bit_size, Xbyak::Reg64 vaddr, Xbyak::Reg64 host_addr, Xbyak::Reg64 page_index, Xbyak::Reg64 page_offset, CodePtr wrapped_fn, const LockedAccessFn& emit_access) {
+    std::vector<CodePtr> access_locations;
+    Xbyak::Label abort, end;
+
+    // Unaligned accesses may span pages, and cmpxchg16b faults on them.
+    const auto emit_alignment_check = [&] {
+        if (bit_size > 8) {
+            code->test(vaddr, static_cast<u32>(bit_size / 8 - 1));
+            code->jnz(abort, code->T_NEAR);
+        }
+    };
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        emit_alignment_check();
+        EmitFastmemAddressCheck(code, conf, vaddr, host_addr, abort);
+        code->add(host_addr, vaddr);
+        emit_access(host_addr, access_locations);
+        for (CodePtr location : access_locations) {
+            RegisterFastmemAccess(location, wrapped_fn);
+        }
+        code->L(end);
+
+        code->SwitchToFarCode();
+        code->L(abort);
+        code->call(wrapped_fn);
+        code->jmp(end, code->T_NEAR);
+        code->SwitchToNearCode();
+        return;
+    }
+
+    if (!conf.page_table) {
+        code->call(wrapped_fn);
+        return;
+    }
+
+    emit_alignment_check();
+    EmitPageTableLookup(code, conf, vaddr, host_addr, page_index, page_offset, abort);
+    emit_access(host_addr, access_locations);
+    code->jmp(end, code->T_NEAR);
+    code->L(abort);
+    code->call(wrapped_fn);
+    code->L(end);
+}
+
+// Returns 0 in the result if the store was performed, and 1 otherwise.
+// The store is a compare-and-swap against the value observed by the preceding exclusive load, so that
+// intervening writes by other agents cause the store to fail.
+void A64EmitX64::ExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    reg_alloc.ScratchGpr({ABI_PARAM3});
+    reg_alloc.UseScratch(args[1], ABI_PARAM4);
+
+    Xbyak::Reg64 old_value = reg_alloc.ScratchGpr({ABI_RETURN});
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+    Xbyak::Reg64 expected = code->ABI_PARAM3;
+    Xbyak::Reg64 value = code->ABI_PARAM4;
+    Xbyak::Reg32 passed = reg_alloc.ScratchGpr().cvt32();
+    Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+    Xbyak::Label end;
+
+    code->mov(passed, u32(1));
+    code->cmp(code->byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
+    code->je(end, code->T_NEAR);
+    code->mov(host_addr, vaddr);
+    code->xor_(host_addr, qword[r15 + offsetof(A64JitState, exclusive_address)]);
+    code->test(host_addr, static_cast<u32>(A64JitState::RESERVATION_GRANULE_MASK));
+    code->jne(end, code->T_NEAR);
+    code->mov(code->byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
+
+    code->mov(expected, qword[r15 + offsetof(A64JitState, exclusive_value)]);
+    code->mov(old_value, expected);
+    LockedAccess(bit_size, vaddr, host_addr, page_index, page_offset, wrapped_fn, [&](Xbyak::Reg64 ptr, std::vector<CodePtr>& access_locations) {
+        access_locations.push_back(code->getCurr());
+        code->lock();
+        code->cmpxchg(SizedPtr(code, ptr, bit_size), SizedReg(value, bit_size));
+    });
+    code->cmp(SizedReg(old_value, bit_size), SizedReg(expected, bit_size));
+    code->setne(passed.cvt8());
+    code->L(end);
+
+    reg_alloc.DefineValue(inst, passed);
+}
+
+void A64EmitX64::EmitA64ExclusiveReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory(ctx, inst, 8, read_memory_8);
+}
+
+void A64EmitX64::EmitA64ExclusiveReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory(ctx, inst, 16, read_memory_16);
+}
+
+void A64EmitX64::EmitA64ExclusiveReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory(ctx, inst, 32, read_memory_32);
+}
+
+void A64EmitX64::EmitA64ExclusiveReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveReadMemory(ctx, inst, 64, read_memory_64);
+}
+
+// The load need not be atomic, as the exclusive store only succeeds if memory still holds the value loaded.
+void A64EmitX64::EmitA64ExclusiveReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.ScratchGpr({ABI_RETURN});
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+
+    Xbyak::Xmm result = reg_alloc.ScratchXmm({HostLoc::XMM1});
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+
+    code->mov(code->byte[r15 + offsetof(A64JitState, exclusive_state)], u8(1));
+    code->mov(qword[r15 + offsetof(A64JitState, exclusive_address)], vaddr);
+
+    if (conf.fastmem_pointer && code->SupportsFastmem()) {
+        Xbyak::Reg64 base = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitFastmemAddressCheck(code, conf, vaddr, base, abort);
+        const CodePtr location = code->getCurr();
+        code->movups(result, code->xword[base + vaddr]);
+        RegisterFastmemAccess(location, read_memory_128);
+        code->L(end);
+
+        code->SwitchToFarCode();
+        code->L(abort);
+        code->call(read_memory_128);
+        code->jmp(end, code->T_NEAR);
+        code->SwitchToNearCode();
+    } else if (conf.page_table) {
+        Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+        Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+        Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+        Xbyak::Label abort, end;
+
+        EmitPageTableLookup(code, conf, vaddr, host_addr, page_index, page_offset, abort);
+        code->movups(result, code->xword[host_addr]);
+        code->jmp(end);
+        code->L(abort);
+        code->call(read_memory_128);
+        code->L(end);
+    } else {
+        code->call(read_memory_128);
+    }
+
+    code->movups(code->xword[r15 + offsetof(A64JitState, exclusive_value)], result);
+
+    reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitX64::EmitA64ExclusiveWriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveWriteMemory(ctx, inst, 8, compare_and_swap_memory_8);
+}
+
+void A64EmitX64::EmitA64ExclusiveWriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveWriteMemory(ctx, inst, 16, compare_and_swap_memory_16);
+}
+
+void A64EmitX64::EmitA64ExclusiveWriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveWriteMemory(ctx, inst, 32, compare_and_swap_memory_32);
+}
+
+void A64EmitX64::EmitA64ExclusiveWriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    ExclusiveWriteMemory(ctx, inst, 64, compare_and_swap_memory_64);
+}
+
+void A64EmitX64::EmitA64ExclusiveWriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.UseScratch(args[0], HostLoc::RSI);
+    reg_alloc.Use(args[1], HostLoc::XMM2);
+
+    Xbyak::Reg64 vaddr = rsi;
+    Xbyak::Xmm old_value = reg_alloc.ScratchXmm({HostLoc::XMM1});
+    Xbyak::Xmm value = xmm2;
+    Xbyak::Reg32 passed = reg_alloc.ScratchGpr().cvt32();
+    Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+    Xbyak::Xmm tmp = reg_alloc.ScratchXmm();
+    reg_alloc.ScratchGpr({HostLoc::RAX});
+    reg_alloc.ScratchGpr({HostLoc::RBX});
+    reg_alloc.ScratchGpr({HostLoc::RCX});
+    reg_alloc.ScratchGpr({HostLoc::RDX});
+
+    Xbyak::Label end;
+
+    code->mov(passed, u32(1));
+    code->cmp(code->byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
+    code->je(end, code->T_NEAR);
+    code->mov(host_addr, vaddr);
+    code->xor_(host_addr, qword[r15 + offsetof(A64JitState, exclusive_address)]);
+    code->test(host_addr, static_cast<u32>(A64JitState::RESERVATION_GRANULE_MASK));
+    code->jne(end, code->T_NEAR);
+    code->mov(code->byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
+
+    code->movups(old_value, code->xword[r15 + offsetof(A64JitState, exclusive_value)]);
+    if (code->DoesCpuSupportCmpxchg16b()) {
+        SplitVector(code, old_value, rax, rdx, tmp);
+        SplitVector(code, value, rbx, rcx, tmp);
+        LockedAccess(128, vaddr, host_addr, page_index, page_offset, compare_and_swap_memory_128, [&](Xbyak::Reg64 ptr, std::vector<CodePtr>& access_locations) {
+            access_locations.push_back(code->getCurr());
+            code->lock();
+            code->cmpxchg16b(code->xword[ptr]);
+            JoinVector(code, old_value, rax, rdx, tmp);
+        });
+    } else {
+        code->call(compare_and_swap_memory_128);
+    }
+
+    code->movups(tmp, code->xword[r15 + offsetof(A64JitState, exclusive_value)]);
+    code->pcmpeqd(tmp, old_value);
+    code->pmovmskb(page_index.cvt32(), tmp);
+    code->cmp(page_index.cvt32(), u32(0xFFFF));
+    code->setne(passed.cvt8());
+    code->L(end);
+
+    reg_alloc.DefineValue(inst, passed);
+}
+
+void A64EmitX64::AtomicMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[2].IsImmediate());
+    const auto op = static_cast<A64::AtomicOp>(args[2].GetImmediateU8());
+
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    reg_alloc.UseScratch(args[1], ABI_PARAM3);
+    reg_alloc.ScratchGpr({ABI_PARAM4});
+
+    Xbyak::Reg64 result = reg_alloc.ScratchGpr({ABI_RETURN});
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+    Xbyak::Reg64 value = code->ABI_PARAM3;
+    Xbyak::Reg64 new_value = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+    // A faulting access is completed by the fallback, so its arguments must remain intact throughout.
+    code->mov(code->ABI_PARAM4.cvt32(), static_cast<u32>(op));
+
+    LockedAccess(bit_size, vaddr, host_addr, page_index, page_offset, wrapped_fn, [&](Xbyak::Reg64 ptr, std::vector<CodePtr>& access_locations) {
+        switch (op) {
+        case A64::AtomicOp::Add:
+            code->mov(result, value);
+            access_locations.push_back(code->getCurr());
+            code->lock();
+            code->xadd(SizedPtr(code, ptr, bit_size), SizedReg(result, bit_size));
+            ZeroExtendSized(code, result, bit_size);
+            break;
+        case A64::AtomicOp::Swap:
+            code->mov(result, value);
+            access_locations.push_back(code->getCurr());
+            code->xchg(SizedPtr(code, ptr, bit_size), SizedReg(result, bit_size));
+            ZeroExtendSized(code, result, bit_size);
+            break;
+        default: {
+            // Everything else is a compare-and-swap loop.
+            const bool is_signed = op == A64::AtomicOp::SMax || op == A64::AtomicOp::SMin;
+            const size_t op_size = std::max<size_t>(bit_size, 32);
+
+            const auto extend = [&](Xbyak::Reg64 reg) {
+                if (bit_size >= 32) {
+                    return;
+                }
+                if (is_signed) {
+                    code->movsx(reg.cvt32(), SizedReg(reg, bit_size));
+                } else {
+                    code->movzx(reg.cvt32(), SizedReg(reg, bit_size));
+                }
+            };
+
+            extend(value);
+
+            code->xor_(result.cvt32(), result.cvt32());
+            access_locations.push_back(code->getCurr());
+            code->mov(SizedReg(result, bit_size), SizedPtr(code, ptr, bit_size));
+
+            Xbyak::Label loop;
+            code->L(loop);
+            switch (op) {
+            case A64::AtomicOp::Clear:
+                code->mov(new_value, value);
+                code->not_(new_value);
+                code->and_(new_value, result);
+                break;
+            case A64::AtomicOp::Eor:
+                code->mov(new_value, result);
+                code->xor_(new_value, value);
+                break;
+            case A64::AtomicOp::Set:
+                code->mov(new_value, result);
+                code->or_(new_value, value);
+                break;
+            case A64::AtomicOp::SMax:
+            case A64::AtomicOp::SMin:
+            case A64::AtomicOp::UMax:
+            case A64::AtomicOp::UMin: {
+                code->mov(new_value, result);
+                extend(new_value);
+                const Xbyak::Reg new_value_sized = SizedReg(new_value, op_size);
+                const Xbyak::Reg value_sized = SizedReg(value, op_size);
+                code->cmp(new_value_sized, value_sized);
+                switch (op) {
+                case A64::AtomicOp::SMax:
+                    code->cmovl(new_value_sized, value_sized);
+                    break;
+                case A64::AtomicOp::SMin:
+                    code->cmovg(new_value_sized, value_sized);
+                    break;
+                case A64::AtomicOp::UMax:
+                    code->cmovb(new_value_sized, value_sized);
+                    break;
+                default:
+                    code->cmova(new_value_sized, value_sized);
+                    break;
+                }
+                break;
+            }
+            default:
+                UNREACHABLE();
+            }
+            // The store may fault even though the load did not, e.g. on a read-only page.
+            access_locations.push_back(code->getCurr());
+            code->lock();
+            code->cmpxchg(SizedPtr(code, ptr, bit_size), SizedReg(new_value, bit_size));
+            code->jnz(loop);
+            break;
+        }
+        }
+    });
+
+    reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitX64::CompareAndSwapMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.UseScratch(args[0], ABI_PARAM2);
+    reg_alloc.UseScratch(args[1], ABI_PARAM3);
+    reg_alloc.UseScratch(args[2], ABI_PARAM4);
+
+    Xbyak::Reg64 result = reg_alloc.ScratchGpr({ABI_RETURN});
+    Xbyak::Reg64 vaddr = code->ABI_PARAM2;
+    Xbyak::Reg64 expected = code->ABI_PARAM3;
+    Xbyak::Reg64 desired = code->ABI_PARAM4;
+    Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+
+    code->mov(result, expected);
+    LockedAccess(bit_size, vaddr, host_addr, page_index, page_offset, wrapped_fn, [&](Xbyak::Reg64 ptr, std::vector<CodePtr>& access_locations) {
+        access_locations.push_back(code->getCurr());
+        code->lock();
+        code->cmpxchg(SizedPtr(code, ptr, bit_size), SizedReg(desired, bit_size));
     });
+    ZeroExtendSized(code, result, bit_size);
+
+    reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitX64::EmitA64AtomicMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    AtomicMemory(ctx, inst, 8, atomic_memory_8);
+}
+
+void A64EmitX64::EmitA64AtomicMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    AtomicMemory(ctx, inst, 16, atomic_memory_16);
+}
+
+void A64EmitX64::EmitA64AtomicMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    AtomicMemory(ctx, inst, 32, atomic_memory_32);
+}
+
+void A64EmitX64::EmitA64AtomicMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    AtomicMemory(ctx, inst, 64, atomic_memory_64);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    CompareAndSwapMemory(ctx, inst, 8, compare_and_swap_memory_8);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    CompareAndSwapMemory(ctx, inst, 16, compare_and_swap_memory_16);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    CompareAndSwapMemory(ctx, inst, 32, compare_and_swap_memory_32);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    CompareAndSwapMemory(ctx, inst, 64, compare_and_swap_memory_64);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    RegAlloc& reg_alloc = ctx.reg_alloc;
+    auto args = reg_alloc.GetArgumentInfo(inst);
+
+    reg_alloc.UseScratch(args[0], HostLoc::RSI);
+    reg_alloc.UseScratch(args[1], HostLoc::XMM1);
+    reg_alloc.Use(args[2], HostLoc::XMM2);
+
+    Xbyak::Reg64 vaddr = rsi;
+    Xbyak::Xmm result = xmm1;
+    Xbyak::Xmm desired = xmm2;
+
+    if (!code->DoesCpuSupportCmpxchg16b()) {
+        // Without cmpxchg16b the access cannot be atomic, so it is always performed via the memory callbacks.
+        reg_alloc.ScratchGpr({ABI_RETURN});
+        code->call(compare_and_swap_memory_128);
+        reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    Xbyak::Reg64 host_addr = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_index = reg_alloc.ScratchGpr();
+    Xbyak::Reg64 page_offset = reg_alloc.ScratchGpr();
+    Xbyak::Xmm tmp = reg_alloc.ScratchXmm();
+    reg_alloc.ScratchGpr({HostLoc::RAX});
+    reg_alloc.ScratchGpr({HostLoc::RBX});
+    reg_alloc.ScratchGpr({HostLoc::RCX});
+    reg_alloc.ScratchGpr({HostLoc::RDX});
+
+    SplitVector(code, result, rax, rdx, tmp);
+    SplitVector(code, desired, rbx, rcx, tmp);
+    LockedAccess(128, vaddr, host_addr, page_index, page_offset, compare_and_swap_memory_128, [&](Xbyak::Reg64 ptr, std::vector<CodePtr>& access_locations) {
+        access_locations.push_back(code->getCurr());
+        code->lock();
+        code->cmpxchg16b(code->xword[ptr]);
+        JoinVector(code, result, rax, rdx, tmp);
+    });
+
+    reg_alloc.DefineValue(inst, result);
 }
 
 void A64EmitX64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor) {
     code->SwitchMxcsrOnExit();
-    DEVIRT(conf.callbacks, &A64::UserCallbacks::InterpreterFallback).EmitCall(code, [&](Xbyak::Reg64 param1, Xbyak::Reg64 param2) {
+    DEVIRT_CALLBACKS(&A64::UserCallbacks::InterpreterFallback).EmitCall(code, [&](Xbyak::Reg64 param1, Xbyak::Reg64 param2) {
         code->mov(param1, A64::LocationDescriptor{terminal.next}.PC());
         code->mov(qword[r15 + offsetof(A64JitState, pc)], param1);
         code->mov(param2.cvt32(), terminal.num_instructions);
@@ -417,13 +1553,51 @@ void A64EmitX64::EmitTerminalImpl(IR::Term::CheckBit terminal, IR::LocationDescr
 }
 
 void A64EmitX64::EmitTerminalImpl(IR::Term::CheckHalt terminal, IR::LocationDescriptor initial_location) {
-    code->cmp(code->byte[r15 + offsetof(A64JitState, halt_requested)], u8(0));
+    code->cmp(code->dword[r15 + offsetof(A64JitState, halt_requested)], 0);
     code->jne(code->GetForceReturnFromRunCodeAddress());
     EmitTerminal(terminal.else_, initial_location);
 }
 
+// When code may be executed concurrently with emission, patch locations jump indirectly through an aligned slot
+// holding the target. Every other byte of a patch location depends only on its address, so repatching rewrites
+// them with their existing values and changes the slot with a single store. Other threads executing the location
+// therefore observe either the old or the new target.
+constexpr size_t INDIRECT_PATCH_SIZE = 56;
+
+/// Returns the address of the first slot at or after ptr.
+static const u8* AlignTargetSlot(const u8* ptr) {
+    constexpr u64 mask = sizeof(u64) - 1;
+    return reinterpret_cast<const u8*>((reinterpret_cast<u64>(ptr) + mask) & ~mask);
+}
+
+void A64EmitX64::EmitTargetSlot(CodePtr target_code_ptr) {
+    const u8* const slot = AlignTargetSlot(code->getCurr<const u8*>());
+    code->nop(static_cast<size_t>(slot - code->getCurr<const u8*>()));
+    *reinterpret_cast<volatile u64*>(const_cast<u8*>(slot)) = reinterpret_cast<u64>(target_code_ptr);
+    code->SetCodePtr(slot + sizeof(u64));
+}
+
+void A64EmitX64::EmitIndirectPatchJmp(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr) {
+    constexpr size_t jmp_size = 6;
+    const u8* const jmp_end = code->getCurr<const u8*>() + jmp_size;
+    const u8* const slot = AlignTargetSlot(jmp_end);
+    code->jmp(qword[rip + static_cast<int>(slot - jmp_end)]);
+
+    // The unlinked target immediately follows the slot.
+    EmitTargetSlot(target_code_ptr ? target_code_ptr : slot + sizeof(u64));
+    code->mov(rax, A64::LocationDescriptor{target_desc}.PC());
+    code->mov(qword[r15 + offsetof(A64JitState, pc)], rax);
+    code->jmp(code->GetReturnFromRunCodeAddress(), code->T_NEAR);
+}
+
 void A64EmitX64::EmitPatchJg(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr) {
     const CodePtr patch_location = code->getCurr();
+    if (emission_mutex) {
+        code->jng(static_cast<const u8*>(patch_location) + INDIRECT_PATCH_SIZE);
+        EmitIndirectPatchJmp(target_desc, target_code_ptr);
+        code->EnsurePatchLocationSize(patch_location, INDIRECT_PATCH_SIZE);
+        return;
+    }
     if (target_code_ptr) {
         code->jg(target_code_ptr);
     } else {
@@ -436,6 +1610,11 @@ void A64EmitX64::EmitPatchJg(const IR::LocationDescriptor& target_desc, CodePtr
 
 void A64EmitX64::EmitPatchJmp(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr) {
     const CodePtr patch_location = code->getCurr();
+    if (emission_mutex) {
+        EmitIndirectPatchJmp(target_desc, target_code_ptr);
+        code->EnsurePatchLocationSize(patch_location, INDIRECT_PATCH_SIZE);
+        return;
+    }
     if (target_code_ptr) {
         code->jmp(target_code_ptr);
     } else {
@@ -451,6 +1630,17 @@ void A64EmitX64::EmitPatchMovRcx(CodePtr target_code_ptr) {
         target_code_ptr = code->GetReturnFromRunCodeAddress();
     }
     const CodePtr patch_location = code->getCurr();
+    if (emission_mutex) {
+        constexpr size_t mov_size = 7;
+        constexpr size_t jmp_size = 5;
+        const u8* const mov_end = static_cast<const u8*>(patch_location) + mov_size;
+        const u8* const slot = AlignTargetSlot(mov_end + jmp_size);
+        code->mov(code->rcx, qword[rip + static_cast<int>(slot - mov_end)]);
+        code->jmp(static_cast<const u8*>(patch_location) + INDIRECT_PATCH_SIZE, code->T_NEAR);
+        EmitTargetSlot(target_code_ptr);
+        code->EnsurePatchLocationSize(patch_location, INDIRECT_PATCH_SIZE);
+        return;
+    }
     code->mov(code->rcx, reinterpret_cast<u64>(target_code_ptr));
     code->EnsurePatchLocationSize(patch_location, 10);
 }
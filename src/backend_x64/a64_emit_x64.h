@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include "backend_x64/a64_jitstate.h"
 #include "backend_x64/block_range_information.h"
 #include "backend_x64/emit_x64.h"
@@ -41,10 +44,56 @@ public:
 
     void InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges);
 
+    /// Invalidates all basic blocks emitted within region, including their guest address ranges.
+    void InvalidateCodeRegion(const CodeRegion& region);
+
+    /// Entrypoint which executes the instruction at the current PC via InterpreterFallback then returns to the dispatcher.
+    CodePtr GetInterpretSingleInstructionEntrypoint() const { return interpret_single_instruction; }
+
 protected:
     const A64::UserConfig conf;
     BlockRangeInformation<u64> block_ranges;
 
+    const void* read_memory_8;
+    const void* read_memory_16;
+    const void* read_memory_32;
+    const void* read_memory_64;
+    const void* read_memory_128;
+    const void* write_memory_8;
+    const void* write_memory_16;
+    const void* write_memory_32;
+    const void* write_memory_64;
+    const void* write_memory_128;
+    const void* atomic_memory_8;
+    const void* atomic_memory_16;
+    const void* atomic_memory_32;
+    const void* atomic_memory_64;
+    const void* compare_and_swap_memory_8;
+    const void* compare_and_swap_memory_16;
+    const void* compare_and_swap_memory_32;
+    const void* compare_and_swap_memory_64;
+    const void* compare_and_swap_memory_128;
+    void GenMemoryAccessors();
+
+    const void* interpret_single_instruction;
+    void GenInterpretSingleInstruction();
+
+    void ReadMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, JitStateArgCallback raw_fn, CodePtr wrapped_fn);
+    void WriteMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, JitStateArgCallback raw_fn, CodePtr wrapped_fn);
+    void ExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn);
+    void ExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn);
+    void AtomicMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn);
+    void CompareAndSwapMemory(A64EmitContext& ctx, IR::Inst* inst, size_t bit_size, CodePtr wrapped_fn);
+
+    /**
+     * Emits the locked access emitted by emit_access on the host memory backing vaddr, or a call to wrapped_fn if
+     * vaddr is not backed by host memory or is not aligned to bit_size. emit_access records the location of each instruction which accesses memory,
+     * so that if one of them faults wrapped_fn is called in its place. wrapped_fn must therefore be able to perform the
+     * whole access using the registers as they are at any of those locations.
+     */
+    using LockedAccessFn = std::function<void(Xbyak::Reg64 host_addr, std::vector<CodePtr>& access_locations)>;
+    void LockedAccess(size_t bit_size, Xbyak::Reg64 vaddr, Xbyak::Reg64 host_addr, Xbyak::Reg64 page_index, Xbyak::Reg64 page_offset, CodePtr wrapped_fn, const LockedAccessFn& emit_access);
+
     // Microinstruction emitters
 #define OPCODE(...)
 #define A32OPC(...)
@@ -68,6 +117,8 @@ protected:
     void EmitPatchJg(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr = nullptr) override;
     void EmitPatchJmp(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr = nullptr) override;
     void EmitPatchMovRcx(CodePtr target_code_ptr = nullptr) override;
+    void EmitIndirectPatchJmp(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr);
+    void EmitTargetSlot(CodePtr target_code_ptr);
 };
 
 } // namespace BackendX64
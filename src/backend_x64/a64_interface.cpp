@@ -4,17 +4,27 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <boost/icl/interval_set.hpp>
+#include <boost/optional.hpp>
 
 #include "backend_x64/a64_emit_x64.h"
 #include "backend_x64/a64_jitstate.h"
 #include "backend_x64/block_of_code.h"
 #include "backend_x64/devirtualize.h"
+#include "backend_x64/dispatch_table.h"
 #include "backend_x64/jitstate_info.h"
+#include "backend_x64/translation_cache.h"
 #include "common/assert.h"
+#include "common/atomic.h"
 #include "common/scope_exit.h"
 #include "dynarmic/A64/a64.h"
 #include "frontend/A64/translate/translate.h"
@@ -26,55 +36,430 @@ namespace A64 {
 
 using namespace BackendX64;
 
-static RunCodeCallbacks GenRunCodeCallbacks(A64::UserCallbacks* cb, CodePtr (*LookupBlock)(void* lookup_block_arg), void* arg) {
+static RunCodeCallbacks GenRunCodeCallbacks(CodePtr (*LookupBlock)(void* lookup_block_arg, A64JitState* jit_state), void* arg) {
     return RunCodeCallbacks{
         std::make_unique<ArgCallback>(LookupBlock, reinterpret_cast<u64>(arg)),
-        std::make_unique<ArgCallback>(DEVIRT(cb, &A64::UserCallbacks::AddTicks)),
-        std::make_unique<ArgCallback>(DEVIRT(cb, &A64::UserCallbacks::GetTicksRemaining)),
+        std::make_unique<JitStateArgCallback>(DEVIRT_JIT_STATE(offsetof(A64JitState, callbacks), &A64::UserCallbacks::AddTicks)),
+        std::make_unique<JitStateArgCallback>(DEVIRT_JIT_STATE(offsetof(A64JitState, callbacks), &A64::UserCallbacks::GetTicksRemaining)),
     };
 }
 
-struct Jit::Impl final {
+struct SharedCache::Impl final {
 public:
-    explicit Impl(UserConfig conf)
-        : conf(conf) 
-        , block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{jit_state})
+    /// @param concurrent Whether attached Jits may execute emitted code concurrently with each other.
+    Impl(UserConfig conf, bool concurrent)
+        : conf(conf)
+        , block_of_code(GenRunCodeCallbacks(&GetCurrentBlockThunk, this), JitStateInfo{A64JitState{}}, conf.code_cache_size, conf.far_code_offset)
         , emitter(&block_of_code, conf)
-    {}
+    {
+        if (concurrent || conf.enable_background_compilation) {
+            emitter.EnableConcurrentExecution(mutex);
+        }
+        if (conf.enable_background_compilation) {
+            compile_thread = std::thread{[this]{ CompileThread(); }};
+        }
+    }
 
-    ~Impl() = default;
+    ~Impl() {
+        ASSERT(jit_states.empty());
 
-    void Run() {
-        ASSERT(!is_executing);
-        is_executing = true;
-        SCOPE_EXIT({ this->is_executing = false; });
-        jit_state.halt_requested = false;
+        if (compile_thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stop_compile_thread = true;
+            }
+            compile_queue_nonempty.notify_one();
+            compile_thread.join();
+        }
+    }
 
-        // TODO: Check code alignment
-        block_of_code.RunCode(&jit_state);
+    void Attach(A64JitState* jit_state) {
+        std::lock_guard<std::mutex> lock{mutex};
+        jit_states.push_back(jit_state);
+    }
 
-        PerformRequestedCacheInvalidation();
+    void Detach(A64JitState* jit_state) {
+        std::lock_guard<std::mutex> lock{mutex};
+        jit_states.erase(std::remove(jit_states.begin(), jit_states.end(), jit_state), jit_states.end());
+    }
+
+    /// Runs emulated code until it returns to the host. Execution may return early if maintenance of the cache is required.
+    void RunCode(A64JitState* jit_state) {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            maintenance_complete.wait(lock, [this]{ return !IsMaintenancePending(); });
+            // Only the halt for maintenance is cleared: A halt requested by the user must still stop Jit::Run.
+            Common::Atomic::And(&jit_state->halt_requested, ~A64JitState::HALT_REQUESTED_FOR_MAINTENANCE);
+            num_executing++;
+        }
+
+        block_of_code.RunCode(jit_state);
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            num_executing--;
+            if (num_executing == 0) {
+                PerformMaintenance();
+            }
+        }
     }
 
     void ClearCache() {
+        std::lock_guard<std::mutex> lock{mutex};
         invalidate_entire_cache = true;
-        RequestCacheInvalidation();
+        RequestMaintenance();
     }
 
     void InvalidateCacheRange(u64 start_address, size_t length) {
+        std::lock_guard<std::mutex> lock{mutex};
         const auto end_address = static_cast<u64>(start_address + length - 1);
         const auto range = boost::icl::discrete_interval<u64>::closed(start_address, end_address);
         invalid_cache_ranges.add(range);
-        RequestCacheInvalidation();
+        RequestMaintenance();
+    }
+
+    std::vector<u8> SaveTranslationCache() {
+        std::lock_guard<std::mutex> lock{translation_cache_mutex};
+        return translation_cache.Save();
+    }
+
+    bool LoadTranslationCache(const std::vector<u8>& data) {
+        std::lock_guard<std::mutex> lock{translation_cache_mutex};
+        return translation_cache.Load(data);
+    }
+
+    const UserConfig conf;
+
+private:
+    struct TranslatedBlock {
+        IR::Block ir_block;
+        /// If present, the block is added to the translation cache once it has been optimized.
+        boost::optional<TranslationCache::GuestCode> guest_code;
+    };
+
+    static CodePtr GetCurrentBlockThunk(void* thisptr, A64JitState* jit_state) {
+        SharedCache::Impl* this_ = reinterpret_cast<SharedCache::Impl*>(thisptr);
+        return this_->GetCurrentBlock(*jit_state);
+    }
+
+    CodePtr GetCurrentBlock(const A64JitState& jit_state) {
+        const IR::LocationDescriptor current_location{jit_state.GetUniqueHash()};
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+
+            if (auto block = emitter.GetBasicBlock(current_location))
+                return block->entrypoint;
+
+            if (IsMaintenancePending()) {
+                // Compilation waits until the cache has been maintained.
+                return block_of_code.GetForceReturnFromRunCodeAddress();
+            }
+
+            if (conf.enable_background_compilation && pending_ranges.find(A64::LocationDescriptor{current_location}.PC()) != pending_ranges.end()) {
+                return BlockOfCode::MarkUncacheable(emitter.GetInterpretSingleInstructionEntrypoint());
+            }
+        }
+
+        // Translation calls back into user code, so it is performed without holding the lock.
+        // Maintenance cannot occur in the meantime as this thread is executing, but it may have been requested.
+        TranslatedBlock block = Translate(A64::LocationDescriptor{current_location}, jit_state.callbacks);
+
+        if (conf.enable_background_compilation) {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (IsMaintenancePending()) {
+                return block_of_code.GetForceReturnFromRunCodeAddress();
+            }
+            return RequestBackgroundCompilation(std::move(block));
+        }
+
+        // JIT Compile
+        Optimization::DeadCodeElimination(block.ir_block);
+        // printf("%s\n", IR::DumpBlock(block.ir_block).c_str());
+        Optimization::VerificationPass(block.ir_block);
+        AddToTranslationCache(block);
+
+        std::lock_guard<std::mutex> lock{mutex};
+
+        if (IsMaintenancePending()) {
+            // The guest code may have been modified during translation.
+            return block_of_code.GetForceReturnFromRunCodeAddress();
+        }
+
+        // Another thread may have emitted this block during translation.
+        if (auto existing_block = emitter.GetBasicBlock(current_location))
+            return existing_block->entrypoint;
+
+        if (!ReserveCodeSpace()) {
+            return block_of_code.GetForceReturnFromRunCodeAddress();
+        }
+
+        return emitter.Emit(block.ir_block).entrypoint;
+    }
+
+    /// Translates the block at location, unless the translation cache holds a translation of the same guest code.
+    /// Guest code is read with the callbacks of the Jit which requires the block.
+    /// Must be called without mutex held.
+    TranslatedBlock Translate(A64::LocationDescriptor location, A64::UserCallbacks* callbacks) {
+        const auto read_code = [callbacks](u64 vaddr) { return callbacks->MemoryReadCode(vaddr); };
+
+        {
+            std::lock_guard<std::mutex> lock{translation_cache_mutex};
+            if (auto ir_block = translation_cache.Lookup(location, read_code)) {
+                return {std::move(*ir_block), boost::none};
+            }
+        }
+
+        IR::Block ir_block = A64::Translate(location, read_code);
+        Optimization::A64MergeInterpretBlocksPass(ir_block, callbacks);
+
+        boost::optional<TranslationCache::GuestCode> guest_code;
+        if (conf.enable_translation_cache) {
+            // Instructions merged into an Interpret terminal also determine the translation.
+            const u64 begin = location.PC();
+            u64 end = A64::LocationDescriptor{ir_block.EndLocation()}.PC();
+            const IR::Terminal terminal = ir_block.GetTerminal();
+            if (auto term = boost::get<IR::Term::Interpret>(&terminal)) {
+                end = std::max<u64>(end, A64::LocationDescriptor{term->next}.PC() + term->num_instructions * 4);
+            }
+            guest_code = TranslationCache::HashGuestCode(begin, (end - begin) / 4, read_code);
+        }
+
+        return {std::move(ir_block), guest_code};
+    }
+
+    /// Must be called without mutex held.
+    void AddToTranslationCache(const TranslatedBlock& block) {
+        if (block.guest_code) {
+            std::lock_guard<std::mutex> lock{translation_cache_mutex};
+            translation_cache.Insert(block.ir_block, *block.guest_code);
+        }
+    }
+
+    static boost::icl::discrete_interval<u64> GuestRange(const IR::Block& ir_block) {
+        const A64::LocationDescriptor location{ir_block.Location()};
+        const A64::LocationDescriptor end_location{ir_block.EndLocation()};
+        return boost::icl::discrete_interval<u64>::closed(location.PC(), end_location.PC() - 1);
+    }
+
+    // The following must be called with mutex held.
+
+    /// Returns false if there is insufficient space to emit a block. In that case, eviction of a region has been requested.
+    bool ReserveCodeSpace() {
+        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
+        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
+            // Evict the oldest region of the cache to make space once no code is executing.
+            evict_code_region = true;
+            RequestMaintenance();
+            return false;
+        }
+        block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
+        return true;
+    }
+
+    /// Queues block for compilation. Instructions are interpreted until a block containing them is ready.
+    CodePtr RequestBackgroundCompilation(TranslatedBlock block) {
+        // Another thread may have queued this block during translation.
+        if (pending_ranges.find(A64::LocationDescriptor{block.ir_block.Location()}.PC()) == pending_ranges.end()) {
+            pending_ranges.add(GuestRange(block.ir_block));
+            compile_queue.push_back(std::move(block));
+            compile_queue_nonempty.notify_one();
+        }
+
+        return BlockOfCode::MarkUncacheable(emitter.GetInterpretSingleInstructionEntrypoint());
+    }
+
+    void CompileThread() {
+        std::unique_lock<std::mutex> lock{mutex};
+        while (true) {
+            compile_queue_nonempty.wait(lock, [this]{ return stop_compile_thread || !compile_queue.empty(); });
+            if (stop_compile_thread) {
+                return;
+            }
+
+            TranslatedBlock block = std::move(compile_queue.front());
+            compile_queue.pop_front();
+            const size_t block_generation = generation;
+
+            lock.unlock();
+            Optimization::DeadCodeElimination(block.ir_block);
+            Optimization::VerificationPass(block.ir_block);
+            AddToTranslationCache(block);
+            lock.lock();
+
+            pending_ranges.subtract(GuestRange(block.ir_block));
+
+            // Blocks translated before an invalidation are discarded. They are requested again if they are still required.
+            if (block_generation != generation || IsMaintenancePending()) {
+                continue;
+            }
+            if (emitter.GetBasicBlock(block.ir_block.Location()) || !ReserveCodeSpace()) {
+                continue;
+            }
+            emitter.Emit(block.ir_block);
+        }
+    }
+
+    bool IsMaintenancePending() const {
+        return invalidate_entire_cache || evict_code_region || !invalid_cache_ranges.empty();
+    }
+
+    void RequestMaintenance() {
+        if (num_executing == 0) {
+            PerformMaintenance();
+            return;
+        }
+
+        // Maintenance is performed by the last Jit to return from emitted code.
+        for (A64JitState* jit_state : jit_states) {
+            Common::Atomic::Or(&jit_state->halt_requested, A64JitState::HALT_REQUESTED_FOR_MAINTENANCE);
+        }
+    }
+
+    void PerformMaintenance() {
+        ASSERT(num_executing == 0);
+
+        if (!IsMaintenancePending()) {
+            return;
+        }
+
+        for (A64JitState* jit_state : jit_states) {
+            jit_state->ResetRSB();
+            jit_state->dispatch_table->Clear();
+        }
+
+        if (invalidate_entire_cache) {
+            block_of_code.ClearCache();
+            emitter.ClearCache();
+        } else {
+            emitter.InvalidateCacheRanges(invalid_cache_ranges);
+            if (evict_code_region) {
+                emitter.InvalidateCodeRegion(block_of_code.AdvanceRegion());
+            }
+        }
+
+        invalid_cache_ranges.clear();
+        invalidate_entire_cache = false;
+        evict_code_region = false;
+
+        compile_queue.clear();
+        pending_ranges.clear();
+        generation++;
+
+        maintenance_complete.notify_all();
+    }
+
+    BlockOfCode block_of_code;
+    A64EmitX64 emitter;
+
+    std::mutex mutex;
+    std::condition_variable maintenance_complete;
+    std::vector<A64JitState*> jit_states;
+    size_t num_executing = 0;
+
+    bool invalidate_entire_cache = false;
+    bool evict_code_region = false;
+    boost::icl::interval_set<u64> invalid_cache_ranges;
+
+    std::mutex translation_cache_mutex; ///< Guards translation_cache. Never acquired while mutex is held.
+    TranslationCache translation_cache;
+
+    // Background compilation
+    std::deque<TranslatedBlock> compile_queue;
+    std::condition_variable compile_queue_nonempty;
+    boost::icl::interval_set<u64> pending_ranges; ///< Guest code in blocks which are queued or being compiled.
+    size_t generation = 0; ///< Incremented whenever the cache is maintained.
+    bool stop_compile_thread = false;
+    std::thread compile_thread;
+};
+
+SharedCache::SharedCache(UserConfig conf)
+    : impl(std::make_unique<SharedCache::Impl>(conf, true)) {}
+
+SharedCache::~SharedCache() = default;
+
+void SharedCache::ClearCache() {
+    impl->ClearCache();
+}
+
+void SharedCache::InvalidateCacheRange(u64 start_address, size_t length) {
+    impl->InvalidateCacheRange(start_address, length);
+}
+
+std::vector<u8> SharedCache::SaveTranslationCache() const {
+    return impl->SaveTranslationCache();
+}
+
+bool SharedCache::LoadTranslationCache(const std::vector<u8>& data) {
+    return impl->LoadTranslationCache(data);
+}
+
+struct Jit::Impl final {
+public:
+    explicit Impl(UserConfig conf)
+        : own_cache(std::make_unique<SharedCache::Impl>(conf, false))
+        , cache(*own_cache)
+        , callbacks(conf.callbacks)
+    {
+        InitJitState();
+        cache.Attach(&jit_state);
+    }
+
+    Impl(SharedCache::Impl& cache, UserCallbacks* callbacks)
+        : cache(cache)
+        , callbacks(callbacks)
+    {
+        InitJitState();
+        cache.Attach(&jit_state);
+    }
+
+    ~Impl() {
+        cache.Detach(&jit_state);
+    }
+
+    void Run() {
+        ASSERT(!is_executing);
+        is_executing = true;
+        SCOPE_EXIT({
+            Common::Atomic::And(&jit_state.halt_requested, ~A64JitState::HALT_REQUESTED_BY_USER);
+            this->is_executing = false;
+        });
+
+        // TODO: Check code alignment
+        u32 halt_requested;
+        do {
+            cache.RunCode(&jit_state);
+            halt_requested = Common::Atomic::Load(&jit_state.halt_requested);
+            // Execution transparently resumes if it was only halted to maintain the cache.
+        } while (halt_requested == A64JitState::HALT_REQUESTED_FOR_MAINTENANCE && jit_state.cycles_remaining > 0);
+    }
+
+    void ClearCache() {
+        RequestHaltIfExecuting();
+        cache.ClearCache();
+    }
+
+    void InvalidateCacheRange(u64 start_address, size_t length) {
+        RequestHaltIfExecuting();
+        cache.InvalidateCacheRange(start_address, length);
+    }
+
+    std::vector<u8> SaveTranslationCache() const {
+        return cache.SaveTranslationCache();
+    }
+
+    bool LoadTranslationCache(const std::vector<u8>& data) {
+        return cache.LoadTranslationCache(data);
     }
 
     void Reset() {
         ASSERT(!is_executing);
         jit_state = {};
+        InitJitState();
     }
 
     void HaltExecution() {
-        jit_state.halt_requested = true;
+        Common::Atomic::Or(&jit_state.halt_requested, A64JitState::HALT_REQUESTED_BY_USER);
     }
 
     u64 GetSP() const {
@@ -142,6 +527,14 @@ public:
         jit_state.SetFpcr(value);
     }
 
+    u32 GetFpsr() const {
+        return jit_state.GetFpsr();
+    }
+
+    void SetFpsr(u32 value) {
+        jit_state.SetFpsr(value);
+    }
+
     u32 GetPstate() const {
         return jit_state.GetPstate();
     }
@@ -150,77 +543,44 @@ public:
         jit_state.SetPstate(value);
     }
 
+    void ClearExclusiveState() {
+        jit_state.exclusive_state = 0;
+    }
+
     bool IsExecuting() const {
         return is_executing;
     }
 
 private:
-    static CodePtr GetCurrentBlockThunk(void* thisptr) {
-        Jit::Impl* this_ = reinterpret_cast<Jit::Impl*>(thisptr);
-        return this_->GetCurrentBlock();
-    }
-
-    CodePtr GetCurrentBlock() {
-        IR::LocationDescriptor current_location{jit_state.GetUniqueHash()};
-
-        if (auto block = emitter.GetBasicBlock(current_location))
-            return block->entrypoint;
-
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
-        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            // Immediately evacuate cache
-            invalidate_entire_cache = true;
-            PerformRequestedCacheInvalidation();
-        }
-
-        // JIT Compile
-        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); });
-        Optimization::DeadCodeElimination(ir_block);
-        Optimization::A64MergeInterpretBlocksPass(ir_block, conf.callbacks);
-        // printf("%s\n", IR::DumpBlock(ir_block).c_str());
-        Optimization::VerificationPass(ir_block);
-        return emitter.Emit(ir_block).entrypoint;
+    void InitJitState() {
+        jit_state.dispatch_table = &dispatch_table;
+        jit_state.callbacks = callbacks;
     }
 
-    void RequestCacheInvalidation() {
+    void RequestHaltIfExecuting() {
         if (is_executing) {
-            jit_state.halt_requested = true;
-            return;
-        }
-
-        PerformRequestedCacheInvalidation();
-    }
-
-    void PerformRequestedCacheInvalidation() {
-        if (!invalidate_entire_cache && invalid_cache_ranges.empty()) {
-            return;
-        }
-
-        jit_state.ResetRSB();
-        if (invalidate_entire_cache) {
-            block_of_code.ClearCache();
-            emitter.ClearCache();
-        } else {
-            emitter.InvalidateCacheRanges(invalid_cache_ranges);
+            HaltExecution();
         }
-        invalid_cache_ranges.clear();
-        invalidate_entire_cache = false;
     }
 
     bool is_executing = false;
 
-    UserConfig conf;
+    std::unique_ptr<SharedCache::Impl> own_cache;
+    SharedCache::Impl& cache;
+    UserCallbacks* const callbacks;
     A64JitState jit_state;
-    BlockOfCode block_of_code;
-    A64EmitX64 emitter;
-
-    bool invalidate_entire_cache = false;
-    boost::icl::interval_set<u64> invalid_cache_ranges;
+    DispatchTable dispatch_table;
 };
 
 Jit::Jit(UserConfig conf)
     : impl(std::make_unique<Jit::Impl>(conf)) {}
 
+Jit::Jit(SharedCache& cache)
+    : impl(std::make_unique<Jit::Impl>(*cache.impl, cache.impl->conf.callbacks)) {}
+
+Jit::Jit(SharedCache& cache, UserCallbacks* callbacks)
+    : impl(std::make_unique<Jit::Impl>(*cache.impl, callbacks)) {}
+
 Jit::~Jit() = default;
 
 void Jit::Run() {
@@ -235,6 +595,14 @@ void Jit::InvalidateCacheRange(u64 start_address, size_t length) {
     impl->InvalidateCacheRange(start_address, length);
 }
 
+std::vector<u8> Jit::SaveTranslationCache() const {
+    return impl->SaveTranslationCache();
+}
+
+bool Jit::LoadTranslationCache(const std::vector<u8>& data) {
+    return impl->LoadTranslationCache(data);
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
@@ -299,6 +667,14 @@ void Jit::SetFpcr(u32 value) {
     impl->SetFpcr(value);
 }
 
+u32 Jit::GetFpsr() const {
+    return impl->GetFpsr();
+}
+
+void Jit::SetFpsr(u32 value) {
+    impl->SetFpsr(value);
+}
+
 u32 Jit::GetPstate() const {
     return impl->GetPstate();
 }
@@ -307,6 +683,10 @@ void Jit::SetPstate(u32 value) {
     impl->SetPstate(value);
 }
 
+void Jit::ClearExclusiveState() {
+    impl->ClearExclusiveState();
+}
+
 bool Jit::IsExecuting() const {
     return impl->IsExecuting();
 }
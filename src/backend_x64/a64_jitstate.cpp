@@ -4,17 +4,63 @@
  * General Public License version 2 or any later version.
  */
 
+#include <array>
+
 #include "backend_x64/a64_jitstate.h"
+#include "backend_x64/block_of_code.h"
+#include "common/bit_util.h"
 #include "frontend/A64/location_descriptor.h"
 
 namespace Dynarmic {
 namespace BackendX64 {
 
+void A64JitState::SetFpcr(u32 new_fpcr) {
+    fpcr = new_fpcr;
+
+    // Flush to zero and default NaN are handled at compile time as they are part of the location descriptor.
+    // The rounding mode has to be reflected in guest_MXCSR as it applies to every floating point operation.
+    const std::array<u32, 4> MXCSR_RMode {0x0, 0x4000, 0x2000, 0x6000};
+    guest_MXCSR &= ~0x6000;
+    guest_MXCSR |= MXCSR_RMode[(new_fpcr >> 22) & 0x3];
+}
+
+// The FPSR cumulative flags share their layout with those of the FPSCR (see a32_jitstate.cpp); QC is bit 27.
+u32 A64JitState::GetFpsr() const {
+    u32 fpsr = 0;
+    fpsr |= (guest_MXCSR & 0b0000000000001);       // IOC = IE
+    fpsr |= (guest_MXCSR & 0b0000000111100) >> 1;  // IXC, UFC, OFC, DZC = PE, UE, OE, ZE
+    fpsr |= FPSCR_IDC;
+    fpsr |= FPSCR_UFC;
+    fpsr |= FPSCR_QC ? 1 << 27 : 0;
+    return fpsr;
+}
+
+void A64JitState::SetFpsr(u32 new_fpsr) {
+    guest_MXCSR &= ~0x0000003D;
+    guest_MXCSR |= ( new_fpsr     ) & 0b0000000000001;  // IE = IOC
+    guest_MXCSR |= ( new_fpsr << 1) & 0b0000000111100;  // PE, UE, OE, ZE = IXC, UFC, OFC, DZC
+    FPSCR_IDC = new_fpsr & (1 << 7);
+    FPSCR_UFC = new_fpsr & (1 << 3);
+    FPSCR_QC = Common::Bit<27>(new_fpsr) ? 1 : 0;
+}
+
 u64 A64JitState::GetUniqueHash() const {
     u64 fpcr_u64 = static_cast<u64>(fpcr & A64::LocationDescriptor::FPCR_MASK) << 37;
     u64 pc_u64 = pc & A64::LocationDescriptor::PC_MASK;
     return pc_u64 | fpcr_u64;
 }
 
+void A64JitState::EmitUniqueHash(BlockOfCode* code, Xbyak::Reg64 result, Xbyak::Reg64 scratch) {
+    using namespace Xbyak::util;
+
+    // This calculation has to match up with GetUniqueHash
+    code->mov(scratch.cvt32(), dword[r15 + offsetof(A64JitState, fpcr)]);
+    code->and_(scratch.cvt32(), A64::LocationDescriptor::FPCR_MASK);
+    code->shl(scratch, 37);
+    code->mov(result, A64::LocationDescriptor::PC_MASK);
+    code->and_(result, qword[r15 + offsetof(A64JitState, pc)]);
+    code->or_(result, scratch);
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
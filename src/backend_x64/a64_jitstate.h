@@ -10,9 +10,15 @@
 
 #include <xbyak.h>
 
+#include "backend_x64/dispatch_table.h"
 #include "common/common_types.h"
 
 namespace Dynarmic {
+
+namespace A64 {
+struct UserCallbacks;
+} // namespace A64
+
 namespace BackendX64 {
 
 class BlockOfCode;
@@ -43,10 +49,10 @@ struct A64JitState {
     alignas(16) std::array<u64, 64> vec{}; // Extension registers.
 
     static constexpr size_t SpillCount = 64;
-    std::array<u64, SpillCount> spill{}; // Spill.
+    alignas(16) std::array<std::array<u64, 2>, SpillCount> spill{}; // Spill.
     static Xbyak::Address GetSpillLocationFromIndex(size_t i) {
         using namespace Xbyak::util;
-        return qword[r15 + offsetof(A64JitState, spill) + i * sizeof(u64)];
+        return Xbyak::Address{128, false, r15 + offsetof(A64JitState, spill) + i * sizeof(u64) * 2};
     }
 
     // For internal use (See: BlockOfCode::RunCode)
@@ -54,8 +60,19 @@ struct A64JitState {
     u32 save_host_MXCSR = 0;
     s64 cycles_to_run = 0;
     s64 cycles_remaining = 0;
-    bool halt_requested = false;
+    // Reasons for halting. Other threads may request a halt, so modify this with Common::Atomic.
+    static constexpr u32 HALT_REQUESTED_BY_USER = 1 << 0;
+    static constexpr u32 HALT_REQUESTED_FOR_MAINTENANCE = 1 << 1;
+    volatile u32 halt_requested = 0;
     bool check_bit = false;
+    DispatchTable* dispatch_table = nullptr;
+    A64::UserCallbacks* callbacks = nullptr; ///< Called by emitted code. Jits sharing a cache may differ in these.
+
+    // Exclusive state
+    static constexpr u64 RESERVATION_GRANULE_MASK = 0xFFFF'FFFF'FFFF'FFF0ull;
+    u8 exclusive_state = 0;
+    u64 exclusive_address = 0;
+    std::array<u64, 2> exclusive_value{}; ///< Value observed by the exclusive load, which the exclusive store compares against.
 
     static constexpr size_t RSBSize = 8; // MUST be a power of 2.
     static constexpr size_t RSBPtrMask = RSBSize - 1;
@@ -69,11 +86,15 @@ struct A64JitState {
 
     u32 FPSCR_IDC = 0;
     u32 FPSCR_UFC = 0;
+    u32 FPSCR_QC = 0; ///< Cumulative saturation flag, set by emitted code.
     u32 fpcr = 0;
     u32 GetFpcr() const { return fpcr; }
-    void SetFpcr(u32 new_fpcr) { fpcr = new_fpcr; }
+    void SetFpcr(u32 new_fpcr);
+    u32 GetFpsr() const;
+    void SetFpsr(u32 new_fpsr);
 
     u64 GetUniqueHash() const;
+    static void EmitUniqueHash(BlockOfCode* code, Xbyak::Reg64 result, Xbyak::Reg64 scratch);
 };
 
 #ifdef _MSC_VER
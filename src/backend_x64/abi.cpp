@@ -14,6 +14,10 @@
 
 // 24th August 2016: This code was modified for Dynarmic.
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #include <xbyak.h>
 
 #include "backend_x64/abi.h"
@@ -127,5 +131,19 @@ void ABI_PopCallerSaveRegistersAndAdjustStack(Xbyak::CodeGenerator* code, size_t
     ABI_PopRegistersAndAdjustStack(code, frame_size, ABI_ALL_CALLER_SAVE);
 }
 
+static std::vector<HostLoc> CallerSaveRegistersExcept(HostLoc exception) {
+    std::vector<HostLoc> regs;
+    std::remove_copy(ABI_ALL_CALLER_SAVE.begin(), ABI_ALL_CALLER_SAVE.end(), std::back_inserter(regs), exception);
+    return regs;
+}
+
+void ABI_PushCallerSaveRegistersAndAdjustStackExcept(Xbyak::CodeGenerator* code, HostLoc exception, size_t frame_size) {
+    ABI_PushRegistersAndAdjustStack(code, frame_size, CallerSaveRegistersExcept(exception));
+}
+
+void ABI_PopCallerSaveRegistersAndAdjustStackExcept(Xbyak::CodeGenerator* code, HostLoc exception, size_t frame_size) {
+    ABI_PopRegistersAndAdjustStack(code, frame_size, CallerSaveRegistersExcept(exception));
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
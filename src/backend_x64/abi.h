@@ -115,5 +115,8 @@ void ABI_PopCalleeSaveRegistersAndAdjustStack(Xbyak::CodeGenerator* code, size_t
 void ABI_PushCallerSaveRegistersAndAdjustStack(Xbyak::CodeGenerator* code, size_t frame_size = 0);
 void ABI_PopCallerSaveRegistersAndAdjustStack(Xbyak::CodeGenerator* code, size_t frame_size = 0);
 
+void ABI_PushCallerSaveRegistersAndAdjustStackExcept(Xbyak::CodeGenerator* code, HostLoc exception, size_t frame_size = 0);
+void ABI_PopCallerSaveRegistersAndAdjustStackExcept(Xbyak::CodeGenerator* code, HostLoc exception, size_t frame_size = 0);
+
 } // namespace BackendX64
 } // namespace Dynarmic
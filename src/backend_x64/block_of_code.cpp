@@ -4,14 +4,23 @@
  * General Public License version 2 or any later version.
  */
 
-#include <cstring>
+#include <cstddef>
+#include <algorithm>
 #include <limits>
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
 #include <xbyak.h>
 
 #include "backend_x64/a32_jitstate.h"
 #include "backend_x64/abi.h"
 #include "backend_x64/block_of_code.h"
+#include "backend_x64/dispatch_table.h"
 #include "common/assert.h"
 
 namespace Dynarmic {
@@ -31,15 +40,93 @@ const Xbyak::Reg64 BlockOfCode::ABI_PARAM3 = Xbyak::util::rdx;
 const Xbyak::Reg64 BlockOfCode::ABI_PARAM4 = Xbyak::util::rcx;
 #endif
 
-constexpr size_t TOTAL_CODE_SIZE = 128 * 1024 * 1024;
-constexpr size_t FAR_CODE_OFFSET = 100 * 1024 * 1024;
+namespace {
+
+constexpr size_t MINIMUM_NEAR_CODE_SIZE = 16 * 1024 * 1024;
+constexpr size_t MINIMUM_FAR_CODE_SIZE = 16 * 1024 * 1024;
+constexpr size_t CONSTANT_POOL_SIZE = 256 * 1024;
+
+/// Reserves address space for the code cache without committing any memory up front.
+class CodeMemoryAllocator final : public Xbyak::Allocator {
+public:
+#ifdef _WIN32
+    static constexpr size_t PRELUDE_COMMIT_SIZE = 1 * 1024 * 1024;
+
+    // Memory for the prelude is committed immediately. The remainder is committed by BlockOfCode::EnsureMemoryCommitted.
+    Xbyak::uint8* alloc(size_t size) override {
+        void* p = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+        if (!p) {
+            return nullptr;
+        }
+        if (!VirtualAlloc(p, std::min(size, PRELUDE_COMMIT_SIZE), MEM_COMMIT, PAGE_EXECUTE_READWRITE)) {
+            VirtualFree(p, 0, MEM_RELEASE);
+            return nullptr;
+        }
+        return static_cast<Xbyak::uint8*>(p);
+    }
+
+    void free(Xbyak::uint8* p) override {
+        VirtualFree(p, 0, MEM_RELEASE);
+    }
+#else
+    // The kernel commits pages on first access. The size of the mapping is stored in the page preceding the code.
+    Xbyak::uint8* alloc(size_t size) override {
+        const size_t mapping_size = size + Xbyak::inner::ALIGN_PAGE_SIZE;
+        void* p = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (p == MAP_FAILED) {
+            return nullptr;
+        }
+        *static_cast<size_t*>(p) = mapping_size;
+        return static_cast<Xbyak::uint8*>(p) + Xbyak::inner::ALIGN_PAGE_SIZE;
+    }
+
+    void free(Xbyak::uint8* p) override {
+        void* mapping = p - Xbyak::inner::ALIGN_PAGE_SIZE;
+        munmap(mapping, *static_cast<size_t*>(mapping));
+    }
+#endif
+
+    bool useProtect() const override { return false; }
+};
+
+CodeMemoryAllocator* GetCodeMemoryAllocator() {
+    static CodeMemoryAllocator allocator;
+    return &allocator;
+}
+
+bool HostHasCmpxchg16b() {
+    constexpr unsigned int cpuid_1_ecx_cx16 = 1 << 13;
+
+    unsigned int data[4];
+    Xbyak::util::Cpu::getCpuid(1, data);
+    return (data[2] & cpuid_1_ecx_cx16) != 0;
+}
+
+thread_local bool use_baseline_host_features = false;
+
+} // anonymous namespace
 
-BlockOfCode::BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi)
-        : Xbyak::CodeGenerator(TOTAL_CODE_SIZE)
+ScopedBaselineHostFeatures::ScopedBaselineHostFeatures(bool enable) : previous(use_baseline_host_features) {
+    use_baseline_host_features = previous || enable;
+}
+
+ScopedBaselineHostFeatures::~ScopedBaselineHostFeatures() {
+    use_baseline_host_features = previous;
+}
+
+BlockOfCode::BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, size_t total_code_size, size_t far_code_offset)
+        : Xbyak::CodeGenerator(total_code_size, nullptr, GetCodeMemoryAllocator())
         , cb(std::move(cb))
         , jsi(jsi)
-        , constant_pool(this, 256)
+        , total_code_size(total_code_size)
+        , far_code_offset(far_code_offset)
+        , constant_pool(this, CONSTANT_POOL_SIZE)
+        , has_cmpxchg16b(HostHasCmpxchg16b())
+        , baseline_host_features_only(use_baseline_host_features)
 {
+    ASSERT_MSG(far_code_offset >= MINIMUM_NEAR_CODE_SIZE, "Near code size is too small");
+    ASSERT_MSG(total_code_size >= far_code_offset + MINIMUM_FAR_CODE_SIZE, "Far code size is too small");
+
     GenRunCode();
     exception_handler.Register(this);
 }
@@ -47,13 +134,16 @@ BlockOfCode::BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi)
 void BlockOfCode::PreludeComplete() {
     prelude_complete = true;
     near_code_begin = getCurr();
-    far_code_begin = getCurr() + FAR_CODE_OFFSET;
+    near_code_end = getCode() + far_code_offset;
+    far_code_begin = getCurr() + far_code_offset;
+    far_code_end = getCode() + total_code_size;
     ClearCache();
 }
 
 void BlockOfCode::ClearCache() {
     ASSERT(prelude_complete);
     in_far_code = false;
+    current_region = 0;
     near_code_ptr = near_code_begin;
     far_code_ptr = far_code_begin;
     SetCodePtr(near_code_begin);
@@ -61,22 +151,59 @@ void BlockOfCode::ClearCache() {
 
 size_t BlockOfCode::SpaceRemaining() const {
     ASSERT(prelude_complete);
-    // This function provides an underestimate of near-code-size but that's okay.
-    // (Why? The maximum size of near code should be measured from near_code_begin, not top_.)
-    // These are offsets from Xbyak::CodeArray::top_.
-    std::size_t far_code_offset, near_code_offset;
-    if (in_far_code) {
-        near_code_offset = static_cast<const u8*>(near_code_ptr) - getCode();
-        far_code_offset = getCurr() - getCode();
-    } else {
-        near_code_offset = getCurr() - getCode();
-        far_code_offset = static_cast<const u8*>(far_code_ptr) - getCode();
-    }
-    if (far_code_offset > TOTAL_CODE_SIZE)
+    const CodeRegion region = GetRegion(current_region);
+    const u8* near_ptr = in_far_code ? static_cast<const u8*>(near_code_ptr) : getCurr();
+    const u8* far_ptr = in_far_code ? getCurr() : static_cast<const u8*>(far_code_ptr);
+    if (near_ptr > region.near_end || far_ptr > region.far_end)
         return 0;
-    if (near_code_offset > FAR_CODE_OFFSET)
-        return 0;
-    return std::min(TOTAL_CODE_SIZE - far_code_offset, FAR_CODE_OFFSET - near_code_offset);
+    return std::min<size_t>(region.near_end - near_ptr, region.far_end - far_ptr);
+}
+
+CodeRegion BlockOfCode::AdvanceRegion() {
+    ASSERT(prelude_complete);
+    ASSERT(!in_far_code);
+    current_region = (current_region + 1) % NumRegions;
+    const CodeRegion region = GetRegion(current_region);
+    near_code_ptr = region.near_begin;
+    far_code_ptr = region.far_begin;
+    SetCodePtr(near_code_ptr);
+    return region;
+}
+
+void BlockOfCode::EnsureMemoryCommitted(size_t bytes) {
+#ifdef _WIN32
+    const auto commit = [bytes](const u8* begin, const u8* end) {
+        if (begin >= end) {
+            return;
+        }
+        const size_t size = std::min<size_t>(bytes, end - begin);
+        const void* result = VirtualAlloc(const_cast<u8*>(begin), size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+        ASSERT_MSG(result, "Failed to commit code cache memory");
+    };
+
+    ASSERT(prelude_complete);
+    const CodeRegion region = GetRegion(current_region);
+    const u8* near_ptr = in_far_code ? static_cast<const u8*>(near_code_ptr) : getCurr();
+    const u8* far_ptr = in_far_code ? getCurr() : static_cast<const u8*>(far_code_ptr);
+    commit(near_ptr, region.near_end);
+    commit(far_ptr, region.far_end);
+#else
+    // Pages are committed on first access.
+    (void)bytes;
+#endif
+}
+
+CodeRegion BlockOfCode::GetRegion(size_t index) const {
+    ASSERT(index < NumRegions);
+    const size_t near_region_size = (near_code_end - near_code_begin) / NumRegions;
+    const size_t far_region_size = (far_code_end - far_code_begin) / NumRegions;
+    const bool is_last = index == NumRegions - 1;
+    return CodeRegion{
+        near_code_begin + index * near_region_size,
+        is_last ? near_code_end : near_code_begin + (index + 1) * near_region_size,
+        far_code_begin + index * far_region_size,
+        is_last ? far_code_end : far_code_begin + (index + 1) * far_region_size,
+    };
 }
 
 void BlockOfCode::RunCode(void* jit_state) const {
@@ -102,7 +229,7 @@ void BlockOfCode::ForceReturnFromRunCode(bool mxcsr_already_exited) {
 }
 
 void BlockOfCode::GenRunCode() {
-    Xbyak::Label loop, enter_mxcsr_then_loop;
+    Xbyak::Label loop, enter_mxcsr_then_loop, dispatch_table_miss, uncacheable;
 
     align();
     run_code_from = getCurr<RunCodeFromFuncType>();
@@ -137,15 +264,43 @@ void BlockOfCode::GenRunCode() {
     L(enter_mxcsr_then_loop);
     SwitchMxcsrOnEntry();
     L(loop);
-    cb.LookupBlock->EmitCall(this);
+    // Probe the dispatch table of this jit state. rbx and rbp are callee-saved, so they survive the call to LookupBlock on a miss.
+    jsi.EmitUniqueHash(this, rbx, rcx);
+    mov(rbp, 0x9E3779B97F4A7C15); // 2^64 / golden ratio
+    imul(rbp, rbx);
+    shr(rbp, 64 - DispatchTable::Bits);
+    shl(rbp, 4);
+    static_assert(sizeof(DispatchTable::Entry) == 1 << 4);
+    static_assert(offsetof(DispatchTable, entries) == 0);
+    add(rbp, qword[r15 + jsi.offsetof_dispatch_table]);
+    cmp(rbx, qword[rbp + offsetof(DispatchTable::Entry, location_descriptor)]);
+    jne(dispatch_table_miss);
+    jmp(qword[rbp + offsetof(DispatchTable::Entry, code_ptr)]);
+
+    L(dispatch_table_miss);
+    cb.LookupBlock->EmitCall(this, [this](Xbyak::Reg64 param1) {
+        mov(param1, r15);
+    });
+    test(ABI_RETURN, UNCACHEABLE_BIT);
+    jnz(uncacheable, T_NEAR);
+    mov(qword[rbp + offsetof(DispatchTable::Entry, location_descriptor)], rbx);
+    mov(qword[rbp + offsetof(DispatchTable::Entry, code_ptr)], ABI_RETURN);
+
+    jmp(ABI_RETURN);
 
+    L(uncacheable);
+    xor_(ABI_RETURN, UNCACHEABLE_BIT);
     jmp(ABI_RETURN);
 
     // Return from run code variants
     const auto emit_return_from_run_code = [this, &loop, &enter_mxcsr_then_loop](bool mxcsr_already_exited, bool force_return){
         if (!force_return) {
+            Xbyak::Label halt;
+            cmp(dword[r15 + jsi.offsetof_halt_requested], 0);
+            jne(halt);
             cmp(qword[r15 + jsi.offsetof_cycles_remaining], 0);
             jg(mxcsr_already_exited ? enter_mxcsr_then_loop : loop);
+            L(halt);
         }
 
         if (!mxcsr_already_exited) {
@@ -188,8 +343,38 @@ void BlockOfCode::SwitchMxcsrOnExit() {
     ldmxcsr(dword[r15 + jsi.offsetof_save_host_MXCSR]);
 }
 
-Xbyak::Address BlockOfCode::MConst(u64 constant) {
-    return constant_pool.GetConstant(constant);
+Xbyak::Address BlockOfCode::MConst(u64 lower, u64 upper) {
+    return constant_pool.GetConstant(lower, upper);
+}
+
+void BlockOfCode::LoadConstant(Xbyak::Xmm dest, u64 lower, u64 upper) {
+    if (lower == 0 && upper == 0) {
+        pxor(dest, dest);
+        return;
+    }
+
+    if (const auto address = constant_pool.TryGetConstant(lower, upper)) {
+        movaps(dest, *address);
+        return;
+    }
+
+    // The constant pool is full. rax is preserved and the stack pointer is adjusted without affecting flags.
+    push(rax);
+    if (upper == 0 || upper == lower) {
+        mov(rax, lower);
+        movq(dest, rax);
+        if (upper == lower) {
+            punpcklqdq(dest, dest);
+        }
+    } else {
+        mov(rax, upper);
+        push(rax);
+        mov(rax, lower);
+        push(rax);
+        movups(dest, xword[rsp]);
+        lea(rsp, ptr[rsp + 16]);
+    }
+    pop(rax);
 }
 
 void BlockOfCode::SwitchToFarCode() {
@@ -211,13 +396,15 @@ void BlockOfCode::SwitchToNearCode() {
 }
 
 void* BlockOfCode::AllocateFromCodeSpace(size_t alloc_size) {
+    ASSERT(!prelude_complete);
     if (size_ + alloc_size >= maxSize_) {
         throw Xbyak::Error(Xbyak::ERR_CODE_IS_TOO_BIG);
     }
 
+    // Nothing has been written here yet, so the memory is still zero from when it was mapped.
+    // Not clearing it means only the pages that are actually used get committed.
     void* ret = getCurr<void*>();
     size_ += alloc_size;
-    memset(ret, 0, alloc_size);
     return ret;
 }
 
@@ -234,8 +421,27 @@ void BlockOfCode::EnsurePatchLocationSize(CodePtr begin, size_t size) {
 }
 
 bool BlockOfCode::DoesCpuSupport(Xbyak::util::Cpu::Type type) const {
+    // Every feature that is queried is an extension beyond SSE2, which x64 guarantees.
+    if (baseline_host_features_only) {
+        return false;
+    }
     return cpu_info.has(type);
 }
 
+bool BlockOfCode::DoesCpuSupportCmpxchg16b() const {
+    if (baseline_host_features_only) {
+        return false;
+    }
+    return has_cmpxchg16b;
+}
+
+bool BlockOfCode::SupportsFastmem() const {
+    return exception_handler.SupportsFastmem();
+}
+
+void BlockOfCode::SetFastmemCallback(std::function<boost::optional<FakeCall>(u64)> cb) {
+    exception_handler.SetFastmemCallback(std::move(cb));
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <array>
+#include <functional>
 #include <memory>
 #include <type_traits>
 
+#include <boost/optional.hpp>
 #include <xbyak.h>
 #include <xbyak_util.h>
 
@@ -23,22 +26,66 @@ namespace BackendX64 {
 
 using CodePtr = const void*;
 
+/// The code cache is split into a number of regions which are filled in turn.
+/// Each region consists of a range of near code and a range of far code.
+struct CodeRegion {
+    const u8* near_begin;
+    const u8* near_end;
+    const u8* far_begin;
+    const u8* far_end;
+
+    bool Contains(CodePtr ptr) const {
+        const u8* p = static_cast<const u8*>(ptr);
+        return (p >= near_begin && p < near_end) || (p >= far_begin && p < far_end);
+    }
+};
+
+/// Describes a call to be simulated by the exception handler when a fastmem access faults.
+/// Execution resumes at call_rip, with ret_rip pushed onto the stack as the return address.
+struct FakeCall {
+    u64 call_rip;
+    u64 ret_rip;
+};
+
 struct RunCodeCallbacks {
+    /// Receives the jit state being run as its argument and returns the entrypoint of the current block.
+    /// The returned entrypoint is remembered by the dispatcher unless it was marked with BlockOfCode::MarkUncacheable.
     std::unique_ptr<Callback> LookupBlock;
     std::unique_ptr<Callback> AddTicks;
     std::unique_ptr<Callback> GetTicksRemaining;
 };
 
+/**
+ * While an enabled instance is alive, BlockOfCodes constructed on the same thread report only the x64 baseline
+ * instruction set (up to SSE2), so that emitted code takes its fallback paths. This is intended for testing.
+ */
+class ScopedBaselineHostFeatures final {
+public:
+    explicit ScopedBaselineHostFeatures(bool enable = true);
+    ~ScopedBaselineHostFeatures();
+
+    ScopedBaselineHostFeatures(const ScopedBaselineHostFeatures&) = delete;
+    ScopedBaselineHostFeatures& operator=(const ScopedBaselineHostFeatures&) = delete;
+
+private:
+    bool previous;
+};
+
 class BlockOfCode final : public Xbyak::CodeGenerator {
 public:
-    BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi);
+    BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, size_t total_code_size, size_t far_code_offset);
     /// Call when external emitters have finished emitting their preludes.
     void PreludeComplete();
 
     /// Clears this block of code and resets code pointer to beginning.
     void ClearCache();
-    /// Calculates how much space is remaining to use. This is the minimum of near code and far code.
+    /// Calculates how much space is remaining to use in the current region. This is the minimum of near code and far code.
     size_t SpaceRemaining() const;
+    /// Moves emission to the beginning of the next region, wrapping around to the oldest region.
+    /// The caller is responsible for invalidating all code within the returned region.
+    CodeRegion AdvanceRegion();
+    /// Ensures that at least `bytes` bytes of memory beyond both the near and far code pointers are committed.
+    void EnsureMemoryCommitted(size_t bytes);
 
     /// Runs emulated code.
     void RunCode(void* jit_state) const;
@@ -71,13 +118,23 @@ public:
         }
     }
 
-    Xbyak::Address MConst(u64 constant);
+    /// Returns the location of a constant in the constant pool.
+    /// Only for constants the emitter itself needs, as the pool has a fixed size.
+    Xbyak::Address MConst(u64 lower, u64 upper = 0);
+    /// Loads a 128-bit constant into dest. Use this rather than MConst for values that come from guest code.
+    /// These are pooled while there is space; otherwise the constant is built in dest without using the pool.
+    void LoadConstant(Xbyak::Xmm dest, u64 lower, u64 upper = 0);
 
     /// Far code sits far away from the near code. Execution remains primarily in near code.
     /// "Cold" / Rarely executed instructions sit in far code, so the CPU doesn't fetch them unless necessary.
     void SwitchToFarCode();
     void SwitchToNearCode();
 
+    /// Marks an entrypoint returned by the LookupBlock callback as one the dispatcher must not remember.
+    static CodePtr MarkUncacheable(CodePtr code_ptr) {
+        return reinterpret_cast<CodePtr>(reinterpret_cast<u64>(code_ptr) | UNCACHEABLE_BIT);
+    }
+
     const void* GetReturnFromRunCodeAddress() const {
         return return_from_run_code[0];
     }
@@ -91,6 +148,7 @@ public:
     /// Allocate memory of `size` bytes from the same block of memory the code is in.
     /// This is useful for objects that need to be placed close to or within code.
     /// The lifetime of this memory is the same as the code around it.
+    /// Only valid before the prelude is complete; the memory returned is zeroed.
     void* AllocateFromCodeSpace(size_t size);
 
     void SetCodePtr(CodePtr code_ptr);
@@ -102,7 +160,16 @@ public:
     static const Xbyak::Reg64 ABI_PARAM3;
     static const Xbyak::Reg64 ABI_PARAM4;
 
+    /// Always returns false if this was constructed within an enabled ScopedBaselineHostFeatures.
     bool DoesCpuSupport(Xbyak::util::Cpu::Type type) const;
+    /// xbyak does not detect CMPXCHG16B, so it is queried separately. Otherwise as DoesCpuSupport.
+    bool DoesCpuSupportCmpxchg16b() const;
+
+    /// Returns true if faulting memory accesses within emitted code can be recovered from.
+    bool SupportsFastmem() const;
+    /// Sets the function that is called with the host rip of a faulting memory access within emitted code.
+    /// If it returns boost::none, the fault is passed on to any previously installed handler.
+    void SetFastmemCallback(std::function<boost::optional<FakeCall>(u64)> cb);
 
     JitStateInfo GetJitStateInfo() const { return jsi; }
 
@@ -110,9 +177,18 @@ private:
     RunCodeCallbacks cb;
     JitStateInfo jsi;
 
+    const size_t total_code_size;
+    const size_t far_code_offset;
+
     bool prelude_complete = false;
-    CodePtr near_code_begin;
-    CodePtr far_code_begin;
+    const u8* near_code_begin;
+    const u8* near_code_end;
+    const u8* far_code_begin;
+    const u8* far_code_end;
+
+    static constexpr size_t NumRegions = 8;
+    size_t current_region = 0;
+    CodeRegion GetRegion(size_t index) const;
 
     ConstantPool constant_pool;
 
@@ -126,6 +202,7 @@ private:
     RunCodeFromFuncType run_code_from = nullptr;
     static constexpr size_t MXCSR_ALREADY_EXITED = 1 << 0;
     static constexpr size_t FORCE_RETURN = 1 << 1;
+    static constexpr u32 UNCACHEABLE_BIT = 1; // Entrypoints are always aligned.
     std::array<const void*, 4> return_from_run_code;
     void GenRunCode();
 
@@ -135,6 +212,9 @@ private:
         ~ExceptionHandler();
 
         void Register(BlockOfCode* code);
+
+        bool SupportsFastmem() const;
+        void SetFastmemCallback(std::function<boost::optional<FakeCall>(u64)> cb);
     private:
         struct Impl;
         std::unique_ptr<Impl> impl;
@@ -142,6 +222,8 @@ private:
     ExceptionHandler exception_handler;
 
     Xbyak::util::Cpu cpu_info;
+    const bool has_cmpxchg16b;
+    const bool baseline_host_features_only;
 };
 
 } // namespace BackendX64
@@ -5,6 +5,7 @@
  */
 
 #include <unordered_set>
+#include <vector>
 
 #include <boost/icl/interval_map.hpp>
 #include <boost/icl/interval_set.hpp>
@@ -40,6 +41,30 @@ std::unordered_set<IR::LocationDescriptor> BlockRangeInformation<ProgramCounterT
     return erase_locations;
 }
 
+template <typename ProgramCounterType>
+void BlockRangeInformation<ProgramCounterType>::RemoveLocations(const std::unordered_set<IR::LocationDescriptor>& locations) {
+    if (locations.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<boost::icl::discrete_interval<ProgramCounterType>, std::set<IR::LocationDescriptor>>> to_remove;
+    for (const auto& segment : block_ranges) {
+        std::set<IR::LocationDescriptor> removed;
+        for (const auto& descriptor : segment.second) {
+            if (locations.count(descriptor)) {
+                removed.insert(descriptor);
+            }
+        }
+        if (!removed.empty()) {
+            to_remove.emplace_back(segment.first, std::move(removed));
+        }
+    }
+
+    for (const auto& pair : to_remove) {
+        block_ranges.subtract(pair);
+    }
+}
+
 template class BlockRangeInformation<u32>;
 template class BlockRangeInformation<u64>;
 
@@ -54,5 +54,29 @@ void ArgCallback::EmitCall(BlockOfCode* code, std::function<void(Xbyak::Reg64, X
     code->CallFunction(fn);
 }
 
+void JitStateArgCallback::EmitCall(BlockOfCode* code, std::function<void()> l) {
+    l();
+    code->mov(code->ABI_PARAM1, code->qword[code->r15 + offset]);
+    code->CallFunction(fn);
+}
+
+void JitStateArgCallback::EmitCall(BlockOfCode* code, std::function<void(Xbyak::Reg64)> l) {
+    l(code->ABI_PARAM2);
+    code->mov(code->ABI_PARAM1, code->qword[code->r15 + offset]);
+    code->CallFunction(fn);
+}
+
+void JitStateArgCallback::EmitCall(BlockOfCode* code, std::function<void(Xbyak::Reg64, Xbyak::Reg64)> l) {
+    l(code->ABI_PARAM2, code->ABI_PARAM3);
+    code->mov(code->ABI_PARAM1, code->qword[code->r15 + offset]);
+    code->CallFunction(fn);
+}
+
+void JitStateArgCallback::EmitCall(BlockOfCode* code, std::function<void(Xbyak::Reg64, Xbyak::Reg64, Xbyak::Reg64)> l) {
+    l(code->ABI_PARAM2, code->ABI_PARAM3, code->ABI_PARAM4);
+    code->mov(code->ABI_PARAM1, code->qword[code->r15 + offset]);
+    code->CallFunction(fn);
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
@@ -60,5 +60,23 @@ private:
     u64 arg;
 };
 
+/// Passes as the first argument the pointer stored at offset within the jit state (in r15) at the time of the call.
+class JitStateArgCallback final : public Callback {
+public:
+    template <typename Function>
+    JitStateArgCallback(Function fn, size_t offset) : fn(reinterpret_cast<void(*)()>(fn)), offset(offset) {}
+
+    ~JitStateArgCallback() = default;
+
+    void EmitCall(BlockOfCode* code, std::function<void()> l = []{}) override;
+    void EmitCall(BlockOfCode* code, std::function<void(Xbyak::Reg64)> l) override;
+    void EmitCall(BlockOfCode* code, std::function<void(Xbyak::Reg64, Xbyak::Reg64)> l) override;
+    void EmitCall(BlockOfCode* code, std::function<void(Xbyak::Reg64, Xbyak::Reg64, Xbyak::Reg64)> l) override;
+
+private:
+    void (*fn)();
+    size_t offset;
+};
+
 } // namespace BackendX64
 } // namespace Dynarmic
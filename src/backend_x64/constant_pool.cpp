@@ -14,22 +14,43 @@ namespace Dynarmic {
 namespace BackendX64 {
 
 ConstantPool::ConstantPool(BlockOfCode* code, size_t size) : code(code), pool_size(size) {
+    ASSERT(size > reserved_size);
     code->int3();
     code->align(align_size);
     pool_begin = reinterpret_cast<u8*>(code->AllocateFromCodeSpace(size));
-    std::memset(pool_begin, 0, size);
     current_pool_ptr = pool_begin;
 }
 
-Xbyak::Address ConstantPool::GetConstant(u64 constant) {
-    auto iter = constant_info.find(constant);
-    if (iter == constant_info.end()) {
-        ASSERT(static_cast<size_t>(current_pool_ptr - pool_begin) < pool_size);
-        std::memcpy(current_pool_ptr, &constant, sizeof(u64));
-        iter = constant_info.emplace(constant, current_pool_ptr).first;
-        current_pool_ptr += align_size;
+Xbyak::Address ConstantPool::GetConstant(u64 lower, u64 upper) {
+    const auto iter = constant_info.find(std::make_pair(lower, upper));
+    if (iter != constant_info.end()) {
+        return code->xword[code->rip + iter->second];
     }
-    return code->xword[code->rip + iter->second];
+
+    ASSERT(static_cast<size_t>(current_pool_ptr - pool_begin) < pool_size);
+    return AddConstant(lower, upper);
+}
+
+boost::optional<Xbyak::Address> ConstantPool::TryGetConstant(u64 lower, u64 upper) {
+    const auto iter = constant_info.find(std::make_pair(lower, upper));
+    if (iter != constant_info.end()) {
+        return code->xword[code->rip + iter->second];
+    }
+
+    if (static_cast<size_t>(current_pool_ptr - pool_begin) >= pool_size - reserved_size) {
+        return boost::none;
+    }
+    return AddConstant(lower, upper);
+}
+
+Xbyak::Address ConstantPool::AddConstant(u64 lower, u64 upper) {
+    std::memcpy(current_pool_ptr, &lower, sizeof(u64));
+    std::memcpy(current_pool_ptr + sizeof(u64), &upper, sizeof(u64));
+    constant_info.emplace(std::make_pair(lower, upper), current_pool_ptr);
+
+    const Xbyak::Address address = code->xword[code->rip + current_pool_ptr];
+    current_pool_ptr += align_size;
+    return address;
 }
 
 } // namespace BackendX64
@@ -7,7 +7,9 @@
 #pragma once
 
 #include <map>
+#include <utility>
 
+#include <boost/optional.hpp>
 #include <xbyak.h>
 
 #include "common/common_types.h"
@@ -21,16 +23,24 @@ class BlockOfCode;
 /// It places constants into this block of memory, returning the address
 /// of the memory location where the constant is placed. If the constant
 /// already exists, its memory location is reused.
+/// Each entry is 128 bits wide so that vector constants can be loaded with a single aligned move.
 class ConstantPool final {
 public:
     ConstantPool(BlockOfCode* code, size_t size);
 
-    Xbyak::Address GetConstant(u64 constant);
+    /// Returns the location of the constant. The pool must not be full.
+    Xbyak::Address GetConstant(u64 lower, u64 upper = 0);
+    /// As GetConstant, but returns nothing rather than add a new constant once the pool is nearly full.
+    /// Space is held back for GetConstant, which is only used for the bounded set of constants the emitter itself needs.
+    boost::optional<Xbyak::Address> TryGetConstant(u64 lower, u64 upper = 0);
 
 private:
     static constexpr size_t align_size = 16; // bytes
+    static constexpr size_t reserved_size = 16 * 1024; // bytes
 
-    std::map<u64, void*> constant_info;
+    Xbyak::Address AddConstant(u64 lower, u64 upper);
+
+    std::map<std::pair<u64, u64>, void*> constant_info;
 
     BlockOfCode* code;
     size_t pool_size;
@@ -36,5 +36,13 @@ ArgCallback Devirtualize(mp::class_type_t<decltype(mfp)>* this_) {
 
 #define DEVIRT(this_, mfp) Dynarmic::BackendX64::Devirtualize<decltype(mfp), mfp>(this_)
 
+/// As Devirtualize, but calls mfp on the object pointed to by the jit state at offset when the call is made.
+template <typename FunctionType, FunctionType mfp>
+JitStateArgCallback DevirtualizeJitStateMember(size_t offset) {
+    return JitStateArgCallback{&impl::ThunkBuilder<FunctionType, mfp>::Thunk, offset};
+}
+
+#define DEVIRT_JIT_STATE(offset, mfp) Dynarmic::BackendX64::DevirtualizeJitStateMember<decltype(mfp), mfp>(offset)
+
 } // namespace BackendX64
 } // namespace Dynarmic
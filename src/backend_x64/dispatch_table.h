@@ -0,0 +1,41 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+/// The dispatcher probes this table before falling back to looking up a block (See: BlockOfCode::GenRunCode).
+/// It is direct-mapped and indexed by a multiplicative hash of the unique hash of the location.
+/// Each Jit owns its own table, as entries are written by the dispatcher without synchronisation.
+struct DispatchTable {
+    struct Entry {
+        u64 location_descriptor;
+        const void* code_ptr;
+    };
+
+    static constexpr size_t Bits = 12;
+    static constexpr size_t Size = size_t(1) << Bits;
+
+    DispatchTable() { Clear(); }
+
+    /// Empties the table. Call when previously emitted blocks become invalid.
+    void Clear() {
+        // No location has a unique hash of all ones.
+        entries.fill(Entry{0xFFFFFFFFFFFFFFFFull, nullptr});
+    }
+
+    std::array<Entry, Size> entries;
+};
+
+} // namespace BackendX64
+} // namespace Dynarmic
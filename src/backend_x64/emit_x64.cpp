@@ -4,6 +4,8 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
+#include <cinttypes>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -275,6 +277,8 @@ void EmitX64::EmitTerminal(IR::Terminal terminal, IR::LocationDescriptor initial
 }
 
 void EmitX64::Patch(const IR::LocationDescriptor& desc, CodePtr bb) {
+    // If other threads may be executing the patched code, this is called with emission_mutex held,
+    // and the patch functions only change each location with a single aligned store.
     const CodePtr save_code_ptr = code->getCurr();
     const PatchInformation& patch_info = patch_information[desc];
 
@@ -300,9 +304,41 @@ void EmitX64::Unpatch(const IR::LocationDescriptor& desc) {
     Patch(desc, nullptr);
 }
 
+void EmitX64::RegisterFastmemAccess(CodePtr location, CodePtr callback) {
+    constexpr size_t call_size = 5;
+    const size_t access_size = static_cast<size_t>(code->getCurr<const u8*>() - static_cast<const u8*>(location));
+    const size_t size = std::max(call_size, access_size);
+    code->EnsurePatchLocationSize(location, size);
+    fastmem_patch_table.Insert(reinterpret_cast<u64>(location), FastmemPatchInfo{callback, code->getCurr(), size});
+}
+
+boost::optional<FakeCall> EmitX64::FastmemCallback(u64 rip) {
+    const auto info = fastmem_patch_table.Lookup(rip);
+    if (!info) {
+        // Not a fastmem access, e.g. a page table access to host memory the embedder has protected.
+        return boost::none;
+    }
+
+    if (emission_mutex) {
+        // Other threads may be executing this access, so it is not patched.
+        return FakeCall{reinterpret_cast<u64>(info->callback), reinterpret_cast<u64>(info->resume_rip)};
+    }
+
+    // Future executions of this access go directly to the fallback.
+    const CodePtr location = reinterpret_cast<CodePtr>(rip);
+    const CodePtr save_code_ptr = code->getCurr();
+    code->SetCodePtr(location);
+    code->call(info->callback);
+    code->EnsurePatchLocationSize(location, info->size);
+    code->SetCodePtr(save_code_ptr);
+
+    return FakeCall{reinterpret_cast<u64>(info->callback), reinterpret_cast<u64>(info->resume_rip)};
+}
+
 void EmitX64::ClearCache() {
     block_descriptors.clear();
     patch_information.clear();
+    fastmem_patch_table.Clear();
 }
 
 void EmitX64::InvalidateBasicBlocks(const std::unordered_set<IR::LocationDescriptor>& locations) {
@@ -319,5 +355,32 @@ void EmitX64::InvalidateBasicBlocks(const std::unordered_set<IR::LocationDescrip
     }
 }
 
+std::unordered_set<IR::LocationDescriptor> EmitX64::InvalidateCodeRegion(const CodeRegion& region) {
+    // Links from within the region are about to be overwritten, so they must never be patched again.
+    for (auto& patch_entry : patch_information) {
+        PatchInformation& patch_info = patch_entry.second;
+        const auto in_region = [&region](CodePtr location) { return region.Contains(location); };
+        patch_info.jg.erase(std::remove_if(patch_info.jg.begin(), patch_info.jg.end(), in_region), patch_info.jg.end());
+        patch_info.jmp.erase(std::remove_if(patch_info.jmp.begin(), patch_info.jmp.end(), in_region), patch_info.jmp.end());
+        patch_info.mov_rcx.erase(std::remove_if(patch_info.mov_rcx.begin(), patch_info.mov_rcx.end(), in_region), patch_info.mov_rcx.end());
+    }
+
+    fastmem_patch_table.EraseIf([&region](u64 location) { return region.Contains(reinterpret_cast<CodePtr>(location)); });
+
+    // Links into the region are unpatched so that they return to the dispatcher.
+    std::unordered_set<IR::LocationDescriptor> evicted;
+    for (const auto& block : block_descriptors) {
+        if (region.Contains(block.second.entrypoint)) {
+            evicted.insert(block.first);
+        }
+    }
+    InvalidateBasicBlocks(evicted);
+    return evicted;
+}
+
+void EmitX64::EnableConcurrentExecution(std::mutex& mutex) {
+    emission_mutex = &mutex;
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
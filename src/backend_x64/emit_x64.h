@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -14,6 +15,7 @@
 
 #include <xbyak_util.h>
 
+#include "backend_x64/fastmem_patch_table.h"
 #include "backend_x64/reg_alloc.h"
 #include "common/address_range.h"
 #include "frontend/ir/location_descriptor.h"
@@ -62,6 +64,19 @@ public:
     /// Invalidates a selection of basic blocks.
     void InvalidateBasicBlocks(const std::unordered_set<IR::LocationDescriptor>& locations);
 
+    /// Invalidates all basic blocks emitted within region, and forgets all references to code within it.
+    /// Returns the locations of the evicted blocks.
+    std::unordered_set<IR::LocationDescriptor> InvalidateCodeRegion(const CodeRegion& region);
+
+    /**
+     * Allows emitted code to be executed by other threads while further code is emitted.
+     * Code which has already been emitted is then no longer modified when new blocks are emitted or when
+     * fastmem accesses fault; it is only modified by invalidation, which the caller must perform while no
+     * thread is executing emitted code.
+     * @param emission_mutex Must be held whenever this emitter is used.
+     */
+    void EnableConcurrentExecution(std::mutex& emission_mutex);
+
 protected:
     // Microinstruction emitters
 #define OPCODE(name, type, ...) void Emit##name(EmitContext& ctx, IR::Inst* inst);
@@ -101,10 +116,19 @@ protected:
     virtual void EmitPatchJmp(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr = nullptr) = 0;
     virtual void EmitPatchMovRcx(CodePtr target_code_ptr = nullptr) = 0;
 
+    // Fastmem
+    /// Registers the host memory access emitted from location up to the current code pointer as a fastmem access.
+    void RegisterFastmemAccess(CodePtr location, CodePtr callback);
+    /// Called by the exception handler when code within the code block faults. Must be async-signal-safe.
+    /// If rip is a fastmem access, patches the access into a call to its fallback. Returns boost::none otherwise.
+    boost::optional<FakeCall> FastmemCallback(u64 rip);
+
     // State
     BlockOfCode* code;
     std::unordered_map<IR::LocationDescriptor, BlockDescriptor> block_descriptors;
     std::unordered_map<IR::LocationDescriptor, PatchInformation> patch_information;
+    FastmemPatchTable fastmem_patch_table;
+    std::mutex* emission_mutex = nullptr; ///< Non-null if emitted code may be executed concurrently with emission.
 };
 
 } // namespace BackendX64
@@ -0,0 +1,143 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "backend_x64/abi.h"
+#include "backend_x64/block_of_code.h"
+#include "backend_x64/emit_x64.h"
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "common/crc32.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+using namespace Xbyak::util;
+
+static void EmitCRC32Castagnoli(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, const int data_size) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        const Xbyak::Reg32 crc = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
+        const Xbyak::Reg value = ctx.reg_alloc.UseGpr(args[1]).changeBit(data_size);
+
+        if (data_size == 64) {
+            code->crc32(crc.cvt64(), value);
+        } else {
+            code->crc32(crc, value);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, crc);
+        return;
+    }
+
+    ctx.reg_alloc.HostCall(inst, args[0], args[1]);
+    code->mov(code->ABI_PARAM3, data_size / 8);
+    code->CallFunction(&Common::ComputeCRC32Castagnoli);
+}
+
+/**
+ * Reduces the 32-bit polynomial in tmp modulo the reflected ISO polynomial (0xEDB88320) using
+ * Barrett reduction with carry-less multiplication. The result is XORed into crc.
+ * This is equivalent to computing the CRC of tmp with an initial value of zero.
+ */
+static void EmitCRC32ISOBarrettReduction(BlockOfCode* code, Xbyak::Reg32 crc, Xbyak::Reg32 tmp, Xbyak::Xmm xmm) {
+    code->movd(xmm, tmp);
+    code->pclmulqdq(xmm, code->MConst(0x00000001F7011641), 0b00000000); // mu
+    code->psllq(xmm, 32);
+    code->pclmulqdq(xmm, code->MConst(0x00000001DB710641), 0b00000000); // P(x)
+    code->psrldq(xmm, 8);
+    code->movd(tmp, xmm);
+    code->xor_(crc, tmp);
+}
+
+static void EmitCRC32ISO(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, const int data_size) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tPCLMULQDQ)) {
+        const Xbyak::Reg32 crc = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
+        const Xbyak::Reg64 value = ctx.reg_alloc.UseScratchGpr(args[1]);
+        const Xbyak::Xmm xmm = ctx.reg_alloc.ScratchXmm();
+
+        switch (data_size) {
+        case 8:
+        case 16:
+            // crc' = (crc >> n) ^ reduce(((crc ^ value) mod x^n) << (32 - n))
+            code->xor_(value.cvt32(), crc);
+            if (data_size == 8) {
+                code->movzx(value.cvt32(), value.cvt8());
+            } else {
+                code->movzx(value.cvt32(), value.cvt16());
+            }
+            code->shl(value.cvt32(), 32 - data_size);
+            code->shr(crc, data_size);
+            EmitCRC32ISOBarrettReduction(code, crc, value.cvt32(), xmm);
+            break;
+        case 32:
+            code->xor_(value.cvt32(), crc);
+            code->xor_(crc, crc);
+            EmitCRC32ISOBarrettReduction(code, crc, value.cvt32(), xmm);
+            break;
+        case 64: {
+            const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+            code->mov(tmp.cvt32(), value.cvt32());
+            code->xor_(tmp.cvt32(), crc);
+            code->xor_(crc, crc);
+            EmitCRC32ISOBarrettReduction(code, crc, tmp.cvt32(), xmm);
+            code->shr(value, 32);
+            code->xor_(value.cvt32(), crc);
+            code->xor_(crc, crc);
+            EmitCRC32ISOBarrettReduction(code, crc, value.cvt32(), xmm);
+            break;
+        }
+        default:
+            UNREACHABLE();
+        }
+
+        ctx.reg_alloc.DefineValue(inst, crc);
+        return;
+    }
+
+    ctx.reg_alloc.HostCall(inst, args[0], args[1]);
+    code->mov(code->ABI_PARAM3, data_size / 8);
+    code->CallFunction(&Common::ComputeCRC32ISO);
+}
+
+void EmitX64::EmitCRC32Castagnoli8(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32Castagnoli(code, ctx, inst, 8);
+}
+
+void EmitX64::EmitCRC32Castagnoli16(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32Castagnoli(code, ctx, inst, 16);
+}
+
+void EmitX64::EmitCRC32Castagnoli32(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32Castagnoli(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitCRC32Castagnoli64(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32Castagnoli(code, ctx, inst, 64);
+}
+
+void EmitX64::EmitCRC32ISO8(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32ISO(code, ctx, inst, 8);
+}
+
+void EmitX64::EmitCRC32ISO16(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32ISO(code, ctx, inst, 16);
+}
+
+void EmitX64::EmitCRC32ISO32(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32ISO(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitCRC32ISO64(EmitContext& ctx, IR::Inst* inst) {
+    EmitCRC32ISO(code, ctx, inst, 64);
+}
+
+} // namespace BackendX64
+} // namespace Dynarmic
@@ -0,0 +1,256 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "backend_x64/block_of_code.h"
+#include "backend_x64/emit_x64.h"
+#include "backend_x64/emit_x64_fallback.h"
+#include "common/aes.h"
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "common/sha.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+using namespace Xbyak::util;
+
+void EmitX64::EmitAESDecryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        code->pxor(zero, zero);
+        code->aesdeclast(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    EmitVectorFallback<1>(code, ctx, inst, &Common::AES::DecryptSingleRound);
+}
+
+void EmitX64::EmitAESEncryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        code->pxor(zero, zero);
+        code->aesenclast(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    EmitVectorFallback<1>(code, ctx, inst, &Common::AES::EncryptSingleRound);
+}
+
+void EmitX64::EmitAESInverseMixColumns(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        code->aesimc(data, data);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    EmitVectorFallback<1>(code, ctx, inst, &Common::AES::InverseMixColumns);
+}
+
+void EmitX64::EmitAESMixColumns(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        // There is no standalone MixColumns instruction. Undo the ShiftRows and SubBytes steps that aesenc
+        // performs (these two steps commute) so that only its MixColumns step remains.
+        code->pxor(zero, zero);
+        code->aesdeclast(data, zero);
+        code->aesenc(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    EmitVectorFallback<1>(code, ctx, inst, &Common::AES::MixColumns);
+}
+
+/**
+ * sha1rnds4 stores the state and message words in the opposite element order to AArch64,
+ * adds the round constant itself, and expects e to be pre-added to the first message word.
+ * We compensate for all three so that the AArch64 convention of including K in w is kept.
+ */
+static void EmitSHA1HashUpdate(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, u8 function, u32 round_constant) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseScratchXmm(args[2]);
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code->pshufd(tmp, code->MConst(u64(round_constant) << 32 | round_constant), 0b01000100);
+    code->psubd(w, tmp);
+    code->pshufd(w, w, 0b00011011);
+    code->pslldq(y, 12);
+    code->paddd(w, y);
+    code->pshufd(x, x, 0b00011011);
+    code->sha1rnds4(x, w, function);
+    code->pshufd(x, x, 0b00011011);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+void EmitX64::EmitSHA1HashUpdateChoose(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        EmitSHA1HashUpdate(code, ctx, inst, 0, 0x5A827999);
+        return;
+    }
+
+    EmitVectorFallback<3>(code, ctx, inst, &Common::SHA::SHA1HashUpdateChoose);
+}
+
+void EmitX64::EmitSHA1HashUpdateMajority(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        EmitSHA1HashUpdate(code, ctx, inst, 2, 0x8F1BBCDC);
+        return;
+    }
+
+    EmitVectorFallback<3>(code, ctx, inst, &Common::SHA::SHA1HashUpdateMajority);
+}
+
+void EmitX64::EmitSHA1HashUpdateParity(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        EmitSHA1HashUpdate(code, ctx, inst, 1, 0x6ED9EBA1);
+        return;
+    }
+
+    EmitVectorFallback<3>(code, ctx, inst, &Common::SHA::SHA1HashUpdateParity);
+}
+
+void EmitX64::EmitSHA1MessageSchedule0(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm c = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    // result = (b<63:0> : a<127:64>) ^ a ^ c
+    code->movaps(result, a);
+    code->shufpd(result, b, 0b01);
+    code->pxor(result, a);
+    code->pxor(result, c);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitSHA1MessageSchedule1(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+
+        code->pshufd(a, a, 0b00011011);
+        code->pshufd(b, b, 0b00011011);
+        code->sha1msg2(a, b);
+        code->pshufd(a, a, 0b00011011);
+
+        ctx.reg_alloc.DefineValue(inst, a);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, &Common::SHA::SHA1MessageSchedule1);
+}
+
+/**
+ * sha256rnds2 performs two rounds on a state split into {A, B, E, F} and {C, D, G, H},
+ * taking the two message words from xmm0. AArch64 instead splits the state into
+ * {A, B, C, D} and {E, F, G, H}, so we shuffle between the two representations.
+ */
+static void EmitSHA256Hash(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, bool part1) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ctx.reg_alloc.ScratchXmm({HostLoc::XMM0});
+    const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm abef = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm cdgh = ctx.reg_alloc.ScratchXmm();
+
+    code->movaps(xmm0, w);
+    code->movaps(abef, y);
+    code->shufps(abef, x, 0b00010001);
+    code->movaps(cdgh, y);
+    code->shufps(cdgh, x, 0b10111011);
+
+    code->sha256rnds2(cdgh, abef);
+    code->pshufd(xmm0, xmm0, 0b00001110);
+    code->sha256rnds2(abef, cdgh);
+
+    code->shufps(abef, cdgh, part1 ? 0b10111011 : 0b00010001);
+
+    ctx.reg_alloc.DefineValue(inst, abef);
+}
+
+void EmitX64::EmitSHA256HashPart1(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        EmitSHA256Hash(code, ctx, inst, true);
+        return;
+    }
+
+    EmitVectorFallback<3>(code, ctx, inst, &Common::SHA::SHA256HashPart1);
+}
+
+void EmitX64::EmitSHA256HashPart2(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        EmitSHA256Hash(code, ctx, inst, false);
+        return;
+    }
+
+    EmitVectorFallback<3>(code, ctx, inst, &Common::SHA::SHA256HashPart2);
+}
+
+void EmitX64::EmitSHA256MessageSchedule0(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+
+        code->sha256msg1(a, b);
+
+        ctx.reg_alloc.DefineValue(inst, a);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, &Common::SHA::SHA256MessageSchedule0);
+}
+
+void EmitX64::EmitSHA256MessageSchedule1(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSHA)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm c = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        // a += c<31:0> : b<127:32>
+        code->movaps(tmp, c);
+        code->palignr(tmp, b, 4);
+        code->paddd(a, tmp);
+        code->sha256msg2(a, c);
+
+        ctx.reg_alloc.DefineValue(inst, a);
+        return;
+    }
+
+    EmitVectorFallback<3>(code, ctx, inst, &Common::SHA::SHA256MessageSchedule1);
+}
+
+} // namespace BackendX64
+} // namespace Dynarmic
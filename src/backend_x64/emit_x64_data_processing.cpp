@@ -7,6 +7,7 @@
 #include "backend_x64/block_of_code.h"
 #include "backend_x64/emit_x64.h"
 #include "common/assert.h"
+#include "common/bit_util.h"
 #include "common/common_types.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/microinstruction.h"
@@ -177,6 +178,39 @@ void EmitX64::EmitConditionalSelect64(EmitContext& ctx, IR::Inst* inst) {
     EmitConditionalSelect(code, ctx, inst, 64);
 }
 
+void EmitX64::EmitConditionalSelectNZCV(EmitContext& ctx, IR::Inst* inst) {
+    EmitConditionalSelect(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitNZCVFromPackedFlags(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (args[0].IsImmediate()) {
+        Xbyak::Reg32 nzcv = ctx.reg_alloc.ScratchGpr().cvt32();
+        u32 value = 0;
+        value |= Common::Bit<31>(args[0].GetImmediateU32()) ? (1 << 15) : 0;
+        value |= Common::Bit<30>(args[0].GetImmediateU32()) ? (1 << 14) : 0;
+        value |= Common::Bit<29>(args[0].GetImmediateU32()) ? (1 << 8) : 0;
+        value |= Common::Bit<28>(args[0].GetImmediateU32()) ? (1 << 0) : 0;
+        code->mov(nzcv, value);
+        ctx.reg_alloc.DefineValue(inst, nzcv);
+    } else {
+        Xbyak::Reg32 nzcv = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
+        code->shr(nzcv, 28);
+        if (code->DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+            Xbyak::Reg32 tmp = ctx.reg_alloc.ScratchGpr().cvt32();
+            code->mov(tmp, 0b11000001'00000001);
+            code->pdep(nzcv, nzcv, tmp);
+        } else {
+            // Spreads N, Z, C and V to bits 15, 14, 8 and 0 respectively.
+            // The other copies left in bits 9 to 13 only correspond to PF, AF and reserved flags in AH.
+            code->imul(nzcv, nzcv, 0b00010000'10000001);
+            code->and_(nzcv.cvt8(), 1);
+        }
+        ctx.reg_alloc.DefineValue(inst, nzcv);
+    }
+}
+
 void EmitX64::EmitLogicalShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
     auto carry_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
 
@@ -878,6 +912,101 @@ void EmitX64::EmitMul64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+// ARM defines division by zero to return zero, and the signed overflow case (INT_MIN / -1)
+// to return INT_MIN. Both of these would raise #DE on x64, so they are handled explicitly.
+
+void EmitX64::EmitUnsignedDiv32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.ScratchGpr({HostLoc::RAX});
+    ctx.reg_alloc.ScratchGpr({HostLoc::RDX});
+    Xbyak::Reg32 dividend = ctx.reg_alloc.UseGpr(args[0]).cvt32();
+    Xbyak::Reg32 divisor = ctx.reg_alloc.UseGpr(args[1]).cvt32();
+
+    Xbyak::Label end;
+
+    code->xor_(eax, eax);
+    code->test(divisor, divisor);
+    code->jz(end);
+    code->mov(eax, dividend);
+    code->xor_(edx, edx);
+    code->div(divisor);
+    code->L(end);
+
+    ctx.reg_alloc.DefineValue(inst, eax);
+}
+
+void EmitX64::EmitUnsignedDiv64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.ScratchGpr({HostLoc::RAX});
+    ctx.reg_alloc.ScratchGpr({HostLoc::RDX});
+    Xbyak::Reg64 dividend = ctx.reg_alloc.UseGpr(args[0]);
+    Xbyak::Reg64 divisor = ctx.reg_alloc.UseGpr(args[1]);
+
+    Xbyak::Label end;
+
+    code->xor_(eax, eax);
+    code->test(divisor, divisor);
+    code->jz(end);
+    code->mov(rax, dividend);
+    code->xor_(edx, edx);
+    code->div(divisor);
+    code->L(end);
+
+    ctx.reg_alloc.DefineValue(inst, rax);
+}
+
+void EmitX64::EmitSignedDiv32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.ScratchGpr({HostLoc::RAX});
+    ctx.reg_alloc.ScratchGpr({HostLoc::RDX});
+    Xbyak::Reg32 dividend = ctx.reg_alloc.UseGpr(args[0]).cvt32();
+    Xbyak::Reg64 divisor = ctx.reg_alloc.UseScratchGpr(args[1]);
+
+    Xbyak::Label end;
+
+    // Performing the division at 64 bits avoids the INT32_MIN / -1 overflow entirely.
+    code->xor_(eax, eax);
+    code->test(divisor.cvt32(), divisor.cvt32());
+    code->jz(end);
+    code->movsxd(divisor, divisor.cvt32());
+    code->movsxd(rax, dividend);
+    code->cqo();
+    code->idiv(divisor);
+    code->L(end);
+
+    ctx.reg_alloc.DefineValue(inst, eax);
+}
+
+void EmitX64::EmitSignedDiv64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ctx.reg_alloc.ScratchGpr({HostLoc::RAX});
+    ctx.reg_alloc.ScratchGpr({HostLoc::RDX});
+    Xbyak::Reg64 dividend = ctx.reg_alloc.UseGpr(args[0]);
+    Xbyak::Reg64 divisor = ctx.reg_alloc.UseGpr(args[1]);
+
+    Xbyak::Label not_minus_one, end;
+
+    code->xor_(eax, eax);
+    code->test(divisor, divisor);
+    code->jz(end);
+    code->mov(rax, dividend);
+    code->cmp(divisor, -1);
+    code->jne(not_minus_one);
+    // x / -1 == -x, and negation of INT64_MIN wraps to INT64_MIN as required.
+    code->neg(rax);
+    code->jmp(end);
+    code->L(not_minus_one);
+    code->cqo();
+    code->idiv(divisor);
+    code->L(end);
+
+    ctx.reg_alloc.DefineValue(inst, rax);
+}
+
 void EmitX64::EmitAnd32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -1090,6 +1219,24 @@ void EmitX64::EmitZeroExtendWordToLong(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void EmitX64::EmitZeroExtendLongToQuad(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    if (args[0].IsImmediate()) {
+        Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        code->LoadConstant(result, args[0].GetImmediateU64());
+        ctx.reg_alloc.DefineValue(inst, result);
+    } else if (args[0].IsInGpr()) {
+        Xbyak::Reg64 source = ctx.reg_alloc.UseGpr(args[0]);
+        Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        code->movq(result, source);
+        ctx.reg_alloc.DefineValue(inst, result);
+    } else {
+        Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+        code->movq(result, result);
+        ctx.reg_alloc.DefineValue(inst, result);
+    }
+}
+
 void EmitX64::EmitByteReverseWord(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     Xbyak::Reg32 result = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
@@ -0,0 +1,77 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <xbyak.h>
+
+#include "backend_x64/abi.h"
+#include "backend_x64/block_of_code.h"
+#include "backend_x64/emit_x64.h"
+#include "common/common_types.h"
+#include "frontend/ir/microinstruction.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+template <typename T>
+using VectorArray = std::array<T, 16 / sizeof(T)>;
+
+/**
+ * Calls fn(result, operands..., immediates...) for operations that have no reasonable SSE lowering.
+ * The result and each 128-bit operand are passed by pointer to stack slots; immediates are passed by value.
+ * This ends the allocation scope, so all other registers must already have been allocated.
+ * The result is returned in xmm0. The return value of fn, if any, is left in ABI_RETURN.
+ */
+template <size_t num_operands, typename Function, typename... Immediates>
+Xbyak::Xmm EmitFallbackCall(BlockOfCode* code, EmitContext& ctx, const std::array<Xbyak::Xmm, num_operands>& operands, Function fn, Immediates... immediates) {
+    static_assert(num_operands + 1 + sizeof...(Immediates) <= 4, "Too many arguments");
+
+    constexpr size_t stack_space = (num_operands + 1) * 16;
+    const std::array<Xbyak::Reg64, 4> params = {code->ABI_PARAM1, code->ABI_PARAM2, code->ABI_PARAM3, code->ABI_PARAM4};
+
+    code->sub(code->rsp, stack_space + ABI_SHADOW_SPACE);
+    for (size_t i = 0; i < num_operands; i++) {
+        code->movups(code->xword[code->rsp + ABI_SHADOW_SPACE + (i + 1) * 16], operands[i]);
+    }
+
+    ctx.reg_alloc.EndOfAllocScope();
+    ctx.reg_alloc.HostCall(nullptr);
+
+    for (size_t i = 0; i <= num_operands; i++) {
+        code->lea(params[i], code->ptr[code->rsp + ABI_SHADOW_SPACE + i * 16]);
+    }
+    const std::array<u64, sizeof...(Immediates)> immediate_values{{static_cast<u64>(immediates)...}};
+    for (size_t i = 0; i < immediate_values.size(); i++) {
+        code->mov(params[num_operands + 1 + i], immediate_values[i]);
+    }
+    // Unary plus converts captureless lambdas to the function pointer CallFunction requires.
+    code->CallFunction(+fn);
+
+    code->movups(code->xmm0, code->xword[code->rsp + ABI_SHADOW_SPACE]);
+    code->add(code->rsp, stack_space + ABI_SHADOW_SPACE);
+
+    return code->xmm0;
+}
+
+/// Calls fn(result, args...) for an instruction whose arguments and result are all 128-bit values.
+template <size_t num_args, typename Function>
+void EmitVectorFallback(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, Function fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    std::array<Xbyak::Xmm, num_args> operands;
+    for (size_t i = 0; i < num_args; i++) {
+        operands[i] = ctx.reg_alloc.UseXmm(args[i]);
+    }
+
+    const Xbyak::Xmm result = EmitFallbackCall(code, ctx, operands, fn);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+} // namespace BackendX64
+} // namespace Dynarmic
@@ -4,10 +4,19 @@
  * General Public License version 2 or any later version.
  */
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "backend_x64/abi.h"
 #include "backend_x64/block_of_code.h"
 #include "backend_x64/emit_x64.h"
+#include "backend_x64/emit_x64_fallback.h"
 #include "common/assert.h"
 #include "common/common_types.h"
+#include "common/fp_rounding_mode.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/microinstruction.h"
 #include "frontend/ir/opcodes.h"
@@ -29,6 +38,13 @@ constexpr u64 f64_penultimate_positive_denormal = 0x000ffffffffffffeu;
 constexpr u64 f64_min_s32 = 0xc1e0000000000000u; // -2147483648 as a double
 constexpr u64 f64_max_s32 = 0x41dfffffffc00000u; // 2147483647 as a double
 constexpr u64 f64_min_u32 = 0x0000000000000000u; // 0 as a double
+constexpr u64 f64_max_u32 = 0x41efffffffe00000u; // 4294967295 as a double
+constexpr u64 f64_min_s64 = 0xc3e0000000000000u; // -2^63 as a double
+constexpr u64 f64_min_u64 = 0x0000000000000000u; // 0 as a double
+constexpr u64 f64_2_pow_63 = 0x43e0000000000000u; // 2^63 as a double (smallest value above the s64 range)
+constexpr u64 f64_2_pow_64 = 0x43f0000000000000u; // 2^64 as a double (smallest value above the u64 range)
+constexpr u64 f64_half = 0x3fe0000000000000u;
+constexpr u64 f64_one = 0x3ff0000000000000u;
 
 static void DenormalsAreZero32(BlockOfCode* code, Xbyak::Xmm xmm_value, Xbyak::Reg32 gpr_scratch) {
     Xbyak::Label end;
@@ -257,6 +273,127 @@ void EmitX64::EmitFPDiv64(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp64(code, ctx, inst, &Xbyak::CodeGenerator::divsd);
 }
 
+static void FPMinMax(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t fsize, bool is_max, bool is_numeric) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm operand = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Reg64 gpr_scratch = ctx.reg_alloc.ScratchGpr();
+
+    const auto ucomis = fsize == 32 ? &Xbyak::CodeGenerator::ucomiss : &Xbyak::CodeGenerator::ucomisd;
+
+    if (ctx.FPSCR_FTZ()) {
+        if (fsize == 32) {
+            DenormalsAreZero32(code, result, gpr_scratch.cvt32());
+            DenormalsAreZero32(code, operand, gpr_scratch.cvt32());
+        } else {
+            DenormalsAreZero64(code, result, gpr_scratch);
+            DenormalsAreZero64(code, operand, gpr_scratch);
+        }
+    }
+
+    if (is_numeric) {
+        // A quiet NaN paired with a number is ignored in favour of the number.
+        Xbyak::Label normal, result_is_nan;
+        const int quiet_bit = fsize == 32 ? 22 : 51;
+
+        (code->*ucomis)(result, operand);
+        code->jnp(normal);
+        (code->*ucomis)(result, result);
+        code->jp(result_is_nan);
+        code->movq(gpr_scratch, operand);
+        code->bt(gpr_scratch, quiet_bit);
+        code->jnc(normal);
+        code->movaps(operand, result);
+        code->jmp(normal);
+        code->L(result_is_nan);
+        (code->*ucomis)(operand, operand);
+        code->jp(normal);
+        code->movq(gpr_scratch, result);
+        code->bt(gpr_scratch, quiet_bit);
+        code->jnc(normal);
+        code->movaps(result, operand);
+        code->L(normal);
+    }
+
+    Xbyak::Label equal, nan, end;
+
+    (code->*ucomis)(result, operand);
+    code->jz(equal);
+    if (fsize == 32) {
+        if (is_max) {
+            code->maxss(result, operand);
+        } else {
+            code->minss(result, operand);
+        }
+    } else {
+        if (is_max) {
+            code->maxsd(result, operand);
+        } else {
+            code->minsd(result, operand);
+        }
+    }
+    code->jmp(end);
+    code->L(equal);
+    code->jp(nan);
+    // The operands are equal, so only the signs of zeros can differ: max(+0, -0) is +0 and min(+0, -0) is -0.
+    if (is_max) {
+        code->andps(result, operand);
+    } else {
+        code->orps(result, operand);
+    }
+    code->jmp(end);
+    code->L(nan);
+    if (fsize == 32) {
+        code->addss(result, operand);
+    } else {
+        code->addsd(result, operand);
+    }
+    code->L(end);
+
+    if (ctx.FPSCR_DN()) {
+        if (fsize == 32) {
+            DefaultNaN32(code, result);
+        } else {
+            DefaultNaN64(code, result);
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPMax32(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 32, true, false);
+}
+
+void EmitX64::EmitFPMax64(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 64, true, false);
+}
+
+void EmitX64::EmitFPMaxNumeric32(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 32, true, true);
+}
+
+void EmitX64::EmitFPMaxNumeric64(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 64, true, true);
+}
+
+void EmitX64::EmitFPMin32(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 32, false, false);
+}
+
+void EmitX64::EmitFPMin64(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 64, false, false);
+}
+
+void EmitX64::EmitFPMinNumeric32(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 32, false, true);
+}
+
+void EmitX64::EmitFPMinNumeric64(EmitContext& ctx, IR::Inst* inst) {
+    FPMinMax(code, ctx, inst, 64, false, true);
+}
+
 void EmitX64::EmitFPMul32(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp32(code, ctx, inst, &Xbyak::CodeGenerator::mulss);
 }
@@ -265,6 +402,183 @@ void EmitX64::EmitFPMul64(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp64(code, ctx, inst, &Xbyak::CodeGenerator::mulsd);
 }
 
+/// Selects the NaN that ARM returns from a fused multiply-add whose result is a NaN.
+template <typename FPT>
+static FPT FPMulAddNaN(FPT addend, FPT op1, FPT op2) {
+    using UT = std::conditional_t<sizeof(FPT) == 8, u64, u32>;
+    constexpr UT quiet_bit = UT(1) << (std::numeric_limits<FPT>::digits - 2);
+
+    const auto is_signalling = [&](FPT value) {
+        UT bits;
+        std::memcpy(&bits, &value, sizeof(UT));
+        return std::isnan(value) && (bits & quiet_bit) == 0;
+    };
+    const auto quieten = [&](FPT value) {
+        UT bits;
+        std::memcpy(&bits, &value, sizeof(UT));
+        bits |= quiet_bit;
+        std::memcpy(&value, &bits, sizeof(UT));
+        return value;
+    };
+
+    const bool product_is_invalid = (std::isinf(op1) && op2 == 0) || (op1 == 0 && std::isinf(op2));
+    if (std::isnan(addend) && !is_signalling(addend) && product_is_invalid) {
+        return std::numeric_limits<FPT>::quiet_NaN();
+    }
+    for (FPT value : {addend, op1, op2}) {
+        if (is_signalling(value)) {
+            return quieten(value);
+        }
+    }
+    for (FPT value : {addend, op1, op2}) {
+        if (std::isnan(value)) {
+            return value;
+        }
+    }
+    return std::numeric_limits<FPT>::quiet_NaN();
+}
+
+template <typename FPT, size_t num_elements, bool ftz, bool dn>
+static u32 FPMulAddFallback(FPT* addend_and_result, const FPT* op1, const FPT* op2) {
+    u32 cumulative_flags = 0;
+
+    const auto flush_input = [&](FPT value) {
+        if (ftz && std::fpclassify(value) == FP_SUBNORMAL) {
+            cumulative_flags |= 1 << 7; // IDC
+            return std::copysign(FPT(0), value);
+        }
+        return value;
+    };
+
+    for (size_t i = 0; i < num_elements; i++) {
+        const FPT addend = flush_input(addend_and_result[i]);
+        const FPT a = flush_input(op1[i]);
+        const FPT b = flush_input(op2[i]);
+
+        // std::fma is correctly rounded in the current (guest) rounding mode.
+        FPT result = std::fma(a, b, addend);
+
+        if (ftz && std::fpclassify(result) == FP_SUBNORMAL) {
+            cumulative_flags |= 1 << 3; // UFC
+            result = std::copysign(FPT(0), result);
+        }
+        if (std::isnan(result)) {
+            result = dn ? std::numeric_limits<FPT>::quiet_NaN() : FPMulAddNaN(addend, a, b);
+        }
+
+        addend_and_result[i] = result;
+    }
+
+    return cumulative_flags;
+}
+
+/// Computes addend + op1 * op2 with a single rounding on hosts without FMA3.
+template <typename FPT, size_t num_elements>
+static void EmitFPMulAddFallback(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst) {
+    using FallbackFn = u32(*)(FPT*, const FPT*, const FPT*);
+    const FallbackFn fallback = [&]() -> FallbackFn {
+        if (ctx.FPSCR_FTZ()) {
+            return ctx.FPSCR_DN() ? &FPMulAddFallback<FPT, num_elements, true, true> : &FPMulAddFallback<FPT, num_elements, true, false>;
+        }
+        return ctx.FPSCR_DN() ? &FPMulAddFallback<FPT, num_elements, false, true> : &FPMulAddFallback<FPT, num_elements, false, false>;
+    }();
+
+    constexpr size_t stack_space = 3 * 16;
+    constexpr size_t addend_offset = ABI_SHADOW_SPACE + 0 * 16;
+    constexpr size_t op1_offset = ABI_SHADOW_SPACE + 1 * 16;
+    constexpr size_t op2_offset = ABI_SHADOW_SPACE + 2 * 16;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm addend = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm op1 = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm op2 = ctx.reg_alloc.UseXmm(args[2]);
+
+    code->sub(rsp, stack_space + ABI_SHADOW_SPACE);
+    code->movups(code->xword[rsp + addend_offset], addend);
+    code->movups(code->xword[rsp + op1_offset], op1);
+    code->movups(code->xword[rsp + op2_offset], op2);
+
+    ctx.reg_alloc.EndOfAllocScope();
+    ctx.reg_alloc.HostCall(nullptr);
+
+    code->lea(code->ABI_PARAM1, ptr[rsp + addend_offset]);
+    code->lea(code->ABI_PARAM2, ptr[rsp + op1_offset]);
+    code->lea(code->ABI_PARAM3, ptr[rsp + op2_offset]);
+    code->CallFunction(fallback);
+
+    if (ctx.FPSCR_FTZ()) {
+        // ABI_PARAM1 is no longer required.
+        code->mov(code->ABI_PARAM1.cvt32(), code->ABI_RETURN.cvt32());
+        code->and_(code->ABI_RETURN.cvt32(), u32(1 << 7));
+        code->or_(dword[r15 + code->GetJitStateInfo().offsetof_FPSCR_IDC], code->ABI_RETURN.cvt32());
+        code->and_(code->ABI_PARAM1.cvt32(), u32(1 << 3));
+        code->or_(dword[r15 + code->GetJitStateInfo().offsetof_FPSCR_UFC], code->ABI_PARAM1.cvt32());
+    }
+
+    code->movups(xmm0, code->xword[rsp + addend_offset]);
+    code->add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    ctx.reg_alloc.DefineValue(inst, xmm0);
+}
+
+void EmitX64::EmitFPMulAdd32(EmitContext& ctx, IR::Inst* inst) {
+    if (!code->DoesCpuSupport(Xbyak::util::Cpu::tFMA)) {
+        EmitFPMulAddFallback<float, 1>(code, ctx, inst);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm operand1 = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm operand2 = ctx.reg_alloc.UseScratchXmm(args[2]);
+    Xbyak::Reg32 gpr_scratch = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    if (ctx.FPSCR_FTZ()) {
+        DenormalsAreZero32(code, result, gpr_scratch);
+        DenormalsAreZero32(code, operand1, gpr_scratch);
+        DenormalsAreZero32(code, operand2, gpr_scratch);
+    }
+    code->vfmadd231ss(result, operand1, operand2);
+    if (ctx.FPSCR_FTZ()) {
+        FlushToZero32(code, result, gpr_scratch);
+    }
+    if (ctx.FPSCR_DN()) {
+        DefaultNaN32(code, result);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPMulAdd64(EmitContext& ctx, IR::Inst* inst) {
+    if (!code->DoesCpuSupport(Xbyak::util::Cpu::tFMA)) {
+        EmitFPMulAddFallback<double, 1>(code, ctx, inst);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm operand1 = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm operand2 = ctx.reg_alloc.UseScratchXmm(args[2]);
+    Xbyak::Reg64 gpr_scratch = ctx.reg_alloc.ScratchGpr();
+
+    if (ctx.FPSCR_FTZ()) {
+        DenormalsAreZero64(code, result, gpr_scratch);
+        DenormalsAreZero64(code, operand1, gpr_scratch);
+        DenormalsAreZero64(code, operand2, gpr_scratch);
+    }
+    code->vfmadd231sd(result, operand1, operand2);
+    if (ctx.FPSCR_FTZ()) {
+        FlushToZero64(code, result, gpr_scratch);
+    }
+    if (ctx.FPSCR_DN()) {
+        DefaultNaN64(code, result);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitX64::EmitFPSqrt32(EmitContext& ctx, IR::Inst* inst) {
     FPTwoOp32(code, ctx, inst, &Xbyak::CodeGenerator::sqrtss);
 }
@@ -281,23 +595,30 @@ void EmitX64::EmitFPSub64(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp64(code, ctx, inst, &Xbyak::CodeGenerator::subsd);
 }
 
-static void SetFpscrNzcvFromFlags(BlockOfCode* code, EmitContext& ctx) {
-    ctx.reg_alloc.ScratchGpr({HostLoc::RCX}); // shifting requires use of cl
-    Xbyak::Reg32 nzcv = ctx.reg_alloc.ScratchGpr().cvt32();
-
-    code->mov(nzcv, 0x28630000);
+static void NZCVFromComparisonFlags(BlockOfCode* code, Xbyak::Reg64 nzcv) {
+    // The result of a comparison is one of greater than, less than, equal or unordered.
+    // Each of the 16-bit fields of this constant is the NZCV for one of those results, in the same format as
+    // GetNZCVFromOp. They are indexed by {ZF, CF}: (0, 0) is greater than, (0, 1) is less than,
+    // (1, 0) is equal and (1, 1) is unordered.
+    code->mov(nzcv, 0x0101'4100'8000'0100);
     code->sete(cl);
-    code->rcl(cl, 3);
-    code->shl(nzcv, cl);
-    code->and_(nzcv, 0xF0000000);
-    code->mov(dword[r15 + code->GetJitStateInfo().offsetof_FPSCR_nzcv], nzcv);
+    code->rcl(cl, 5); // cl = (ZF << 5) | (CF << 4)
+    code->shr(nzcv, cl);
+    code->movzx(nzcv.cvt32(), nzcv.cvt16());
 }
 
 void EmitX64::EmitFPCompare32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    Xbyak::Xmm reg_a = ctx.reg_alloc.UseXmm(args[0]);
-    Xbyak::Xmm reg_b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm reg_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm reg_b = ctx.reg_alloc.UseScratchXmm(args[1]);
     bool exc_on_qnan = args[2].GetImmediateU1();
+    ctx.reg_alloc.ScratchGpr({HostLoc::RCX}); // shifting requires use of cl
+    Xbyak::Reg64 nzcv = ctx.reg_alloc.ScratchGpr();
+
+    if (ctx.FPSCR_FTZ()) {
+        DenormalsAreZero32(code, reg_a, nzcv.cvt32());
+        DenormalsAreZero32(code, reg_b, nzcv.cvt32());
+    }
 
     if (exc_on_qnan) {
         code->comiss(reg_a, reg_b);
@@ -305,14 +626,22 @@ void EmitX64::EmitFPCompare32(EmitContext& ctx, IR::Inst* inst) {
         code->ucomiss(reg_a, reg_b);
     }
 
-    SetFpscrNzcvFromFlags(code, ctx);
+    NZCVFromComparisonFlags(code, nzcv);
+    ctx.reg_alloc.DefineValue(inst, nzcv);
 }
 
 void EmitX64::EmitFPCompare64(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    Xbyak::Xmm reg_a = ctx.reg_alloc.UseXmm(args[0]);
-    Xbyak::Xmm reg_b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm reg_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm reg_b = ctx.reg_alloc.UseScratchXmm(args[1]);
     bool exc_on_qnan = args[2].GetImmediateU1();
+    ctx.reg_alloc.ScratchGpr({HostLoc::RCX}); // shifting requires use of cl
+    Xbyak::Reg64 nzcv = ctx.reg_alloc.ScratchGpr();
+
+    if (ctx.FPSCR_FTZ()) {
+        DenormalsAreZero64(code, reg_a, nzcv);
+        DenormalsAreZero64(code, reg_b, nzcv);
+    }
 
     if (exc_on_qnan) {
         code->comisd(reg_a, reg_b);
@@ -320,7 +649,8 @@ void EmitX64::EmitFPCompare64(EmitContext& ctx, IR::Inst* inst) {
         code->ucomisd(reg_a, reg_b);
     }
 
-    SetFpscrNzcvFromFlags(code, ctx);
+    NZCVFromComparisonFlags(code, nzcv);
+    ctx.reg_alloc.DefineValue(inst, nzcv);
 }
 
 void EmitX64::EmitFPSingleToDouble(EmitContext& ctx, IR::Inst* inst) {
@@ -548,6 +878,226 @@ void EmitX64::EmitFPDoubleToU32(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, to);
 }
 
+/// Rounds and saturates on hosts without SSE4.1 (which are unable to use ROUNDSD for explicit rounding modes).
+template <typename FPT, bool unsigned_, size_t isize>
+static u64 FPToFixed(u64 input, u64 fbits, u64 rounding) {
+    FPT input_fpt;
+    std::memcpy(&input_fpt, &input, sizeof(FPT));
+
+    // Conversion to double is lossless, and scaling by a power of two is exact.
+    double value = static_cast<double>(input_fpt);
+    if (std::isnan(value)) {
+        return 0;
+    }
+    value = std::ldexp(value, static_cast<int>(fbits));
+
+    // These are implemented without relying upon the current host rounding mode.
+    switch (static_cast<FP::RoundingMode>(rounding)) {
+    case FP::RoundingMode::ToNearest_TieEven: {
+        const double floor = std::floor(value);
+        const double fraction = value - floor;
+        if (fraction > 0.5 || (fraction == 0.5 && std::fmod(floor, 2.0) != 0.0)) {
+            value = floor + 1.0;
+        } else {
+            value = floor;
+        }
+        break;
+    }
+    case FP::RoundingMode::TowardsPlusInfinity:
+        value = std::ceil(value);
+        break;
+    case FP::RoundingMode::TowardsMinusInfinity:
+        value = std::floor(value);
+        break;
+    case FP::RoundingMode::TowardsZero:
+        value = std::trunc(value);
+        break;
+    case FP::RoundingMode::ToNearest_TieAwayFromZero: {
+        const double truncated = std::trunc(value);
+        if (std::fabs(value - truncated) >= 0.5) {
+            value = truncated + std::copysign(1.0, value);
+        } else {
+            value = truncated;
+        }
+        break;
+    }
+    }
+
+    // ARM saturates on conversion.
+    constexpr size_t value_bits = unsigned_ ? isize : isize - 1;
+    const double min_value = unsigned_ ? 0.0 : -std::ldexp(1.0, value_bits);
+    const double max_value_exclusive = std::ldexp(1.0, value_bits);
+    constexpr u64 max_result = ~u64(0) >> (64 - value_bits);
+
+    if (value >= max_value_exclusive) {
+        return max_result;
+    }
+    if (value < min_value) {
+        value = min_value;
+    }
+    if constexpr (unsigned_) {
+        return static_cast<u64>(value);
+    } else {
+        return static_cast<u64>(static_cast<s64>(value)) & (~u64(0) >> (64 - isize));
+    }
+}
+
+/// Converts the lowest element of operand into the lowest element of result.
+template <typename FPT, bool unsigned_, size_t isize>
+static void FPToFixedFallback(VectorArray<u64>& result, const VectorArray<u64>& operand, u64 fbits, u64 rounding) {
+    result = {FPToFixed<FPT, unsigned_, isize>(operand[0], fbits, rounding), 0};
+}
+
+template <size_t fsize, bool unsigned_, size_t isize>
+static void EmitFPToFixed(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst) {
+    using FPT = std::conditional_t<fsize == 64, double, float>;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const size_t fbits = args[1].GetImmediateU8();
+    const auto rounding = static_cast<FP::RoundingMode>(args[2].GetImmediateU8());
+
+    Xbyak::Xmm src = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+
+    if (ctx.FPSCR_FTZ()) {
+        if constexpr (fsize == 64) {
+            DenormalsAreZero64(code, src, result);
+        } else {
+            DenormalsAreZero32(code, src, result.cvt32());
+        }
+    }
+
+    if (rounding != FP::RoundingMode::TowardsZero && !code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        const Xbyak::Xmm fallback_result = EmitFallbackCall<1>(code, ctx, {src}, &FPToFixedFallback<FPT, unsigned_, isize>, fbits, rounding);
+        ctx.reg_alloc.DefineValue(inst, fallback_result);
+        return;
+    }
+
+    Xbyak::Xmm xmm_scratch = ctx.reg_alloc.ScratchXmm();
+
+    // ARM saturates on conversion; this differs from x64 which returns a sentinel value.
+    // Conversion to double is lossless, and allows for clamping.
+    if constexpr (fsize == 32) {
+        code->cvtss2sd(src, src);
+    }
+    ZeroIfNaN64(code, src, xmm_scratch);
+    if (fbits != 0) {
+        const u64 scale_factor = static_cast<u64>(fbits + 1023) << 52; // 2^fbits as a double
+        code->mulsd(src, code->MConst(scale_factor));
+    }
+
+    // Round to an integer first so that the final conversion (which truncates) is exact.
+    switch (rounding) {
+    case FP::RoundingMode::ToNearest_TieEven:
+        code->roundsd(src, src, 0b00);
+        break;
+    case FP::RoundingMode::TowardsMinusInfinity:
+        code->roundsd(src, src, 0b01);
+        break;
+    case FP::RoundingMode::TowardsPlusInfinity:
+        code->roundsd(src, src, 0b10);
+        break;
+    case FP::RoundingMode::TowardsZero:
+        break;
+    case FP::RoundingMode::ToNearest_TieAwayFromZero: {
+        // x64 has no such rounding mode: truncate, then step away from zero if the discarded fraction is at least a half.
+        // The truncated value has the same sign as the original value.
+        Xbyak::Xmm xmm_sign = ctx.reg_alloc.ScratchXmm();
+        code->movaps(xmm_scratch, src);
+        code->roundsd(src, src, 0b11);
+        code->subsd(xmm_scratch, src);
+        code->andps(xmm_scratch, code->MConst(f64_non_sign_mask));
+        code->cmpnltsd(xmm_scratch, code->MConst(f64_half));
+        code->andps(xmm_scratch, code->MConst(f64_one));
+        code->movaps(xmm_sign, src);
+        code->andps(xmm_sign, code->MConst(f64_negative_zero));
+        code->orps(xmm_scratch, xmm_sign);
+        code->addsd(src, xmm_scratch);
+        break;
+    }
+    default:
+        UNREACHABLE();
+    }
+
+    if constexpr (!unsigned_ && isize == 32) {
+        code->minsd(src, code->MConst(f64_max_s32));
+        code->maxsd(src, code->MConst(f64_min_s32));
+        code->cvttsd2si(result.cvt32(), src);
+    } else if constexpr (unsigned_ && isize == 32) {
+        code->maxsd(src, code->MConst(f64_min_u32));
+        code->minsd(src, code->MConst(f64_max_u32));
+        code->cvttsd2si(result, src); // 64 bit gpr
+    } else if constexpr (!unsigned_ && isize == 64) {
+        Xbyak::Reg64 gpr_mask = ctx.reg_alloc.ScratchGpr();
+
+        // Values of 2^63 and above produce the sentinel 0x8000000000000000, which we invert to saturate.
+        code->maxsd(src, code->MConst(f64_min_s64));
+        code->movaps(xmm_scratch, code->MConst(f64_2_pow_63));
+        code->cmplesd(xmm_scratch, src);
+        code->cvttsd2si(result, src);
+        code->movq(gpr_mask, xmm_scratch);
+        code->xor_(result, gpr_mask);
+    } else if (code->DoesCpuSupport(Xbyak::util::Cpu::tAVX512F)) {
+        // Negative values have already been clamped, and values of 2^64 and above produce the saturated sentinel.
+        code->maxsd(src, code->MConst(f64_min_u64));
+        code->vcvttsd2usi(result, src);
+    } else {
+        Xbyak::Reg64 gpr_scratch = ctx.reg_alloc.ScratchGpr();
+        Xbyak::Reg64 gpr_mask = ctx.reg_alloc.ScratchGpr();
+
+        // Since SSE2 doesn't provide an unsigned conversion, we shift the range as appropriate.
+        // Values of 2^63 and above produce the sentinel 0x8000000000000000, in which case we OR in (value - 2^63).
+        code->maxsd(src, code->MConst(f64_min_u64));
+        code->movaps(xmm_scratch, src);
+        code->subsd(xmm_scratch, code->MConst(f64_2_pow_63));
+        code->cvttsd2si(result, src);
+        code->cvttsd2si(gpr_scratch, xmm_scratch);
+        code->mov(gpr_mask, result);
+        code->sar(gpr_mask, 63);
+        code->and_(gpr_mask, gpr_scratch);
+        code->or_(result, gpr_mask);
+        // Saturate values of 2^64 and above.
+        code->movaps(xmm_scratch, code->MConst(f64_2_pow_64));
+        code->cmplesd(xmm_scratch, src);
+        code->movq(gpr_mask, xmm_scratch);
+        code->or_(result, gpr_mask);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPDoubleToFixedS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<64, false, 32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPDoubleToFixedS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<64, false, 64>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPDoubleToFixedU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<64, true, 32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPDoubleToFixedU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<64, true, 64>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPSingleToFixedS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<32, false, 32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPSingleToFixedS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<32, false, 64>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPSingleToFixedU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<32, true, 32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPSingleToFixedU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPToFixed<32, true, 64>(code, ctx, inst);
+}
+
 void EmitX64::EmitFPS32ToSingle(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     Xbyak::Reg32 from = ctx.reg_alloc.UseGpr(args[0]).cvt32();
@@ -600,5 +1150,485 @@ void EmitX64::EmitFPU32ToDouble(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, to);
 }
 
+void EmitX64::EmitFPS64ToSingle(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Reg64 from = ctx.reg_alloc.UseGpr(args[0]);
+    Xbyak::Xmm to = ctx.reg_alloc.ScratchXmm();
+    bool round_to_nearest = args[1].GetImmediateU1();
+    ASSERT_MSG(!round_to_nearest, "round_to_nearest unimplemented");
+
+    code->cvtsi2ss(to, from);
+
+    ctx.reg_alloc.DefineValue(inst, to);
+}
+
+void EmitX64::EmitFPS64ToDouble(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Reg64 from = ctx.reg_alloc.UseGpr(args[0]);
+    Xbyak::Xmm to = ctx.reg_alloc.ScratchXmm();
+    bool round_to_nearest = args[1].GetImmediateU1();
+    ASSERT_MSG(!round_to_nearest, "round_to_nearest unimplemented");
+
+    code->cvtsi2sd(to, from);
+
+    ctx.reg_alloc.DefineValue(inst, to);
+}
+
+template <size_t fsize>
+static void EmitFPU64ToFloat(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    bool round_to_nearest = args[1].GetImmediateU1();
+    ASSERT_MSG(!round_to_nearest, "round_to_nearest unimplemented");
+
+    const auto convert = [code](Xbyak::Xmm to, Xbyak::Reg64 from) {
+        if constexpr (fsize == 32) {
+            code->cvtsi2ss(to, from);
+        } else {
+            code->cvtsi2sd(to, from);
+        }
+    };
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tAVX512F)) {
+        Xbyak::Reg64 from = ctx.reg_alloc.UseGpr(args[0]);
+        Xbyak::Xmm to = ctx.reg_alloc.ScratchXmm();
+
+        if constexpr (fsize == 32) {
+            code->vcvtusi2ss(to, to, from);
+        } else {
+            code->vcvtusi2sd(to, to, from);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, to);
+        return;
+    }
+
+    Xbyak::Reg64 from = ctx.reg_alloc.UseScratchGpr(args[0]);
+    Xbyak::Reg64 gpr_scratch = ctx.reg_alloc.ScratchGpr();
+    Xbyak::Xmm to = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Label large, end;
+
+    // Since SSE2 doesn't provide an unsigned conversion, values of 2^63 and above are halved before
+    // conversion and doubled afterwards. The discarded bit is kept sticky so that rounding is unaffected.
+    code->test(from, from);
+    code->js(large);
+    convert(to, from);
+    code->jmp(end);
+    code->L(large);
+    code->mov(gpr_scratch.cvt32(), from.cvt32());
+    code->and_(gpr_scratch.cvt32(), 1);
+    code->shr(from, 1);
+    code->or_(from, gpr_scratch);
+    convert(to, from);
+    if constexpr (fsize == 32) {
+        code->addss(to, to);
+    } else {
+        code->addsd(to, to);
+    }
+    code->L(end);
+
+    ctx.reg_alloc.DefineValue(inst, to);
+}
+
+void EmitX64::EmitFPU64ToSingle(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPU64ToFloat<32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPU64ToDouble(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPU64ToFloat<64>(code, ctx, inst);
+}
+
+/// Loads the per-lane constant (~0 << left) >> right with a single load from the constant pool.
+template <size_t fsize>
+static void VectorShiftedOnes(BlockOfCode* code, Xbyak::Xmm dest, int left, int right) {
+    const u64 lane_mask = fsize == 32 ? 0xFFFFFFFF : 0xFFFFFFFFFFFFFFFF;
+    const u64 lane = ((lane_mask << left) & lane_mask) >> right;
+    const u64 constant = fsize == 32 ? (lane << 32) | lane : lane;
+    code->movaps(dest, code->MConst(constant, constant));
+}
+
+template <size_t fsize>
+static void VectorNonSignMask(BlockOfCode* code, Xbyak::Xmm dest) {
+    VectorShiftedOnes<fsize>(code, dest, 0, 1);
+}
+
+template <size_t fsize>
+static void VectorDefaultNaNConstant(BlockOfCode* code, Xbyak::Xmm dest) {
+    VectorShiftedOnes<fsize>(code, dest, fsize == 32 ? 23 : 52, 1);
+}
+
+/// Sets each lane of xmm_mask to all ones if the corresponding lane of xmm_value is a NaN.
+template <size_t fsize>
+static void VectorNaNMask(BlockOfCode* code, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_value) {
+    code->movaps(xmm_mask, xmm_value);
+    if constexpr (fsize == 32) {
+        code->cmpunordps(xmm_mask, xmm_mask);
+    } else {
+        code->cmpunordpd(xmm_mask, xmm_mask);
+    }
+}
+
+/// Sets each lane of xmm_mask to all ones if the quiet bit of the corresponding lane of xmm_value is set.
+template <size_t fsize>
+static void VectorQuietBitMask(BlockOfCode* code, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_value) {
+    code->movaps(xmm_mask, xmm_value);
+    if constexpr (fsize == 32) {
+        code->pslld(xmm_mask, 9);
+        code->psrad(xmm_mask, 31);
+    } else {
+        code->psllq(xmm_mask, 12);
+        code->psrad(xmm_mask, 31);
+        code->pshufd(xmm_mask, xmm_mask, 0b11110101);
+    }
+}
+
+/// Sets each lane of xmm_mask to all ones if the corresponding lane of xmm_value is a denormal.
+template <size_t fsize>
+static void VectorDenormalMask(BlockOfCode* code, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_value, Xbyak::Xmm xmm_scratch) {
+    // |value| - 1 is below the largest denormal exactly when value is a denormal (zero wraps around to a NaN).
+    // This relies on the host not treating denormals as zero, as MXCSR.DAZ is never set.
+    VectorNonSignMask<fsize>(code, xmm_scratch);
+    code->movaps(xmm_mask, xmm_value);
+    code->andps(xmm_mask, xmm_scratch);
+    VectorShiftedOnes<fsize>(code, xmm_scratch, 0, fsize - 1);
+    if constexpr (fsize == 32) {
+        code->psubd(xmm_mask, xmm_scratch);
+        VectorShiftedOnes<fsize>(code, xmm_scratch, 0, 9);
+        code->cmpltps(xmm_mask, xmm_scratch);
+    } else {
+        code->psubq(xmm_mask, xmm_scratch);
+        VectorShiftedOnes<fsize>(code, xmm_scratch, 0, 12);
+        code->cmpltpd(xmm_mask, xmm_scratch);
+    }
+}
+
+/// Sets the given cumulative flag if any lane of xmm_mask is set, without branching.
+template <size_t fsize>
+static void VectorSetFlagIfAnyLane(BlockOfCode* code, Xbyak::Xmm xmm_mask, Xbyak::Reg32 gpr_scratch, size_t flag_offset, u32 flag) {
+    if constexpr (fsize == 32) {
+        code->movmskps(gpr_scratch, xmm_mask);
+    } else {
+        code->movmskpd(gpr_scratch, xmm_mask);
+    }
+    code->neg(gpr_scratch); // Sets CF if any lane was set
+    code->sbb(gpr_scratch, gpr_scratch);
+    code->and_(gpr_scratch, flag);
+    code->or_(dword[r15 + flag_offset], gpr_scratch);
+}
+
+template <size_t fsize>
+static void VectorFlushDenormals(BlockOfCode* code, Xbyak::Xmm xmm_value, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_scratch, Xbyak::Reg32 gpr_scratch, size_t flag_offset, u32 flag) {
+    VectorDenormalMask<fsize>(code, xmm_mask, xmm_value, xmm_scratch);
+    VectorSetFlagIfAnyLane<fsize>(code, xmm_mask, gpr_scratch, flag_offset, flag);
+    // Only the sign bit of a denormal lane is kept.
+    VectorNonSignMask<fsize>(code, xmm_scratch);
+    code->andps(xmm_mask, xmm_scratch);
+    code->andnps(xmm_mask, xmm_value);
+    code->movaps(xmm_value, xmm_mask);
+}
+
+template <size_t fsize>
+static void VectorDenormalsAreZero(BlockOfCode* code, Xbyak::Xmm xmm_value, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_scratch, Xbyak::Reg32 gpr_scratch) {
+    VectorFlushDenormals<fsize>(code, xmm_value, xmm_mask, xmm_scratch, gpr_scratch, code->GetJitStateInfo().offsetof_FPSCR_IDC, 1 << 7);
+}
+
+template <size_t fsize>
+static void VectorFlushToZero(BlockOfCode* code, Xbyak::Xmm xmm_value, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_scratch, Xbyak::Reg32 gpr_scratch) {
+    VectorFlushDenormals<fsize>(code, xmm_value, xmm_mask, xmm_scratch, gpr_scratch, code->GetJitStateInfo().offsetof_FPSCR_UFC, 1 << 3);
+}
+
+template <size_t fsize>
+static void VectorDefaultNaN(BlockOfCode* code, Xbyak::Xmm xmm_value, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_scratch) {
+    VectorNaNMask<fsize>(code, xmm_mask, xmm_value);
+    VectorDefaultNaNConstant<fsize>(code, xmm_scratch);
+    code->andps(xmm_scratch, xmm_mask);
+    code->andnps(xmm_mask, xmm_value);
+    code->orps(xmm_mask, xmm_scratch);
+    code->movaps(xmm_value, xmm_mask);
+}
+
+/// Replaces each lane of dest with the corresponding lane of src where xmm_mask is set.
+static void VectorBlend(BlockOfCode* code, Xbyak::Xmm dest, Xbyak::Xmm src, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_scratch) {
+    code->movaps(xmm_scratch, src);
+    code->xorps(xmm_scratch, dest);
+    code->andps(xmm_scratch, xmm_mask);
+    code->xorps(dest, xmm_scratch);
+}
+
+/// Sets each lane of xmm_mask to all ones if the corresponding lane of xmm_value is an infinity.
+template <size_t fsize>
+static void VectorInfinityMask(BlockOfCode* code, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_value, Xbyak::Xmm xmm_scratch) {
+    VectorNonSignMask<fsize>(code, xmm_scratch);
+    code->movaps(xmm_mask, xmm_value);
+    code->andps(xmm_mask, xmm_scratch);
+    VectorShiftedOnes<fsize>(code, xmm_scratch, fsize == 32 ? 24 : 53, 1);
+    if constexpr (fsize == 32) {
+        code->cmpeqps(xmm_mask, xmm_scratch);
+    } else {
+        code->cmpeqpd(xmm_mask, xmm_scratch);
+    }
+}
+
+/// Sets each lane of xmm_mask to all ones if the corresponding lane of xmm_value is a zero.
+template <size_t fsize>
+static void VectorZeroMask(BlockOfCode* code, Xbyak::Xmm xmm_mask, Xbyak::Xmm xmm_value) {
+    code->xorps(xmm_mask, xmm_mask);
+    if constexpr (fsize == 32) {
+        code->cmpeqps(xmm_mask, xmm_value);
+    } else {
+        code->cmpeqpd(xmm_mask, xmm_value);
+    }
+}
+
+/**
+ * Flushes denormal results and replaces NaN results as ARM would.
+ *
+ * With FPCR.DN set every NaN becomes the default NaN. Otherwise, as x64 differs from ARM in its choice of NaN,
+ * a NaN result is replaced with the first signalling NaN operand (quietened), else the first quiet NaN operand,
+ * else the default NaN. For a fused multiply-add a quiet NaN addend does not propagate if the product is invalid.
+ * The fixup is done for all lanes at once and out of line, as NaNs are expected to be rare.
+ */
+template <size_t fsize>
+static void EmitFPVectorPostProcess(BlockOfCode* code, EmitContext& ctx, Xbyak::Xmm result, const std::vector<Xbyak::Xmm>& operands, bool is_muladd) {
+    Xbyak::Xmm xmm_nan = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm xmm_scratch = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Reg32 gpr_scratch = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    if (ctx.FPSCR_FTZ()) {
+        VectorFlushToZero<fsize>(code, result, xmm_nan, xmm_scratch, gpr_scratch);
+    }
+
+    if (ctx.FPSCR_DN()) {
+        VectorDefaultNaN<fsize>(code, result, xmm_nan, xmm_scratch);
+        return;
+    }
+
+    Xbyak::Xmm xmm_selected = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm xmm_lane = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm xmm_quiet = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm xmm_extra = is_muladd ? ctx.reg_alloc.ScratchXmm() : xmm_scratch;
+    Xbyak::Label nan, end;
+
+    VectorNaNMask<fsize>(code, xmm_nan, result);
+    if constexpr (fsize == 32) {
+        code->movmskps(gpr_scratch, xmm_nan);
+    } else {
+        code->movmskpd(gpr_scratch, xmm_nan);
+    }
+    code->test(gpr_scratch, gpr_scratch);
+    code->jnz(nan, Xbyak::CodeGenerator::T_NEAR);
+    code->L(end);
+
+    code->SwitchToFarCode();
+    code->L(nan);
+
+    // Operands are considered in reverse so that earlier operands take priority.
+    VectorDefaultNaNConstant<fsize>(code, xmm_selected);
+    for (auto iter = operands.rbegin(); iter != operands.rend(); ++iter) {
+        VectorNaNMask<fsize>(code, xmm_lane, *iter);
+        VectorBlend(code, xmm_selected, *iter, xmm_lane, xmm_scratch);
+    }
+    for (auto iter = operands.rbegin(); iter != operands.rend(); ++iter) {
+        VectorNaNMask<fsize>(code, xmm_lane, *iter);
+        VectorQuietBitMask<fsize>(code, xmm_quiet, *iter);
+        code->andnps(xmm_quiet, xmm_lane);
+        VectorBlend(code, xmm_selected, *iter, xmm_quiet, xmm_scratch);
+    }
+    VectorShiftedOnes<fsize>(code, xmm_scratch, fsize - 1, fsize == 32 ? 9 : 12);
+    code->orps(xmm_selected, xmm_scratch);
+
+    if (is_muladd) {
+        const Xbyak::Xmm addend = operands[0];
+        const Xbyak::Xmm op1 = operands[1];
+        const Xbyak::Xmm op2 = operands[2];
+
+        // The product is invalid if one factor is an infinity and the other is a zero.
+        VectorNaNMask<fsize>(code, xmm_lane, addend);
+        VectorQuietBitMask<fsize>(code, xmm_quiet, addend);
+        code->andps(xmm_lane, xmm_quiet);
+        VectorInfinityMask<fsize>(code, xmm_quiet, op1, xmm_scratch);
+        VectorInfinityMask<fsize>(code, xmm_extra, op2, xmm_scratch);
+        code->orps(xmm_quiet, xmm_extra);
+        code->andps(xmm_lane, xmm_quiet);
+        VectorZeroMask<fsize>(code, xmm_quiet, op1);
+        VectorZeroMask<fsize>(code, xmm_extra, op2);
+        code->orps(xmm_quiet, xmm_extra);
+        code->andps(xmm_lane, xmm_quiet);
+        VectorDefaultNaNConstant<fsize>(code, xmm_quiet);
+        VectorBlend(code, xmm_selected, xmm_quiet, xmm_lane, xmm_scratch);
+    }
+
+    VectorBlend(code, result, xmm_selected, xmm_nan, xmm_scratch);
+    code->jmp(end, Xbyak::CodeGenerator::T_NEAR);
+    code->SwitchToNearCode();
+}
+
+template <size_t fsize>
+static void EmitFPVectorTwoOp(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, void (Xbyak::CodeGenerator::*fn)(const Xbyak::Xmm&, const Xbyak::Operand&)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm operand = ctx.FPSCR_FTZ() ? ctx.reg_alloc.UseScratchXmm(args[0]) : ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    if (ctx.FPSCR_FTZ()) {
+        Xbyak::Xmm xmm_mask = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Xmm xmm_scratch = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Reg32 gpr_scratch = ctx.reg_alloc.ScratchGpr().cvt32();
+        VectorDenormalsAreZero<fsize>(code, operand, xmm_mask, xmm_scratch, gpr_scratch);
+    }
+    (code->*fn)(result, operand);
+    EmitFPVectorPostProcess<fsize>(code, ctx, result, {operand}, false);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template <size_t fsize>
+static void EmitFPVectorThreeOp(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, void (Xbyak::CodeGenerator::*fn)(const Xbyak::Xmm&, const Xbyak::Operand&)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.FPSCR_FTZ() ? ctx.reg_alloc.UseScratchXmm(args[0]) : ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm b = ctx.FPSCR_FTZ() ? ctx.reg_alloc.UseScratchXmm(args[1]) : ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    if (ctx.FPSCR_FTZ()) {
+        Xbyak::Xmm xmm_mask = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Xmm xmm_scratch = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Reg32 gpr_scratch = ctx.reg_alloc.ScratchGpr().cvt32();
+        VectorDenormalsAreZero<fsize>(code, a, xmm_mask, xmm_scratch, gpr_scratch);
+        VectorDenormalsAreZero<fsize>(code, b, xmm_mask, xmm_scratch, gpr_scratch);
+    }
+    code->movaps(result, a);
+    (code->*fn)(result, b);
+    EmitFPVectorPostProcess<fsize>(code, ctx, result, {a, b}, false);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPVectorAbs32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    VectorNonSignMask<32>(code, mask);
+    code->andps(result, mask);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPVectorAbs64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    VectorNonSignMask<64>(code, mask);
+    code->andpd(result, mask);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPVectorAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::addps);
+}
+
+void EmitX64::EmitFPVectorAdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<64>(code, ctx, inst, &Xbyak::CodeGenerator::addpd);
+}
+
+void EmitX64::EmitFPVectorDiv32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::divps);
+}
+
+void EmitX64::EmitFPVectorDiv64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<64>(code, ctx, inst, &Xbyak::CodeGenerator::divpd);
+}
+
+void EmitX64::EmitFPVectorMul32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::mulps);
+}
+
+void EmitX64::EmitFPVectorMul64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<64>(code, ctx, inst, &Xbyak::CodeGenerator::mulpd);
+}
+
+template <size_t fsize>
+static void EmitFPVectorMulAdd(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst) {
+    using FPT = std::conditional_t<fsize == 64, double, float>;
+
+    if (!code->DoesCpuSupport(Xbyak::util::Cpu::tFMA)) {
+        EmitFPMulAddFallback<FPT, 128 / fsize>(code, ctx, inst);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm addend = ctx.FPSCR_FTZ() ? ctx.reg_alloc.UseScratchXmm(args[0]) : ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm op1 = ctx.FPSCR_FTZ() ? ctx.reg_alloc.UseScratchXmm(args[1]) : ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm op2 = ctx.FPSCR_FTZ() ? ctx.reg_alloc.UseScratchXmm(args[2]) : ctx.reg_alloc.UseXmm(args[2]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    if (ctx.FPSCR_FTZ()) {
+        Xbyak::Xmm xmm_mask = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Xmm xmm_scratch = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Reg32 gpr_scratch = ctx.reg_alloc.ScratchGpr().cvt32();
+        VectorDenormalsAreZero<fsize>(code, addend, xmm_mask, xmm_scratch, gpr_scratch);
+        VectorDenormalsAreZero<fsize>(code, op1, xmm_mask, xmm_scratch, gpr_scratch);
+        VectorDenormalsAreZero<fsize>(code, op2, xmm_mask, xmm_scratch, gpr_scratch);
+    }
+    code->movaps(result, addend);
+    if constexpr (fsize == 32) {
+        code->vfmadd231ps(result, op1, op2);
+    } else {
+        code->vfmadd231pd(result, op1, op2);
+    }
+    EmitFPVectorPostProcess<fsize>(code, ctx, result, {addend, op1, op2}, true);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPVectorMulAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorMulAdd<32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPVectorMulAdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorMulAdd<64>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPVectorNeg32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    VectorShiftedOnes<32>(code, mask, 31, 0);
+    code->xorps(result, mask);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPVectorNeg64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    VectorShiftedOnes<64>(code, mask, 63, 0);
+    code->xorpd(result, mask);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPVectorSqrt32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorTwoOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::sqrtps);
+}
+
+void EmitX64::EmitFPVectorSqrt64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorTwoOp<64>(code, ctx, inst, &Xbyak::CodeGenerator::sqrtpd);
+}
+
+void EmitX64::EmitFPVectorSub32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::subps);
+}
+
+void EmitX64::EmitFPVectorSub64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorThreeOp<64>(code, ctx, inst, &Xbyak::CodeGenerator::subpd);
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
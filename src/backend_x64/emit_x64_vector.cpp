@@ -4,10 +4,17 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
 #include "backend_x64/block_of_code.h"
 #include "backend_x64/emit_x64.h"
+#include "backend_x64/emit_x64_fallback.h"
 #include "common/assert.h"
+#include "common/bit_util.h"
 #include "common/common_types.h"
+#include "common/polynomial_multiply.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/microinstruction.h"
 #include "frontend/ir/opcodes.h"
@@ -28,6 +35,17 @@ static void EmitVectorOperation(BlockOfCode* code, EmitContext& ctx, IR::Inst* i
     ctx.reg_alloc.DefineValue(inst, xmm_a);
 }
 
+static void EmitVectorOperation(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, void (Xbyak::CodeGenerator::*fn)(const Xbyak::Xmm& xmm, const Xbyak::Operand&)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+
+    (code->*fn)(xmm_a, xmm_b);
+
+    ctx.reg_alloc.DefineValue(inst, xmm_a);
+}
+
 void EmitX64::EmitVectorAdd8(EmitContext& ctx, IR::Inst* inst) {
     EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddb);
 }
@@ -44,10 +62,57 @@ void EmitX64::EmitVectorAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddq);
 }
 
+void EmitX64::EmitVectorSub8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubb);
+}
+
+void EmitX64::EmitVectorSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubw);
+}
+
+void EmitX64::EmitVectorSub32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubd);
+}
+
+void EmitX64::EmitVectorSub64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubq);
+}
+
 void EmitX64::EmitVectorAnd(EmitContext& ctx, IR::Inst* inst) {
     EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pand);
 }
 
+void EmitX64::EmitVectorAndNot(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm xmm_b = ctx.reg_alloc.UseScratchXmm(args[1]);
+
+    code->pandn(xmm_b, xmm_a);
+
+    ctx.reg_alloc.DefineValue(inst, xmm_b);
+}
+
+void EmitX64::EmitVectorOr(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::por);
+}
+
+void EmitX64::EmitVectorEor(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pxor);
+}
+
+void EmitX64::EmitVectorNot(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm xmm_b = ctx.reg_alloc.ScratchXmm();
+
+    code->pcmpeqw(xmm_b, xmm_b);
+    code->pxor(xmm_a, xmm_b);
+
+    ctx.reg_alloc.DefineValue(inst, xmm_a);
+}
+
 void EmitX64::EmitVectorLowerPairedAdd8(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -205,6 +270,52 @@ void EmitX64::EmitVectorPairedAdd64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+void EmitX64::EmitVectorPolyMulLong8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    // Widen the lower eight bytes of each operand to words.
+    code->pxor(mask, mask);
+    code->punpcklbw(a, mask);
+    code->punpcklbw(b, mask);
+
+    // Shift-and-add multiplication, with addition replaced by exclusive-or.
+    code->pxor(result, result);
+    for (int i = 0; i < 8; i++) {
+        code->movdqa(mask, b);
+        code->psllw(mask, 15 - i);
+        code->psraw(mask, 15);
+        code->pand(mask, a);
+        code->pxor(result, mask);
+        if (i != 7) {
+            code->psllw(a, 1);
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorPolyMulLong64(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tPCLMULQDQ)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+        Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+
+        code->pclmulqdq(a, b, 0x00);
+
+        ctx.reg_alloc.DefineValue(inst, a);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
+        result = Common::PolynomialMultiplyLong64(a[0], b[0]);
+    });
+}
+
 void EmitX64::EmitVectorLowerBroadcast8(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -274,6 +385,177 @@ void EmitX64::EmitVectorBroadcast16(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+void EmitX64::EmitVectorGetElement8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm source = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Reg32 dest = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pextrb(dest, source, index);
+    } else {
+        code->pextrw(dest, source, index / 2);
+        if (index % 2 == 1) {
+            code->shr(dest, 8);
+        } else {
+            code->movzx(dest, dest.cvt8());
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, dest);
+}
+
+void EmitX64::EmitVectorGetElement16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm source = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Reg32 dest = ctx.reg_alloc.ScratchGpr().cvt32();
+    code->pextrw(dest, source, index);
+    ctx.reg_alloc.DefineValue(inst, dest);
+}
+
+void EmitX64::EmitVectorGetElement32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    if (index == 0) {
+        ctx.reg_alloc.DefineValue(inst, args[0]);
+        return;
+    }
+
+    Xbyak::Xmm source = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Reg32 dest = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pextrd(dest, source, index);
+    } else {
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        code->pshufd(tmp, source, index);
+        code->movd(dest, tmp);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, dest);
+}
+
+void EmitX64::EmitVectorGetElement64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    if (index == 0) {
+        ctx.reg_alloc.DefineValue(inst, args[0]);
+        return;
+    }
+
+    Xbyak::Xmm source = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Reg64 dest = ctx.reg_alloc.ScratchGpr().cvt64();
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pextrq(dest, source, 1);
+    } else {
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        code->movhlps(tmp, source);
+        code->movq(dest, tmp);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, dest);
+}
+
+void EmitX64::EmitVectorSetElement8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm source_vector = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        Xbyak::Reg8 source_elem = ctx.reg_alloc.UseGpr(args[2]).cvt8();
+
+        code->pinsrb(source_vector, source_elem.cvt32(), index);
+    } else {
+        Xbyak::Reg32 source_elem = ctx.reg_alloc.UseScratchGpr(args[2]).cvt32();
+        Xbyak::Reg32 tmp = ctx.reg_alloc.ScratchGpr().cvt32();
+
+        code->pextrw(tmp, source_vector, index / 2);
+        if (index % 2 == 0) {
+            code->and_(tmp, 0xFF00);
+            code->movzx(source_elem, source_elem.cvt8());
+            code->or_(tmp, source_elem);
+        } else {
+            code->and_(tmp, 0x00FF);
+            code->shl(source_elem, 8);
+            code->or_(tmp, source_elem);
+        }
+        code->pinsrw(source_vector, tmp, index / 2);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, source_vector);
+}
+
+void EmitX64::EmitVectorSetElement16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm source_vector = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Reg16 source_elem = ctx.reg_alloc.UseGpr(args[2]).cvt16();
+
+    code->pinsrw(source_vector, source_elem.cvt32(), index);
+
+    ctx.reg_alloc.DefineValue(inst, source_vector);
+}
+
+void EmitX64::EmitVectorSetElement32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm source_vector = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        Xbyak::Reg32 source_elem = ctx.reg_alloc.UseGpr(args[2]).cvt32();
+
+        code->pinsrd(source_vector, source_elem, index);
+    } else {
+        Xbyak::Reg32 source_elem = ctx.reg_alloc.UseScratchGpr(args[2]).cvt32();
+
+        code->pinsrw(source_vector, source_elem, index * 2);
+        code->shr(source_elem, 16);
+        code->pinsrw(source_vector, source_elem, index * 2 + 1);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, source_vector);
+}
+
+void EmitX64::EmitVectorSetElement64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm source_vector = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        Xbyak::Reg64 source_elem = ctx.reg_alloc.UseGpr(args[2]);
+
+        code->pinsrq(source_vector, source_elem, index);
+    } else {
+        Xbyak::Xmm source_elem = ctx.reg_alloc.UseXmm(args[2]);
+
+        if (index == 0) {
+            code->movsd(source_vector, source_elem);
+        } else {
+            code->punpcklqdq(source_vector, source_elem);
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, source_vector);
+}
+
 void EmitX64::EmitVectorBroadcast32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -284,9 +566,22 @@ void EmitX64::EmitVectorBroadcast32(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+/// Loads a 64-bit constant into both halves of dest.
+static void EmitBroadcastConstant(BlockOfCode* code, Xbyak::Xmm dest, u64 constant) {
+    code->movaps(dest, code->MConst(constant, constant));
+}
+
 void EmitX64::EmitVectorBroadcast64(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
+    if (args[0].IsImmediate()) {
+        const u64 imm = args[0].GetImmediateU64();
+        Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        code->LoadConstant(result, imm, imm);
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
 
     code->punpcklqdq(a, a);
@@ -294,5 +589,2133 @@ void EmitX64::EmitVectorBroadcast64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+void EmitX64::EmitVectorBroadcastElem16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (index < 4) {
+        code->pshuflw(a, a, static_cast<u8>(index * 0b01010101));
+        code->punpcklqdq(a, a);
+    } else {
+        code->pshufhw(a, a, static_cast<u8>((index - 4) * 0b01010101));
+        code->punpckhqdq(a, a);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorBroadcastElem32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    code->pshufd(result, a, static_cast<u8>(index * 0b01010101));
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorBroadcastElem64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 index = args[1].GetImmediateU8();
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    code->pshufd(result, a, index == 0 ? 0b01000100 : 0b11101110);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+static u64 SignBitMask(size_t esize) {
+    switch (esize) {
+    case 8:
+        return 0x8080808080808080;
+    case 16:
+        return 0x8000800080008000;
+    case 32:
+        return 0x8000000080000000;
+    default:
+        return 0x8000000000000000;
+    }
+}
+
+static void EmitPcmpgt(BlockOfCode* code, size_t esize, Xbyak::Xmm a, Xbyak::Xmm b) {
+    switch (esize) {
+    case 8:
+        code->pcmpgtb(a, b);
+        break;
+    case 16:
+        code->pcmpgtw(a, b);
+        break;
+    case 32:
+        code->pcmpgtd(a, b);
+        break;
+    default:
+        code->pcmpgtq(a, b);
+        break;
+    }
+}
+
+static void EmitPadd(BlockOfCode* code, size_t esize, Xbyak::Xmm a, Xbyak::Xmm b) {
+    switch (esize) {
+    case 8:
+        code->paddb(a, b);
+        break;
+    case 16:
+        code->paddw(a, b);
+        break;
+    case 32:
+        code->paddd(a, b);
+        break;
+    default:
+        code->paddq(a, b);
+        break;
+    }
+}
+
+static void EmitPsub(BlockOfCode* code, size_t esize, Xbyak::Xmm a, Xbyak::Xmm b) {
+    switch (esize) {
+    case 8:
+        code->psubb(a, b);
+        break;
+    case 16:
+        code->psubw(a, b);
+        break;
+    case 32:
+        code->psubd(a, b);
+        break;
+    default:
+        code->psubq(a, b);
+        break;
+    }
+}
+
+/// Shifts each element of a right by one. Bytes are shifted logically.
+static void EmitShiftRightByOne(BlockOfCode* code, EmitContext& ctx, size_t esize, bool is_signed, Xbyak::Xmm a) {
+    switch (esize) {
+    case 8: {
+        ASSERT(!is_signed);
+        Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+        EmitBroadcastConstant(code, mask, 0x7F7F7F7F7F7F7F7F);
+        code->psrlw(a, 1);
+        code->pand(a, mask);
+        break;
+    }
+    case 16:
+        if (is_signed) {
+            code->psraw(a, 1);
+        } else {
+            code->psrlw(a, 1);
+        }
+        break;
+    case 32:
+        if (is_signed) {
+            code->psrad(a, 1);
+        } else {
+            code->psrld(a, 1);
+        }
+        break;
+    default:
+        ASSERT_MSG(false, "Unreachable");
+    }
+}
+
+void EmitX64::EmitVectorMultiply8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm odd_a = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm odd_b = ctx.reg_alloc.ScratchXmm();
+
+    // There is no byte multiply, so multiply the even and odd bytes separately as words.
+    code->movdqa(odd_a, a);
+    code->movdqa(odd_b, b);
+    code->psrlw(odd_a, 8);
+    code->psrlw(odd_b, 8);
+    code->pmullw(a, b);
+    code->pmullw(odd_a, odd_b);
+    code->psllw(a, 8);
+    code->psrlw(a, 8);
+    code->psllw(odd_a, 8);
+    code->por(a, odd_a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorMultiply16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmullw);
+}
+
+void EmitX64::EmitVectorMultiply32(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmulld);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    // pmuludq multiplies the even elements, so shift the odd elements down and multiply those separately.
+    code->movdqa(result, a);
+    code->pmuludq(result, b);
+    code->psrlq(a, 32);
+    code->psrlq(b, 32);
+    code->pmuludq(a, b);
+    code->pshufd(result, result, 0b00001000);
+    code->pshufd(b, a, 0b00001000);
+    code->punpckldq(result, b);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorMultiply64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm cross1 = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm cross2 = ctx.reg_alloc.ScratchXmm();
+
+    // lo(a * b) = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+    code->movdqa(cross1, a);
+    code->psrlq(cross1, 32);
+    code->pmuludq(cross1, b);
+    code->movdqa(cross2, b);
+    code->psrlq(cross2, 32);
+    code->pmuludq(cross2, a);
+    code->paddq(cross1, cross2);
+    code->psllq(cross1, 32);
+    code->pmuludq(a, b);
+    code->paddq(a, cross1);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorPolyMul8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+    // Horner's scheme over the bits of b starting from the most significant,
+    // with addition replaced by exclusive-or.
+    code->pxor(zero, zero);
+    code->pxor(result, result);
+    for (int i = 0; i < 8; i++) {
+        code->paddb(result, result);
+        code->movdqa(mask, zero);
+        code->pcmpgtb(mask, b);
+        code->pand(mask, a);
+        code->pxor(result, mask);
+        if (i != 7) {
+            code->paddb(b, b);
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorEqual8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqb);
+}
+
+void EmitX64::EmitVectorEqual16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqw);
+}
+
+void EmitX64::EmitVectorEqual32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqd);
+}
+
+void EmitX64::EmitVectorEqual64(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqq);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code->pcmpeqd(a, b);
+    code->pshufd(tmp, a, 0b10110001);
+    code->pand(a, tmp);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorGreaterS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtb);
+}
+
+void EmitX64::EmitVectorGreaterS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtw);
+}
+
+void EmitX64::EmitVectorGreaterS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtd);
+}
+
+void EmitX64::EmitVectorGreaterS64(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtq);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = a[i] > b[i] ? -1 : 0;
+        }
+    });
+}
+
+/// Computes the element-wise maximum or minimum by selecting on the result of a greater-than comparison.
+/// Unsigned comparisons are performed by flipping the sign bits of both operands first.
+static void EmitVectorMinMaxByComparison(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed, bool is_max) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    code->movdqa(mask, a);
+    if (is_signed) {
+        EmitPcmpgt(code, esize, mask, b);
+    } else {
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        EmitBroadcastConstant(code, tmp, SignBitMask(esize));
+        code->pxor(mask, tmp);
+        code->pxor(tmp, b);
+        EmitPcmpgt(code, esize, mask, tmp);
+    }
+
+    if (is_max) {
+        code->pand(a, mask);
+        code->pandn(mask, b);
+        code->por(a, mask);
+        ctx.reg_alloc.DefineValue(inst, a);
+    } else {
+        code->pand(b, mask);
+        code->pandn(mask, a);
+        code->por(b, mask);
+        ctx.reg_alloc.DefineValue(inst, b);
+    }
+}
+
+void EmitX64::EmitVectorMaxS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsb);
+        return;
+    }
+
+    EmitVectorMinMaxByComparison(code, ctx, inst, 8, true, true);
+}
+
+void EmitX64::EmitVectorMaxS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsw);
+}
+
+void EmitX64::EmitVectorMaxS32(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsd);
+        return;
+    }
+
+    EmitVectorMinMaxByComparison(code, ctx, inst, 32, true, true);
+}
+
+void EmitX64::EmitVectorMaxS64(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        EmitVectorMinMaxByComparison(code, ctx, inst, 64, true, true);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = std::max(a[i], b[i]);
+        }
+    });
+}
+
+void EmitX64::EmitVectorMaxU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxub);
+}
+
+void EmitX64::EmitVectorMaxU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxuw);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+
+    // max(a, b) == saturate(a - b) + b
+    code->psubusw(a, b);
+    code->paddw(a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorMaxU32(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxud);
+        return;
+    }
+
+    EmitVectorMinMaxByComparison(code, ctx, inst, 32, false, true);
+}
+
+void EmitX64::EmitVectorMaxU64(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        EmitVectorMinMaxByComparison(code, ctx, inst, 64, false, true);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = std::max(a[i], b[i]);
+        }
+    });
+}
+
+void EmitX64::EmitVectorMinS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsb);
+        return;
+    }
+
+    EmitVectorMinMaxByComparison(code, ctx, inst, 8, true, false);
+}
+
+void EmitX64::EmitVectorMinS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsw);
+}
+
+void EmitX64::EmitVectorMinS32(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsd);
+        return;
+    }
+
+    EmitVectorMinMaxByComparison(code, ctx, inst, 32, true, false);
+}
+
+void EmitX64::EmitVectorMinS64(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        EmitVectorMinMaxByComparison(code, ctx, inst, 64, true, false);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = std::min(a[i], b[i]);
+        }
+    });
+}
+
+void EmitX64::EmitVectorMinU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminub);
+}
+
+void EmitX64::EmitVectorMinU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminuw);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    // min(a, b) == a - saturate(a - b)
+    code->movdqa(tmp, a);
+    code->psubusw(tmp, b);
+    code->psubw(a, tmp);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorMinU32(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminud);
+        return;
+    }
+
+    EmitVectorMinMaxByComparison(code, ctx, inst, 32, false, false);
+}
+
+void EmitX64::EmitVectorMinU64(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        EmitVectorMinMaxByComparison(code, ctx, inst, 64, false, false);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = std::min(a[i], b[i]);
+        }
+    });
+}
+
+/// (a + b) >> 1 without intermediate overflow, computed as (a & b) + ((a ^ b) >> 1).
+/// Signed bytes are biased to unsigned bytes, as there is no arithmetic byte shift.
+static void EmitVectorHalvingAdd(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    const bool bias = esize == 8 && is_signed;
+    if (bias) {
+        EmitBroadcastConstant(code, tmp, SignBitMask(8));
+        code->pxor(a, tmp);
+        code->pxor(b, tmp);
+    }
+
+    code->movdqa(tmp, a);
+    code->pxor(tmp, b);
+    code->pand(a, b);
+    EmitShiftRightByOne(code, ctx, esize, is_signed && !bias, tmp);
+    EmitPadd(code, esize, a, tmp);
+
+    if (bias) {
+        EmitBroadcastConstant(code, tmp, SignBitMask(8));
+        code->pxor(a, tmp);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+/// (a - b) >> 1 without intermediate overflow, computed as ((a ^ b) >> 1) - (~a & b).
+/// Biasing signed bytes preserves a - b, so the unsigned result can be used as-is.
+static void EmitVectorHalvingSub(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    const bool bias = esize == 8 && is_signed;
+    if (bias) {
+        EmitBroadcastConstant(code, tmp, SignBitMask(8));
+        code->pxor(a, tmp);
+        code->pxor(b, tmp);
+    }
+
+    code->movdqa(tmp, a);
+    code->pxor(tmp, b);
+    code->pandn(a, b);
+    EmitShiftRightByOne(code, ctx, esize, is_signed && !bias, tmp);
+    EmitPsub(code, esize, tmp, a);
+
+    ctx.reg_alloc.DefineValue(inst, tmp);
+}
+
+/// (a + b + 1) >> 1 without intermediate overflow.
+static void EmitVectorRoundingHalvingAdd(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    if (esize == 32) {
+        // (a | b) - ((a ^ b) >> 1)
+        code->movdqa(tmp, a);
+        code->pxor(tmp, b);
+        code->por(a, b);
+        EmitShiftRightByOne(code, ctx, esize, is_signed, tmp);
+        code->psubd(a, tmp);
+
+        ctx.reg_alloc.DefineValue(inst, a);
+        return;
+    }
+
+    // pavgb and pavgw are unsigned, so signed operands are biased.
+    if (is_signed) {
+        EmitBroadcastConstant(code, tmp, SignBitMask(esize));
+        code->pxor(a, tmp);
+        code->pxor(b, tmp);
+    }
+
+    if (esize == 8) {
+        code->pavgb(a, b);
+    } else {
+        code->pavgw(a, b);
+    }
+
+    if (is_signed) {
+        code->pxor(a, tmp);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorHalvingAddS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingAdd(code, ctx, inst, 8, true);
+}
+
+void EmitX64::EmitVectorHalvingAddS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingAdd(code, ctx, inst, 16, true);
+}
+
+void EmitX64::EmitVectorHalvingAddS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingAdd(code, ctx, inst, 32, true);
+}
+
+void EmitX64::EmitVectorHalvingAddU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingAdd(code, ctx, inst, 8, false);
+}
+
+void EmitX64::EmitVectorHalvingAddU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingAdd(code, ctx, inst, 16, false);
+}
+
+void EmitX64::EmitVectorHalvingAddU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingAdd(code, ctx, inst, 32, false);
+}
+
+void EmitX64::EmitVectorHalvingSubS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingSub(code, ctx, inst, 8, true);
+}
+
+void EmitX64::EmitVectorHalvingSubS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingSub(code, ctx, inst, 16, true);
+}
+
+void EmitX64::EmitVectorHalvingSubS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingSub(code, ctx, inst, 32, true);
+}
+
+void EmitX64::EmitVectorHalvingSubU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingSub(code, ctx, inst, 8, false);
+}
+
+void EmitX64::EmitVectorHalvingSubU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingSub(code, ctx, inst, 16, false);
+}
+
+void EmitX64::EmitVectorHalvingSubU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorHalvingSub(code, ctx, inst, 32, false);
+}
+
+void EmitX64::EmitVectorRHalvingAddS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorRoundingHalvingAdd(code, ctx, inst, 8, true);
+}
+
+void EmitX64::EmitVectorRHalvingAddS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorRoundingHalvingAdd(code, ctx, inst, 16, true);
+}
+
+void EmitX64::EmitVectorRHalvingAddS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorRoundingHalvingAdd(code, ctx, inst, 32, true);
+}
+
+void EmitX64::EmitVectorRHalvingAddU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorRoundingHalvingAdd(code, ctx, inst, 8, false);
+}
+
+void EmitX64::EmitVectorRHalvingAddU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorRoundingHalvingAdd(code, ctx, inst, 16, false);
+}
+
+void EmitX64::EmitVectorRHalvingAddU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorRoundingHalvingAdd(code, ctx, inst, 32, false);
+}
+
+/// |a - b|, computed by negating a - b wherever b > a.
+static void EmitVectorAbsDiff(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (!is_signed && esize != 32) {
+        Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+        Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        // One of the two saturating differences is always zero.
+        code->movdqa(tmp, a);
+        if (esize == 8) {
+            code->psubusb(tmp, b);
+            code->psubusb(b, a);
+        } else {
+            code->psubusw(tmp, b);
+            code->psubusw(b, a);
+        }
+        code->por(tmp, b);
+
+        ctx.reg_alloc.DefineValue(inst, tmp);
+        return;
+    }
+
+    if (!is_signed && code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+        Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        code->movdqa(tmp, a);
+        code->pmaxud(tmp, b);
+        code->pminud(a, b);
+        code->psubd(tmp, a);
+
+        ctx.reg_alloc.DefineValue(inst, tmp);
+        return;
+    }
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    code->movdqa(mask, b);
+    if (is_signed) {
+        EmitPcmpgt(code, esize, mask, a);
+    } else {
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        EmitBroadcastConstant(code, tmp, SignBitMask(esize));
+        code->pxor(mask, tmp);
+        code->pxor(tmp, a);
+        EmitPcmpgt(code, esize, mask, tmp);
+    }
+
+    EmitPsub(code, esize, a, b);
+    code->pxor(a, mask);
+    EmitPsub(code, esize, a, mask);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorAbsDiffS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorAbsDiff(code, ctx, inst, 8, true);
+}
+
+void EmitX64::EmitVectorAbsDiffS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorAbsDiff(code, ctx, inst, 16, true);
+}
+
+void EmitX64::EmitVectorAbsDiffS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorAbsDiff(code, ctx, inst, 32, true);
+}
+
+void EmitX64::EmitVectorAbsDiffU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorAbsDiff(code, ctx, inst, 8, false);
+}
+
+void EmitX64::EmitVectorAbsDiffU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorAbsDiff(code, ctx, inst, 16, false);
+}
+
+void EmitX64::EmitVectorAbsDiffU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorAbsDiff(code, ctx, inst, 32, false);
+}
+
+void EmitX64::EmitVectorSaturatedAddS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddsb);
+}
+
+void EmitX64::EmitVectorSaturatedAddS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddsw);
+}
+
+/// Signed 32-bit saturating addition or subtraction. Overflowed elements are replaced
+/// with INT32_MIN or INT32_MAX depending on the sign of the first operand.
+static void EmitVectorSignedSaturatedAddSub32(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, bool is_sub) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm overflow = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code->movdqa(result, a);
+    code->movdqa(overflow, a);
+    if (is_sub) {
+        // Overflow iff the operands have different signs and the result's sign differs from a's.
+        code->psubd(result, b);
+        code->pxor(overflow, b);
+        code->movdqa(tmp, a);
+        code->pxor(tmp, result);
+    } else {
+        // Overflow iff the result's sign differs from the signs of both operands.
+        code->paddd(result, b);
+        code->pxor(overflow, result);
+        code->movdqa(tmp, b);
+        code->pxor(tmp, result);
+    }
+    code->pand(overflow, tmp);
+    code->psrad(overflow, 31);
+
+    code->psrad(a, 31);
+    EmitBroadcastConstant(code, tmp, 0x7FFFFFFF7FFFFFFF);
+    code->pxor(a, tmp);
+
+    code->pand(a, overflow);
+    code->pandn(overflow, result);
+    code->por(a, overflow);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorSaturatedAddS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedAddSub32(code, ctx, inst, false);
+}
+
+void EmitX64::EmitVectorSaturatedAddS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            const s64 sum = static_cast<s64>(static_cast<u64>(a[i]) + static_cast<u64>(b[i]));
+            if (((a[i] ^ sum) & (b[i] ^ sum)) < 0) {
+                result[i] = a[i] < 0 ? std::numeric_limits<s64>::min() : std::numeric_limits<s64>::max();
+            } else {
+                result[i] = sum;
+            }
+        }
+    });
+}
+
+void EmitX64::EmitVectorSaturatedAddU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddusb);
+}
+
+void EmitX64::EmitVectorSaturatedAddU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddusw);
+}
+
+void EmitX64::EmitVectorSaturatedAddU32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm sum = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code->movdqa(sum, a);
+    code->paddd(sum, b);
+
+    // The addition carried iff a > sum (unsigned).
+    EmitBroadcastConstant(code, tmp, 0x8000000080000000);
+    code->pxor(a, tmp);
+    code->pxor(tmp, sum);
+    code->pcmpgtd(a, tmp);
+    code->por(sum, a);
+
+    ctx.reg_alloc.DefineValue(inst, sum);
+}
+
+void EmitX64::EmitVectorSaturatedAddU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            const u64 sum = a[i] + b[i];
+            result[i] = sum < a[i] ? std::numeric_limits<u64>::max() : sum;
+        }
+    });
+}
+
+void EmitX64::EmitVectorSaturatedSubS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubsb);
+}
+
+void EmitX64::EmitVectorSaturatedSubS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubsw);
+}
+
+void EmitX64::EmitVectorSaturatedSubS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedAddSub32(code, ctx, inst, true);
+}
+
+void EmitX64::EmitVectorSaturatedSubS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            const s64 difference = static_cast<s64>(static_cast<u64>(a[i]) - static_cast<u64>(b[i]));
+            if (((a[i] ^ b[i]) & (a[i] ^ difference)) < 0) {
+                result[i] = a[i] < 0 ? std::numeric_limits<s64>::min() : std::numeric_limits<s64>::max();
+            } else {
+                result[i] = difference;
+            }
+        }
+    });
+}
+
+void EmitX64::EmitVectorSaturatedSubU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubusb);
+}
+
+void EmitX64::EmitVectorSaturatedSubU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubusw);
+}
+
+void EmitX64::EmitVectorSaturatedSubU32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+    Xbyak::Xmm difference = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code->movdqa(difference, a);
+    code->psubd(difference, b);
+
+    // The subtraction borrowed iff b > a (unsigned).
+    EmitBroadcastConstant(code, tmp, 0x8000000080000000);
+    code->pxor(a, tmp);
+    code->pxor(b, tmp);
+    code->pcmpgtd(b, a);
+    code->pandn(b, difference);
+
+    ctx.reg_alloc.DefineValue(inst, b);
+}
+
+void EmitX64::EmitVectorSaturatedSubU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = a[i] < b[i] ? 0 : a[i] - b[i];
+        }
+    });
+}
+
+/// The only doubling product that overflows is (-1.0) * (-1.0), which produces the most negative value.
+static void EmitSaturateDoublingMultiplyHigh(BlockOfCode* code, size_t esize, Xbyak::Xmm result, Xbyak::Xmm tmp) {
+    EmitBroadcastConstant(code, tmp, SignBitMask(esize));
+    if (esize == 16) {
+        code->pcmpeqw(tmp, result);
+    } else {
+        code->pcmpeqd(tmp, result);
+    }
+    code->pxor(result, tmp);
+}
+
+template <bool rounding>
+static void SignedSaturatedDoublingMultiplyHigh32(VectorArray<s32>& result, const VectorArray<s32>& a, const VectorArray<s32>& b) {
+    for (size_t i = 0; i < result.size(); i++) {
+        if (a[i] == std::numeric_limits<s32>::min() && b[i] == std::numeric_limits<s32>::min()) {
+            result[i] = std::numeric_limits<s32>::max();
+            continue;
+        }
+        const s64 product = 2 * static_cast<s64>(a[i]) * static_cast<s64>(b[i]) + (rounding ? s64(1) << 31 : 0);
+        result[i] = static_cast<s32>(product >> 32);
+    }
+}
+
+static void EmitVectorSignedSaturatedDoublingMultiplyHigh16(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, bool rounding) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    if (rounding && code->DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        code->pmulhrsw(a, b);
+    } else {
+        // Shift the top bit of the low half of the product into the doubled high half.
+        code->movdqa(tmp, a);
+        code->pmullw(tmp, b);
+        code->pmulhw(a, b);
+        code->psllw(a, 1);
+        if (rounding) {
+            // Round using bit 14 of the low half of the product.
+            Xbyak::Xmm round = ctx.reg_alloc.ScratchXmm();
+            code->movdqa(round, tmp);
+            code->psllw(round, 1);
+            code->psrlw(round, 15);
+            code->psrlw(tmp, 15);
+            code->por(a, tmp);
+            code->paddw(a, round);
+        } else {
+            code->psrlw(tmp, 15);
+            code->por(a, tmp);
+        }
+    }
+    EmitSaturateDoublingMultiplyHigh(code, 16, a, tmp);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+static void EmitVectorSignedSaturatedDoublingMultiplyHigh32(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, bool rounding) {
+    if (!code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorFallback<2>(code, ctx, inst, rounding ? &SignedSaturatedDoublingMultiplyHigh32<true> : &SignedSaturatedDoublingMultiplyHigh32<false>);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm odd_a = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm odd_b = ctx.reg_alloc.ScratchXmm();
+
+    // pmuldq multiplies the even elements, so move the odd elements down and multiply those separately.
+    code->pshufd(odd_a, a, 0b11110101);
+    code->pshufd(odd_b, b, 0b11110101);
+    code->pmuldq(a, b);
+    code->pmuldq(odd_a, odd_b);
+    if (rounding) {
+        EmitBroadcastConstant(code, odd_b, 0x0000000040000000);
+        code->paddq(a, odd_b);
+        code->paddq(odd_a, odd_b);
+    }
+
+    // Bits 31 to 62 of each product are the result: move them to the low word of even and the high word of odd elements.
+    code->psrlq(a, 31);
+    code->psllq(odd_a, 1);
+    code->pblendw(a, odd_a, 0b11001100);
+    EmitSaturateDoublingMultiplyHigh(code, 32, a, odd_b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorSatDMulHigh16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedDoublingMultiplyHigh16(code, ctx, inst, false);
+}
+
+void EmitX64::EmitVectorSatDMulHigh32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedDoublingMultiplyHigh32(code, ctx, inst, false);
+}
+
+void EmitX64::EmitVectorSatRDMulHigh16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedDoublingMultiplyHigh16(code, ctx, inst, true);
+}
+
+void EmitX64::EmitVectorSatRDMulHigh32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedDoublingMultiplyHigh32(code, ctx, inst, true);
+}
+
+/// Shifts x by the signed amount held in the bottom byte of y, shifting right if it is negative.
+template <typename T>
+static T VShift(T x, T y) {
+    const s64 shift_amount = static_cast<s8>(static_cast<u8>(y));
+    const s64 bit_size = static_cast<s64>(Common::BitSize<T>());
+
+    if (shift_amount >= bit_size) {
+        return 0;
+    }
+
+    if (shift_amount <= -bit_size) {
+        if constexpr (std::is_signed_v<T>) {
+            return static_cast<T>(x >> (bit_size - 1));
+        } else {
+            return 0;
+        }
+    }
+
+    if (shift_amount < 0) {
+        return static_cast<T>(x >> -shift_amount);
+    }
+
+    using unsigned_type = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<unsigned_type>(x) << shift_amount);
+}
+
+/// As VShift, except that right shifts round to nearest instead of towards negative infinity.
+template <typename T>
+static T RoundingVShift(T x, T y) {
+    const s64 shift_amount = static_cast<s8>(static_cast<u8>(y));
+    const s64 bit_size = static_cast<s64>(Common::BitSize<T>());
+
+    if (shift_amount >= 0) {
+        return VShift(x, y);
+    }
+
+    const s64 shift = -shift_amount;
+    if (shift > bit_size) {
+        return 0;
+    }
+
+    const T round_bit = static_cast<T>((x >> (shift - 1)) & 1);
+    if (shift == bit_size) {
+        if constexpr (std::is_signed_v<T>) {
+            return static_cast<T>((x >> (bit_size - 1)) + round_bit);
+        } else {
+            return round_bit;
+        }
+    }
+    return static_cast<T>((x >> shift) + round_bit);
+}
+
+template <typename T, T (*shift_fn)(T, T)>
+static void EmitVectorVShift(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst) {
+    // SSE has no per-element variable shifts.
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<T>& result, const VectorArray<T>& a, const VectorArray<T>& b) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = shift_fn(a[i], b[i]);
+        }
+    });
+}
+
+void EmitX64::EmitVectorVShiftS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s8, VShift<s8>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorVShiftS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s16, VShift<s16>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorVShiftS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s32, VShift<s32>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorVShiftS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s64, VShift<s64>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorVShiftU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u8, VShift<u8>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorVShiftU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u16, VShift<u16>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorVShiftU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u32, VShift<u32>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorVShiftU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u64, VShift<u64>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s8, RoundingVShift<s8>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s16, RoundingVShift<s16>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s32, RoundingVShift<s32>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<s64, RoundingVShift<s64>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u8, RoundingVShift<u8>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u16, RoundingVShift<u16>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u32, RoundingVShift<u32>>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorRoundingVShiftU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorVShift<u64, RoundingVShift<u64>>(code, ctx, inst);
+}
+
+/// Extracts the even (or odd) elements of a and b into the lower and upper halves of the result.
+/// Bytes and words are narrowed with a pack instruction after moving the wanted element into the low bits.
+static void EmitVectorUnzip(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool odd) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+
+    switch (esize) {
+    case 8:
+        if (!odd) {
+            code->psllw(a, 8);
+            code->psllw(b, 8);
+        }
+        code->psrlw(a, 8);
+        code->psrlw(b, 8);
+        code->packuswb(a, b);
+        break;
+    case 16:
+        if (!odd) {
+            code->pslld(a, 16);
+            code->pslld(b, 16);
+        }
+        code->psrad(a, 16);
+        code->psrad(b, 16);
+        code->packssdw(a, b);
+        break;
+    case 32:
+        code->shufps(a, b, odd ? 0b11011101 : 0b10001000);
+        break;
+    case 64:
+        if (odd) {
+            code->punpckhqdq(a, b);
+        } else {
+            code->punpcklqdq(a, b);
+        }
+        break;
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+/// As EmitVectorUnzip, but operating on the lower halves of a and b. The upper half of the result is zero.
+static void EmitVectorUnzipLower(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool odd) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+    code->punpcklqdq(a, b);
+    code->pxor(zero, zero);
+
+    switch (esize) {
+    case 8:
+        if (!odd) {
+            code->psllw(a, 8);
+        }
+        code->psrlw(a, 8);
+        code->packuswb(a, zero);
+        break;
+    case 16:
+        if (!odd) {
+            code->pslld(a, 16);
+        }
+        code->psrad(a, 16);
+        code->packssdw(a, zero);
+        break;
+    case 32:
+        code->pshufd(a, a, odd ? 0b00001101 : 0b00001000);
+        code->movq(a, a);
+        break;
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorUnzipEven8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 8, false);
+}
+
+void EmitX64::EmitVectorUnzipEven16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 16, false);
+}
+
+void EmitX64::EmitVectorUnzipEven32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 32, false);
+}
+
+void EmitX64::EmitVectorUnzipEven64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 64, false);
+}
+
+void EmitX64::EmitVectorUnzipOdd8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 8, true);
+}
+
+void EmitX64::EmitVectorUnzipOdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 16, true);
+}
+
+void EmitX64::EmitVectorUnzipOdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 32, true);
+}
+
+void EmitX64::EmitVectorUnzipOdd64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzip(code, ctx, inst, 64, true);
+}
+
+void EmitX64::EmitVectorUnzipEvenLower8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzipLower(code, ctx, inst, 8, false);
+}
+
+void EmitX64::EmitVectorUnzipEvenLower16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzipLower(code, ctx, inst, 16, false);
+}
+
+void EmitX64::EmitVectorUnzipEvenLower32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzipLower(code, ctx, inst, 32, false);
+}
+
+void EmitX64::EmitVectorUnzipOddLower8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzipLower(code, ctx, inst, 8, true);
+}
+
+void EmitX64::EmitVectorUnzipOddLower16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzipLower(code, ctx, inst, 16, true);
+}
+
+void EmitX64::EmitVectorUnzipOddLower32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorUnzipLower(code, ctx, inst, 32, true);
+}
+
+void EmitX64::EmitVectorInterleaveLower8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpcklbw);
+}
+
+void EmitX64::EmitVectorInterleaveLower16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpcklwd);
+}
+
+void EmitX64::EmitVectorInterleaveLower32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpckldq);
+}
+
+void EmitX64::EmitVectorInterleaveLower64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpcklqdq);
+}
+
+void EmitX64::EmitVectorInterleaveUpper8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpckhbw);
+}
+
+void EmitX64::EmitVectorInterleaveUpper16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpckhwd);
+}
+
+void EmitX64::EmitVectorInterleaveUpper32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpckhdq);
+}
+
+void EmitX64::EmitVectorInterleaveUpper64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::punpckhqdq);
+}
+
+static void EmitVectorShiftImmediate(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, void (Xbyak::CodeGenerator::*fn)(const Xbyak::Mmx& mmx, int imm8)) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 shift_amount = args[1].GetImmediateU8();
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    (code->*fn)(result, shift_amount);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 shift_amount = args[1].GetImmediateU8();
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (shift_amount >= 8) {
+        code->pxor(result, result);
+    } else if (shift_amount == 1) {
+        code->paddb(result, result);
+    } else if (shift_amount > 0) {
+        // There is no byte shift, so shift words and clear the bits that crossed into the neighbouring byte.
+        Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+        EmitBroadcastConstant(code, mask, ((0xFFULL << shift_amount) & 0xFF) * 0x0101010101010101);
+        code->psllw(result, shift_amount);
+        code->pand(result, mask);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::psllw);
+}
+
+void EmitX64::EmitVectorShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::pslld);
+}
+
+void EmitX64::EmitVectorShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::psllq);
+}
+
+void EmitX64::EmitVectorShiftRightU8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 shift_amount = args[1].GetImmediateU8();
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (shift_amount >= 8) {
+        code->pxor(result, result);
+    } else if (shift_amount > 0) {
+        Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+        EmitBroadcastConstant(code, mask, (0xFFULL >> shift_amount) * 0x0101010101010101);
+        code->psrlw(result, shift_amount);
+        code->pand(result, mask);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorShiftRightU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::psrlw);
+}
+
+void EmitX64::EmitVectorShiftRightU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::psrld);
+}
+
+void EmitX64::EmitVectorShiftRightU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::psrlq);
+}
+
+void EmitX64::EmitVectorShiftRightS8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 shift_amount = args[1].GetImmediateU8();
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+
+    // Place each byte in the top half of a word, shift the words arithmetically and pack them back down.
+    // The shifted values always fit in a byte, so packsswb never saturates.
+    code->movdqa(upper, result);
+    code->punpcklbw(result, result);
+    code->punpckhbw(upper, upper);
+    code->psraw(result, std::min<u8>(shift_amount, 8) + 8);
+    code->psraw(upper, std::min<u8>(shift_amount, 8) + 8);
+    code->packsswb(result, upper);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorShiftRightS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::psraw);
+}
+
+void EmitX64::EmitVectorShiftRightS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorShiftImmediate(code, ctx, inst, &Xbyak::CodeGenerator::psrad);
+}
+
+void EmitX64::EmitVectorShiftRightS64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+    const u8 shift_amount = std::min<u8>(args[1].GetImmediateU8(), 63);
+
+    Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm sign = ctx.reg_alloc.ScratchXmm();
+
+    // There is no psraq: shift logically, then sign-extend from the shifted sign bit with (x ^ m) - m.
+    EmitBroadcastConstant(code, sign, 0x8000000000000000 >> shift_amount);
+    code->psrlq(result, shift_amount);
+    code->pxor(result, sign);
+    code->psubq(result, sign);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorSignExtend8(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pmovsxbw(a, a);
+    } else {
+        code->punpcklbw(a, a);
+        code->psraw(a, 8);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorSignExtend16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pmovsxwd(a, a);
+    } else {
+        code->punpcklwd(a, a);
+        code->psrad(a, 16);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorSignExtend32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        code->pmovsxdq(a, a);
+    } else {
+        Xbyak::Xmm sign = ctx.reg_alloc.ScratchXmm();
+        code->movdqa(sign, a);
+        code->psrad(sign, 31);
+        code->punpckldq(a, sign);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+static void EmitVectorZeroExtend(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t original_esize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        switch (original_esize) {
+        case 8:
+            code->pmovzxbw(a, a);
+            break;
+        case 16:
+            code->pmovzxwd(a, a);
+            break;
+        case 32:
+            code->pmovzxdq(a, a);
+            break;
+        }
+    } else {
+        Xbyak::Xmm zeros = ctx.reg_alloc.ScratchXmm();
+        code->pxor(zeros, zeros);
+        switch (original_esize) {
+        case 8:
+            code->punpcklbw(a, zeros);
+            break;
+        case 16:
+            code->punpcklwd(a, zeros);
+            break;
+        case 32:
+            code->punpckldq(a, zeros);
+            break;
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorZeroExtend8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorZeroExtend(code, ctx, inst, 8);
+}
+
+void EmitX64::EmitVectorZeroExtend16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorZeroExtend(code, ctx, inst, 16);
+}
+
+void EmitX64::EmitVectorZeroExtend32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorZeroExtend(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitVectorNarrow16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm zeros = ctx.reg_alloc.ScratchXmm();
+
+    // Zero-extend the low byte of each word so that packuswb does not saturate.
+    code->pxor(zeros, zeros);
+    code->psllw(a, 8);
+    code->psrlw(a, 8);
+    code->packuswb(a, zeros);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorNarrow32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm zeros = ctx.reg_alloc.ScratchXmm();
+
+    // Sign-extend the low word of each doubleword so that packssdw does not saturate.
+    code->pxor(zeros, zeros);
+    code->pslld(a, 16);
+    code->psrad(a, 16);
+    code->packssdw(a, zeros);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorNarrow64(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    code->pshufd(a, a, 0b00001000);
+    code->movq(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+/// Sets FPSR.QC if any element of the narrowed result does not widen back to the corresponding element of original.
+static void EmitVectorSatNarrowCheck(BlockOfCode* code, size_t narrow_esize, bool is_signed, Xbyak::Xmm result, Xbyak::Xmm original, Xbyak::Xmm widened, Xbyak::Reg32 mask) {
+    code->movdqa(widened, result);
+    if (narrow_esize == 8) {
+        code->punpcklbw(widened, widened);
+        if (is_signed) {
+            code->psraw(widened, 8);
+        } else {
+            code->psrlw(widened, 8);
+        }
+        code->pcmpeqw(widened, original);
+    } else {
+        ASSERT(narrow_esize == 16);
+        code->punpcklwd(widened, widened);
+        if (is_signed) {
+            code->psrad(widened, 16);
+        } else {
+            code->psrld(widened, 16);
+        }
+        code->pcmpeqd(widened, original);
+    }
+    code->pmovmskb(mask, widened);
+    code->cmp(mask, 0xFFFF);
+    code->setne(mask.cvt8());
+    code->or_(code->byte[r15 + code->GetJitStateInfo().offsetof_FPSCR_QC], mask.cvt8());
+}
+
+/// Packs the elements of a into the lower half of the result with fn, zeroing the upper half and setting FPSR.QC on saturation.
+static void EmitVectorSatPack(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, void (Xbyak::CodeGenerator::*fn)(const Xbyak::Mmx& mmx, const Xbyak::Operand&), size_t narrow_esize, bool is_signed) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Reg32 mask = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    code->movdqa(result, a);
+    code->pxor(tmp, tmp);
+    (code->*fn)(result, tmp);
+    EmitVectorSatNarrowCheck(code, narrow_esize, is_signed, result, a, tmp, mask);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+/// Calls fn(result, a) for saturating narrows without a reasonable SSE lowering. fn returns whether any element saturated.
+template <typename Function>
+static void EmitVectorSatNarrowFallback(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, Function fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+
+    const Xbyak::Xmm result = EmitFallbackCall<1>(code, ctx, {a}, fn);
+    code->or_(code->byte[r15 + code->GetJitStateInfo().offsetof_FPSCR_QC], code->ABI_RETURN.cvt8());
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+/// Narrows each element of a to Result, clamping it to [min, max].
+template <typename Result, typename Arg>
+static bool SatNarrow(VectorArray<Result>& result, const VectorArray<Arg>& a, Arg min, Arg max) {
+    bool qc_flag = false;
+    result = {};
+    for (size_t i = 0; i < a.size(); ++i) {
+        const Arg saturated = std::clamp<Arg>(a[i], min, max);
+        qc_flag |= saturated != a[i];
+        result[i] = static_cast<Result>(saturated);
+    }
+    return qc_flag;
+}
+
+void EmitX64::EmitVectorSatNarrowS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSatPack(code, ctx, inst, &Xbyak::CodeGenerator::packsswb, 8, true);
+}
+
+void EmitX64::EmitVectorSatNarrowS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSatPack(code, ctx, inst, &Xbyak::CodeGenerator::packssdw, 16, true);
+}
+
+void EmitX64::EmitVectorSatNarrowS64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSatNarrowFallback(code, ctx, inst, [](VectorArray<s32>& result, const VectorArray<s64>& a) {
+        return SatNarrow<s32, s64>(result, a, std::numeric_limits<s32>::min(), std::numeric_limits<s32>::max());
+    });
+}
+
+void EmitX64::EmitVectorSatNarrowSU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSatPack(code, ctx, inst, &Xbyak::CodeGenerator::packuswb, 8, false);
+}
+
+void EmitX64::EmitVectorSatNarrowSU32(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+        Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Reg32 mask = ctx.reg_alloc.ScratchGpr().cvt32();
+
+        code->movdqa(result, a);
+        code->pxor(tmp, tmp);
+        code->packusdw(result, tmp);
+        EmitVectorSatNarrowCheck(code, 16, false, result, a, tmp, mask);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    EmitVectorSatNarrowFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<s32>& a) {
+        return SatNarrow<u16, s32>(result, a, 0, std::numeric_limits<u16>::max());
+    });
+}
+
+void EmitX64::EmitVectorSatNarrowSU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSatNarrowFallback(code, ctx, inst, [](VectorArray<u32>& result, const VectorArray<s64>& a) {
+        return SatNarrow<u32, s64>(result, a, 0, std::numeric_limits<u32>::max());
+    });
+}
+
+void EmitX64::EmitVectorSatNarrowU16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+    Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm excess = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Reg32 mask = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    // min(a, 0xFF) == a - max(a - 0xFF, 0), which keeps every word within range of packuswb.
+    EmitBroadcastConstant(code, tmp, 0x00FF00FF00FF00FF);
+    code->movdqa(result, a);
+    code->movdqa(excess, a);
+    code->psubusw(excess, tmp);
+    code->psubw(result, excess);
+    code->pxor(tmp, tmp);
+    code->packuswb(result, tmp);
+    EmitVectorSatNarrowCheck(code, 8, false, result, a, tmp, mask);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitVectorSatNarrowU32(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+        Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        Xbyak::Reg32 mask = ctx.reg_alloc.ScratchGpr().cvt32();
+
+        EmitBroadcastConstant(code, tmp, 0x0000FFFF0000FFFF);
+        code->movdqa(result, a);
+        code->pminud(result, tmp);
+        code->pxor(tmp, tmp);
+        code->packusdw(result, tmp);
+        EmitVectorSatNarrowCheck(code, 16, false, result, a, tmp, mask);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    EmitVectorSatNarrowFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u32>& a) {
+        return SatNarrow<u16, u32>(result, a, 0, std::numeric_limits<u16>::max());
+    });
+}
+
+void EmitX64::EmitVectorSatNarrowU64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSatNarrowFallback(code, ctx, inst, [](VectorArray<u32>& result, const VectorArray<u64>& a) {
+        return SatNarrow<u32, u64>(result, a, 0, std::numeric_limits<u32>::max());
+    });
+}
+
+void EmitX64::EmitVectorExtract(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[2].IsImmediate());
+    const u8 position = args[2].GetImmediateU8();
+    ASSERT(position % 8 == 0);
+
+    if (position == 0) {
+        ctx.reg_alloc.DefineValue(inst, args[0]);
+        return;
+    }
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+        Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+
+        code->palignr(b, a, position / 8);
+
+        ctx.reg_alloc.DefineValue(inst, b);
+        return;
+    }
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
+
+    code->psrldq(a, position / 8);
+    code->pslldq(b, (128 - position) / 8);
+    code->por(a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorExtractLower(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[2].IsImmediate());
+    const u8 position = args[2].GetImmediateU8();
+    ASSERT(position % 8 == 0);
+
+    Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+
+    code->punpcklqdq(a, b);
+    code->psrldq(a, position / 8);
+    code->movq(a, a);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+void EmitX64::EmitVectorTableLookup(EmitContext& ctx, IR::Inst* inst) {
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        Xbyak::Xmm table = ctx.reg_alloc.UseScratchXmm(args[0]);
+        Xbyak::Xmm indices = ctx.reg_alloc.UseScratchXmm(args[1]);
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        // Saturate out-of-range indices so that their top bit is set, which makes pshufb produce zero.
+        EmitBroadcastConstant(code, tmp, 0x7070707070707070);
+        code->paddusb(indices, tmp);
+        code->pshufb(table, indices);
+
+        ctx.reg_alloc.DefineValue(inst, table);
+        return;
+    }
+
+    EmitVectorFallback<2>(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& table, const VectorArray<u8>& indices) {
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = indices[i] < table.size() ? table[indices[i]] : 0;
+        }
+    });
+}
+
+/// Clears everything but the lowest esize bits of data.
+static void EmitZeroAllButLowestElement(BlockOfCode* code, Xbyak::Xmm data, size_t esize) {
+    switch (esize) {
+    case 8:
+        code->pand(data, code->MConst(0xFF));
+        break;
+    case 16:
+        code->pand(data, code->MConst(0xFFFF));
+        break;
+    case 32:
+        code->pand(data, code->MConst(0xFFFFFFFF));
+        break;
+    case 64:
+        code->movq(data, data);
+        break;
+    default:
+        UNREACHABLE();
+    }
+}
+
+/// Repeatedly combines each element with its neighbour at half the remaining distance,
+/// so that the lowest element ends up holding the combination of all elements.
+template <typename Op>
+static void EmitHorizontalFold(BlockOfCode* code, Xbyak::Xmm data, Xbyak::Xmm tmp, size_t esize, Op op) {
+    code->pshufd(tmp, data, 0b01001110);
+    op(data, tmp);
+    if (esize == 64) {
+        return;
+    }
+    code->pshufd(tmp, data, 0b10110001);
+    op(data, tmp);
+    if (esize == 32) {
+        return;
+    }
+    code->movdqa(tmp, data);
+    code->psrld(tmp, 16);
+    op(data, tmp);
+    if (esize == 16) {
+        return;
+    }
+    code->movdqa(tmp, data);
+    code->psrlw(tmp, 8);
+    op(data, tmp);
+}
+
+static void EmitVectorReduceAddBytes(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, bool is_signed, size_t result_esize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    if (is_signed) {
+        // Bias to unsigned, then remove the bias of all sixteen bytes from the sum.
+        EmitBroadcastConstant(code, tmp, 0x8080808080808080);
+        code->pxor(data, tmp);
+    }
+
+    code->pxor(tmp, tmp);
+    code->psadbw(data, tmp);
+    code->pshufd(tmp, data, 0b01001110);
+    code->paddw(data, tmp);
+
+    if (is_signed) {
+        code->psubw(data, code->MConst(16 * 0x80));
+    }
+
+    EmitZeroAllButLowestElement(code, data, result_esize);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReduceAdd8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceAddBytes(code, ctx, inst, false, 8);
+}
+
+void EmitX64::EmitVectorReduceAdd16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        code->phaddw(data, data);
+        code->phaddw(data, data);
+        code->phaddw(data, data);
+    } else {
+        Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        EmitHorizontalFold(code, data, tmp, 16, [this](Xbyak::Xmm a, Xbyak::Xmm b) { code->paddw(a, b); });
+    }
+
+    EmitZeroAllButLowestElement(code, data, 16);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReduceAdd32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    EmitHorizontalFold(code, data, tmp, 32, [this](Xbyak::Xmm a, Xbyak::Xmm b) { code->paddd(a, b); });
+    EmitZeroAllButLowestElement(code, data, 32);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReduceAddLongS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceAddBytes(code, ctx, inst, true, 16);
+}
+
+void EmitX64::EmitVectorReduceAddLongS16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    // Multiplying by one sign-extends and sums adjacent pairs into doublewords.
+    EmitBroadcastConstant(code, tmp, 0x0001000100010001);
+    code->pmaddwd(data, tmp);
+    EmitHorizontalFold(code, data, tmp, 32, [this](Xbyak::Xmm a, Xbyak::Xmm b) { code->paddd(a, b); });
+    EmitZeroAllButLowestElement(code, data, 32);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReduceAddLongS32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm sign = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+
+    code->movdqa(sign, data);
+    code->psrad(sign, 31);
+    code->movdqa(upper, data);
+    code->punpckhdq(upper, sign);
+    code->punpckldq(data, sign);
+    code->paddq(data, upper);
+    EmitHorizontalFold(code, data, upper, 64, [this](Xbyak::Xmm a, Xbyak::Xmm b) { code->paddq(a, b); });
+    EmitZeroAllButLowestElement(code, data, 64);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReduceAddLongU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceAddBytes(code, ctx, inst, false, 16);
+}
+
+void EmitX64::EmitVectorReduceAddLongU16(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code->movdqa(tmp, data);
+    code->psrld(tmp, 16);
+    code->pslld(data, 16);
+    code->psrld(data, 16);
+    code->paddd(data, tmp);
+    EmitHorizontalFold(code, data, tmp, 32, [this](Xbyak::Xmm a, Xbyak::Xmm b) { code->paddd(a, b); });
+    EmitZeroAllButLowestElement(code, data, 32);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReduceAddLongU32(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+    Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+
+    code->pxor(zero, zero);
+    code->movdqa(upper, data);
+    code->punpckhdq(upper, zero);
+    code->punpckldq(data, zero);
+    code->paddq(data, upper);
+    EmitHorizontalFold(code, data, upper, 64, [this](Xbyak::Xmm a, Xbyak::Xmm b) { code->paddq(a, b); });
+    EmitZeroAllButLowestElement(code, data, 64);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+static void EmitVectorReduceMinMax(BlockOfCode* code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed, bool is_max) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    const u64 element_mask = esize == 32 ? 0xFFFFFFFF : (u64(1) << esize) - 1;
+    const u64 sign_bits = SignBitMask(esize);
+
+    if (esize != 32 && code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        // Transform the elements such that the wanted element is the unsigned minimum, which phminposuw finds directly.
+        u64 flip = 0;
+        if (is_signed) {
+            flip = is_max ? ~sign_bits : sign_bits;
+        } else if (is_max) {
+            flip = ~u64(0);
+        }
+
+        if (flip != 0) {
+            EmitBroadcastConstant(code, tmp, flip);
+            code->pxor(data, tmp);
+        }
+
+        if (esize == 8) {
+            // Reduce adjacent byte pairs to zero-extended words.
+            code->movdqa(tmp, data);
+            code->psrlw(tmp, 8);
+            code->pminub(data, tmp);
+        }
+
+        code->phminposuw(data, data);
+
+        if (flip != 0) {
+            code->pxor(data, code->MConst(flip & element_mask));
+        }
+        EmitZeroAllButLowestElement(code, data, esize);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    // Bias the elements where needed so that an SSE2 instruction can be used for the comparison.
+    const bool biased = esize == 8 ? is_signed : !is_signed && !code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41);
+    if (biased) {
+        EmitBroadcastConstant(code, tmp, sign_bits);
+        code->pxor(data, tmp);
+    }
+
+    switch (esize) {
+    case 8:
+        EmitHorizontalFold(code, data, tmp, 8, [code, is_max](Xbyak::Xmm a, Xbyak::Xmm b) {
+            if (is_max) {
+                code->pmaxub(a, b);
+            } else {
+                code->pminub(a, b);
+            }
+        });
+        break;
+    case 16:
+        EmitHorizontalFold(code, data, tmp, 16, [code, is_max](Xbyak::Xmm a, Xbyak::Xmm b) {
+            if (is_max) {
+                code->pmaxsw(a, b);
+            } else {
+                code->pminsw(a, b);
+            }
+        });
+        break;
+    case 32:
+        if (code->DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+            EmitHorizontalFold(code, data, tmp, 32, [code, is_signed, is_max](Xbyak::Xmm a, Xbyak::Xmm b) {
+                if (is_signed && is_max) {
+                    code->pmaxsd(a, b);
+                } else if (is_signed) {
+                    code->pminsd(a, b);
+                } else if (is_max) {
+                    code->pmaxud(a, b);
+                } else {
+                    code->pminud(a, b);
+                }
+            });
+        } else {
+            Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+            EmitHorizontalFold(code, data, tmp, 32, [code, is_max, mask](Xbyak::Xmm a, Xbyak::Xmm b) {
+                if (is_max) {
+                    code->movdqa(mask, a);
+                    code->pcmpgtd(mask, b);
+                } else {
+                    code->movdqa(mask, b);
+                    code->pcmpgtd(mask, a);
+                }
+                code->pand(a, mask);
+                code->pandn(mask, b);
+                code->por(a, mask);
+            });
+        }
+        break;
+    default:
+        UNREACHABLE();
+    }
+
+    if (biased) {
+        code->pxor(data, code->MConst(sign_bits & element_mask));
+    }
+    EmitZeroAllButLowestElement(code, data, esize);
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReduceMaxS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 8, true, true);
+}
+
+void EmitX64::EmitVectorReduceMaxS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 16, true, true);
+}
+
+void EmitX64::EmitVectorReduceMaxS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 32, true, true);
+}
+
+void EmitX64::EmitVectorReduceMaxU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 8, false, true);
+}
+
+void EmitX64::EmitVectorReduceMaxU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 16, false, true);
+}
+
+void EmitX64::EmitVectorReduceMaxU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 32, false, true);
+}
+
+void EmitX64::EmitVectorReduceMinS8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 8, true, false);
+}
+
+void EmitX64::EmitVectorReduceMinS16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 16, true, false);
+}
+
+void EmitX64::EmitVectorReduceMinS32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 32, true, false);
+}
+
+void EmitX64::EmitVectorReduceMinU8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 8, false, false);
+}
+
+void EmitX64::EmitVectorReduceMinU16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 16, false, false);
+}
+
+void EmitX64::EmitVectorReduceMinU32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorReduceMinMax(code, ctx, inst, 32, false, false);
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
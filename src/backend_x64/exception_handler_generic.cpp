@@ -19,5 +19,13 @@ void BlockOfCode::ExceptionHandler::Register(BlockOfCode*) {
     // Do nothing
 }
 
+bool BlockOfCode::ExceptionHandler::SupportsFastmem() const {
+    return false;
+}
+
+void BlockOfCode::ExceptionHandler::SetFastmemCallback(std::function<boost::optional<FakeCall>(u64)>) {
+    // Do nothing
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
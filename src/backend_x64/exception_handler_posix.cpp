@@ -0,0 +1,202 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ucontext.h>
+
+#include "backend_x64/block_of_code.h"
+#include "common/assert.h"
+#include "common/common_types.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+namespace {
+
+struct CodeBlockInfo {
+    u64 code_begin, code_end;
+    std::function<boost::optional<FakeCall>(u64)> cb;
+};
+
+// The signal handler must not take locks or allocate. Registered code blocks are therefore kept in an
+// immutable sorted vector which is atomically replaced whenever the set of code blocks changes.
+// A replaced vector is only freed once no signal handler could still be reading it.
+class SigHandler {
+public:
+    SigHandler();
+
+    void AddCodeBlock(CodeBlockInfo info);
+    void RemoveCodeBlock(u64 code_begin);
+
+    bool SupportsFastmem() const { return supports_fast_mem; }
+
+private:
+    using CodeBlockInfos = std::vector<CodeBlockInfo>;
+
+    static const CodeBlockInfo* FindCodeBlockInfo(const CodeBlockInfos& infos, u64 rip) {
+        const auto iter = std::upper_bound(infos.begin(), infos.end(), rip, [](u64 rip, const auto& x) { return rip < x.code_begin; });
+        if (iter == infos.begin()) {
+            return nullptr;
+        }
+        const CodeBlockInfo& info = *std::prev(iter);
+        return info.code_end > rip ? &info : nullptr;
+    }
+
+    void Publish(std::unique_ptr<CodeBlockInfos> new_infos);
+
+    bool supports_fast_mem = true;
+
+    std::atomic<const CodeBlockInfos*> code_block_infos{new CodeBlockInfos};
+    std::atomic<size_t> active_readers{0};
+    std::mutex writer_mutex;
+
+    struct sigaction old_sa_segv;
+    struct sigaction old_sa_bus;
+
+    static void SigAction(int sig, siginfo_t* info, void* raw_context);
+};
+
+SigHandler sig_handler;
+
+SigHandler::SigHandler() {
+    struct sigaction sa;
+    sa.sa_handler = nullptr;
+    sa.sa_sigaction = &SigHandler::SigAction;
+    sa.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+
+    if (sigaction(SIGSEGV, &sa, &old_sa_segv) != 0) {
+        supports_fast_mem = false;
+        return;
+    }
+    if (sigaction(SIGBUS, &sa, &old_sa_bus) != 0) {
+        supports_fast_mem = false;
+        return;
+    }
+}
+
+void SigHandler::Publish(std::unique_ptr<CodeBlockInfos> new_infos) {
+    const CodeBlockInfos* old_infos = code_block_infos.exchange(new_infos.release());
+
+    // Wait for any signal handler which may have loaded the old pointer to finish with it.
+    while (active_readers.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    delete old_infos;
+}
+
+void SigHandler::AddCodeBlock(CodeBlockInfo cbi) {
+    std::lock_guard<std::mutex> guard(writer_mutex);
+
+    const CodeBlockInfos& infos = *code_block_infos.load();
+    ASSERT(!FindCodeBlockInfo(infos, cbi.code_begin));
+
+    auto new_infos = std::make_unique<CodeBlockInfos>(infos);
+    const auto iter = std::upper_bound(new_infos->begin(), new_infos->end(), cbi.code_begin, [](u64 code_begin, const auto& x) { return code_begin < x.code_begin; });
+    new_infos->insert(iter, std::move(cbi));
+    Publish(std::move(new_infos));
+}
+
+void SigHandler::RemoveCodeBlock(u64 code_begin) {
+    std::lock_guard<std::mutex> guard(writer_mutex);
+
+    const CodeBlockInfos& infos = *code_block_infos.load();
+    if (!FindCodeBlockInfo(infos, code_begin)) {
+        return;
+    }
+
+    auto new_infos = std::make_unique<CodeBlockInfos>();
+    new_infos->reserve(infos.size() - 1);
+    std::copy_if(infos.begin(), infos.end(), std::back_inserter(*new_infos), [&](const auto& x) { return x.code_begin != code_begin; });
+    Publish(std::move(new_infos));
+}
+
+void SigHandler::SigAction(int sig, siginfo_t* info, void* raw_context) {
+    ASSERT(sig == SIGSEGV || sig == SIGBUS);
+
+    auto& gregs = static_cast<ucontext_t*>(raw_context)->uc_mcontext.gregs;
+    auto& rip = gregs[REG_RIP];
+    auto& rsp = gregs[REG_RSP];
+
+    sig_handler.active_readers.fetch_add(1);
+    const CodeBlockInfo* cbi = FindCodeBlockInfo(*sig_handler.code_block_infos.load(), static_cast<u64>(rip));
+    const boost::optional<FakeCall> fc = cbi ? cbi->cb(static_cast<u64>(rip)) : boost::none;
+    sig_handler.active_readers.fetch_sub(1);
+
+    if (fc) {
+        // Simulate a call from the faulting instruction to the fallback.
+        // Emitted code never stores below rsp, so it is safe to push here.
+        rsp -= sizeof(u64);
+        *reinterpret_cast<u64*>(rsp) = fc->ret_rip;
+        rip = static_cast<greg_t>(fc->call_rip);
+
+        return;
+    }
+
+    // This fault was not a fastmem access: Defer to the previously installed handler.
+    struct sigaction* retry_sa = sig == SIGSEGV ? &sig_handler.old_sa_segv : &sig_handler.old_sa_bus;
+    if (retry_sa->sa_flags & SA_SIGINFO) {
+        retry_sa->sa_sigaction(sig, info, raw_context);
+        return;
+    }
+    if (retry_sa->sa_handler == SIG_DFL) {
+        // Returning re-executes the faulting instruction, which raises the signal again with the default disposition.
+        signal(sig, SIG_DFL);
+        return;
+    }
+    if (retry_sa->sa_handler == SIG_IGN) {
+        return;
+    }
+    retry_sa->sa_handler(sig);
+}
+
+} // anonymous namespace
+
+struct BlockOfCode::ExceptionHandler::Impl final {
+    Impl(u64 code_begin, u64 code_end) : code_begin(code_begin), code_end(code_end) {}
+
+    ~Impl() {
+        sig_handler.RemoveCodeBlock(code_begin);
+    }
+
+    void SetCallback(std::function<boost::optional<FakeCall>(u64)> cb) {
+        sig_handler.RemoveCodeBlock(code_begin);
+        sig_handler.AddCodeBlock({code_begin, code_end, std::move(cb)});
+    }
+
+private:
+    u64 code_begin, code_end;
+};
+
+BlockOfCode::ExceptionHandler::ExceptionHandler() = default;
+BlockOfCode::ExceptionHandler::~ExceptionHandler() = default;
+
+void BlockOfCode::ExceptionHandler::Register(BlockOfCode* code) {
+    const u64 code_begin = reinterpret_cast<u64>(code->getCode());
+    const u64 code_end = code_begin + code->maxSize_;
+    impl = std::make_unique<Impl>(code_begin, code_end);
+}
+
+bool BlockOfCode::ExceptionHandler::SupportsFastmem() const {
+    return impl && sig_handler.SupportsFastmem();
+}
+
+void BlockOfCode::ExceptionHandler::SetFastmemCallback(std::function<boost::optional<FakeCall>(u64)> cb) {
+    ASSERT(impl);
+    impl->SetCallback(std::move(cb));
+}
+
+} // namespace BackendX64
+} // namespace Dynarmic
@@ -198,5 +198,13 @@ void BlockOfCode::ExceptionHandler::Register(BlockOfCode* code) {
     impl = std::make_unique<Impl>(rfuncs, code->getCode());
 }
 
+bool BlockOfCode::ExceptionHandler::SupportsFastmem() const {
+    return false;
+}
+
+void BlockOfCode::ExceptionHandler::SetFastmemCallback(std::function<boost::optional<FakeCall>(u64)>) {
+    // Do nothing
+}
+
 } // namespace BackendX64
 } // namespace Dynarmic
@@ -0,0 +1,120 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <utility>
+
+#include "backend_x64/fastmem_patch_table.h"
+#include "common/assert.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+constexpr size_t initial_table_bits = 10;
+
+FastmemPatchTable::Table::Table(size_t bits)
+    : bits(bits), mask((size_t(1) << bits) - 1), slots(std::make_unique<Slot[]>(size_t(1) << bits)) {}
+
+size_t FastmemPatchTable::Table::Index(u64 location) const {
+    return static_cast<size_t>((location * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+}
+
+FastmemPatchTable::FastmemPatchTable() {
+    Reset(initial_table_bits);
+}
+
+FastmemPatchTable::~FastmemPatchTable() = default;
+
+void FastmemPatchTable::InsertInto(Table& table, u64 location, FastmemPatchInfo info) {
+    ASSERT(location != 0);
+
+    size_t index = table.Index(location);
+    while (true) {
+        Slot& slot = table.slots[index];
+        const u64 slot_location = slot.location.load(std::memory_order_relaxed);
+        if (slot_location == 0) {
+            slot.info = info;
+            slot.location.store(location, std::memory_order_release);
+            return;
+        }
+        ASSERT_MSG(slot_location != location, "Fastmem access registered twice");
+        index = (index + 1) & table.mask;
+    }
+}
+
+void FastmemPatchTable::Insert(u64 location, FastmemPatchInfo info) {
+    Table& table = *tables.back();
+
+    if ((num_entries + 1) * 2 > table.mask + 1) {
+        // Concurrent lookups may be using the current table, so it is left intact until the next Clear or EraseIf.
+        auto new_table = std::make_unique<Table>(table.bits + 1);
+        for (size_t i = 0; i <= table.mask; i++) {
+            const Slot& slot = table.slots[i];
+            if (const u64 slot_location = slot.location.load(std::memory_order_relaxed)) {
+                InsertInto(*new_table, slot_location, slot.info);
+            }
+        }
+        current_table.store(new_table.get(), std::memory_order_release);
+        tables.push_back(std::move(new_table));
+    }
+
+    InsertInto(*tables.back(), location, info);
+    num_entries++;
+}
+
+boost::optional<FastmemPatchInfo> FastmemPatchTable::Lookup(u64 location) const {
+    const Table& table = *current_table.load(std::memory_order_acquire);
+
+    size_t index = table.Index(location);
+    while (true) {
+        const Slot& slot = table.slots[index];
+        const u64 slot_location = slot.location.load(std::memory_order_acquire);
+        if (slot_location == location) {
+            return slot.info;
+        }
+        if (slot_location == 0) {
+            return boost::none;
+        }
+        index = (index + 1) & table.mask;
+    }
+}
+
+void FastmemPatchTable::Clear() {
+    Reset(initial_table_bits);
+}
+
+void FastmemPatchTable::EraseIf(const std::function<bool(u64)>& pred) {
+    std::vector<std::pair<u64, FastmemPatchInfo>> remaining;
+    const Table& table = *tables.back();
+    for (size_t i = 0; i <= table.mask; i++) {
+        const Slot& slot = table.slots[i];
+        const u64 slot_location = slot.location.load(std::memory_order_relaxed);
+        if (slot_location != 0 && !pred(slot_location)) {
+            remaining.emplace_back(slot_location, slot.info);
+        }
+    }
+
+    size_t bits = initial_table_bits;
+    while ((remaining.size() + 1) * 2 > (size_t(1) << bits)) {
+        bits++;
+    }
+
+    Reset(bits);
+    for (const auto& entry : remaining) {
+        InsertInto(*tables.back(), entry.first, entry.second);
+    }
+    num_entries = remaining.size();
+}
+
+void FastmemPatchTable::Reset(size_t bits) {
+    auto table = std::make_unique<Table>(bits);
+    current_table.store(table.get(), std::memory_order_release);
+    tables.clear();
+    tables.push_back(std::move(table));
+    num_entries = 0;
+}
+
+} // namespace BackendX64
+} // namespace Dynarmic
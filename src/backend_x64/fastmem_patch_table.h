@@ -0,0 +1,79 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "common/common_types.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+using CodePtr = const void*;
+
+struct FastmemPatchInfo {
+    CodePtr callback;   ///< Fallback which performs the access via the user's callbacks.
+    CodePtr resume_rip; ///< Location immediately after the access.
+    size_t size;        ///< Size of the patchable region.
+};
+
+/**
+ * Maps the locations of fastmem accesses to their patch information.
+ *
+ * Lookup is called from the fault handler, so it takes no locks and does not allocate. It may run concurrently
+ * with Insert, which only ever fills empty slots and publishes a slot's contents by storing its location last.
+ * The table is open-addressed and kept at most half full, growing into a new table when required. A table
+ * which has been replaced may still be in use by a concurrent Lookup, so it is only freed by Clear or EraseIf.
+ */
+class FastmemPatchTable final {
+public:
+    FastmemPatchTable();
+    ~FastmemPatchTable();
+
+    /// Adds an entry for location, which must not already be present.
+    void Insert(u64 location, FastmemPatchInfo info);
+
+    /// Async-signal-safe.
+    boost::optional<FastmemPatchInfo> Lookup(u64 location) const;
+
+    /// Must only be called while no thread may call Lookup.
+    void Clear();
+    /// Removes all entries whose location satisfies pred. Must only be called while no thread may call Lookup.
+    void EraseIf(const std::function<bool(u64)>& pred);
+
+private:
+    struct Slot {
+        std::atomic<u64> location{0}; ///< Zero if this slot is empty.
+        FastmemPatchInfo info;
+    };
+
+    struct Table {
+        explicit Table(size_t bits);
+
+        size_t Index(u64 location) const;
+
+        const size_t bits;
+        const size_t mask;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    static void InsertInto(Table& table, u64 location, FastmemPatchInfo info);
+    void Reset(size_t bits);
+
+    std::atomic<const Table*> current_table{nullptr};
+    std::vector<std::unique_ptr<Table>> tables; ///< The last of these is current_table.
+    size_t num_entries = 0;
+};
+
+} // namespace BackendX64
+} // namespace Dynarmic
@@ -8,11 +8,15 @@
 
 #include <cstddef>
 
+#include <xbyak.h>
+
 #include "common/common_types.h"
 
 namespace Dynarmic {
 namespace BackendX64 {
 
+class BlockOfCode;
+
 struct JitStateInfo {
     template <typename JitStateType>
     JitStateInfo(const JitStateType&)
@@ -20,6 +24,8 @@ struct JitStateInfo {
         , offsetof_cycles_to_run(offsetof(JitStateType, cycles_to_run))
         , offsetof_save_host_MXCSR(offsetof(JitStateType, save_host_MXCSR))
         , offsetof_guest_MXCSR(offsetof(JitStateType, guest_MXCSR))
+        , offsetof_halt_requested(offsetof(JitStateType, halt_requested))
+        , offsetof_dispatch_table(offsetof(JitStateType, dispatch_table))
         , offsetof_rsb_ptr(offsetof(JitStateType, rsb_ptr))
         , rsb_ptr_mask(JitStateType::RSBPtrMask)
         , offsetof_rsb_location_descriptors(offsetof(JitStateType, rsb_location_descriptors))
@@ -28,12 +34,16 @@ struct JitStateInfo {
         , offsetof_FPSCR_nzcv(offsetof(JitStateType, FPSCR_nzcv))
         , offsetof_FPSCR_IDC(offsetof(JitStateType, FPSCR_IDC))
         , offsetof_FPSCR_UFC(offsetof(JitStateType, FPSCR_UFC))
+        , offsetof_FPSCR_QC(offsetof(JitStateType, FPSCR_QC))
+        , EmitUniqueHash(&JitStateType::EmitUniqueHash)
     {}
 
     const size_t offsetof_cycles_remaining;
     const size_t offsetof_cycles_to_run;
     const size_t offsetof_save_host_MXCSR;
     const size_t offsetof_guest_MXCSR;
+    const size_t offsetof_halt_requested;
+    const size_t offsetof_dispatch_table;
     const size_t offsetof_rsb_ptr;
     const size_t rsb_ptr_mask;
     const size_t offsetof_rsb_location_descriptors;
@@ -42,6 +52,10 @@ struct JitStateInfo {
     const size_t offsetof_FPSCR_nzcv;
     const size_t offsetof_FPSCR_IDC;
     const size_t offsetof_FPSCR_UFC;
+    const size_t offsetof_FPSCR_QC;
+
+    /// Code emitter: Calculates the equivalent of JitStateType::GetUniqueHash into result.
+    void (* const EmitUniqueHash)(BlockOfCode* code, Xbyak::Reg64 result, Xbyak::Reg64 scratch);
 };
 
 } // namespace BackendX64
@@ -301,6 +301,11 @@ HostLoc RegAlloc::UseImpl(IR::Value use_value, HostLocList desired_locations) {
     }
 
     const HostLoc destination_location = SelectARegister(desired_locations);
+    if (LocInfo(current_location).GetMaxBitWidth() > HostLocBitWidth(destination_location)) {
+        // A narrower view of a wider value (e.g. element 0 of a vector) cannot migrate wholesale.
+        return UseScratchImpl(use_value, desired_locations);
+    }
+
     if (IsSameHostLocClass(destination_location, current_location)) {
         Exchange(destination_location, current_location);
     } else {
@@ -466,11 +471,7 @@ HostLoc RegAlloc::LoadImmediate(IR::Value imm, HostLoc host_loc) {
 
     if (HostLocIsXMM(host_loc)) {
         Xbyak::Xmm reg = HostLocToXmm(host_loc);
-        u64 imm_value = ImmediateToU64(imm);
-        if (imm_value == 0)
-            code->pxor(reg, reg);
-        else
-            code->movdqa(reg, code->MConst(imm_value)); // TODO: movaps/movapd more appropriate sometimes
+        code->LoadConstant(reg, ImmediateToU64(imm));
         return host_loc;
     }
 
@@ -573,8 +574,8 @@ void RegAlloc::EmitMove(HostLoc to, HostLoc from) {
             code->movd(HostLocToXmm(to), HostLocToReg64(from).cvt32());
         }
     } else if (HostLocIsGPR(to) && HostLocIsXMM(from)) {
-        ASSERT(bit_width != 128);
-        if (bit_width == 64) {
+        // A 128-bit source only reaches here when copying its low bits to scratch.
+        if (bit_width >= 64) {
             code->movq(HostLocToReg64(to), HostLocToXmm(from));
         } else {
             code->movd(HostLocToReg64(to).cvt32(), HostLocToXmm(from));
@@ -618,16 +619,16 @@ void RegAlloc::EmitMove(HostLoc to, HostLoc from) {
     } else if (HostLocIsGPR(to) && HostLocIsSpill(from)) {
         ASSERT(bit_width != 128);
         if (bit_width == 64) {
-            code->mov(HostLocToReg64(to), spill_to_addr(from));
+            code->mov(HostLocToReg64(to), Xbyak::util::qword[spill_to_addr(from).getRegExp()]);
         } else {
-            code->mov(HostLocToReg64(to).cvt32(), spill_to_addr(from));
+            code->mov(HostLocToReg64(to).cvt32(), Xbyak::util::dword[spill_to_addr(from).getRegExp()]);
         }
     } else if (HostLocIsSpill(to) && HostLocIsGPR(from)) {
         ASSERT(bit_width != 128);
         if (bit_width == 64) {
-            code->mov(spill_to_addr(to), HostLocToReg64(from));
+            code->mov(Xbyak::util::qword[spill_to_addr(to).getRegExp()], HostLocToReg64(from));
         } else {
-            code->mov(spill_to_addr(to), HostLocToReg64(from).cvt32());
+            code->mov(Xbyak::util::dword[spill_to_addr(to).getRegExp()], HostLocToReg64(from).cvt32());
         }
     } else {
         ASSERT_MSG(false, "Invalid RegAlloc::EmitMove");
@@ -0,0 +1,151 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <cstring>
+#include <utility>
+
+#include "backend_x64/translation_cache.h"
+#include "common/assert.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/serialization.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+namespace {
+
+constexpr u32 Magic = 0x54524E44; // "DNRT"
+constexpr u32 FormatVersion = 1;
+
+struct Header {
+    u32 magic;
+    u32 format_version;
+    u32 opcode_count; ///< Guards against data from a version of this library with a different IR.
+    u32 reserved;
+    u64 num_entries;
+    u64 checksum; ///< Of all data following the header.
+};
+
+struct EntryHeader {
+    u64 location;
+    u64 code_address;
+    u64 code_num_words;
+    u64 code_hash;
+    u64 serialized_block_size;
+};
+
+// FNV-1a
+constexpr u64 HashBasis = 0xCBF29CE484222325;
+constexpr u64 HashPrime = 0x100000001B3;
+
+u64 HashBytes(u64 hash, const u8* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * HashPrime;
+    }
+    return hash;
+}
+
+template <typename T>
+void Append(std::vector<u8>& out, const T& value) {
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+} // anonymous namespace
+
+TranslationCache::GuestCode TranslationCache::HashGuestCode(u64 address, u64 num_words, const ReadCodeFn& read_code) {
+    u64 hash = HashBasis;
+    for (u64 i = 0; i < num_words; i++) {
+        const u32 word = read_code(address + i * 4);
+        hash = HashBytes(hash, reinterpret_cast<const u8*>(&word), sizeof(word));
+    }
+    return {address, num_words, hash};
+}
+
+void TranslationCache::Insert(const IR::Block& block, const GuestCode& guest_code) {
+    Entry entry{guest_code, {}};
+    IR::SerializeBlock(block, entry.serialized_block);
+    entries.insert_or_assign(block.Location(), std::move(entry));
+}
+
+boost::optional<IR::Block> TranslationCache::Lookup(IR::LocationDescriptor location, const ReadCodeFn& read_code) const {
+    const auto iter = entries.find(location);
+    if (iter == entries.end())
+        return boost::none;
+
+    const Entry& entry = iter->second;
+    const GuestCode current_code = HashGuestCode(entry.guest_code.address, entry.guest_code.num_words, read_code);
+    if (current_code.hash != entry.guest_code.hash)
+        return boost::none;
+
+    const u8* data = entry.serialized_block.data();
+    auto block = IR::DeserializeBlock(data, data + entry.serialized_block.size());
+    ASSERT(block);
+    return block;
+}
+
+std::vector<u8> TranslationCache::Save() const {
+    std::vector<u8> payload;
+    for (const auto& location_entry : entries) {
+        const Entry& entry = location_entry.second;
+        Append(payload, EntryHeader{location_entry.first.Value(), entry.guest_code.address, entry.guest_code.num_words, entry.guest_code.hash, entry.serialized_block.size()});
+        payload.insert(payload.end(), entry.serialized_block.begin(), entry.serialized_block.end());
+    }
+
+    std::vector<u8> result;
+    Append(result, Header{Magic, FormatVersion, static_cast<u32>(IR::OpcodeCount), 0, entries.size(), HashBytes(HashBasis, payload.data(), payload.size())});
+    result.insert(result.end(), payload.begin(), payload.end());
+    return result;
+}
+
+bool TranslationCache::Load(const std::vector<u8>& data) {
+    Header header;
+    if (data.size() < sizeof(header))
+        return false;
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    const u8* current = data.data() + sizeof(header);
+    const u8* const end = data.data() + data.size();
+
+    if (header.magic != Magic || header.format_version != FormatVersion || header.opcode_count != IR::OpcodeCount)
+        return false;
+    if (header.checksum != HashBytes(HashBasis, current, static_cast<size_t>(end - current)))
+        return false;
+
+    std::unordered_map<IR::LocationDescriptor, Entry> loaded_entries;
+    for (u64 i = 0; i < header.num_entries; i++) {
+        EntryHeader entry_header;
+        if (static_cast<size_t>(end - current) < sizeof(entry_header))
+            return false;
+        std::memcpy(&entry_header, current, sizeof(entry_header));
+        current += sizeof(entry_header);
+
+        if (static_cast<u64>(end - current) < entry_header.serialized_block_size)
+            return false;
+        const u8* const block_begin = current;
+        const u8* const block_end = current + entry_header.serialized_block_size;
+
+        // Check that the block is well-formed now so that Lookup need not.
+        const auto block = IR::DeserializeBlock(current, block_end);
+        if (!block || current != block_end || block->Location().Value() != entry_header.location)
+            return false;
+
+        const GuestCode guest_code{entry_header.code_address, entry_header.code_num_words, entry_header.code_hash};
+        loaded_entries.insert_or_assign(IR::LocationDescriptor{entry_header.location}, Entry{guest_code, std::vector<u8>(block_begin, block_end)});
+    }
+
+    if (current != end)
+        return false;
+
+    for (auto& location_entry : loaded_entries) {
+        entries.insert_or_assign(location_entry.first, std::move(location_entry.second));
+    }
+    return true;
+}
+
+} // namespace BackendX64
+} // namespace Dynarmic
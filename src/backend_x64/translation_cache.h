@@ -0,0 +1,65 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/location_descriptor.h"
+
+namespace Dynarmic {
+namespace BackendX64 {
+
+/**
+ * Retains the intermediate representation of translated blocks so that it can be persisted and reused by
+ * a later session. A block is only reused if the guest code it was translated from is unchanged.
+ */
+class TranslationCache final {
+public:
+    using ReadCodeFn = std::function<u32(u64)>;
+
+    /// Identifies the guest code a block was translated from.
+    struct GuestCode {
+        u64 address;
+        u64 num_words;
+        u64 hash;
+    };
+
+    /// Hashes the num_words 32-bit words of guest code starting at address.
+    static GuestCode HashGuestCode(u64 address, u64 num_words, const ReadCodeFn& read_code);
+
+    /// Adds block, which was translated from guest_code, replacing any existing block at the same location.
+    void Insert(const IR::Block& block, const GuestCode& guest_code);
+
+    /// Returns the block at location if there is one and the guest code it was translated from is unchanged.
+    boost::optional<IR::Block> Lookup(IR::LocationDescriptor location, const ReadCodeFn& read_code) const;
+
+    /// Serializes the contents of the cache. The result is only meaningful to the same version of this library.
+    std::vector<u8> Save() const;
+
+    /**
+     * Adds the contents of a cache serialized by Save, replacing existing blocks at the same locations.
+     * @returns false if data is malformed, in which case the cache is unchanged.
+     */
+    bool Load(const std::vector<u8>& data);
+
+private:
+    struct Entry {
+        GuestCode guest_code;
+        std::vector<u8> serialized_block;
+    };
+
+    std::unordered_map<IR::LocationDescriptor, Entry> entries;
+};
+
+} // namespace BackendX64
+} // namespace Dynarmic
@@ -0,0 +1,47 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "common/common_types.h"
+
+namespace Dynarmic {
+namespace Common {
+namespace Atomic {
+
+// Sequentially consistent operations on plain integers, for fields which emitted code also accesses directly.
+
+inline u32 Load(volatile u32* ptr) {
+#ifdef _MSC_VER
+    return _InterlockedOr(reinterpret_cast<volatile long*>(ptr), 0);
+#else
+    return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+#endif
+}
+
+inline void Or(volatile u32* ptr, u32 value) {
+#ifdef _MSC_VER
+    _InterlockedOr(reinterpret_cast<volatile long*>(ptr), value);
+#else
+    __atomic_or_fetch(ptr, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+inline void And(volatile u32* ptr, u32 value) {
+#ifdef _MSC_VER
+    _InterlockedAnd(reinterpret_cast<volatile long*>(ptr), value);
+#else
+    __atomic_and_fetch(ptr, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+} // namespace Atomic
+} // namespace Common
+} // namespace Dynarmic
@@ -0,0 +1,25 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+namespace Dynarmic {
+namespace FP {
+
+/**
+ * Rounding modes that an IR instruction may explicitly request.
+ * The first four values match the encoding of the FPCR.RMode and FPSCR.RMode fields.
+ */
+enum class RoundingMode {
+    ToNearest_TieEven,
+    TowardsPlusInfinity,
+    TowardsMinusInfinity,
+    TowardsZero,
+    ToNearest_TieAwayFromZero,
+};
+
+} // namespace FP
+} // namespace Dynarmic
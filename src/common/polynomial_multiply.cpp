@@ -0,0 +1,36 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <array>
+
+#include "common/common_types.h"
+#include "common/polynomial_multiply.h"
+
+namespace Dynarmic {
+namespace Common {
+
+std::array<u64, 2> PolynomialMultiplyLong64(u64 a, u64 b) {
+    u64 a_lo = a;
+    u64 a_hi = 0;
+    u64 result_lo = 0;
+    u64 result_hi = 0;
+
+    // Shift-and-add multiplication over the bits of b, with addition replaced by exclusive-or.
+    while (b != 0) {
+        if (b & 1) {
+            result_lo ^= a_lo;
+            result_hi ^= a_hi;
+        }
+        a_hi = (a_hi << 1) | (a_lo >> 63);
+        a_lo <<= 1;
+        b >>= 1;
+    }
+
+    return {result_lo, result_hi};
+}
+
+} // namespace Common
+} // namespace Dynarmic
@@ -0,0 +1,21 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "common/common_types.h"
+
+namespace Dynarmic {
+namespace Common {
+
+/// Carry-less multiplication of two 64-bit polynomials over GF(2).
+/// Returns the 128-bit product as {low half, high half}.
+std::array<u64, 2> PolynomialMultiplyLong64(u64 a, u64 b);
+
+} // namespace Common
+} // namespace Dynarmic
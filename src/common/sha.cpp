@@ -0,0 +1,134 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <array>
+
+#include "common/bit_util.h"
+#include "common/common_types.h"
+#include "common/sha.h"
+
+namespace Dynarmic {
+namespace Common {
+namespace SHA {
+
+namespace {
+
+enum class SHA1Function {
+    Choose,
+    Majority,
+    Parity,
+};
+
+u32 ROL(u32 value, size_t amount) {
+    return Common::RotateRight(value, 32 - amount);
+}
+
+template <SHA1Function function>
+void SHA1HashUpdate(Vector& result, const Vector& x, const Vector& y, const Vector& w) {
+    result = x;
+    u32 e = y[0];
+
+    for (size_t i = 0; i < 4; i++) {
+        const u32 b = result[1];
+        const u32 c = result[2];
+        const u32 d = result[3];
+
+        u32 t;
+        if constexpr (function == SHA1Function::Choose) {
+            t = (b & c) | (~b & d);
+        } else if constexpr (function == SHA1Function::Majority) {
+            t = (b & c) | (b & d) | (c & d);
+        } else {
+            t = b ^ c ^ d;
+        }
+
+        e = e + ROL(result[0], 5) + t + w[i];
+        result[1] = ROL(result[1], 30);
+
+        const u32 next_e = result[3];
+        result = {e, result[0], result[1], result[2]};
+        e = next_e;
+    }
+}
+
+} // anonymous namespace
+
+void SHA1HashUpdateChoose(Vector& result, const Vector& x, const Vector& y, const Vector& w) {
+    SHA1HashUpdate<SHA1Function::Choose>(result, x, y, w);
+}
+
+void SHA1HashUpdateMajority(Vector& result, const Vector& x, const Vector& y, const Vector& w) {
+    SHA1HashUpdate<SHA1Function::Majority>(result, x, y, w);
+}
+
+void SHA1HashUpdateParity(Vector& result, const Vector& x, const Vector& y, const Vector& w) {
+    SHA1HashUpdate<SHA1Function::Parity>(result, x, y, w);
+}
+
+void SHA1MessageSchedule1(Vector& result, const Vector& a, const Vector& b) {
+    const Vector t = {a[0] ^ b[1], a[1] ^ b[2], a[2] ^ b[3], a[3]};
+    result[0] = ROL(t[0], 1);
+    result[1] = ROL(t[1], 1);
+    result[2] = ROL(t[2], 1);
+    result[3] = ROL(t[3], 1) ^ ROL(t[0], 2);
+}
+
+namespace {
+
+template <bool part1>
+void SHA256Hash(Vector& result, const Vector& x_in, const Vector& y_in, const Vector& w) {
+    const auto sigma0 = [](u32 v) { return Common::RotateRight(v, 2) ^ Common::RotateRight(v, 13) ^ Common::RotateRight(v, 22); };
+    const auto sigma1 = [](u32 v) { return Common::RotateRight(v, 6) ^ Common::RotateRight(v, 11) ^ Common::RotateRight(v, 25); };
+
+    Vector x = x_in;
+    Vector y = y_in;
+
+    for (size_t i = 0; i < 4; i++) {
+        const u32 choose = (y[0] & y[1]) ^ (~y[0] & y[2]);
+        const u32 majority = (x[0] & x[1]) ^ (x[0] & x[2]) ^ (x[1] & x[2]);
+        const u32 t = y[3] + sigma1(y[0]) + choose + w[i];
+        const u32 new_x3 = t + x[3];
+        const u32 new_y3 = t + sigma0(x[0]) + majority;
+
+        // <Y, X> = ROL(Y : X, 32)
+        y = {new_x3, y[0], y[1], y[2]};
+        x = {new_y3, x[0], x[1], x[2]};
+    }
+
+    result = part1 ? x : y;
+}
+
+} // anonymous namespace
+
+void SHA256HashPart1(Vector& result, const Vector& x, const Vector& y, const Vector& w) {
+    SHA256Hash<true>(result, x, y, w);
+}
+
+void SHA256HashPart2(Vector& result, const Vector& x, const Vector& y, const Vector& w) {
+    SHA256Hash<false>(result, x, y, w);
+}
+
+void SHA256MessageSchedule0(Vector& result, const Vector& a, const Vector& b) {
+    const auto sigma0 = [](u32 v) { return Common::RotateRight(v, 7) ^ Common::RotateRight(v, 18) ^ (v >> 3); };
+
+    result[0] = a[0] + sigma0(a[1]);
+    result[1] = a[1] + sigma0(a[2]);
+    result[2] = a[2] + sigma0(a[3]);
+    result[3] = a[3] + sigma0(b[0]);
+}
+
+void SHA256MessageSchedule1(Vector& result, const Vector& a, const Vector& b, const Vector& c) {
+    const auto sigma1 = [](u32 v) { return Common::RotateRight(v, 17) ^ Common::RotateRight(v, 19) ^ (v >> 10); };
+
+    result[0] = a[0] + b[1] + sigma1(c[2]);
+    result[1] = a[1] + b[2] + sigma1(c[3]);
+    result[2] = a[2] + b[3] + sigma1(result[0]);
+    result[3] = a[3] + c[0] + sigma1(result[1]);
+}
+
+} // namespace SHA
+} // namespace Common
+} // namespace Dynarmic
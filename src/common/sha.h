@@ -0,0 +1,34 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "common/common_types.h"
+
+namespace Dynarmic {
+namespace Common {
+namespace SHA {
+
+// Element 0 is the least significant word, matching the AArch64 register layout.
+using Vector = std::array<u32, 4>;
+
+// x holds {a, b, c, d}, y<31:0> holds e and w holds four message words with the round constant added.
+void SHA1HashUpdateChoose(Vector& result, const Vector& x, const Vector& y, const Vector& w);
+void SHA1HashUpdateMajority(Vector& result, const Vector& x, const Vector& y, const Vector& w);
+void SHA1HashUpdateParity(Vector& result, const Vector& x, const Vector& y, const Vector& w);
+void SHA1MessageSchedule1(Vector& result, const Vector& a, const Vector& b);
+
+// x holds {a, b, c, d} and y holds {e, f, g, h}. Part 1 returns the updated x and part 2 the updated y.
+void SHA256HashPart1(Vector& result, const Vector& x, const Vector& y, const Vector& w);
+void SHA256HashPart2(Vector& result, const Vector& x, const Vector& y, const Vector& w);
+void SHA256MessageSchedule0(Vector& result, const Vector& a, const Vector& b);
+void SHA256MessageSchedule1(Vector& result, const Vector& a, const Vector& b, const Vector& c);
+
+} // namespace SHA
+} // namespace Common
+} // namespace Dynarmic
@@ -17,6 +17,7 @@
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic {
@@ -25,6 +26,13 @@ namespace A32 {
 template <typename Visitor>
 using ArmMatcher = Decoder::Matcher<Visitor, u32>;
 
+namespace detail {
+/// Bits [7:4] and [27:20] distinguish between most groups of instructions.
+inline size_t ToFastLookupIndexArm(u32 instruction) {
+    return ((instruction >> 4) & 0x00F) | ((instruction >> 16) & 0xFF0);
+}
+} // namespace detail
+
 template <typename V>
 std::vector<ArmMatcher<V>> GetArmDecodeTable() {
     std::vector<ArmMatcher<V>> table = {
@@ -322,12 +330,9 @@ std::vector<ArmMatcher<V>> GetArmDecodeTable() {
 
 template<typename V>
 boost::optional<const ArmMatcher<V>&> DecodeArm(u32 instruction) {
-    static const auto table = GetArmDecodeTable<V>();
-
-    const auto matches_instruction = [instruction](const auto& matcher) { return matcher.Matches(instruction); };
+    static const Decoder::LookupTable<ArmMatcher<V>, 12> table{GetArmDecodeTable<V>(), &detail::ToFastLookupIndexArm};
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? boost::optional<const ArmMatcher<V>&>(*iter) : boost::none;
+    return table.Decode(instruction);
 }
 
 } // namespace A32
@@ -12,6 +12,7 @@
 
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic {
@@ -20,9 +21,16 @@ namespace A32 {
 template <typename Visitor>
 using Thumb16Matcher = Decoder::Matcher<Visitor, u16>;
 
-template<typename V>
-boost::optional<const Thumb16Matcher<V>&> DecodeThumb16(u16 instruction) {
-    static const std::vector<Thumb16Matcher<V>> table = {
+namespace detail {
+/// Bits [15:6] distinguish between most groups of instructions.
+inline size_t ToFastLookupIndexThumb16(u16 instruction) {
+    return instruction >> 6;
+}
+} // namespace detail
+
+template <typename V>
+std::vector<Thumb16Matcher<V>> GetThumb16DecodeTable() {
+    return {
 
 #define INST(fn, name, bitstring) Decoder::detail::detail<Thumb16Matcher<V>>::GetMatcher(fn, name, bitstring)
 
@@ -116,11 +124,13 @@ boost::optional<const Thumb16Matcher<V>&> DecodeThumb16(u16 instruction) {
 #undef INST
 
     };
+}
 
-    const auto matches_instruction = [instruction](const auto& matcher){ return matcher.Matches(instruction); };
+template<typename V>
+boost::optional<const Thumb16Matcher<V>&> DecodeThumb16(u16 instruction) {
+    static const Decoder::LookupTable<Thumb16Matcher<V>, 10> table{GetThumb16DecodeTable<V>(), &detail::ToFastLookupIndexThumb16};
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? boost::optional<const Thumb16Matcher<V>&>(*iter) : boost::none;
+    return table.Decode(instruction);
 }
 
 } // namespace A32
@@ -12,6 +12,7 @@
 
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic {
@@ -20,9 +21,16 @@ namespace A32 {
 template <typename Visitor>
 using Thumb32Matcher = Decoder::Matcher<Visitor, u32>;
 
-template<typename V>
-boost::optional<const Thumb32Matcher<V>&> DecodeThumb32(u32 instruction) {
-    static const std::vector<Thumb32Matcher<V>> table = {
+namespace detail {
+/// Bits [31:27] and [15:11] distinguish between most groups of instructions.
+inline size_t ToFastLookupIndexThumb32(u32 instruction) {
+    return ((instruction >> 11) & 0x01F) | ((instruction >> 22) & 0x3E0);
+}
+} // namespace detail
+
+template <typename V>
+std::vector<Thumb32Matcher<V>> GetThumb32DecodeTable() {
+    return {
 
 #define INST(fn, name, bitstring) Decoder::detail::detail<Thumb32Matcher<V>>::GetMatcher(fn, name, bitstring)
 
@@ -36,11 +44,13 @@ boost::optional<const Thumb32Matcher<V>&> DecodeThumb32(u32 instruction) {
 #undef INST
 
     };
+}
 
-    const auto matches_instruction = [instruction](const auto& matcher){ return matcher.Matches(instruction); };
+template<typename V>
+boost::optional<const Thumb32Matcher<V>&> DecodeThumb32(u32 instruction) {
+    static const Decoder::LookupTable<Thumb32Matcher<V>, 10> table{GetThumb32DecodeTable<V>(), &detail::ToFastLookupIndexThumb32};
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? boost::optional<const Thumb32Matcher<V>&>(*iter) : boost::none;
+    return table.Decode(instruction);
 }
 
 } // namespace A32
@@ -12,6 +12,7 @@
 
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic {
@@ -20,9 +21,16 @@ namespace A32 {
 template <typename Visitor>
 using VFP2Matcher = Decoder::Matcher<Visitor, u32>;
 
-template<typename V>
-boost::optional<const VFP2Matcher<V>&> DecodeVFP2(u32 instruction) {
-    static const std::vector<VFP2Matcher<V>> table = {
+namespace detail {
+/// Bits [7:4] and [27:20] distinguish between most groups of instructions.
+inline size_t ToFastLookupIndexVFP2(u32 instruction) {
+    return ((instruction >> 4) & 0x00F) | ((instruction >> 16) & 0xFF0);
+}
+} // namespace detail
+
+template <typename V>
+std::vector<VFP2Matcher<V>> GetVFP2DecodeTable() {
+    return {
 
 #define INST(fn, name, bitstring) Decoder::detail::detail<VFP2Matcher<V>>::GetMatcher(fn, name, bitstring)
 
@@ -78,14 +86,16 @@ boost::optional<const VFP2Matcher<V>&> DecodeVFP2(u32 instruction) {
 #undef INST
 
     };
+}
+
+template<typename V>
+boost::optional<const VFP2Matcher<V>&> DecodeVFP2(u32 instruction) {
+    static const Decoder::LookupTable<VFP2Matcher<V>, 12> table{GetVFP2DecodeTable<V>(), &detail::ToFastLookupIndexVFP2};
 
     if ((instruction & 0xF0000000) == 0xF0000000)
         return boost::none; // Don't try matching any unconditional instructions.
 
-    const auto matches_instruction = [instruction](const auto& matcher){ return matcher.Matches(instruction); };
-
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? boost::optional<const VFP2Matcher<V>&>(*iter) : boost::none;
+    return table.Decode(instruction);
 }
 
 } // namespace A32
@@ -535,9 +535,9 @@ bool ArmTranslatorVisitor::vfp2_VCMP(Cond cond, bool D, size_t Vd, bool sz, bool
         auto reg_d = ir.GetExtendedRegister(d);
         auto reg_m = ir.GetExtendedRegister(m);
         if (sz) {
-            ir.FPCompare64(reg_d, reg_m, exc_on_qnan, true);
+            ir.SetFpscrNZCV(ir.FPCompare64(reg_d, reg_m, exc_on_qnan, true));
         } else {
-            ir.FPCompare32(reg_d, reg_m, exc_on_qnan, true);
+            ir.SetFpscrNZCV(ir.FPCompare32(reg_d, reg_m, exc_on_qnan, true));
         }
     }
     return true;
@@ -551,9 +551,9 @@ bool ArmTranslatorVisitor::vfp2_VCMP_zero(Cond cond, bool D, size_t Vd, bool sz,
     if (ConditionPassed(cond)) {
         auto reg_d = ir.GetExtendedRegister(d);
         if (sz) {
-            ir.FPCompare64(reg_d, ir.Imm64(0), exc_on_qnan, true);
+            ir.SetFpscrNZCV(ir.FPCompare64(reg_d, ir.Imm64(0), exc_on_qnan, true));
         } else {
-            ir.FPCompare32(reg_d, ir.Imm32(0), exc_on_qnan, true);
+            ir.SetFpscrNZCV(ir.FPCompare32(reg_d, ir.Imm32(0), exc_on_qnan, true));
         }
     }
     return true;
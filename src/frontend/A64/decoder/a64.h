@@ -8,6 +8,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <set>
+#include <string>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -15,6 +17,7 @@
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic {
@@ -23,6 +26,13 @@ namespace A64 {
 template <typename Visitor>
 using Matcher = Decoder::Matcher<Visitor, u32>;
 
+namespace detail {
+/// Bits [13:10] and [29:22] distinguish between most groups of instructions.
+inline size_t ToFastLookupIndex(u32 instruction) {
+    return ((instruction >> 10) & 0x00F) | ((instruction >> 18) & 0xFF0);
+}
+} // namespace detail
+
 template <typename Visitor>
 std::vector<Matcher<Visitor>> GetDecodeTable() {
     std::vector<Matcher<Visitor>> table = {
@@ -36,17 +46,25 @@ std::vector<Matcher<Visitor>> GetDecodeTable() {
         return Common::BitCount(matcher1.GetMask()) > Common::BitCount(matcher2.GetMask());
     });
 
+    // Exceptions to the above rule of thumb.
+    // SIMD modified immediate encodings are the immh == 0b0000 subset of the SIMD shift by immediate encodings.
+    const std::set<std::string> comes_first {
+        "MOVI, MVNI, ORR, BIC (vector, immediate)",
+        "FMOV (vector, immediate)",
+    };
+
+    std::stable_partition(table.begin(), table.end(), [&](const auto& matcher) {
+        return comes_first.count(matcher.GetName()) > 0;
+    });
+
     return table;
 }
 
 template<typename Visitor>
 boost::optional<const Matcher<Visitor>&> Decode(u32 instruction) {
-    static const auto table = GetDecodeTable<Visitor>();
-
-    const auto matches_instruction = [instruction](const auto& matcher) { return matcher.Matches(instruction); };
+    static const Decoder::LookupTable<Matcher<Visitor>, 12> table{GetDecodeTable<Visitor>(), &detail::ToFastLookupIndex};
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? boost::optional<const Matcher<Visitor>&>(*iter) : boost::none;
+    return table.Decode(instruction);
 }
 
 } // namespace A64
@@ -58,6 +58,10 @@ IR::U64 IREmitter::ReadMemory64(const IR::U64& vaddr) {
     return Inst<IR::U64>(Opcode::A64ReadMemory64, vaddr);
 }
 
+IR::U128 IREmitter::ReadMemory128(const IR::U64& vaddr) {
+    return Inst<IR::U128>(Opcode::A64ReadMemory128, vaddr);
+}
+
 void IREmitter::WriteMemory8(const IR::U64& vaddr, const IR::U8& value) {
     Inst(Opcode::A64WriteMemory8, vaddr, value);
 }
@@ -74,6 +78,96 @@ void IREmitter::WriteMemory64(const IR::U64& vaddr, const IR::U64& value) {
     Inst(Opcode::A64WriteMemory64, vaddr, value);
 }
 
+void IREmitter::WriteMemory128(const IR::U64& vaddr, const IR::U128& value) {
+    Inst(Opcode::A64WriteMemory128, vaddr, value);
+}
+
+void IREmitter::ClearExclusive() {
+    Inst(Opcode::A64ClearExclusive);
+}
+
+void IREmitter::DataMemoryBarrier() {
+    Inst(Opcode::A64DataMemoryBarrier);
+}
+
+IR::U8 IREmitter::ExclusiveReadMemory8(const IR::U64& vaddr) {
+    return Inst<IR::U8>(Opcode::A64ExclusiveReadMemory8, vaddr);
+}
+
+IR::U16 IREmitter::ExclusiveReadMemory16(const IR::U64& vaddr) {
+    return Inst<IR::U16>(Opcode::A64ExclusiveReadMemory16, vaddr);
+}
+
+IR::U32 IREmitter::ExclusiveReadMemory32(const IR::U64& vaddr) {
+    return Inst<IR::U32>(Opcode::A64ExclusiveReadMemory32, vaddr);
+}
+
+IR::U64 IREmitter::ExclusiveReadMemory64(const IR::U64& vaddr) {
+    return Inst<IR::U64>(Opcode::A64ExclusiveReadMemory64, vaddr);
+}
+
+IR::U128 IREmitter::ExclusiveReadMemory128(const IR::U64& vaddr) {
+    return Inst<IR::U128>(Opcode::A64ExclusiveReadMemory128, vaddr);
+}
+
+IR::U32 IREmitter::ExclusiveWriteMemory8(const IR::U64& vaddr, const IR::U8& value) {
+    return Inst<IR::U32>(Opcode::A64ExclusiveWriteMemory8, vaddr, value);
+}
+
+IR::U32 IREmitter::ExclusiveWriteMemory16(const IR::U64& vaddr, const IR::U16& value) {
+    return Inst<IR::U32>(Opcode::A64ExclusiveWriteMemory16, vaddr, value);
+}
+
+IR::U32 IREmitter::ExclusiveWriteMemory32(const IR::U64& vaddr, const IR::U32& value) {
+    return Inst<IR::U32>(Opcode::A64ExclusiveWriteMemory32, vaddr, value);
+}
+
+IR::U32 IREmitter::ExclusiveWriteMemory64(const IR::U64& vaddr, const IR::U64& value) {
+    return Inst<IR::U32>(Opcode::A64ExclusiveWriteMemory64, vaddr, value);
+}
+
+IR::U32 IREmitter::ExclusiveWriteMemory128(const IR::U64& vaddr, const IR::U128& value) {
+    return Inst<IR::U32>(Opcode::A64ExclusiveWriteMemory128, vaddr, value);
+}
+
+IR::UAny IREmitter::AtomicMemory(AtomicOp op, const IR::U64& vaddr, const IR::UAny& value) {
+    const IR::U8 op_imm = Imm8(static_cast<u8>(op));
+    switch (value.GetType()) {
+    case IR::Type::U8:
+        return Inst<IR::U8>(Opcode::A64AtomicMemory8, vaddr, value, op_imm);
+    case IR::Type::U16:
+        return Inst<IR::U16>(Opcode::A64AtomicMemory16, vaddr, value, op_imm);
+    case IR::Type::U32:
+        return Inst<IR::U32>(Opcode::A64AtomicMemory32, vaddr, value, op_imm);
+    case IR::Type::U64:
+        return Inst<IR::U64>(Opcode::A64AtomicMemory64, vaddr, value, op_imm);
+    default:
+        ASSERT_MSG(false, "Unreachable");
+        return {};
+    }
+}
+
+IR::UAny IREmitter::CompareAndSwapMemory(const IR::U64& vaddr, const IR::UAny& expected, const IR::UAny& desired) {
+    ASSERT(expected.GetType() == desired.GetType());
+    switch (expected.GetType()) {
+    case IR::Type::U8:
+        return Inst<IR::U8>(Opcode::A64CompareAndSwapMemory8, vaddr, expected, desired);
+    case IR::Type::U16:
+        return Inst<IR::U16>(Opcode::A64CompareAndSwapMemory16, vaddr, expected, desired);
+    case IR::Type::U32:
+        return Inst<IR::U32>(Opcode::A64CompareAndSwapMemory32, vaddr, expected, desired);
+    case IR::Type::U64:
+        return Inst<IR::U64>(Opcode::A64CompareAndSwapMemory64, vaddr, expected, desired);
+    default:
+        ASSERT_MSG(false, "Unreachable");
+        return {};
+    }
+}
+
+IR::U128 IREmitter::CompareAndSwapMemory128(const IR::U64& vaddr, const IR::U128& expected, const IR::U128& desired) {
+    return Inst<IR::U128>(Opcode::A64CompareAndSwapMemory128, vaddr, expected, desired);
+}
+
 IR::U32 IREmitter::GetW(Reg reg) {
     if (reg == Reg::ZR)
         return Imm32(0);
@@ -86,6 +180,10 @@ IR::U64 IREmitter::GetX(Reg reg) {
     return Inst<IR::U64>(Opcode::A64GetX, IR::Value(reg));
 }
 
+IR::U128 IREmitter::GetS(Vec vec) {
+    return Inst<IR::U128>(Opcode::A64GetS, IR::Value(vec));
+}
+
 IR::U128 IREmitter::GetD(Vec vec) {
     return Inst<IR::U128>(Opcode::A64GetD, IR::Value(vec));
 }
@@ -110,6 +208,10 @@ void IREmitter::SetX(const Reg reg, const IR::U64& value) {
     Inst(Opcode::A64SetX, IR::Value(reg), value);
 }
 
+void IREmitter::SetS(const Vec vec, const IR::U32& value) {
+    Inst(Opcode::A64SetS, IR::Value(vec), value);
+}
+
 void IREmitter::SetD(const Vec vec, const IR::U128& value) {
     Inst(Opcode::A64SetD, IR::Value(vec), value);
 }
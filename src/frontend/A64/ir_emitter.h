@@ -44,18 +44,38 @@ public:
     IR::U16 ReadMemory16(const IR::U64& vaddr);
     IR::U32 ReadMemory32(const IR::U64& vaddr);
     IR::U64 ReadMemory64(const IR::U64& vaddr);
+    IR::U128 ReadMemory128(const IR::U64& vaddr);
     void WriteMemory8(const IR::U64& vaddr, const IR::U8& value);
     void WriteMemory16(const IR::U64& vaddr, const IR::U16& value);
     void WriteMemory32(const IR::U64& vaddr, const IR::U32& value);
     void WriteMemory64(const IR::U64& vaddr, const IR::U64& value);
+    void WriteMemory128(const IR::U64& vaddr, const IR::U128& value);
+
+    void ClearExclusive();
+    void DataMemoryBarrier();
+    IR::U8 ExclusiveReadMemory8(const IR::U64& vaddr);
+    IR::U16 ExclusiveReadMemory16(const IR::U64& vaddr);
+    IR::U32 ExclusiveReadMemory32(const IR::U64& vaddr);
+    IR::U64 ExclusiveReadMemory64(const IR::U64& vaddr);
+    IR::U128 ExclusiveReadMemory128(const IR::U64& vaddr);
+    IR::U32 ExclusiveWriteMemory8(const IR::U64& vaddr, const IR::U8& value);
+    IR::U32 ExclusiveWriteMemory16(const IR::U64& vaddr, const IR::U16& value);
+    IR::U32 ExclusiveWriteMemory32(const IR::U64& vaddr, const IR::U32& value);
+    IR::U32 ExclusiveWriteMemory64(const IR::U64& vaddr, const IR::U64& value);
+    IR::U32 ExclusiveWriteMemory128(const IR::U64& vaddr, const IR::U128& value);
+    IR::UAny AtomicMemory(AtomicOp op, const IR::U64& vaddr, const IR::UAny& value);
+    IR::UAny CompareAndSwapMemory(const IR::U64& vaddr, const IR::UAny& expected, const IR::UAny& desired);
+    IR::U128 CompareAndSwapMemory128(const IR::U64& vaddr, const IR::U128& expected, const IR::U128& desired);
 
     IR::U32 GetW(Reg source_reg);
     IR::U64 GetX(Reg source_reg);
+    IR::U128 GetS(Vec source_vec);
     IR::U128 GetD(Vec source_vec);
     IR::U128 GetQ(Vec source_vec);
     IR::U64 GetSP();
     void SetW(Reg dest_reg, const IR::U32& value);
     void SetX(Reg dest_reg, const IR::U64& value);
+    void SetS(Vec dest_vec, const IR::U32& value);
     void SetD(Vec dest_vec, const IR::U128& value);
     void SetQ(Vec dest_vec, const IR::U128& value);
     void SetSP(const IR::U64& value);
@@ -0,0 +1,41 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+bool TranslatorVisitor::FCMP_float(Imm<2> type, Vec Vm, Vec Vn, bool cmp_with_zero) {
+    const auto datasize = FPGetDataSize(type);
+    if (!datasize || *datasize == 16) {
+        return UnallocatedEncoding();
+    }
+
+    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U32U64 operand2 = cmp_with_zero ? I(*datasize, 0) : IR::U32U64(V_scalar(*datasize, Vm));
+
+    const IR::NZCV nzcv = ir.FPCompare(operand1, operand2, false, true);
+    ir.SetNZCV(nzcv);
+    return true;
+}
+
+bool TranslatorVisitor::FCMPE_float(Imm<2> type, Vec Vm, Vec Vn, bool cmp_with_zero) {
+    const auto datasize = FPGetDataSize(type);
+    if (!datasize || *datasize == 16) {
+        return UnallocatedEncoding();
+    }
+
+    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U32U64 operand2 = cmp_with_zero ? I(*datasize, 0) : IR::U32U64(V_scalar(*datasize, Vm));
+
+    const IR::NZCV nzcv = ir.FPCompare(operand1, operand2, true, true);
+    ir.SetNZCV(nzcv);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
@@ -0,0 +1,99 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/fp_rounding_mode.h"
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class Signedness {
+    Signed,
+    Unsigned
+};
+
+static bool FixedPointConvertToFloat(TranslatorVisitor& v, bool sf, Imm<2> type, Imm<6> scale, Reg Rn, Vec Vd, Signedness signedness) {
+    const size_t intsize = sf ? 64 : 32;
+    const auto fltsize = v.FPGetDataSize(type);
+    if (!fltsize || *fltsize == 16) {
+        return v.UnallocatedEncoding();
+    }
+    if (!sf && !scale.Bit<5>()) {
+        return v.UnallocatedEncoding();
+    }
+    const size_t fbits = 64 - scale.ZeroExtend<size_t>();
+
+    const IR::U32U64 intval = v.X(intsize, Rn);
+    const IR::U32U64 converted = [&]() -> IR::U32U64 {
+        const bool is_signed = signedness == Signedness::Signed;
+        if (*fltsize == 32 && intsize == 32) {
+            return is_signed ? v.ir.FPS32ToSingle(intval, false, true) : v.ir.FPU32ToSingle(intval, false, true);
+        }
+        if (*fltsize == 32) {
+            return is_signed ? v.ir.FPS64ToSingle(intval, false, true) : v.ir.FPU64ToSingle(intval, false, true);
+        }
+        if (intsize == 32) {
+            return is_signed ? v.ir.FPS32ToDouble(intval, false, true) : v.ir.FPU32ToDouble(intval, false, true);
+        }
+        return is_signed ? v.ir.FPS64ToDouble(intval, false, true) : v.ir.FPU64ToDouble(intval, false, true);
+    }();
+
+    // Scaling by a power of two is exact here, so the result is only rounded once (by the conversion above).
+    const IR::U32U64 fltval = [&]() -> IR::U32U64 {
+        if (fbits == 0) {
+            return converted;
+        }
+        if (*fltsize == 32) {
+            return v.ir.FPMul(converted, v.ir.Imm32(static_cast<u32>(127 - fbits) << 23), true);
+        }
+        return v.ir.FPMul(converted, v.ir.Imm64(static_cast<u64>(1023 - fbits) << 52), true);
+    }();
+
+    v.V_scalar(*fltsize, Vd, fltval);
+    return true;
+}
+
+static bool FloatingPointConvertToFixed(TranslatorVisitor& v, bool sf, Imm<2> type, Imm<6> scale, Vec Vn, Reg Rd, Signedness signedness) {
+    const size_t intsize = sf ? 64 : 32;
+    const auto fltsize = v.FPGetDataSize(type);
+    if (!fltsize || *fltsize == 16) {
+        return v.UnallocatedEncoding();
+    }
+    if (!sf && !scale.Bit<5>()) {
+        return v.UnallocatedEncoding();
+    }
+    const size_t fbits = 64 - scale.ZeroExtend<size_t>();
+
+    const IR::U32U64 fltval = v.V_scalar(*fltsize, Vn);
+    const IR::U32U64 intval = [&]() -> IR::U32U64 {
+        if (signedness == Signedness::Signed) {
+            return intsize == 32 ? IR::U32U64{v.ir.FPToFixedS32(fltval, fbits, FP::RoundingMode::TowardsZero)} : IR::U32U64{v.ir.FPToFixedS64(fltval, fbits, FP::RoundingMode::TowardsZero)};
+        }
+        return intsize == 32 ? IR::U32U64{v.ir.FPToFixedU32(fltval, fbits, FP::RoundingMode::TowardsZero)} : IR::U32U64{v.ir.FPToFixedU64(fltval, fbits, FP::RoundingMode::TowardsZero)};
+    }();
+
+    v.X(intsize, Rd, intval);
+    return true;
+}
+
+bool TranslatorVisitor::SCVTF_float_fix(bool sf, Imm<2> type, Imm<6> scale, Reg Rn, Vec Vd) {
+    return FixedPointConvertToFloat(*this, sf, type, scale, Rn, Vd, Signedness::Signed);
+}
+
+bool TranslatorVisitor::UCVTF_float_fix(bool sf, Imm<2> type, Imm<6> scale, Reg Rn, Vec Vd) {
+    return FixedPointConvertToFloat(*this, sf, type, scale, Rn, Vd, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::FCVTZS_float_fix(bool sf, Imm<2> type, Imm<6> scale, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToFixed(*this, sf, type, scale, Vn, Rd, Signedness::Signed);
+}
+
+bool TranslatorVisitor::FCVTZU_float_fix(bool sf, Imm<2> type, Imm<6> scale, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToFixed(*this, sf, type, scale, Vn, Rd, Signedness::Unsigned);
+}
+
+} // namespace A64
+} // namespace Dynarmic
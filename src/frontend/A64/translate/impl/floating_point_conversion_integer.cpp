@@ -0,0 +1,112 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/fp_rounding_mode.h"
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class Signedness {
+    Signed,
+    Unsigned
+};
+
+static bool IntegerConvertToFloat(TranslatorVisitor& v, bool sf, Imm<2> type, Reg Rn, Vec Vd, Signedness signedness) {
+    const size_t intsize = sf ? 64 : 32;
+    const auto fltsize = v.FPGetDataSize(type);
+    if (!fltsize || *fltsize == 16) {
+        return v.UnallocatedEncoding();
+    }
+
+    const IR::U32U64 intval = v.X(intsize, Rn);
+    const IR::U32U64 fltval = [&]() -> IR::U32U64 {
+        const bool is_signed = signedness == Signedness::Signed;
+        if (*fltsize == 32 && intsize == 32) {
+            return is_signed ? v.ir.FPS32ToSingle(intval, false, true) : v.ir.FPU32ToSingle(intval, false, true);
+        }
+        if (*fltsize == 32) {
+            return is_signed ? v.ir.FPS64ToSingle(intval, false, true) : v.ir.FPU64ToSingle(intval, false, true);
+        }
+        if (intsize == 32) {
+            return is_signed ? v.ir.FPS32ToDouble(intval, false, true) : v.ir.FPU32ToDouble(intval, false, true);
+        }
+        return is_signed ? v.ir.FPS64ToDouble(intval, false, true) : v.ir.FPU64ToDouble(intval, false, true);
+    }();
+
+    v.V_scalar(*fltsize, Vd, fltval);
+    return true;
+}
+
+static bool FloatingPointConvertToInteger(TranslatorVisitor& v, bool sf, Imm<2> type, Vec Vn, Reg Rd, Signedness signedness, FP::RoundingMode rounding_mode) {
+    const size_t intsize = sf ? 64 : 32;
+    const auto fltsize = v.FPGetDataSize(type);
+    if (!fltsize || *fltsize == 16) {
+        return v.UnallocatedEncoding();
+    }
+
+    const IR::U32U64 fltval = v.V_scalar(*fltsize, Vn);
+    const IR::U32U64 intval = [&]() -> IR::U32U64 {
+        if (signedness == Signedness::Signed) {
+            return intsize == 32 ? IR::U32U64{v.ir.FPToFixedS32(fltval, 0, rounding_mode)} : IR::U32U64{v.ir.FPToFixedS64(fltval, 0, rounding_mode)};
+        }
+        return intsize == 32 ? IR::U32U64{v.ir.FPToFixedU32(fltval, 0, rounding_mode)} : IR::U32U64{v.ir.FPToFixedU64(fltval, 0, rounding_mode)};
+    }();
+
+    v.X(intsize, Rd, intval);
+    return true;
+}
+
+bool TranslatorVisitor::SCVTF_float_int(bool sf, Imm<2> type, Reg Rn, Vec Vd) {
+    return IntegerConvertToFloat(*this, sf, type, Rn, Vd, Signedness::Signed);
+}
+
+bool TranslatorVisitor::UCVTF_float_int(bool sf, Imm<2> type, Reg Rn, Vec Vd) {
+    return IntegerConvertToFloat(*this, sf, type, Rn, Vd, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::FCVTNS_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Signed, FP::RoundingMode::ToNearest_TieEven);
+}
+
+bool TranslatorVisitor::FCVTNU_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieEven);
+}
+
+bool TranslatorVisitor::FCVTAS_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Signed, FP::RoundingMode::ToNearest_TieAwayFromZero);
+}
+
+bool TranslatorVisitor::FCVTAU_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieAwayFromZero);
+}
+
+bool TranslatorVisitor::FCVTPS_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Signed, FP::RoundingMode::TowardsPlusInfinity);
+}
+
+bool TranslatorVisitor::FCVTPU_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Unsigned, FP::RoundingMode::TowardsPlusInfinity);
+}
+
+bool TranslatorVisitor::FCVTMS_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Signed, FP::RoundingMode::TowardsMinusInfinity);
+}
+
+bool TranslatorVisitor::FCVTMU_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Unsigned, FP::RoundingMode::TowardsMinusInfinity);
+}
+
+bool TranslatorVisitor::FCVTZS_float_int(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Signed, FP::RoundingMode::TowardsZero);
+}
+
+bool TranslatorVisitor::FCVTZU_float_int(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
+    return FloatingPointConvertToInteger(*this, sf, type, Vn, Rd, Signedness::Unsigned, FP::RoundingMode::TowardsZero);
+}
+
+} // namespace A64
+} // namespace Dynarmic
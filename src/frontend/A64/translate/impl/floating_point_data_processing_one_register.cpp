@@ -0,0 +1,86 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+bool TranslatorVisitor::FMOV_float(Imm<2> type, Vec Vn, Vec Vd) {
+    const auto datasize = FPGetDataSize(type);
+    if (!datasize || *datasize == 16) {
+        return UnallocatedEncoding();
+    }
+
+    const IR::UAny operand = V_scalar(*datasize, Vn);
+
+    V_scalar(*datasize, Vd, operand);
+    return true;
+}
+
+bool TranslatorVisitor::FABS_float(Imm<2> type, Vec Vn, Vec Vd) {
+    const auto datasize = FPGetDataSize(type);
+    if (!datasize || *datasize == 16) {
+        return UnallocatedEncoding();
+    }
+
+    const IR::U32U64 operand = V_scalar(*datasize, Vn);
+    const IR::U32U64 result = ir.FPAbs(operand);
+    V_scalar(*datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::FNEG_float(Imm<2> type, Vec Vn, Vec Vd) {
+    const auto datasize = FPGetDataSize(type);
+    if (!datasize || *datasize == 16) {
+        return UnallocatedEncoding();
+    }
+
+    const IR::U32U64 operand = V_scalar(*datasize, Vn);
+    const IR::U32U64 result = ir.FPNeg(operand);
+    V_scalar(*datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::FSQRT_float(Imm<2> type, Vec Vn, Vec Vd) {
+    const auto datasize = FPGetDataSize(type);
+    if (!datasize || *datasize == 16) {
+        return UnallocatedEncoding();
+    }
+
+    const IR::U32U64 operand = V_scalar(*datasize, Vn);
+    const IR::U32U64 result = ir.FPSqrt(operand);
+    V_scalar(*datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::FCVT_float(Imm<2> type, Imm<2> opc, Vec Vn, Vec Vd) {
+    if (type == opc) {
+        return UnallocatedEncoding();
+    }
+
+    const auto srcsize = FPGetDataSize(type);
+    const auto dstsize = FPGetDataSize(opc);
+    if (!srcsize || !dstsize) {
+        return UnallocatedEncoding();
+    }
+
+    // Conversions to and from half-precision are not yet implemented.
+    if (*srcsize == 16 || *dstsize == 16) {
+        return InterpretThisInstruction();
+    }
+
+    const IR::UAny operand = V_scalar(*srcsize, Vn);
+    if (*dstsize == 64) {
+        V_scalar(*dstsize, Vd, ir.FPSingleToDouble(IR::U32(operand), true));
+    } else {
+        V_scalar(*dstsize, Vd, ir.FPDoubleToSingle(IR::U64(operand), true));
+    }
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
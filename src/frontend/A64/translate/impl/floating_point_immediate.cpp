@@ -0,0 +1,35 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+bool TranslatorVisitor::FMOV_float_imm(Imm<2> type, Imm<8> imm8, Vec Vd) {
+    const auto datasize = FPGetDataSize(type);
+    if (!datasize || *datasize == 16) {
+        return UnallocatedEncoding();
+    }
+
+    // VFPExpandImm
+    const u64 sign = imm8.Bit<7>() ? 1 : 0;
+    const u64 fraction = imm8.ZeroExtend<u64>() & 0b111111; // Includes the lowest two bits of the exponent
+    const u64 result = [&]{
+        if (*datasize == 64) {
+            const u64 exponent = imm8.Bit<6>() ? 0b011111111 : 0b100000000;
+            return (sign << 63) | (exponent << 54) | (fraction << 48);
+        }
+        const u64 exponent = imm8.Bit<6>() ? 0b011111 : 0b100000;
+        return (sign << 31) | (exponent << 25) | (fraction << 19);
+    }();
+
+    V_scalar(*datasize, Vd, I(*datasize, result));
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
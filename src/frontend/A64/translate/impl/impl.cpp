@@ -147,7 +147,51 @@ void TranslatorVisitor::V(size_t bitsize, Vec vec, IR::U128 value) {
     }
 }
 
-IR::UAny TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, AccType /*acctype*/) {
+IR::U128 TranslatorVisitor::Vpart(size_t bitsize, Vec vec, size_t part) {
+    ASSERT(part == 0 || part == 1);
+    ASSERT(bitsize == 64);
+    if (part == 0) {
+        return V(64, vec);
+    }
+    return ir.ZeroExtendToQuad(ir.VectorGetElement(bitsize, V(128, vec), part));
+}
+
+void TranslatorVisitor::Vpart(size_t bitsize, Vec vec, size_t part, IR::U128 value) {
+    ASSERT(part == 0 || part == 1);
+    ASSERT(bitsize == 64);
+    if (part == 0) {
+        V(64, vec, value);
+    } else {
+        ir.SetQ(vec, ir.VectorInterleaveLower(64, V(128, vec), value));
+    }
+}
+
+IR::UAny TranslatorVisitor::V_scalar(size_t bitsize, Vec vec) {
+    switch (bitsize) {
+    case 32:
+        return ir.VectorGetElement(32, ir.GetS(vec), 0);
+    case 64:
+        return ir.VectorGetElement(64, ir.GetD(vec), 0);
+    default:
+        ASSERT_MSG(false, "V_scalar - get : Invalid bitsize");
+        return {};
+    }
+}
+
+void TranslatorVisitor::V_scalar(size_t bitsize, Vec vec, IR::UAny value) {
+    switch (bitsize) {
+    case 32:
+        ir.SetS(vec, IR::U32(value));
+        return;
+    case 64:
+        ir.SetD(vec, ir.ZeroExtendToQuad(value));
+        return;
+    default:
+        ASSERT_MSG(false, "V_scalar - set : Invalid bitsize");
+    }
+}
+
+IR::UAnyU128 TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, AccType /*acctype*/) {
     switch (bytesize) {
     case 1:
         return ir.ReadMemory8(address);
@@ -157,13 +201,15 @@ IR::UAny TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, AccType /*acct
         return ir.ReadMemory32(address);
     case 8:
         return ir.ReadMemory64(address);
+    case 16:
+        return ir.ReadMemory128(address);
     default:
         ASSERT_MSG(false, "Invalid bytesize parameter %zu", bytesize);
         return {};
     }
 }
 
-void TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, AccType /*acctype*/, IR::UAny value) {
+void TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, AccType /*acctype*/, IR::UAnyU128 value) {
     switch (bytesize) {
     case 1:
         ir.WriteMemory8(address, value);
@@ -177,12 +223,51 @@ void TranslatorVisitor::Mem(IR::U64 address, size_t bytesize, AccType /*acctype*
     case 8:
         ir.WriteMemory64(address, value);
         return;
+    case 16:
+        ir.WriteMemory128(address, value);
+        return;
     default:
         ASSERT_MSG(false, "Invalid bytesize parameter %zu", bytesize);
         return;
     }
 }
 
+IR::UAnyU128 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, AccType /*acctype*/) {
+    switch (bytesize) {
+    case 1:
+        return ir.ExclusiveReadMemory8(address);
+    case 2:
+        return ir.ExclusiveReadMemory16(address);
+    case 4:
+        return ir.ExclusiveReadMemory32(address);
+    case 8:
+        return ir.ExclusiveReadMemory64(address);
+    case 16:
+        return ir.ExclusiveReadMemory128(address);
+    default:
+        ASSERT_MSG(false, "Invalid bytesize parameter %zu", bytesize);
+        return {};
+    }
+}
+
+IR::U32 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, AccType /*acctype*/, IR::UAnyU128 value) {
+    switch (bytesize) {
+    case 1:
+        return ir.ExclusiveWriteMemory8(address, value);
+    case 2:
+        return ir.ExclusiveWriteMemory16(address, value);
+    case 4:
+        return ir.ExclusiveWriteMemory32(address, value);
+    case 8:
+        return ir.ExclusiveWriteMemory64(address, value);
+    case 16:
+        return ir.ExclusiveWriteMemory128(address, value);
+    default:
+        ASSERT_MSG(false, "Invalid bytesize parameter %zu", bytesize);
+        return {};
+    }
+}
+
 IR::U32U64 TranslatorVisitor::SignExtend(IR::UAny value, size_t to_size) {
     switch (to_size) {
     case 32:
@@ -299,5 +384,17 @@ IR::U32U64 TranslatorVisitor::ExtendReg(size_t bitsize, Reg reg, Imm<3> option,
     return ir.LogicalShiftLeft(extended, ir.Imm8(shift));
 }
 
+boost::optional<size_t> TranslatorVisitor::FPGetDataSize(Imm<2> type) {
+    switch (type.ZeroExtend()) {
+    case 0b00:
+        return 32;
+    case 0b01:
+        return 64;
+    case 0b11:
+        return 16;
+    }
+    return boost::none;
+}
+
 } // namespace A64
 } // namespace Dynarmic
@@ -17,7 +17,7 @@ namespace Dynarmic {
 namespace A64 {
 
 enum class AccType {
-    NORMAL, VEC, STREAM, VECSTREAM, ATOMIC, ORDERED, UNPRIV, IFETCH, PTW, DC, IC, AT,
+    NORMAL, VEC, STREAM, VECSTREAM, ATOMIC, ORDERED, LIMITEDORDERED, UNPRIV, IFETCH, PTW, DC, IC, AT,
 };
 
 enum class MemOp {
@@ -51,14 +51,24 @@ struct TranslatorVisitor final {
     IR::U128 V(size_t bitsize, Vec vec);
     void V(size_t bitsize, Vec vec, IR::U128 value);
 
-    IR::UAny Mem(IR::U64 address, size_t size, AccType acctype);
-    void Mem(IR::U64 address, size_t size, AccType acctype, IR::UAny value);
+    IR::U128 Vpart(size_t bitsize, Vec vec, size_t part);
+    void Vpart(size_t bitsize, Vec vec, size_t part, IR::U128 value);
+
+    IR::UAny V_scalar(size_t bitsize, Vec vec);
+    void V_scalar(size_t bitsize, Vec vec, IR::UAny value);
+
+    IR::UAnyU128 Mem(IR::U64 address, size_t size, AccType acctype);
+    void Mem(IR::U64 address, size_t size, AccType acctype, IR::UAnyU128 value);
+    IR::UAnyU128 ExclusiveMem(IR::U64 address, size_t size, AccType acctype);
+    IR::U32 ExclusiveMem(IR::U64 address, size_t size, AccType acctype, IR::UAnyU128 value);
 
     IR::U32U64 SignExtend(IR::UAny value, size_t to_size);
     IR::U32U64 ZeroExtend(IR::UAny value, size_t to_size);
     IR::U32U64 ShiftReg(size_t bitsize, Reg reg, Imm<2> shift, IR::U8 amount);
     IR::U32U64 ExtendReg(size_t bitsize, Reg reg, Imm<3> option, u8 shift);
 
+    boost::optional<size_t> FPGetDataSize(Imm<2> type);
+
     // Data processing - Immediate - PC relative addressing
     bool ADR(Imm<2> immlo, Imm<19> immhi, Reg Rd);
     bool ADRP(Imm<2> immlo, Imm<19> immhi, Reg Rd);
@@ -153,82 +163,52 @@ struct TranslatorVisitor final {
     bool TBNZ(Imm<1> b5, Imm<5> b40, Imm<14> imm14, Reg Rt);
 
     // Loads and stores - Advanced SIMD Load/Store multiple structures
-    bool ST4_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool ST4_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
-    bool ST1_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool ST1_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
-    bool ST3_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool ST3_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
-    bool ST2_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool ST2_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD4_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD4_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD1_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD1_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD3_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD3_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD2_mult_1(bool Q, Imm<2> size, Reg Rn, Reg Rt);
-    bool LD2_mult_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Reg Rt);
+    bool STx_mult_1(bool Q, Imm<4> opcode, Imm<2> size, Reg Rn, Vec Vt);
+    bool STx_mult_2(bool Q, Reg Rm, Imm<4> opcode, Imm<2> size, Reg Rn, Vec Vt);
+    bool LDx_mult_1(bool Q, Imm<4> opcode, Imm<2> size, Reg Rn, Vec Vt);
+    bool LDx_mult_2(bool Q, Reg Rm, Imm<4> opcode, Imm<2> size, Reg Rn, Vec Vt);
 
     // Loads and stores - Advanced SIMD Load/Store single structures
-    bool ST1_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool ST1_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool ST3_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool ST3_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool ST2_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool ST2_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool ST4_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool ST4_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD1_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD1_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD3_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD3_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST1_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST1_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST3_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST3_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST2_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST2_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST4_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool ST4_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD1_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD1_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD3_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD3_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
     bool LD1R_1(bool Q, Imm<2> size, Reg Rn, Vec Vt);
     bool LD1R_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Vec Vt);
     bool LD3R_1(bool Q, Imm<2> size, Reg Rn, Vec Vt);
     bool LD3R_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD2_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD2_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD4_sngl_1(bool Q, bool S, Imm<2> size, Reg Rn, Vec Vt);
-    bool LD4_sngl_2(bool Q, Reg Rm, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD2_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD2_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD4_sngl_1(bool Q, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
+    bool LD4_sngl_2(bool Q, Reg Rm, Imm<2> upper_opcode, bool S, Imm<2> size, Reg Rn, Vec Vt);
     bool LD2R_1(bool Q, Imm<2> size, Reg Rn, Vec Vt);
     bool LD2R_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Vec Vt);
     bool LD4R_1(bool Q, Imm<2> size, Reg Rn, Vec Vt);
     bool LD4R_2(bool Q, Reg Rm, Imm<2> size, Reg Rn, Vec Vt);
 
     // Loads and stores - Load/Store Exclusive
-    bool STXRB(Reg Rs, Reg Rn, Reg Rt);
-    bool STLXRB(Reg Rs, Reg Rn, Reg Rt);
+    bool STXR(Imm<2> sz, Reg Rs, Reg Rn, Reg Rt);
+    bool STLXR(Imm<2> sz, Reg Rs, Reg Rn, Reg Rt);
     bool CASP(bool sz, bool L, Reg Rs, bool o0, Reg Rn, Reg Rt);
-    bool LDXRB(Reg Rn, Reg Rt);
-    bool LDAXRB(Reg Rn, Reg Rt);
-    bool STLLRB(Reg Rn, Reg Rt);
-    bool STLRB(Reg Rn, Reg Rt);
-    bool CASB(bool L, Reg Rs, bool o0, Reg Rn, Reg Rt);
-    bool LDLARB(Reg Rn, Reg Rt);
-    bool LDARB(Reg Rn, Reg Rt);
-    bool STXRH(Reg Rs, Reg Rn, Reg Rt);
-    bool STLXRH(Reg Rs, Reg Rn, Reg Rt);
-    bool LDXRH(Reg Rn, Reg Rt);
-    bool LDAXRH(Reg Rn, Reg Rt);
-    bool STLLRH(Reg Rn, Reg Rt);
-    bool STLRH(Reg Rn, Reg Rt);
-    bool CASH(bool L, Reg Rs, bool o0, Reg Rn, Reg Rt);
-    bool LDLARH(Reg Rn, Reg Rt);
-    bool LDARH(Reg Rn, Reg Rt);
-    bool STXR(Reg Rs, Reg Rn, Reg Rt);
-    bool STLXR(Reg Rs, Reg Rn, Reg Rt);
+    bool LDXR(Imm<2> sz, Reg Rn, Reg Rt);
+    bool LDAXR(Imm<2> sz, Reg Rn, Reg Rt);
+    bool STLLR(Imm<2> sz, Reg Rn, Reg Rt);
+    bool STLR(Imm<2> sz, Reg Rn, Reg Rt);
+    bool LDLAR(Imm<2> sz, Reg Rn, Reg Rt);
+    bool LDAR(Imm<2> sz, Reg Rn, Reg Rt);
     bool STXP(bool sz, Reg Rs, Reg Rt2, Reg Rn, Reg Rt);
     bool STLXP(bool sz, Reg Rs, Reg Rt2, Reg Rn, Reg Rt);
-    bool LDXR(Reg Rn, Reg Rt);
-    bool LDAXR(Reg Rn, Reg Rt);
     bool LDXP(bool sz, Reg Rt2, Reg Rn, Reg Rt);
     bool LDAXP(bool sz, Reg Rt2, Reg Rn, Reg Rt);
-    bool STLLR(Reg Rn, Reg Rt);
-    bool STLR(Reg Rn, Reg Rt);
-    bool CAS(bool L, Reg Rs, bool o0, Reg Rn, Reg Rt);
-    bool LDLAR(Reg Rn, Reg Rt);
-    bool LDAR(Reg Rn, Reg Rt);
+    bool CAS(Imm<2> sz, bool L, Reg Rs, bool o0, Reg Rn, Reg Rt);
 
     // Loads and stores - Load register (literal)
     bool LDR_lit_gen(bool opc_0, Imm<19> imm19, Reg Rt);
@@ -276,36 +256,16 @@ struct TranslatorVisitor final {
     bool LDTRSW(Imm<9> imm9, Reg Rn, Reg Rt);
 
     // Loads and stores - Atomic memory options
-    bool LDADDB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDCLRB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDEORB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSETB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMAXB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMINB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMAXB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMINB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool SWPB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDAPRB(Reg Rn, Reg Rt);
-    bool LDADDH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDCLRH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDEORH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSETH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMAXH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMAXH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool SWPH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDAPRH(Reg Rn, Reg Rt);
-    bool LDADD(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDCLR(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDEOR(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSET(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMAX(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMIN(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMAX(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMIN(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool SWP(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDAPR(Reg Rn, Reg Rt);
+    bool LDADD(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDCLR(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDEOR(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSET(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSMAX(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSMIN(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDUMAX(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDUMIN(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool SWP(Imm<2> sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDAPR(Imm<2> sz, Reg Rn, Reg Rt);
 
     // Loads and stores - Load/Store register (register offset)
     bool STRB_reg(Reg Rm, Imm<3> option, bool S, Reg Rn, Reg Rt);
@@ -557,7 +517,7 @@ struct TranslatorVisitor final {
     bool ABS_1(Imm<2> size, Vec Vn, Vec Vd);
     bool ABS_2(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool SQXTN_1(Imm<2> size, Vec Vn, Reg Rd);
-    bool SQXTN_2(bool Q, Imm<2> size, Vec Vn, Reg Rd);
+    bool SQXTN_2(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool USQADD_1(Imm<2> size, Vec Vn, Vec Vd);
     bool USQADD_2(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool SQNEG_1(Imm<2> size, Vec Vn, Vec Vd);
@@ -569,9 +529,9 @@ struct TranslatorVisitor final {
     bool NEG_1(Imm<2> size, Vec Vn, Vec Vd);
     bool NEG_2(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool SQXTUN_1(Imm<2> size, Vec Vn, Reg Rd);
-    bool SQXTUN_2(bool Q, Imm<2> size, Vec Vn, Reg Rd);
+    bool SQXTUN_2(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool UQXTN_1(Imm<2> size, Vec Vn, Reg Rd);
-    bool UQXTN_2(bool Q, Imm<2> size, Vec Vn, Reg Rd);
+    bool UQXTN_2(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool FCVTXN_1(bool sz, Vec Vn, Reg Rd);
     bool FCVTXN_2(bool Q, bool sz, Vec Vn, Reg Rd);
 
@@ -589,12 +549,12 @@ struct TranslatorVisitor final {
     bool FMINP_pair_2(bool sz, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD Scalar three different
-    bool SQDMLAL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMLAL_vec_2(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMLSL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMLSL_vec_2(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMULL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMULL_vec_2(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
+    bool SQDMLAL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMLAL_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMLSL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMLSL_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMULL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMULL_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD Scalar three same
     bool SQADD_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
@@ -656,9 +616,9 @@ struct TranslatorVisitor final {
     bool SQSHL_imm_1(Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool SQSHL_imm_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool SQSHRN_1(Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool SQSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
+    bool SQSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool SQRSHRN_1(Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool SQRSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
+    bool SQRSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool SCVTF_fix_1(Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool SCVTF_fix_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool FCVTZS_fix_1(Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
@@ -680,13 +640,13 @@ struct TranslatorVisitor final {
     bool UQSHL_imm_1(Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool UQSHL_imm_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool SQSHRUN_1(Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool SQSHRUN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
+    bool SQSHRUN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool SQRSHRUN_1(Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool SQRSHRUN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
+    bool SQRSHRUN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool UQSHRN_1(Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool UQSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
+    bool UQSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool UQRSHRN_1(Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool UQRSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
+    bool UQRSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool UCVTF_fix_1(Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool UCVTF_fix_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
     bool FCVTZU_fix_1(Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
@@ -813,7 +773,7 @@ struct TranslatorVisitor final {
     bool CLS_asimd(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool CNT(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool SADALP(bool Q, Imm<2> size, Vec Vn, Vec Vd);
-    bool XTN(bool Q, Imm<2> size, Vec Vn, Reg Rd);
+    bool XTN(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool FCVTN(bool Q, bool sz, Vec Vn, Reg Rd);
     bool FCVTL(bool Q, bool sz, Reg Rn, Vec Vd);
     bool URECPE(bool Q, bool sz, Vec Vn, Vec Vd);
@@ -821,7 +781,7 @@ struct TranslatorVisitor final {
     bool UADDLP(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool CLZ_asimd(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool UADALP(bool Q, Imm<2> size, Vec Vn, Vec Vd);
-    bool SHLL(bool Q, Imm<2> size, Reg Rn, Vec Vd);
+    bool SHLL(bool Q, Imm<2> size, Vec Vn, Vec Vd);
     bool NOT(bool Q, Vec Vn, Vec Vd);
     bool RBIT_asimd(bool Q, Vec Vn, Vec Vd);
     bool URSQRTE(bool Q, bool sz, Vec Vn, Vec Vd);
@@ -844,29 +804,29 @@ struct TranslatorVisitor final {
     bool UMINV(bool Q, Imm<2> size, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD three different
-    bool SADDL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SADDW(bool Q, Imm<2> size, Reg Rm, Vec Vn, Vec Vd);
-    bool SSUBL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SSUBW(bool Q, Imm<2> size, Reg Rm, Vec Vn, Vec Vd);
-    bool ADDHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Reg Rd);
-    bool SABAL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SUBHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Reg Rd);
-    bool SABDL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SMLAL_vec(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SMLSL_vec(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SMULL_vec(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool PMULL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool UADDL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool UADDW(bool Q, Imm<2> size, Reg Rm, Vec Vn, Vec Vd);
-    bool USUBL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool USUBW(bool Q, Imm<2> size, Reg Rm, Vec Vn, Vec Vd);
-    bool RADDHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Reg Rd);
-    bool UABAL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool RSUBHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Reg Rd);
-    bool UABDL(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool UMLAL_vec(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool UMLSL_vec(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool UMULL_vec(bool Q, Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
+    bool SADDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SADDW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SSUBL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SSUBW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool ADDHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SABAL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SUBHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SABDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SMLAL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SMLSL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SMULL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool PMULL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool UADDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool UADDW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool USUBL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool USUBW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool RADDHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool UABAL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool RSUBHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool UABDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool UMLAL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool UMLSL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool UMULL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD three same
     bool SHADD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
@@ -881,12 +841,12 @@ struct TranslatorVisitor final {
     bool SMAXP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
     bool SMINP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
     bool ADDP_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
-    bool FMLAL_vec_1(bool Q, bool sz, Reg Rm, Reg Rn, Vec Vd);
-    bool FMLAL_vec_2(bool Q, bool sz, Reg Rm, Reg Rn, Vec Vd);
+    bool FMLAL_vec_1(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd);
+    bool FMLAL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd);
     bool AND_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd);
     bool BIC_asimd_reg(bool Q, Vec Vm, Vec Vn, Vec Vd);
-    bool FMLSL_vec_1(bool Q, bool sz, Reg Rm, Reg Rn, Vec Vd);
-    bool FMLSL_vec_2(bool Q, bool sz, Reg Rm, Reg Rn, Vec Vd);
+    bool FMLSL_vec_1(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd);
+    bool FMLSL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd);
     bool ORR_asimd_reg(bool Q, Vec Vm, Vec Vn, Vec Vd);
     bool ORN_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd);
     bool UHADD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
@@ -906,34 +866,31 @@ struct TranslatorVisitor final {
     bool BIF(bool Q, Vec Vm, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD modified immediate
-    bool MOVI(bool Q, bool op, Imm<1> a, Imm<1> b, Imm<1> c, Imm<4> cmode, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Reg Rd);
-    bool ORR_asimd_imm(bool Q, Imm<1> a, Imm<1> b, Imm<1> c, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Reg Rd);
-    bool FMOV_1(bool Q, Imm<1> a, Imm<1> b, Imm<1> c, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Reg Rd);
-    bool FMOV_2(bool Q, bool op, Imm<1> a, Imm<1> b, Imm<1> c, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Reg Rd);
-    bool MVNI(bool Q, Imm<1> a, Imm<1> b, Imm<1> c, Imm<4> cmode, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Reg Rd);
-    bool BIC_imm(bool Q, Imm<1> a, Imm<1> b, Imm<1> c, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Reg Rd);
-
-    // Data Processing - FP and SIMD - SIMD Shfit by immediate
-    bool SHRN(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool RSHRN(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Reg Rd);
-    bool SSHLL(bool Q, Imm<4> immh, Imm<3> immb, Reg Rn, Vec Vd);
-    bool USHLL(bool Q, Imm<4> immh, Imm<3> immb, Reg Rn, Vec Vd);
+    bool MOVI(bool Q, bool op, Imm<1> a, Imm<1> b, Imm<1> c, Imm<4> cmode, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Vec Vd);
+    bool FMOV_1(bool Q, Imm<1> a, Imm<1> b, Imm<1> c, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Vec Vd);
+    bool FMOV_2(bool Q, bool op, Imm<1> a, Imm<1> b, Imm<1> c, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Vec Vd);
+
+    // Data Processing - FP and SIMD - SIMD Shift by immediate
+    bool SHRN(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
+    bool RSHRN(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
+    bool SSHLL(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
+    bool USHLL(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD x indexed element
-    bool SMLAL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
-    bool SMLSL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
+    bool SMLAL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
+    bool SMLSL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
     bool MUL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
-    bool SMULL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
+    bool SMULL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
     bool SDOT_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
     bool FMLAL_elt_1(bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
     bool FMLAL_elt_2(bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
     bool FMLSL_elt_1(bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
     bool FMLSL_elt_2(bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
     bool MLA_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
-    bool UMLAL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
+    bool UMLAL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
     bool MLS_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
-    bool UMLSL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
-    bool UMULL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Reg Rn, Vec Vd);
+    bool UMLSL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
+    bool UMULL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
     bool UDOT_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd);
     bool FCMLA_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, Imm<2> rot, bool H, Vec Vn, Vec Vd);
 
@@ -998,8 +955,8 @@ struct TranslatorVisitor final {
     bool FRINTI_float(Imm<2> type, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - Floating point compare
-    bool FCMP_float(Imm<2> type, Vec Vm, Vec Vn);
-    bool FCMPE_float(Imm<2> type, Vec Vm, Vec Vn);
+    bool FCMP_float(Imm<2> type, Vec Vm, Vec Vn, bool cmp_with_zero);
+    bool FCMPE_float(Imm<2> type, Vec Vm, Vec Vn, bool cmp_with_zero);
 
     // Data Processing - FP and SIMD - Floating point immediate
     bool FMOV_float_imm(Imm<2> type, Imm<8> imm8, Vec Vd);
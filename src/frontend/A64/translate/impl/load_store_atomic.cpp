@@ -0,0 +1,116 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+static IR::U64 AtomicAddress(TranslatorVisitor& v, Reg Rn) {
+    if (Rn == Reg::SP) {
+        // TODO: Check SP Alignment
+        return v.SP(64);
+    }
+    return v.X(64, Rn);
+}
+
+// Acquire and release semantics are implied by the host's locked instructions, and by the fences around the fallback
+// used when memory is not backed by the host, so A and R are not required.
+static bool AtomicMemoryOperation(TranslatorVisitor& v, Imm<2> sz, AtomicOp op, Reg Rs, Reg Rn, Reg Rt) {
+    const size_t datasize = 8 << sz.ZeroExtend<size_t>();
+    const size_t regsize = datasize == 64 ? 64 : 32;
+
+    const IR::U64 address = AtomicAddress(v, Rn);
+    const IR::UAny value = v.X(datasize, Rs);
+    const IR::UAny data = v.ir.AtomicMemory(op, address, value);
+    v.X(regsize, Rt, v.ZeroExtend(data, regsize));
+    return true;
+}
+
+bool TranslatorVisitor::LDADD(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::Add, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDCLR(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::Clear, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDEOR(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::Eor, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSET(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::Set, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMAX(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::SMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMIN(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::SMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMAX(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::UMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMIN(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::UMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::SWP(Imm<2> sz, bool /*A*/, bool /*R*/, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz, AtomicOp::Swap, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDAPR(Imm<2> sz, Reg Rn, Reg Rt) {
+    const size_t datasize = 8 << sz.ZeroExtend<size_t>();
+    const size_t regsize = datasize == 64 ? 64 : 32;
+
+    const IR::U64 address = AtomicAddress(*this, Rn);
+    const IR::UAny data = Mem(address, datasize / 8, AccType::ORDERED);
+    X(regsize, Rt, ZeroExtend(data, regsize));
+    return true;
+}
+
+bool TranslatorVisitor::CAS(Imm<2> sz, bool /*L*/, Reg Rs, bool /*o0*/, Reg Rn, Reg Rt) {
+    const size_t datasize = 8 << sz.ZeroExtend<size_t>();
+    const size_t regsize = datasize == 64 ? 64 : 32;
+
+    const IR::U64 address = AtomicAddress(*this, Rn);
+    const IR::UAny comparevalue = X(datasize, Rs);
+    const IR::UAny newvalue = X(datasize, Rt);
+    const IR::UAny data = ir.CompareAndSwapMemory(address, comparevalue, newvalue);
+    X(regsize, Rs, ZeroExtend(data, regsize));
+    return true;
+}
+
+bool TranslatorVisitor::CASP(bool sz, bool /*L*/, Reg Rs, bool /*o0*/, Reg Rn, Reg Rt) {
+    if (RegNumber(Rs) % 2 == 1 || RegNumber(Rt) % 2 == 1) {
+        return UnallocatedEncoding();
+    }
+
+    const IR::U64 address = AtomicAddress(*this, Rn);
+
+    if (sz) {
+        const IR::U128 comparevalue = ir.VectorSetElement(64, ir.ZeroExtendToQuad(X(64, Rs)), 1, X(64, Rs + 1));
+        const IR::U128 newvalue = ir.VectorSetElement(64, ir.ZeroExtendToQuad(X(64, Rt)), 1, X(64, Rt + 1));
+        const IR::U128 data = ir.CompareAndSwapMemory128(address, comparevalue, newvalue);
+        X(64, Rs, ir.VectorGetElement(64, data, 0));
+        X(64, Rs + 1, ir.VectorGetElement(64, data, 1));
+        return true;
+    }
+
+    const IR::U64 comparevalue = ir.Pack2x32To1x64(X(32, Rs), X(32, Rs + 1));
+    const IR::U64 newvalue = ir.Pack2x32To1x64(X(32, Rt), X(32, Rt + 1));
+    const IR::U64 data = ir.CompareAndSwapMemory(address, comparevalue, newvalue);
+    X(32, Rs, ir.LeastSignificantWord(data));
+    X(32, Rs + 1, ir.MostSignificantWord(data).result);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
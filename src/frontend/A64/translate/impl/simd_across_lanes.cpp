@@ -0,0 +1,159 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class MinMaxOperation {
+    Max,
+    Min
+};
+
+enum class Signedness {
+    Signed,
+    Unsigned
+};
+
+enum class FPReductionOperation {
+    Max,
+    MaxNumeric,
+    Min,
+    MinNumeric
+};
+
+static bool LongAdd(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec Vd, Signedness sign) {
+    if ((size == 0b10 && !Q) || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 result = sign == Signedness::Signed ? v.ir.VectorReduceAddLongSigned(esize, operand)
+                                                       : v.ir.VectorReduceAddLongUnsigned(esize, operand);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool MinMax(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec Vd, Signedness sign, MinMaxOperation operation) {
+    if ((size == 0b10 && !Q) || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    IR::U128 operand = v.V(datasize, Vn);
+    if (!Q) {
+        // Duplicate the lower half so that the zeroed upper half does not take part in the reduction.
+        operand = v.ir.VectorInterleaveLower(64, operand, operand);
+    }
+
+    const IR::U128 result = [&] {
+        if (sign == Signedness::Signed) {
+            return operation == MinMaxOperation::Max ? v.ir.VectorReduceMaxSigned(esize, operand)
+                                                     : v.ir.VectorReduceMinSigned(esize, operand);
+        }
+        return operation == MinMaxOperation::Max ? v.ir.VectorReduceMaxUnsigned(esize, operand)
+                                                 : v.ir.VectorReduceMinUnsigned(esize, operand);
+    }();
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool FPReduce(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, FPReductionOperation operation) {
+    if (sz || !Q) {
+        return v.ReservedValue();
+    }
+
+    const IR::U128 operand = v.V(128, Vn);
+
+    const auto op = [&](const IR::U32& a, const IR::U32& b) -> IR::U32 {
+        switch (operation) {
+        case FPReductionOperation::Max:
+            return v.ir.FPMax32(a, b, true);
+        case FPReductionOperation::MaxNumeric:
+            return v.ir.FPMaxNumeric32(a, b, true);
+        case FPReductionOperation::Min:
+            return v.ir.FPMin32(a, b, true);
+        case FPReductionOperation::MinNumeric:
+            return v.ir.FPMinNumeric32(a, b, true);
+        }
+        UNREACHABLE();
+        return {};
+    };
+
+    // The reduction is performed as a tree over each half of the vector, as the architecture specifies.
+    const IR::U32 lo = op(v.ir.VectorGetElement(32, operand, 0), v.ir.VectorGetElement(32, operand, 1));
+    const IR::U32 hi = op(v.ir.VectorGetElement(32, operand, 2), v.ir.VectorGetElement(32, operand, 3));
+    const IR::U32 result = op(lo, hi);
+
+    v.V_scalar(32, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::ADDV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    if ((size == 0b10 && !Q) || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand = V(datasize, Vn);
+    const IR::U128 result = ir.VectorReduceAdd(esize, operand);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SADDLV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return LongAdd(*this, Q, size, Vn, Vd, Signedness::Signed);
+}
+
+bool TranslatorVisitor::UADDLV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return LongAdd(*this, Q, size, Vn, Vd, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::SMAXV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return MinMax(*this, Q, size, Vn, Vd, Signedness::Signed, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::SMINV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return MinMax(*this, Q, size, Vn, Vd, Signedness::Signed, MinMaxOperation::Min);
+}
+
+bool TranslatorVisitor::UMAXV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return MinMax(*this, Q, size, Vn, Vd, Signedness::Unsigned, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::UMINV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return MinMax(*this, Q, size, Vn, Vd, Signedness::Unsigned, MinMaxOperation::Min);
+}
+
+bool TranslatorVisitor::FMAXV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FPReduce(*this, Q, sz, Vn, Vd, FPReductionOperation::Max);
+}
+
+bool TranslatorVisitor::FMAXNMV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FPReduce(*this, Q, sz, Vn, Vd, FPReductionOperation::MaxNumeric);
+}
+
+bool TranslatorVisitor::FMINV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FPReduce(*this, Q, sz, Vn, Vd, FPReductionOperation::Min);
+}
+
+bool TranslatorVisitor::FMINNMV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FPReduce(*this, Q, sz, Vn, Vd, FPReductionOperation::MinNumeric);
+}
+
+} // namespace A64
+} // namespace Dynarmic
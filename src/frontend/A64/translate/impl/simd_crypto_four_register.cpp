@@ -0,0 +1,35 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+bool TranslatorVisitor::EOR3(Vec Vm, Vec Va, Vec Vn, Vec Vd) {
+    const IR::U128 a = V(128, Va);
+    const IR::U128 m = V(128, Vm);
+    const IR::U128 n = V(128, Vn);
+
+    const IR::U128 result = ir.VectorEor(ir.VectorEor(n, m), a);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::BCAX(Vec Vm, Vec Va, Vec Vn, Vec Vd) {
+    const IR::U128 a = V(128, Va);
+    const IR::U128 m = V(128, Vm);
+    const IR::U128 n = V(128, Vn);
+
+    const IR::U128 result = ir.VectorEor(n, ir.VectorAnd(m, ir.VectorNot(a)));
+
+    V(128, Vd, result);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
@@ -0,0 +1,124 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/bit_util.h"
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class ModifiedImmediateOperation {
+    Movi,
+    Mvni,
+    Orr,
+    Bic
+};
+
+// AdvSIMDExpandImm
+static u64 AdvSIMDExpandImm(bool op, Imm<4> cmode, Imm<8> imm8) {
+    const u64 imm = imm8.ZeroExtend<u64>();
+
+    switch (cmode.ZeroExtend() >> 1) {
+    case 0b000:
+        return Common::Replicate<u64>(imm, 32);
+    case 0b001:
+        return Common::Replicate<u64>(imm << 8, 32);
+    case 0b010:
+        return Common::Replicate<u64>(imm << 16, 32);
+    case 0b011:
+        return Common::Replicate<u64>(imm << 24, 32);
+    case 0b100:
+        return Common::Replicate<u64>(imm, 16);
+    case 0b101:
+        return Common::Replicate<u64>(imm << 8, 16);
+    case 0b110:
+        // Shifting ones (MSL)
+        if (!cmode.Bit<0>()) {
+            return Common::Replicate<u64>((imm << 8) | 0xFF, 32);
+        }
+        return Common::Replicate<u64>((imm << 16) | 0xFFFF, 32);
+    case 0b111:
+        if (!cmode.Bit<0>() && !op) {
+            return Common::Replicate<u64>(imm, 8);
+        }
+        if (!cmode.Bit<0>() && op) {
+            // Each bit of imm8 selects whether the corresponding byte is all ones
+            u64 result = 0;
+            for (size_t i = 0; i < 8; i++) {
+                if (Common::Bit(i, imm)) {
+                    result |= u64(0xFF) << (i * 8);
+                }
+            }
+            return result;
+        }
+        if (!op) {
+            // Single-precision floating point immediate
+            const u64 exponent = imm8.Bit<6>() ? 0b011111 : 0b100000;
+            return Common::Replicate<u64>((u64(imm8.Bit<7>()) << 31) | (exponent << 25) | ((imm & 0b111111) << 19), 32);
+        }
+        // Double-precision floating point immediate
+        const u64 exponent = imm8.Bit<6>() ? 0b011111111 : 0b100000000;
+        return (u64(imm8.Bit<7>()) << 63) | (exponent << 54) | ((imm & 0b111111) << 48);
+    }
+    UNREACHABLE();
+    return 0;
+}
+
+static ModifiedImmediateOperation DecodeOperation(bool op, Imm<4> cmode) {
+    // Both values of op are moves for the byte (0b1110) and floating point (0b1111) forms.
+    if (cmode == 0b1110 || cmode == 0b1111) {
+        return ModifiedImmediateOperation::Movi;
+    }
+    // The shifting ones forms (0b110x) have no ORR or BIC counterpart.
+    if (cmode.Bit<0>() && cmode.ZeroExtend() >> 1 != 0b110) {
+        return op ? ModifiedImmediateOperation::Bic : ModifiedImmediateOperation::Orr;
+    }
+    return op ? ModifiedImmediateOperation::Mvni : ModifiedImmediateOperation::Movi;
+}
+
+static bool ModifiedImmediate(TranslatorVisitor& v, bool Q, bool op, Imm<4> cmode, Imm<8> imm8, Vec Vd) {
+    if (cmode == 0b1111 && op && !Q) {
+        return v.UnallocatedEncoding();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const ModifiedImmediateOperation operation = DecodeOperation(op, cmode);
+    const u64 imm64 = AdvSIMDExpandImm(op, cmode, imm8);
+
+    // The immediate is materialized with a single load from the constant pool.
+    const auto immediate = [&](u64 value) {
+        return datasize == 64 ? v.ir.ZeroExtendToQuad(v.ir.Imm64(value)) : v.ir.VectorBroadcast64(v.ir.Imm64(value));
+    };
+
+    const IR::U128 result = [&] {
+        switch (operation) {
+        case ModifiedImmediateOperation::Movi:
+            return immediate(imm64);
+        case ModifiedImmediateOperation::Mvni:
+            return immediate(~imm64);
+        case ModifiedImmediateOperation::Orr:
+            return v.ir.VectorOr(v.V(datasize, Vd), immediate(imm64));
+        case ModifiedImmediateOperation::Bic:
+            return v.ir.VectorAnd(v.V(datasize, Vd), immediate(~imm64));
+        }
+        UNREACHABLE();
+        return IR::U128{};
+    }();
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::MOVI(bool Q, bool op, Imm<1> a, Imm<1> b, Imm<1> c, Imm<4> cmode, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Vec Vd) {
+    return ModifiedImmediate(*this, Q, op, cmode, concatenate(a, b, c, d, e, f, g, h), Vd);
+}
+
+bool TranslatorVisitor::FMOV_2(bool Q, bool op, Imm<1> a, Imm<1> b, Imm<1> c, Imm<1> d, Imm<1> e, Imm<1> f, Imm<1> g, Imm<1> h, Vec Vd) {
+    return ModifiedImmediate(*this, Q, op, Imm<4>{0b1111}, concatenate(a, b, c, d, e, f, g, h), Vd);
+}
+
+} // namespace A64
+} // namespace Dynarmic
@@ -0,0 +1,133 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class Transposition {
+    TRN1,
+    TRN2
+};
+
+static bool VectorTranspose(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Transposition type) {
+    if (!Q && size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+
+    const IR::U128 m = v.V(datasize, Vm);
+    const IR::U128 n = v.V(datasize, Vn);
+
+    const IR::U128 result = [&] {
+        if (esize == 64) {
+            return type == Transposition::TRN1 ? v.ir.VectorInterleaveLower(64, n, m) : v.ir.VectorInterleaveUpper(64, n, m);
+        }
+
+        // Treat each pair of elements as a single element of twice the size, and move
+        // the wanted element of each operand into the correct half of that pair.
+        const u8 shift = static_cast<u8>(esize);
+        if (type == Transposition::TRN1) {
+            const IR::U128 lower = v.ir.VectorLogicalShiftRight(esize * 2, v.ir.VectorLogicalShiftLeft(esize * 2, n, shift), shift);
+            const IR::U128 upper = v.ir.VectorLogicalShiftLeft(esize * 2, m, shift);
+            return v.ir.VectorOr(lower, upper);
+        }
+
+        const IR::U128 lower = v.ir.VectorLogicalShiftRight(esize * 2, n, shift);
+        const IR::U128 upper = v.ir.VectorLogicalShiftLeft(esize * 2, v.ir.VectorLogicalShiftRight(esize * 2, m, shift), shift);
+        return v.ir.VectorOr(lower, upper);
+    }();
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::UZP1(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    if (!Q && size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+
+    const IR::U128 m = V(datasize, Vm);
+    const IR::U128 n = V(datasize, Vn);
+    const IR::U128 result = Q ? ir.VectorUnzipEven(esize, n, m) : ir.VectorUnzipEvenLower(esize, n, m);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::UZP2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    if (!Q && size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+
+    const IR::U128 m = V(datasize, Vm);
+    const IR::U128 n = V(datasize, Vn);
+    const IR::U128 result = Q ? ir.VectorUnzipOdd(esize, n, m) : ir.VectorUnzipOddLower(esize, n, m);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::TRN1(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorTranspose(*this, Q, size, Vm, Vn, Vd, Transposition::TRN1);
+}
+
+bool TranslatorVisitor::TRN2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorTranspose(*this, Q, size, Vm, Vn, Vd, Transposition::TRN2);
+}
+
+bool TranslatorVisitor::ZIP1(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    if (!Q && size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+
+    const IR::U128 m = V(datasize, Vm);
+    const IR::U128 n = V(datasize, Vn);
+    const IR::U128 result = ir.VectorInterleaveLower(esize, n, m);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::ZIP2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    if (!Q && size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+
+    const IR::U128 m = V(datasize, Vm);
+    const IR::U128 n = V(datasize, Vn);
+
+    const IR::U128 result = [&] {
+        if (Q) {
+            return ir.VectorInterleaveUpper(esize, n, m);
+        }
+
+        // The upper halves of 64-bit operands end up in the upper half of the interleaved lower halves.
+        const IR::U128 interleaved = ir.VectorInterleaveLower(esize, n, m);
+        return ir.VectorExtract(interleaved, interleaved, 64);
+    }();
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
@@ -0,0 +1,83 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class PairwiseOperation {
+    Add,
+    Max,
+    MaxNumeric,
+    Min,
+    MinNumeric
+};
+
+static bool FPPairwiseOperation(TranslatorVisitor& v, bool sz, Vec Vn, Vec Vd, PairwiseOperation operation) {
+    const size_t esize = sz ? 64 : 32;
+
+    const IR::U128 operand = v.V(128, Vn);
+    const IR::U32U64 element1 = v.ir.VectorGetElement(esize, operand, 0);
+    const IR::U32U64 element2 = v.ir.VectorGetElement(esize, operand, 1);
+
+    const IR::U32U64 result = [&] {
+        switch (operation) {
+        case PairwiseOperation::Add:
+            return v.ir.FPAdd(element1, element2, true);
+        case PairwiseOperation::Max:
+            return v.ir.FPMax(element1, element2, true);
+        case PairwiseOperation::MaxNumeric:
+            return v.ir.FPMaxNumeric(element1, element2, true);
+        case PairwiseOperation::Min:
+            return v.ir.FPMin(element1, element2, true);
+        case PairwiseOperation::MinNumeric:
+            return v.ir.FPMinNumeric(element1, element2, true);
+        }
+        UNREACHABLE();
+        return IR::U32U64{};
+    }();
+
+    v.V_scalar(esize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::ADDP_pair(Imm<2> size, Vec Vn, Vec Vd) {
+    if (size != 0b11) {
+        return ReservedValue();
+    }
+
+    const IR::U128 operand = V(128, Vn);
+    const IR::U64 operand1 = ir.VectorGetElement(64, operand, 0);
+    const IR::U64 operand2 = ir.VectorGetElement(64, operand, 1);
+    const IR::U64 result = ir.Add(operand1, operand2);
+
+    V_scalar(64, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::FADDP_pair_2(bool sz, Vec Vn, Vec Vd) {
+    return FPPairwiseOperation(*this, sz, Vn, Vd, PairwiseOperation::Add);
+}
+
+bool TranslatorVisitor::FMAXNMP_pair_2(bool sz, Vec Vn, Vec Vd) {
+    return FPPairwiseOperation(*this, sz, Vn, Vd, PairwiseOperation::MaxNumeric);
+}
+
+bool TranslatorVisitor::FMAXP_pair_2(bool sz, Vec Vn, Vec Vd) {
+    return FPPairwiseOperation(*this, sz, Vn, Vd, PairwiseOperation::Max);
+}
+
+bool TranslatorVisitor::FMINNMP_pair_2(bool sz, Vec Vn, Vec Vd) {
+    return FPPairwiseOperation(*this, sz, Vn, Vd, PairwiseOperation::MinNumeric);
+}
+
+bool TranslatorVisitor::FMINP_pair_2(bool sz, Vec Vn, Vec Vd) {
+    return FPPairwiseOperation(*this, sz, Vn, Vd, PairwiseOperation::Min);
+}
+
+} // namespace A64
+} // namespace Dynarmic
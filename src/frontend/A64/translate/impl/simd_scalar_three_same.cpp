@@ -0,0 +1,141 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+// Shared decode for instructions whose scalar form only exists for 64-bit elements.
+template <typename Op>
+static bool ScalarThreeSame64(TranslatorVisitor& v, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Op op) {
+    if (size != 0b11) {
+        return v.ReservedValue();
+    }
+
+    const IR::U128 operand1 = v.V(64, Vn);
+    const IR::U128 operand2 = v.V(64, Vm);
+    const IR::U128 result = op(64, operand1, operand2);
+
+    v.V(64, Vd, result);
+    return true;
+}
+
+// Shared decode for instructions that have a scalar form for every element size.
+// The operation must map zero operands to zero, as it is also applied to the zeroed upper elements.
+template <typename Op>
+static bool ScalarThreeSameAnySize(TranslatorVisitor& v, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Op op) {
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+
+    const IR::U128 operand1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vn), 0));
+    const IR::U128 operand2 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vm), 0));
+    const IR::U128 result = op(esize, operand1, operand2);
+
+    v.V(64, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SQADD_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSameAnySize(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorSignedSaturatedAdd(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SQSUB_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSameAnySize(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorSignedSaturatedSub(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::UQADD_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSameAnySize(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorUnsignedSaturatedAdd(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::UQSUB_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSameAnySize(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorUnsignedSaturatedSub(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::ADD_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorAdd(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SUB_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorSub(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::CMEQ_reg_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorEqual(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::CMGT_reg_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorGreaterSigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::CMGE_reg_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorNot(ir.VectorGreaterSigned(esize, b, a));
+    });
+}
+
+bool TranslatorVisitor::CMHI_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        // a > b iff max(b, a) != b
+        return ir.VectorNot(ir.VectorEqual(esize, ir.VectorMaxUnsigned(esize, b, a), b));
+    });
+}
+
+bool TranslatorVisitor::CMHS_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        // a >= b iff max(a, b) == a
+        return ir.VectorEqual(esize, ir.VectorMaxUnsigned(esize, a, b), a);
+    });
+}
+
+bool TranslatorVisitor::CMTST_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        const IR::U128 zero = ir.ZeroExtendLongToQuad(ir.Imm64(0));
+        return ir.VectorNot(ir.VectorEqual(esize, ir.VectorAnd(a, b), zero));
+    });
+}
+
+bool TranslatorVisitor::SSHL_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorArithmeticVShift(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::USHL_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorLogicalVShift(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SRSHL_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorRoundingShiftLeftSigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::URSHL_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarThreeSame64(*this, size, Vm, Vn, Vd, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorRoundingShiftLeftUnsigned(esize, a, b);
+    });
+}
+
+} // namespace A64
+} // namespace Dynarmic
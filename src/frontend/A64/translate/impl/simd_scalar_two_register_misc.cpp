@@ -0,0 +1,95 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class ComparisonType {
+    EQ,
+    GE,
+    GT,
+    LE,
+    LT
+};
+
+static bool ScalarCompareAgainstZero(TranslatorVisitor& v, Imm<2> size, Vec Vn, Vec Vd, ComparisonType type) {
+    if (size != 0b11) {
+        return v.ReservedValue();
+    }
+
+    const IR::U128 operand = v.V(64, Vn);
+    const IR::U128 zero = v.ir.ZeroExtendLongToQuad(v.ir.Imm64(0));
+    const IR::U128 result = [&] {
+        switch (type) {
+        case ComparisonType::EQ:
+            return v.ir.VectorEqual(64, operand, zero);
+        case ComparisonType::GE:
+            return v.ir.VectorNot(v.ir.VectorGreaterSigned(64, zero, operand));
+        case ComparisonType::GT:
+            return v.ir.VectorGreaterSigned(64, operand, zero);
+        case ComparisonType::LE:
+            return v.ir.VectorNot(v.ir.VectorGreaterSigned(64, operand, zero));
+        case ComparisonType::LT:
+            return v.ir.VectorGreaterSigned(64, zero, operand);
+        }
+        UNREACHABLE();
+        return IR::U128{};
+    }();
+
+    v.V(64, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::CMGT_zero_1(Imm<2> size, Vec Vn, Vec Vd) {
+    return ScalarCompareAgainstZero(*this, size, Vn, Vd, ComparisonType::GT);
+}
+
+bool TranslatorVisitor::CMEQ_zero_1(Imm<2> size, Vec Vn, Vec Vd) {
+    return ScalarCompareAgainstZero(*this, size, Vn, Vd, ComparisonType::EQ);
+}
+
+bool TranslatorVisitor::CMLT_1(Imm<2> size, Vec Vn, Vec Vd) {
+    return ScalarCompareAgainstZero(*this, size, Vn, Vd, ComparisonType::LT);
+}
+
+bool TranslatorVisitor::CMGE_zero_1(Imm<2> size, Vec Vn, Vec Vd) {
+    return ScalarCompareAgainstZero(*this, size, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::CMLE_1(Imm<2> size, Vec Vn, Vec Vd) {
+    return ScalarCompareAgainstZero(*this, size, Vn, Vd, ComparisonType::LE);
+}
+
+bool TranslatorVisitor::ABS_1(Imm<2> size, Vec Vn, Vec Vd) {
+    if (size != 0b11) {
+        return ReservedValue();
+    }
+
+    const IR::U128 operand = V(64, Vn);
+    const IR::U128 zero = ir.ZeroExtendLongToQuad(ir.Imm64(0));
+    const IR::U128 result = ir.VectorMaxSigned(64, operand, ir.VectorSub(64, zero, operand));
+
+    V(64, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::NEG_1(Imm<2> size, Vec Vn, Vec Vd) {
+    if (size != 0b11) {
+        return ReservedValue();
+    }
+
+    const IR::U128 operand = V(64, Vn);
+    const IR::U128 zero = ir.ZeroExtendLongToQuad(ir.Imm64(0));
+    const IR::U128 result = ir.VectorSub(64, zero, operand);
+
+    V(64, Vd, result);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
@@ -0,0 +1,101 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <utility>
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class Rounding {
+    None,
+    Round
+};
+
+enum class AccumulateBehavior {
+    None,
+    Accumulate,
+    Subtract
+};
+
+// Returns the index and register number of the element operand.
+// 16-bit elements are indexed by H:L:M and restricted to V0-V15; otherwise M is the top bit of the register number.
+static std::pair<size_t, Vec> Combine(Imm<2> size, bool H, bool L, bool M, Vec Vm) {
+    if (size == 0b01) {
+        return {(H ? 4 : 0) + (L ? 2 : 0) + (M ? 1 : 0), Vm};
+    }
+    return {(H ? 2 : 0) + (L ? 1 : 0), M ? Vm + 16 : Vm};
+}
+
+static bool DoublingMultiplyHighByElement(TranslatorVisitor& v, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd, Rounding rounding) {
+    if (size != 0b01 && size != 0b10) {
+        return v.UnallocatedEncoding();
+    }
+
+    const std::pair<size_t, Vec> element = Combine(size, H, L, M, Vm);
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+
+    // The upper elements of operand1 are zero, so are the upper elements of the result.
+    const IR::U128 operand1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vn), 0));
+    const IR::U128 operand2 = v.ir.VectorBroadcastElement(esize, v.V(128, element.second), element.first);
+    const IR::U128 result = rounding == Rounding::Round
+                          ? v.ir.VectorSignedSaturatedRoundingDoublingMultiplyReturnHigh(esize, operand1, operand2)
+                          : v.ir.VectorSignedSaturatedDoublingMultiplyReturnHigh(esize, operand1, operand2);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool FPMultiplyByElement(TranslatorVisitor& v, bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd, AccumulateBehavior behavior) {
+    if (sz && L) {
+        return v.UnallocatedEncoding();
+    }
+
+    const size_t index = sz ? (H ? 1 : 0) : (H ? 2 : 0) + (L ? 1 : 0);
+    const size_t esize = sz ? 64 : 32;
+
+    const IR::U32U64 operand1 = v.V_scalar(esize, Vn);
+    const IR::U32U64 operand2 = v.ir.VectorGetElement(esize, v.V(128, M ? Vm + 16 : Vm), index);
+    const IR::U32U64 result = [&] {
+        switch (behavior) {
+        case AccumulateBehavior::None:
+            return v.ir.FPMul(operand1, operand2, true);
+        case AccumulateBehavior::Accumulate:
+            return v.ir.FPMulAdd(v.V_scalar(esize, Vd), operand1, operand2, true);
+        case AccumulateBehavior::Subtract:
+            return v.ir.FPMulAdd(v.V_scalar(esize, Vd), v.ir.FPNeg(operand1), operand2, true);
+        }
+        UNREACHABLE();
+        return IR::U32U64{};
+    }();
+
+    v.V_scalar(esize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SQDMULH_elt_1(Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return DoublingMultiplyHighByElement(*this, size, L, M, Vm, H, Vn, Vd, Rounding::None);
+}
+
+bool TranslatorVisitor::SQRDMULH_elt_1(Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return DoublingMultiplyHighByElement(*this, size, L, M, Vm, H, Vn, Vd, Rounding::Round);
+}
+
+bool TranslatorVisitor::FMUL_elt_2(bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElement(*this, sz, L, M, Vm, H, Vn, Vd, AccumulateBehavior::None);
+}
+
+bool TranslatorVisitor::FMLA_elt_2(bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElement(*this, sz, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::FMLS_elt_2(bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElement(*this, sz, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Subtract);
+}
+
+} // namespace A64
+} // namespace Dynarmic
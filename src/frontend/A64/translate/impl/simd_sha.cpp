@@ -0,0 +1,118 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+bool TranslatorVisitor::SHA1C(Vec Vm, Vec Vn, Vec Vd) {
+    const IR::U128 x = V(128, Vd);
+    const IR::U128 y = V(128, Vn);
+    const IR::U128 w = V(128, Vm);
+
+    const IR::U128 result = ir.SHA1HashUpdateChoose(x, y, w);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA1M(Vec Vm, Vec Vn, Vec Vd) {
+    const IR::U128 x = V(128, Vd);
+    const IR::U128 y = V(128, Vn);
+    const IR::U128 w = V(128, Vm);
+
+    const IR::U128 result = ir.SHA1HashUpdateMajority(x, y, w);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA1P(Vec Vm, Vec Vn, Vec Vd) {
+    const IR::U128 x = V(128, Vd);
+    const IR::U128 y = V(128, Vn);
+    const IR::U128 w = V(128, Vm);
+
+    const IR::U128 result = ir.SHA1HashUpdateParity(x, y, w);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA1SU0(Vec Vm, Vec Vn, Vec Vd) {
+    const IR::U128 operand1 = V(128, Vd);
+    const IR::U128 operand2 = V(128, Vn);
+    const IR::U128 operand3 = V(128, Vm);
+
+    const IR::U128 result = ir.SHA1MessageSchedule0(operand1, operand2, operand3);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA1SU1(Vec Vn, Vec Vd) {
+    const IR::U128 operand1 = V(128, Vd);
+    const IR::U128 operand2 = V(128, Vn);
+
+    const IR::U128 result = ir.SHA1MessageSchedule1(operand1, operand2);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA1H(Vec Vn, Vec Vd) {
+    const IR::U32 operand = V_scalar(32, Vn);
+    const IR::U32 result = ir.RotateRight(operand, ir.Imm8(2));
+
+    V_scalar(32, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA256H(Vec Vm, Vec Vn, Vec Vd) {
+    const IR::U128 x = V(128, Vd);
+    const IR::U128 y = V(128, Vn);
+    const IR::U128 w = V(128, Vm);
+
+    const IR::U128 result = ir.SHA256Hash(x, y, w, true);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA256H2(Vec Vm, Vec Vn, Vec Vd) {
+    const IR::U128 x = V(128, Vn);
+    const IR::U128 y = V(128, Vd);
+    const IR::U128 w = V(128, Vm);
+
+    const IR::U128 result = ir.SHA256Hash(x, y, w, false);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA256SU0(Vec Vn, Vec Vd) {
+    const IR::U128 operand1 = V(128, Vd);
+    const IR::U128 operand2 = V(128, Vn);
+
+    const IR::U128 result = ir.SHA256MessageSchedule0(operand1, operand2);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SHA256SU1(Vec Vm, Vec Vn, Vec Vd) {
+    const IR::U128 operand1 = V(128, Vd);
+    const IR::U128 operand2 = V(128, Vn);
+    const IR::U128 operand3 = V(128, Vm);
+
+    const IR::U128 result = ir.SHA256MessageSchedule1(operand1, operand2, operand3);
+
+    V(128, Vd, result);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
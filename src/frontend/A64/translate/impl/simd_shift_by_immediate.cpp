@@ -0,0 +1,282 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/bit_util.h"
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class Rounding {
+    None,
+    Round
+};
+
+enum class Accumulating {
+    None,
+    Accumulate
+};
+
+enum class Signedness {
+    Signed,
+    Unsigned
+};
+
+enum class Narrowing {
+    Truncation,
+    SaturateToUnsigned,
+    SaturateToSigned
+};
+
+enum class InsertDirection {
+    Left,
+    Right
+};
+
+/// Rounding adds 1 << (shift_amount - 1) before shifting, which is the same as adding
+/// bit (shift_amount - 1) of the original element after shifting.
+static IR::U128 PerformRoundingCorrection(TranslatorVisitor& v, size_t esize, u8 shift_amount, const IR::U128& original, const IR::U128& shifted) {
+    const IR::U128 round_bit = v.ir.VectorLogicalShiftRight(esize, v.ir.VectorLogicalShiftLeft(esize, original, static_cast<u8>(esize - shift_amount)), static_cast<u8>(esize - 1));
+    return v.ir.VectorAdd(esize, shifted, round_bit);
+}
+
+static IR::U128 ShiftRightElements(TranslatorVisitor& v, size_t esize, u8 shift_amount, const IR::U128& operand, Rounding rounding, Signedness signedness) {
+    IR::U128 result = signedness == Signedness::Signed ? v.ir.VectorArithmeticShiftRight(esize, operand, shift_amount)
+                                                       : v.ir.VectorLogicalShiftRight(esize, operand, shift_amount);
+    if (rounding == Rounding::Round) {
+        result = PerformRoundingCorrection(v, esize, shift_amount, operand, result);
+    }
+    return result;
+}
+
+static bool ShiftRight(TranslatorVisitor& v, bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd,
+                       Rounding rounding, Accumulating accumulating, Signedness signedness) {
+    if (immh == 0b0000) {
+        return v.UnallocatedEncoding();
+    }
+
+    if (immh.Bit<3>() && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << Common::HighestSetBit(immh.ZeroExtend());
+    const size_t datasize = Q ? 128 : 64;
+    const u8 shift_amount = static_cast<u8>(2 * esize - concatenate(immh, immb).ZeroExtend());
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    IR::U128 result = ShiftRightElements(v, esize, shift_amount, operand, rounding, signedness);
+
+    if (accumulating == Accumulating::Accumulate) {
+        const IR::U128 accumulator = v.V(datasize, Vd);
+        result = v.ir.VectorAdd(esize, result, accumulator);
+    }
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+static bool ShiftRightNarrowing(TranslatorVisitor& v, bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd,
+                                Rounding rounding, Narrowing narrowing, Signedness signedness) {
+    if (immh == 0b0000) {
+        return v.UnallocatedEncoding();
+    }
+
+    if (immh.Bit<3>()) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << Common::HighestSetBit(immh.ZeroExtend());
+    const size_t source_esize = 2 * esize;
+    const size_t part = Q ? 1 : 0;
+    const u8 shift_amount = static_cast<u8>(source_esize - concatenate(immh, immb).ZeroExtend());
+
+    const IR::U128 operand = v.V(128, Vn);
+    const IR::U128 wide_result = ShiftRightElements(v, source_esize, shift_amount, operand, rounding, signedness);
+
+    const IR::U128 result = [&] {
+        switch (narrowing) {
+        case Narrowing::Truncation:
+            return v.ir.VectorNarrow(source_esize, wide_result);
+        case Narrowing::SaturateToUnsigned:
+            if (signedness == Signedness::Signed) {
+                return v.ir.VectorSignedSaturatedNarrowToUnsigned(source_esize, wide_result);
+            }
+            return v.ir.VectorUnsignedSaturatedNarrow(source_esize, wide_result);
+        case Narrowing::SaturateToSigned:
+            ASSERT(signedness == Signedness::Signed);
+            return v.ir.VectorSignedSaturatedNarrowToSigned(source_esize, wide_result);
+        }
+        UNREACHABLE();
+        return IR::U128{};
+    }();
+
+    v.Vpart(64, Vd, part, result);
+    return true;
+}
+
+static bool ShiftLeftLong(TranslatorVisitor& v, bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd, Signedness signedness) {
+    if (immh == 0b0000) {
+        return v.UnallocatedEncoding();
+    }
+
+    if (immh.Bit<3>()) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << Common::HighestSetBit(immh.ZeroExtend());
+    const size_t part = Q ? 1 : 0;
+    const u8 shift_amount = static_cast<u8>(concatenate(immh, immb).ZeroExtend() - esize);
+
+    const IR::U128 operand = v.Vpart(64, Vn, part);
+    const IR::U128 expanded_operand = signedness == Signedness::Signed ? v.ir.VectorSignExtend(esize, operand)
+                                                                       : v.ir.VectorZeroExtend(esize, operand);
+
+    // SXTL and UXTL are aliases with a zero shift amount.
+    const IR::U128 result = shift_amount == 0 ? expanded_operand
+                                              : v.ir.VectorLogicalShiftLeft(2 * esize, expanded_operand, shift_amount);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool ShiftAndInsert(TranslatorVisitor& v, bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd, InsertDirection direction) {
+    if (immh == 0b0000) {
+        return v.UnallocatedEncoding();
+    }
+
+    if (immh.Bit<3>() && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << Common::HighestSetBit(immh.ZeroExtend());
+    const size_t datasize = Q ? 128 : 64;
+    const u8 immhb = static_cast<u8>(concatenate(immh, immb).ZeroExtend());
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vd);
+
+    // The bits of Vd that are not overwritten are isolated by shifting them out and back in again.
+    IR::U128 result;
+    if (direction == InsertDirection::Left) {
+        const u8 shift_amount = static_cast<u8>(immhb - esize);
+        const u8 preserved = static_cast<u8>(esize - shift_amount);
+        const IR::U128 shifted = v.ir.VectorLogicalShiftLeft(esize, operand, shift_amount);
+        const IR::U128 kept = v.ir.VectorLogicalShiftRight(esize, v.ir.VectorLogicalShiftLeft(esize, operand2, preserved), preserved);
+        result = v.ir.VectorOr(shifted, kept);
+    } else {
+        const u8 shift_amount = static_cast<u8>(2 * esize - immhb);
+        const u8 preserved = static_cast<u8>(esize - shift_amount);
+        const IR::U128 shifted = v.ir.VectorLogicalShiftRight(esize, operand, shift_amount);
+        const IR::U128 kept = v.ir.VectorLogicalShiftLeft(esize, v.ir.VectorLogicalShiftRight(esize, operand2, preserved), preserved);
+        result = v.ir.VectorOr(shifted, kept);
+    }
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SSHR_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::None, Accumulating::None, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SSRA_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::None, Accumulating::Accumulate, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SRSHR_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Accumulating::None, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SRSRA_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Accumulating::Accumulate, Signedness::Signed);
+}
+
+bool TranslatorVisitor::USHR_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::None, Accumulating::None, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::USRA_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::None, Accumulating::Accumulate, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::URSHR_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Accumulating::None, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::URSRA_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRight(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Accumulating::Accumulate, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::SHL_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    if (immh == 0b0000) {
+        return UnallocatedEncoding();
+    }
+
+    if (immh.Bit<3>() && !Q) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << Common::HighestSetBit(immh.ZeroExtend());
+    const size_t datasize = Q ? 128 : 64;
+    const u8 shift_amount = static_cast<u8>(concatenate(immh, immb).ZeroExtend() - esize);
+
+    const IR::U128 operand = V(datasize, Vn);
+    const IR::U128 result = ir.VectorLogicalShiftLeft(esize, operand, shift_amount);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SLI_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftAndInsert(*this, Q, immh, immb, Vn, Vd, InsertDirection::Left);
+}
+
+bool TranslatorVisitor::SRI_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftAndInsert(*this, Q, immh, immb, Vn, Vd, InsertDirection::Right);
+}
+
+bool TranslatorVisitor::SHRN(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::None, Narrowing::Truncation, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::RSHRN(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Narrowing::Truncation, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::SQSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::None, Narrowing::SaturateToSigned, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SQRSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Narrowing::SaturateToSigned, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SQSHRUN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::None, Narrowing::SaturateToUnsigned, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SQRSHRUN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Narrowing::SaturateToUnsigned, Signedness::Signed);
+}
+
+bool TranslatorVisitor::UQSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::None, Narrowing::SaturateToUnsigned, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::UQRSHRN_2(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftRightNarrowing(*this, Q, immh, immb, Vn, Vd, Rounding::Round, Narrowing::SaturateToUnsigned, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::SSHLL(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftLeftLong(*this, Q, immh, immb, Vn, Vd, Signedness::Signed);
+}
+
+bool TranslatorVisitor::USHLL(bool Q, Imm<4> immh, Imm<3> immb, Vec Vn, Vec Vd) {
+    return ShiftLeftLong(*this, Q, immh, immb, Vn, Vd, Signedness::Unsigned);
+}
+
+} // namespace A64
+} // namespace Dynarmic
@@ -0,0 +1,48 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+static void TableLookup(TranslatorVisitor& v, bool Q, Vec Vm, Imm<2> len, Vec Vn, Vec Vd, bool is_tbl) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t regs = len.ZeroExtend<size_t>() + 1;
+
+    const IR::U128 indices = v.V(datasize, Vm);
+
+    // Each table register is looked up separately with its indices rebased to zero.
+    // Indices below the current register wrap around and are out of range like those above it.
+    IR::U128 result = v.ir.VectorTableLookup(v.V(128, Vn), indices);
+    for (size_t i = 1; i < regs; i++) {
+        const Vec table = static_cast<Vec>((VecNumber(Vn) + i) % 32);
+        const IR::U128 rebased = v.ir.VectorSub(8, indices, v.ir.VectorBroadcast8(v.ir.Imm8(static_cast<u8>(16 * i))));
+        result = v.ir.VectorOr(result, v.ir.VectorTableLookup(v.V(128, table), rebased));
+    }
+
+    if (!is_tbl) {
+        // Elements with out-of-range indices are left unchanged.
+        const IR::U128 limit = v.ir.VectorBroadcast8(v.ir.Imm8(static_cast<u8>(16 * regs)));
+        const IR::U128 out_of_range = v.ir.VectorEqual(8, v.ir.VectorMaxUnsigned(8, indices, limit), indices);
+        result = v.ir.VectorOr(result, v.ir.VectorAnd(v.V(datasize, Vd), out_of_range));
+    }
+
+    v.V(datasize, Vd, result);
+}
+
+bool TranslatorVisitor::TBL(bool Q, Vec Vm, Imm<2> len, Vec Vn, Vec Vd) {
+    TableLookup(*this, Q, Vm, len, Vn, Vd, true);
+    return true;
+}
+
+bool TranslatorVisitor::TBX(bool Q, Vec Vm, Imm<2> len, Vec Vn, Vec Vd) {
+    TableLookup(*this, Q, Vm, len, Vn, Vd, false);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
@@ -0,0 +1,252 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class Signedness {
+    Signed,
+    Unsigned
+};
+
+enum class AddSub {
+    Add,
+    Subtract
+};
+
+enum class Rounding {
+    None,
+    Round
+};
+
+enum class AccumulateBehavior {
+    None,
+    Accumulate,
+    Subtract
+};
+
+static IR::U128 Extend(TranslatorVisitor& v, size_t esize, const IR::U128& operand, Signedness sign) {
+    return sign == Signedness::Signed ? v.ir.VectorSignExtend(esize, operand) : v.ir.VectorZeroExtend(esize, operand);
+}
+
+static IR::U128 Accumulate(TranslatorVisitor& v, size_t esize, Vec Vd, const IR::U128& value, AccumulateBehavior behavior) {
+    switch (behavior) {
+    case AccumulateBehavior::None:
+        return value;
+    case AccumulateBehavior::Accumulate:
+        return v.ir.VectorAdd(esize, v.V(128, Vd), value);
+    case AccumulateBehavior::Subtract:
+        return v.ir.VectorSub(esize, v.V(128, Vd), value);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+static bool AddSubLong(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, AddSub op, Signedness sign) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand1 = Extend(v, esize, v.Vpart(64, Vn, part), sign);
+    const IR::U128 operand2 = Extend(v, esize, v.Vpart(64, Vm, part), sign);
+    const IR::U128 result = op == AddSub::Add ? v.ir.VectorAdd(2 * esize, operand1, operand2)
+                                              : v.ir.VectorSub(2 * esize, operand1, operand2);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool AddSubWide(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, AddSub op, Signedness sign) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand1 = v.V(128, Vn);
+    const IR::U128 operand2 = Extend(v, esize, v.Vpart(64, Vm, part), sign);
+    const IR::U128 result = op == AddSub::Add ? v.ir.VectorAdd(2 * esize, operand1, operand2)
+                                              : v.ir.VectorSub(2 * esize, operand1, operand2);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool AddSubHighNarrow(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, AddSub op, Rounding rounding) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand1 = v.V(128, Vn);
+    const IR::U128 operand2 = v.V(128, Vm);
+    const IR::U128 wide = op == AddSub::Add ? v.ir.VectorAdd(2 * esize, operand1, operand2)
+                                            : v.ir.VectorSub(2 * esize, operand1, operand2);
+
+    IR::U128 high = v.ir.VectorLogicalShiftRight(2 * esize, wide, static_cast<u8>(esize));
+    if (rounding == Rounding::Round) {
+        // Adding 1 << (esize - 1) before taking the high half carries bit (esize - 1) into it.
+        const IR::U128 round_bit = v.ir.VectorLogicalShiftRight(2 * esize, v.ir.VectorLogicalShiftLeft(2 * esize, wide, static_cast<u8>(esize)), static_cast<u8>(2 * esize - 1));
+        high = v.ir.VectorAdd(2 * esize, high, round_bit);
+    }
+
+    const IR::U128 result = v.ir.VectorNarrow(2 * esize, high);
+
+    v.Vpart(64, Vd, part, result);
+    return true;
+}
+
+static bool AbsoluteDifferenceLong(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, AccumulateBehavior behavior, Signedness sign) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand1 = v.Vpart(64, Vn, part);
+    const IR::U128 operand2 = v.Vpart(64, Vm, part);
+
+    // The absolute difference always fits in an unsigned element of the original size.
+    const IR::U128 difference = sign == Signedness::Signed ? v.ir.VectorSignedAbsoluteDifference(esize, operand1, operand2)
+                                                           : v.ir.VectorUnsignedAbsoluteDifference(esize, operand1, operand2);
+    const IR::U128 result = Accumulate(v, 2 * esize, Vd, v.ir.VectorZeroExtend(esize, difference), behavior);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool MultiplyLong(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, AccumulateBehavior behavior, Signedness sign) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand1 = Extend(v, esize, v.Vpart(64, Vn, part), sign);
+    const IR::U128 operand2 = Extend(v, esize, v.Vpart(64, Vm, part), sign);
+    const IR::U128 product = v.ir.VectorMultiply(2 * esize, operand1, operand2);
+    const IR::U128 result = Accumulate(v, 2 * esize, Vd, product, behavior);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SADDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubLong(*this, Q, size, Vm, Vn, Vd, AddSub::Add, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SADDW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubWide(*this, Q, size, Vm, Vn, Vd, AddSub::Add, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SSUBL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubLong(*this, Q, size, Vm, Vn, Vd, AddSub::Subtract, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SSUBW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubWide(*this, Q, size, Vm, Vn, Vd, AddSub::Subtract, Signedness::Signed);
+}
+
+bool TranslatorVisitor::ADDHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubHighNarrow(*this, Q, size, Vm, Vn, Vd, AddSub::Add, Rounding::None);
+}
+
+bool TranslatorVisitor::SABAL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifferenceLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Accumulate, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SUBHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubHighNarrow(*this, Q, size, Vm, Vn, Vd, AddSub::Subtract, Rounding::None);
+}
+
+bool TranslatorVisitor::SABDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifferenceLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::None, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SMLAL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return MultiplyLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Accumulate, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SMLSL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return MultiplyLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Subtract, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SMULL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return MultiplyLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::None, Signedness::Signed);
+}
+
+bool TranslatorVisitor::PMULL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    if (size == 0b01 || size == 0b10) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand1 = Vpart(64, Vn, part);
+    const IR::U128 operand2 = Vpart(64, Vm, part);
+    const IR::U128 result = ir.VectorPolynomialMultiplyLong(esize, operand1, operand2);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::UADDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubLong(*this, Q, size, Vm, Vn, Vd, AddSub::Add, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::UADDW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubWide(*this, Q, size, Vm, Vn, Vd, AddSub::Add, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::USUBL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubLong(*this, Q, size, Vm, Vn, Vd, AddSub::Subtract, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::USUBW(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubWide(*this, Q, size, Vm, Vn, Vd, AddSub::Subtract, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::RADDHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubHighNarrow(*this, Q, size, Vm, Vn, Vd, AddSub::Add, Rounding::Round);
+}
+
+bool TranslatorVisitor::UABAL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifferenceLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Accumulate, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::RSUBHN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AddSubHighNarrow(*this, Q, size, Vm, Vn, Vd, AddSub::Subtract, Rounding::Round);
+}
+
+bool TranslatorVisitor::UABDL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifferenceLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::None, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::UMLAL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return MultiplyLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Accumulate, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::UMLSL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return MultiplyLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Subtract, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::UMULL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return MultiplyLong(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::None, Signedness::Unsigned);
+}
+
+} // namespace A64
+} // namespace Dynarmic
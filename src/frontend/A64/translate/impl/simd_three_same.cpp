@@ -9,6 +9,127 @@
 namespace Dynarmic {
 namespace A64 {
 
+enum class Signedness {
+    Signed,
+    Unsigned
+};
+
+enum class MinMaxOperation {
+    Max,
+    Min
+};
+
+enum class ExtraBehavior {
+    None,
+    Accumulate
+};
+
+enum class ElementSizes {
+    Any,    // 64-bit elements are only reserved in the 64-bit vector form.
+    No64Bit // 64-bit elements are always reserved.
+};
+
+static IR::U128 MinMax(IREmitter& ir, size_t esize, Signedness sign, MinMaxOperation operation, const IR::U128& a, const IR::U128& b) {
+    if (sign == Signedness::Signed) {
+        return operation == MinMaxOperation::Max ? ir.VectorMaxSigned(esize, a, b) : ir.VectorMinSigned(esize, a, b);
+    }
+    return operation == MinMaxOperation::Max ? ir.VectorMaxUnsigned(esize, a, b) : ir.VectorMinUnsigned(esize, a, b);
+}
+
+static bool VectorMinMaxOperation(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Signedness sign, MinMaxOperation operation) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 result = MinMax(v.ir, esize, sign, operation, operand1, operand2);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+static bool PairedMinMaxOperation(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Signedness sign, MinMaxOperation operation) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+
+    // Pairs are formed from adjacent elements of the concatenation Vm:Vn.
+    const IR::U128 even = Q ? v.ir.VectorUnzipEven(esize, operand1, operand2) : v.ir.VectorUnzipEvenLower(esize, operand1, operand2);
+    const IR::U128 odd = Q ? v.ir.VectorUnzipOdd(esize, operand1, operand2) : v.ir.VectorUnzipOddLower(esize, operand1, operand2);
+    const IR::U128 result = MinMax(v.ir, esize, sign, operation, even, odd);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+static bool AbsoluteDifference(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Signedness sign, ExtraBehavior behavior) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+
+    IR::U128 result = sign == Signedness::Signed ? v.ir.VectorSignedAbsoluteDifference(esize, operand1, operand2)
+                                                 : v.ir.VectorUnsignedAbsoluteDifference(esize, operand1, operand2);
+
+    if (behavior == ExtraBehavior::Accumulate) {
+        result = v.ir.VectorAdd(esize, v.V(datasize, Vd), result);
+    }
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+// Shared decode for integer instructions with 8, 16, 32 and (unless restricted) 64-bit element forms.
+template <typename Op>
+static bool ThreeSame(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, ElementSizes sizes, Op op) {
+    if (size == 0b11 && (!Q || sizes == ElementSizes::No64Bit)) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 result = op(esize, operand1, operand2);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+// Shared decode for floating-point instructions with single and double precision forms.
+template <typename Op>
+static bool FPThreeSame(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd, Op op) {
+    if (sz && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = sz ? 64 : 32;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 result = op(esize, operand1, operand2);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::ADD_vector(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     if (size == 0b11 && !Q) return ReservedValue();
     const size_t esize = 8 << size.ZeroExtend<size_t>();
@@ -74,5 +195,341 @@ bool TranslatorVisitor::AND_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::SUB_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorSub(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SQADD_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorSignedSaturatedAdd(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SQSUB_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorSignedSaturatedSub(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::UQADD_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorUnsignedSaturatedAdd(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::UQSUB_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorUnsignedSaturatedSub(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::CMEQ_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorEqual(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::CMGT_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorGreaterSigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::CMGE_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorNot(ir.VectorGreaterSigned(esize, b, a));
+    });
+}
+
+bool TranslatorVisitor::CMHI_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        // a > b iff max(b, a) != b
+        return ir.VectorNot(ir.VectorEqual(esize, ir.VectorMaxUnsigned(esize, b, a), b));
+    });
+}
+
+bool TranslatorVisitor::CMHS_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        // a >= b iff max(a, b) == a
+        return ir.VectorEqual(esize, ir.VectorMaxUnsigned(esize, a, b), a);
+    });
+}
+
+bool TranslatorVisitor::CMTST_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        const IR::U128 zero = ir.ZeroExtendLongToQuad(ir.Imm64(0));
+        return ir.VectorNot(ir.VectorEqual(esize, ir.VectorAnd(a, b), zero));
+    });
+}
+
+bool TranslatorVisitor::SSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorArithmeticVShift(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::USHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorLogicalVShift(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SRSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorRoundingShiftLeftSigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::URSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::Any, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorRoundingShiftLeftUnsigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SHADD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorHalvingAddSigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::UHADD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorHalvingAddUnsigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SHSUB(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorHalvingSubSigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::UHSUB(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorHalvingSubUnsigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SRHADD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorRoundingHalvingAddSigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::URHADD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorRoundingHalvingAddUnsigned(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::SMAX(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Signed, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::SMIN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Signed, MinMaxOperation::Min);
+}
+
+bool TranslatorVisitor::UMAX(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::UMIN(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned, MinMaxOperation::Min);
+}
+
+bool TranslatorVisitor::SMAXP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return PairedMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Signed, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::SMINP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return PairedMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Signed, MinMaxOperation::Min);
+}
+
+bool TranslatorVisitor::UMAXP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return PairedMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::UMINP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return PairedMinMaxOperation(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned, MinMaxOperation::Min);
+}
+
+bool TranslatorVisitor::SABD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifference(*this, Q, size, Vm, Vn, Vd, Signedness::Signed, ExtraBehavior::None);
+}
+
+bool TranslatorVisitor::UABD(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifference(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned, ExtraBehavior::None);
+}
+
+bool TranslatorVisitor::SABA(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifference(*this, Q, size, Vm, Vn, Vd, Signedness::Signed, ExtraBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::UABA(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return AbsoluteDifference(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned, ExtraBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::MUL_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorMultiply(esize, a, b);
+    });
+}
+
+bool TranslatorVisitor::MLA_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this, datasize, Vd](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorAdd(esize, V(datasize, Vd), ir.VectorMultiply(esize, a, b));
+    });
+}
+
+bool TranslatorVisitor::MLS_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    return ThreeSame(*this, Q, size, Vm, Vn, Vd, ElementSizes::No64Bit, [this, datasize, Vd](size_t esize, const IR::U128& a, const IR::U128& b) {
+        return ir.VectorSub(esize, V(datasize, Vd), ir.VectorMultiply(esize, a, b));
+    });
+}
+
+bool TranslatorVisitor::PMUL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    if (size != 0b00) {
+        return ReservedValue();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.VectorPolynomialMultiply(operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::BIC_asimd_reg(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.VectorAndNot(operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::ORR_asimd_reg(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.VectorOr(operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::ORN_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.VectorOr(operand1, ir.VectorNot(operand2));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::EOR_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.VectorEor(operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::BSL(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vm);
+    const IR::U128 operand3 = V(datasize, Vn);
+    const IR::U128 operand4 = V(datasize, Vd);
+
+    // Select bits from Vn where Vd is set and from Vm elsewhere.
+    const IR::U128 result = ir.VectorEor(operand1, ir.VectorAnd(ir.VectorEor(operand1, operand3), operand4));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::BIT(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vd);
+    const IR::U128 operand3 = V(datasize, Vn);
+    const IR::U128 operand4 = V(datasize, Vm);
+
+    // Insert bits from Vn where Vm is set.
+    const IR::U128 result = ir.VectorEor(operand1, ir.VectorAnd(ir.VectorEor(operand1, operand3), operand4));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::BIF(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vd);
+    const IR::U128 operand3 = V(datasize, Vn);
+    const IR::U128 operand4 = V(datasize, Vm);
+
+    // Insert bits from Vn where Vm is clear.
+    const IR::U128 result = ir.VectorEor(operand1, ir.VectorAndNot(ir.VectorEor(operand1, operand3), operand4));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::FADD_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPThreeSame(*this, Q, sz, Vm, Vn, Vd, [this](size_t esize, const auto& a, const auto& b) {
+        return ir.FPVectorAdd(esize, a, b, true);
+    });
+}
+
+bool TranslatorVisitor::FSUB_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPThreeSame(*this, Q, sz, Vm, Vn, Vd, [this](size_t esize, const auto& a, const auto& b) {
+        return ir.FPVectorSub(esize, a, b, true);
+    });
+}
+
+bool TranslatorVisitor::FMUL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPThreeSame(*this, Q, sz, Vm, Vn, Vd, [this](size_t esize, const auto& a, const auto& b) {
+        return ir.FPVectorMul(esize, a, b, true);
+    });
+}
+
+bool TranslatorVisitor::FDIV_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPThreeSame(*this, Q, sz, Vm, Vn, Vd, [this](size_t esize, const auto& a, const auto& b) {
+        return ir.FPVectorDiv(esize, a, b, true);
+    });
+}
+
+bool TranslatorVisitor::FMLA_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    return FPThreeSame(*this, Q, sz, Vm, Vn, Vd, [this, datasize, Vd](size_t esize, const auto& a, const auto& b) {
+        return ir.FPVectorMulAdd(esize, V(datasize, Vd), a, b, true);
+    });
+}
+
+bool TranslatorVisitor::FMLS_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    return FPThreeSame(*this, Q, sz, Vm, Vn, Vd, [this, datasize, Vd](size_t esize, const auto& a, const auto& b) {
+        return ir.FPVectorMulAdd(esize, V(datasize, Vd), ir.FPVectorNeg(esize, a), b, true);
+    });
+}
+
 } // namespace A64
 } // namespace Dynarmic
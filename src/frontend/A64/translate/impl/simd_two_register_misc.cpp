@@ -0,0 +1,209 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class NarrowingOp {
+    Truncation,
+    SignedSaturateToSigned,
+    SignedSaturateToUnsigned,
+    UnsignedSaturateToUnsigned
+};
+
+enum class ComparisonType {
+    EQ,
+    GE,
+    GT,
+    LE,
+    LT
+};
+
+static bool CompareAgainstZero(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec Vd, ComparisonType type) {
+    if (size == 0b11 && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 zero = v.ir.ZeroExtendLongToQuad(v.ir.Imm64(0));
+    const IR::U128 result = [&] {
+        switch (type) {
+        case ComparisonType::EQ:
+            return v.ir.VectorEqual(esize, operand, zero);
+        case ComparisonType::GE:
+            return v.ir.VectorNot(v.ir.VectorGreaterSigned(esize, zero, operand));
+        case ComparisonType::GT:
+            return v.ir.VectorGreaterSigned(esize, operand, zero);
+        case ComparisonType::LE:
+            return v.ir.VectorNot(v.ir.VectorGreaterSigned(esize, operand, zero));
+        case ComparisonType::LT:
+            return v.ir.VectorGreaterSigned(esize, zero, operand);
+        }
+        UNREACHABLE();
+        return IR::U128{};
+    }();
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+static bool ExtractNarrow(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec Vd, NarrowingOp op) {
+    if (size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t source_esize = 2 * esize;
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand = v.V(128, Vn);
+    const IR::U128 result = [&] {
+        switch (op) {
+        case NarrowingOp::Truncation:
+            return v.ir.VectorNarrow(source_esize, operand);
+        case NarrowingOp::SignedSaturateToSigned:
+            return v.ir.VectorSignedSaturatedNarrowToSigned(source_esize, operand);
+        case NarrowingOp::SignedSaturateToUnsigned:
+            return v.ir.VectorSignedSaturatedNarrowToUnsigned(source_esize, operand);
+        case NarrowingOp::UnsignedSaturateToUnsigned:
+            return v.ir.VectorUnsignedSaturatedNarrow(source_esize, operand);
+        }
+        UNREACHABLE();
+        return IR::U128{};
+    }();
+
+    v.Vpart(64, Vd, part, result);
+    return true;
+}
+
+static bool FPTwoRegisterMisc(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, IR::U128 (IR::IREmitter::*fn)(size_t, const IR::U128&)) {
+    if (sz && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = sz ? 64 : 32;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 result = (v.ir.*fn)(esize, operand);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::CMGT_zero_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return CompareAgainstZero(*this, Q, size, Vn, Vd, ComparisonType::GT);
+}
+
+bool TranslatorVisitor::CMEQ_zero_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return CompareAgainstZero(*this, Q, size, Vn, Vd, ComparisonType::EQ);
+}
+
+bool TranslatorVisitor::CMLT_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return CompareAgainstZero(*this, Q, size, Vn, Vd, ComparisonType::LT);
+}
+
+bool TranslatorVisitor::CMGE_zero_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return CompareAgainstZero(*this, Q, size, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::CMLE_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return CompareAgainstZero(*this, Q, size, Vn, Vd, ComparisonType::LE);
+}
+
+bool TranslatorVisitor::ABS_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    if (size == 0b11 && !Q) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand = V(datasize, Vn);
+    const IR::U128 zero = ir.ZeroExtendLongToQuad(ir.Imm64(0));
+    const IR::U128 result = ir.VectorMaxSigned(esize, operand, ir.VectorSub(esize, zero, operand));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::NEG_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    if (size == 0b11 && !Q) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand = V(datasize, Vn);
+    const IR::U128 zero = ir.ZeroExtendLongToQuad(ir.Imm64(0));
+    const IR::U128 result = ir.VectorSub(esize, zero, operand);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::XTN(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return ExtractNarrow(*this, Q, size, Vn, Vd, NarrowingOp::Truncation);
+}
+
+bool TranslatorVisitor::SQXTN_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return ExtractNarrow(*this, Q, size, Vn, Vd, NarrowingOp::SignedSaturateToSigned);
+}
+
+bool TranslatorVisitor::SQXTUN_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return ExtractNarrow(*this, Q, size, Vn, Vd, NarrowingOp::SignedSaturateToUnsigned);
+}
+
+bool TranslatorVisitor::UQXTN_2(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    return ExtractNarrow(*this, Q, size, Vn, Vd, NarrowingOp::UnsignedSaturateToUnsigned);
+}
+
+bool TranslatorVisitor::SHLL(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
+    if (size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand = ir.VectorZeroExtend(esize, Vpart(64, Vn, part));
+    const IR::U128 result = ir.VectorLogicalShiftLeft(esize * 2, operand, static_cast<u8>(esize));
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::FABS_2(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FPTwoRegisterMisc(*this, Q, sz, Vn, Vd, &IR::IREmitter::FPVectorAbs);
+}
+
+bool TranslatorVisitor::FNEG_2(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FPTwoRegisterMisc(*this, Q, sz, Vn, Vd, &IR::IREmitter::FPVectorNeg);
+}
+
+bool TranslatorVisitor::FSQRT_2(bool Q, bool sz, Vec Vn, Vec Vd) {
+    if (sz && !Q) {
+        return ReservedValue();
+    }
+
+    const size_t esize = sz ? 64 : 32;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand = V(datasize, Vn);
+    const IR::U128 result = ir.FPVectorSqrt(esize, operand, true);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+} // namespace A64
+} // namespace Dynarmic
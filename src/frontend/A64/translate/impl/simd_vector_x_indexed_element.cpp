@@ -0,0 +1,199 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <utility>
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic {
+namespace A64 {
+
+enum class Signedness {
+    Signed,
+    Unsigned
+};
+
+enum class Rounding {
+    None,
+    Round
+};
+
+enum class AccumulateBehavior {
+    None,
+    Accumulate,
+    Subtract
+};
+
+// Returns the index and register number of the element operand.
+// 16-bit elements are indexed by H:L:M and restricted to V0-V15; otherwise M is the top bit of the register number.
+static std::pair<size_t, Vec> Combine(Imm<2> size, bool H, bool L, bool M, Vec Vm) {
+    if (size == 0b01) {
+        return {(H ? 4 : 0) + (L ? 2 : 0) + (M ? 1 : 0), Vm};
+    }
+    return {(H ? 2 : 0) + (L ? 1 : 0), M ? Vm + 16 : Vm};
+}
+
+static IR::U128 Accumulate(TranslatorVisitor& v, size_t esize, size_t datasize, Vec Vd, const IR::U128& value, AccumulateBehavior behavior) {
+    switch (behavior) {
+    case AccumulateBehavior::None:
+        return value;
+    case AccumulateBehavior::Accumulate:
+        return v.ir.VectorAdd(esize, v.V(datasize, Vd), value);
+    case AccumulateBehavior::Subtract:
+        return v.ir.VectorSub(esize, v.V(datasize, Vd), value);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+static bool MultiplyByElement(TranslatorVisitor& v, bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd, AccumulateBehavior behavior) {
+    if (size != 0b01 && size != 0b10) {
+        return v.UnallocatedEncoding();
+    }
+
+    const std::pair<size_t, Vec> element = Combine(size, H, L, M, Vm);
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.ir.VectorBroadcastElement(esize, v.V(128, element.second), element.first);
+    const IR::U128 product = v.ir.VectorMultiply(esize, operand1, operand2);
+    const IR::U128 result = Accumulate(v, esize, datasize, Vd, product, behavior);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+static bool MultiplyLongByElement(TranslatorVisitor& v, bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd, AccumulateBehavior behavior, Signedness sign) {
+    if (size != 0b01 && size != 0b10) {
+        return v.UnallocatedEncoding();
+    }
+
+    const std::pair<size_t, Vec> element = Combine(size, H, L, M, Vm);
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t part = Q ? 1 : 0;
+
+    const auto extend = [&](const IR::U128& operand) {
+        return sign == Signedness::Signed ? v.ir.VectorSignExtend(esize, operand) : v.ir.VectorZeroExtend(esize, operand);
+    };
+
+    const IR::U128 operand1 = extend(v.Vpart(64, Vn, part));
+    const IR::U128 operand2 = extend(v.ir.VectorBroadcastElement(esize, v.V(128, element.second), element.first));
+    const IR::U128 product = v.ir.VectorMultiply(2 * esize, operand1, operand2);
+    const IR::U128 result = Accumulate(v, 2 * esize, 128, Vd, product, behavior);
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+static bool DoublingMultiplyHighByElement(TranslatorVisitor& v, bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd, Rounding rounding) {
+    if (size != 0b01 && size != 0b10) {
+        return v.UnallocatedEncoding();
+    }
+
+    const std::pair<size_t, Vec> element = Combine(size, H, L, M, Vm);
+    const size_t esize = 8 << size.ZeroExtend<size_t>();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.ir.VectorBroadcastElement(esize, v.V(128, element.second), element.first);
+    const IR::U128 result = rounding == Rounding::Round
+                          ? v.ir.VectorSignedSaturatedRoundingDoublingMultiplyReturnHigh(esize, operand1, operand2)
+                          : v.ir.VectorSignedSaturatedDoublingMultiplyReturnHigh(esize, operand1, operand2);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+static bool FPMultiplyByElement(TranslatorVisitor& v, bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd, AccumulateBehavior behavior) {
+    if (sz && L) {
+        return v.UnallocatedEncoding();
+    }
+    if (sz && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t index = sz ? (H ? 1 : 0) : (H ? 2 : 0) + (L ? 1 : 0);
+    const size_t esize = sz ? 64 : 32;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.ir.VectorBroadcastElement(esize, v.V(128, M ? Vm + 16 : Vm), index);
+    const IR::U128 result = [&] {
+        switch (behavior) {
+        case AccumulateBehavior::None:
+            return v.ir.FPVectorMul(esize, operand1, operand2, true);
+        case AccumulateBehavior::Accumulate:
+            return v.ir.FPVectorMulAdd(esize, v.V(datasize, Vd), operand1, operand2, true);
+        case AccumulateBehavior::Subtract:
+            return v.ir.FPVectorMulAdd(esize, v.V(datasize, Vd), v.ir.FPVectorNeg(esize, operand1), operand2, true);
+        }
+        UNREACHABLE();
+        return IR::U128{};
+    }();
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::MUL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::None);
+}
+
+bool TranslatorVisitor::MLA_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::MLS_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Subtract);
+}
+
+bool TranslatorVisitor::SMULL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyLongByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::None, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SMLAL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyLongByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Accumulate, Signedness::Signed);
+}
+
+bool TranslatorVisitor::SMLSL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyLongByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Subtract, Signedness::Signed);
+}
+
+bool TranslatorVisitor::UMULL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyLongByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::None, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::UMLAL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyLongByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Accumulate, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::UMLSL_elt(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return MultiplyLongByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Subtract, Signedness::Unsigned);
+}
+
+bool TranslatorVisitor::SQDMULH_elt_2(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return DoublingMultiplyHighByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, Rounding::None);
+}
+
+bool TranslatorVisitor::SQRDMULH_elt_2(bool Q, Imm<2> size, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return DoublingMultiplyHighByElement(*this, Q, size, L, M, Vm, H, Vn, Vd, Rounding::Round);
+}
+
+bool TranslatorVisitor::FMUL_elt_4(bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElement(*this, Q, sz, L, M, Vm, H, Vn, Vd, AccumulateBehavior::None);
+}
+
+bool TranslatorVisitor::FMLA_elt_4(bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElement(*this, Q, sz, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::FMLS_elt_4(bool Q, bool sz, bool L, bool M, Vec Vm, bool H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElement(*this, Q, sz, L, M, Vm, H, Vn, Vd, AccumulateBehavior::Subtract);
+}
+
+} // namespace A64
+} // namespace Dynarmic
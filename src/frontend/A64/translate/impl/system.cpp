@@ -37,5 +37,10 @@ bool TranslatorVisitor::SEVL() {
     return true;
 }
 
+bool TranslatorVisitor::CLREX([[maybe_unused]] Imm<4> CRm) {
+    ir.ClearExclusive();
+    return true;
+}
+
 } // namespace A64
 } // namespace Dynarmic
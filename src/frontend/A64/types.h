@@ -42,6 +42,19 @@ enum class ShiftType {
     ROR,
 };
 
+/// Operation performed by the A64AtomicMemory IR instructions.
+enum class AtomicOp {
+    Add,
+    Clear,
+    Eor,
+    Set,
+    SMax,
+    SMin,
+    UMax,
+    UMin,
+    Swap,
+};
+
 const char* CondToString(Cond cond);
 std::string RegToString(Reg reg);
 std::string VecToString(Vec vec);
@@ -0,0 +1,106 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace Dynarmic {
+namespace Decoder {
+
+/**
+ * Partitions a list of matchers by a subset of the bits of an opcode, so that decoding an instruction only
+ * requires testing the matchers which are able to match an opcode with the same values for those bits.
+ *
+ * @tparam MatcherT  The type of the Matcher to use.
+ * @tparam IndexBits The number of opcode bits used to index the table.
+ */
+template <typename MatcherT, size_t IndexBits>
+class LookupTable final {
+public:
+    using opcode_type = typename MatcherT::opcode_type;
+
+    /**
+     * Gathers the bits used to index the table from an opcode into the lowest IndexBits bits.
+     * As this is also applied to the masks and expected values of matchers, it must only move bits.
+     */
+    using IndexFunction = size_t (*)(opcode_type);
+
+    /**
+     * @param matchers List of matchers. If several matchers match an instruction, the earliest one in this list is used.
+     * @param index_fn Function which calculates the index for an opcode.
+     */
+    LookupTable(std::vector<MatcherT> matchers_, IndexFunction index_fn)
+        : matchers(std::move(matchers_)), index_fn(index_fn)
+    {
+        // Each matcher is added to every bucket whose index agrees with it on the bits it tests. These indices
+        // are enumerated directly as the subsets of the remaining index bits, so each bucket is built in a
+        // single pass over the matchers and candidates remain in the order of the matchers.
+        constexpr size_t index_mask = table_size - 1;
+        const auto for_each_index = [index_fn](const MatcherT& matcher, auto fn) {
+            const size_t mask = index_fn(matcher.GetMask());
+            const size_t expected = index_fn(matcher.GetExpected());
+            if ((expected & ~mask) != 0) {
+                return;
+            }
+            const size_t free_bits = ~mask & index_mask;
+            size_t subset = 0;
+            do {
+                fn(expected | subset);
+                subset = (subset - free_bits) & free_bits;
+            } while (subset != 0);
+        };
+
+        std::array<size_t, table_size> bucket_sizes{};
+        for (const auto& matcher : matchers) {
+            for_each_index(matcher, [&](size_t index) { bucket_sizes[index]++; });
+        }
+
+        bucket_begin[0] = 0;
+        for (size_t index = 0; index < table_size; index++) {
+            bucket_begin[index + 1] = bucket_begin[index] + bucket_sizes[index];
+        }
+
+        candidates.resize(bucket_begin[table_size]);
+        std::array<size_t, table_size> bucket_fill = {};
+        for (const auto& matcher : matchers) {
+            for_each_index(matcher, [&](size_t index) { candidates[bucket_begin[index] + bucket_fill[index]++] = &matcher; });
+        }
+    }
+
+    LookupTable(const LookupTable&) = delete;
+    LookupTable& operator=(const LookupTable&) = delete;
+
+    /// Finds the matcher for instruction, if one exists.
+    boost::optional<const MatcherT&> Decode(opcode_type instruction) const {
+        const size_t index = index_fn(instruction);
+        const auto begin = candidates.begin() + bucket_begin[index];
+        const auto end = candidates.begin() + bucket_begin[index + 1];
+
+        const auto matches_instruction = [instruction](const MatcherT* matcher) { return matcher->Matches(instruction); };
+
+        auto iter = std::find_if(begin, end, matches_instruction);
+        return iter != end ? boost::optional<const MatcherT&>(**iter) : boost::none;
+    }
+
+private:
+    static constexpr size_t table_size = size_t(1) << IndexBits;
+
+    const std::vector<MatcherT> matchers;
+    const IndexFunction index_fn;
+    /// The candidates for index are candidates[bucket_begin[index]] up to candidates[bucket_begin[index + 1]].
+    std::vector<const MatcherT*> candidates;
+    std::array<size_t, table_size + 1> bucket_begin;
+};
+
+} // namespace Decoder
+} // namespace Dynarmic
@@ -104,10 +104,18 @@ U32U64 IREmitter::ConditionalSelect(Cond cond, const U32U64& a, const U32U64& b)
     }
 }
 
+NZCV IREmitter::ConditionalSelect(Cond cond, const NZCV& a, const NZCV& b) {
+    return Inst<NZCV>(Opcode::ConditionalSelectNZCV, Value{cond}, a, b);
+}
+
 NZCV IREmitter::NZCVFrom(const Value& value) {
     return Inst<NZCV>(Opcode::GetNZCVFromOp, value);
 }
 
+NZCV IREmitter::NZCVFromPackedFlags(const U32& a) {
+    return Inst<NZCV>(Opcode::NZCVFromPackedFlags, a);
+}
+
 ResultAndCarry<U32> IREmitter::LogicalShiftLeft(const U32& value_in, const U8& shift_amount, const U1& carry_in) {
     auto result = Inst<U32>(Opcode::LogicalShiftLeft32, value_in, shift_amount, carry_in);
     auto carry_out = Inst<U1>(Opcode::GetCarryFromOp, result);
@@ -269,6 +277,38 @@ U32U64 IREmitter::Mul(const U32U64& a, const U32U64& b) {
     return Inst<U64>(Opcode::Mul64, a, b);
 }
 
+U32 IREmitter::UnsignedDiv(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::UnsignedDiv32, a, b);
+}
+
+U64 IREmitter::UnsignedDiv(const U64& a, const U64& b) {
+    return Inst<U64>(Opcode::UnsignedDiv64, a, b);
+}
+
+U32U64 IREmitter::UnsignedDiv(const U32U64& a, const U32U64& b) {
+    if (a.GetType() == Type::U32) {
+        return Inst<U32>(Opcode::UnsignedDiv32, a, b);
+    }
+
+    return Inst<U64>(Opcode::UnsignedDiv64, a, b);
+}
+
+U32 IREmitter::SignedDiv(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::SignedDiv32, a, b);
+}
+
+U64 IREmitter::SignedDiv(const U64& a, const U64& b) {
+    return Inst<U64>(Opcode::SignedDiv64, a, b);
+}
+
+U32U64 IREmitter::SignedDiv(const U32U64& a, const U32U64& b) {
+    if (a.GetType() == Type::U32) {
+        return Inst<U32>(Opcode::SignedDiv32, a, b);
+    }
+
+    return Inst<U64>(Opcode::SignedDiv64, a, b);
+}
+
 U32 IREmitter::And(const U32& a, const U32& b) {
     return Inst<U32>(Opcode::And32, a, b);
 }
@@ -400,6 +440,14 @@ U64 IREmitter::ZeroExtendWordToLong(const U32& a) {
     return Inst<U64>(Opcode::ZeroExtendWordToLong, a);
 }
 
+U128 IREmitter::ZeroExtendToQuad(const UAny& a) {
+    return ZeroExtendLongToQuad(ZeroExtendToLong(a));
+}
+
+U128 IREmitter::ZeroExtendLongToQuad(const U64& a) {
+    return Inst<U128>(Opcode::ZeroExtendLongToQuad, a);
+}
+
 U32 IREmitter::ZeroExtendHalfToWord(const U16& a) {
     return Inst<U32>(Opcode::ZeroExtendHalfToWord, a);
 }
@@ -438,6 +486,38 @@ U64 IREmitter::CountLeadingZeros(const U64& a) {
     return Inst<U64>(Opcode::CountLeadingZeros64, a);
 }
 
+U32 IREmitter::CRC32Castagnoli8(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::CRC32Castagnoli8, a, b);
+}
+
+U32 IREmitter::CRC32Castagnoli16(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::CRC32Castagnoli16, a, b);
+}
+
+U32 IREmitter::CRC32Castagnoli32(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::CRC32Castagnoli32, a, b);
+}
+
+U32 IREmitter::CRC32Castagnoli64(const U32& a, const U64& b) {
+    return Inst<U32>(Opcode::CRC32Castagnoli64, a, b);
+}
+
+U32 IREmitter::CRC32ISO8(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::CRC32ISO8, a, b);
+}
+
+U32 IREmitter::CRC32ISO16(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::CRC32ISO16, a, b);
+}
+
+U32 IREmitter::CRC32ISO32(const U32& a, const U32& b) {
+    return Inst<U32>(Opcode::CRC32ISO32, a, b);
+}
+
+U32 IREmitter::CRC32ISO64(const U32& a, const U64& b) {
+    return Inst<U32>(Opcode::CRC32ISO64, a, b);
+}
+
 U32U64 IREmitter::CountLeadingZeros(const U32U64& a) {
     if (a.GetType() == IR::Type::U32) {
         return Inst<U32>(Opcode::CountLeadingZeros32, a);
@@ -648,10 +728,52 @@ U128 IREmitter::VectorAdd64(const U128& a, const U128& b) {
     return Inst<U128>(Opcode::VectorAdd64, a, b);
 }
 
+U128 IREmitter::VectorAdd(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorAdd8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorAdd16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorAdd32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorAdd64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSub(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSub8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorSub16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSub32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorSub64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
 U128 IREmitter::VectorAnd(const U128& a, const U128& b) {
     return Inst<U128>(Opcode::VectorAnd, a, b);
 }
 
+U128 IREmitter::VectorAndNot(const U128& a, const U128& b) {
+    return Inst<U128>(Opcode::VectorAndNot, a, b);
+}
+
+U128 IREmitter::VectorOr(const U128& a, const U128& b) {
+    return Inst<U128>(Opcode::VectorOr, a, b);
+}
+
+U128 IREmitter::VectorEor(const U128& a, const U128& b) {
+    return Inst<U128>(Opcode::VectorEor, a, b);
+}
+
 U128 IREmitter::VectorLowerBroadcast8(const U8& a) {
     return Inst<U128>(Opcode::VectorLowerBroadcast8, a);
 }
@@ -680,6 +802,58 @@ U128 IREmitter::VectorBroadcast64(const U64& a) {
     return Inst<U128>(Opcode::VectorBroadcast64, a);
 }
 
+U128 IREmitter::VectorBroadcastElement(size_t esize, const U128& a, size_t index) {
+    ASSERT_MSG(esize * index < 128, "Invalid index");
+    switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorBroadcastElem16, a, Imm8(static_cast<u8>(index)));
+    case 32:
+        return Inst<U128>(Opcode::VectorBroadcastElem32, a, Imm8(static_cast<u8>(index)));
+    case 64:
+        return Inst<U128>(Opcode::VectorBroadcastElem64, a, Imm8(static_cast<u8>(index)));
+    }
+    UNREACHABLE();
+    return {};
+}
+
+UAny IREmitter::VectorGetElement(size_t esize, const U128& a, size_t index) {
+    ASSERT_MSG(esize * index < 128, "Invalid index");
+    switch (esize) {
+    case 8:
+        return Inst<U8>(Opcode::VectorGetElement8, a, Imm8(static_cast<u8>(index)));
+    case 16:
+        return Inst<U16>(Opcode::VectorGetElement16, a, Imm8(static_cast<u8>(index)));
+    case 32:
+        return Inst<U32>(Opcode::VectorGetElement32, a, Imm8(static_cast<u8>(index)));
+    case 64:
+        return Inst<U64>(Opcode::VectorGetElement64, a, Imm8(static_cast<u8>(index)));
+    default:
+        ASSERT_MSG(false, "Unreachable");
+        return {};
+    }
+}
+
+U128 IREmitter::VectorSetElement(size_t esize, const U128& a, size_t index, const UAny& elem) {
+    ASSERT_MSG(esize * index < 128, "Invalid index");
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSetElement8, a, Imm8(static_cast<u8>(index)), elem);
+    case 16:
+        return Inst<U128>(Opcode::VectorSetElement16, a, Imm8(static_cast<u8>(index)), elem);
+    case 32:
+        return Inst<U128>(Opcode::VectorSetElement32, a, Imm8(static_cast<u8>(index)), elem);
+    case 64:
+        return Inst<U128>(Opcode::VectorSetElement64, a, Imm8(static_cast<u8>(index)), elem);
+    default:
+        ASSERT_MSG(false, "Unreachable");
+        return {};
+    }
+}
+
+U128 IREmitter::VectorNot(const U128& a) {
+    return Inst<U128>(Opcode::VectorNot, a);
+}
+
 U128 IREmitter::VectorLowerPairedAdd8(const U128& a, const U128& b) {
     return Inst<U128>(Opcode::VectorLowerPairedAdd8, a, b);
 }
@@ -708,6 +882,686 @@ U128 IREmitter::VectorPairedAdd64(const U128& a, const U128& b) {
     return Inst<U128>(Opcode::VectorPairedAdd64, a, b);
 }
 
+U128 IREmitter::VectorPolynomialMultiplyLong(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorPolyMulLong8, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorPolyMulLong64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorMultiply(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorMultiply8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorMultiply16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorMultiply32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorMultiply64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorPolynomialMultiply(const U128& a, const U128& b) {
+    return Inst<U128>(Opcode::VectorPolyMul8, a, b);
+}
+
+U128 IREmitter::VectorEqual(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorEqual8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorEqual16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorEqual32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorEqual64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorGreaterSigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorGreaterS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorGreaterS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorGreaterS32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorGreaterS64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorMaxSigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorMaxS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorMaxS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorMaxS32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorMaxS64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorMaxUnsigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorMaxU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorMaxU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorMaxU32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorMaxU64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorMinSigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorMinS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorMinS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorMinS32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorMinS64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorMinUnsigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorMinU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorMinU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorMinU32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorMinU64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorHalvingAddSigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorHalvingAddS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorHalvingAddS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorHalvingAddS32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorHalvingAddUnsigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorHalvingAddU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorHalvingAddU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorHalvingAddU32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorHalvingSubSigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorHalvingSubS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorHalvingSubS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorHalvingSubS32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorHalvingSubUnsigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorHalvingSubU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorHalvingSubU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorHalvingSubU32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorRoundingHalvingAddSigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorRHalvingAddS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorRHalvingAddS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorRHalvingAddS32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorRoundingHalvingAddUnsigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorRHalvingAddU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorRHalvingAddU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorRHalvingAddU32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignedAbsoluteDifference(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorAbsDiffS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorAbsDiffS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorAbsDiffS32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnsignedAbsoluteDifference(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorAbsDiffU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorAbsDiffU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorAbsDiffU32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignedSaturatedAdd(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSaturatedAddS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorSaturatedAddS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSaturatedAddS32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorSaturatedAddS64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignedSaturatedSub(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSaturatedSubS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorSaturatedSubS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSaturatedSubS32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorSaturatedSubS64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignedSaturatedDoublingMultiplyReturnHigh(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSatDMulHigh16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSatDMulHigh32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignedSaturatedRoundingDoublingMultiplyReturnHigh(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSatRDMulHigh16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSatRDMulHigh32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnsignedSaturatedAdd(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSaturatedAddU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorSaturatedAddU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSaturatedAddU32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorSaturatedAddU64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnsignedSaturatedSub(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSaturatedSubU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorSaturatedSubU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSaturatedSubU32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorSaturatedSubU64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorArithmeticVShift(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorVShiftS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorVShiftS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorVShiftS32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorVShiftS64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorLogicalVShift(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorVShiftU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorVShiftU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorVShiftU32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorVShiftU64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorRoundingShiftLeftSigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorRoundingVShiftS8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorRoundingVShiftS16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorRoundingVShiftS32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorRoundingVShiftS64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorRoundingShiftLeftUnsigned(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorRoundingVShiftU8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorRoundingVShiftU16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorRoundingVShiftU32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorRoundingVShiftU64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnzipEven(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorUnzipEven8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorUnzipEven16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorUnzipEven32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorUnzipEven64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnzipOdd(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorUnzipOdd8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorUnzipOdd16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorUnzipOdd32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorUnzipOdd64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnzipEvenLower(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorUnzipEvenLower8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorUnzipEvenLower16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorUnzipEvenLower32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnzipOddLower(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorUnzipOddLower8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorUnzipOddLower16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorUnzipOddLower32, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorInterleaveLower(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorInterleaveLower8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorInterleaveLower16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorInterleaveLower32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorInterleaveLower64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorInterleaveUpper(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorInterleaveUpper8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorInterleaveUpper16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorInterleaveUpper32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorInterleaveUpper64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorLogicalShiftLeft(size_t esize, const U128& a, u8 shift_amount) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorShiftLeft8, a, Imm8(shift_amount));
+    case 16:
+        return Inst<U128>(Opcode::VectorShiftLeft16, a, Imm8(shift_amount));
+    case 32:
+        return Inst<U128>(Opcode::VectorShiftLeft32, a, Imm8(shift_amount));
+    case 64:
+        return Inst<U128>(Opcode::VectorShiftLeft64, a, Imm8(shift_amount));
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorLogicalShiftRight(size_t esize, const U128& a, u8 shift_amount) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorShiftRightU8, a, Imm8(shift_amount));
+    case 16:
+        return Inst<U128>(Opcode::VectorShiftRightU16, a, Imm8(shift_amount));
+    case 32:
+        return Inst<U128>(Opcode::VectorShiftRightU32, a, Imm8(shift_amount));
+    case 64:
+        return Inst<U128>(Opcode::VectorShiftRightU64, a, Imm8(shift_amount));
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorArithmeticShiftRight(size_t esize, const U128& a, u8 shift_amount) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorShiftRightS8, a, Imm8(shift_amount));
+    case 16:
+        return Inst<U128>(Opcode::VectorShiftRightS16, a, Imm8(shift_amount));
+    case 32:
+        return Inst<U128>(Opcode::VectorShiftRightS32, a, Imm8(shift_amount));
+    case 64:
+        return Inst<U128>(Opcode::VectorShiftRightS64, a, Imm8(shift_amount));
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignExtend(size_t original_esize, const U128& a) {
+    switch (original_esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSignExtend8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorSignExtend16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorSignExtend32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorZeroExtend(size_t original_esize, const U128& a) {
+    switch (original_esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorZeroExtend8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorZeroExtend16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorZeroExtend32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorNarrow(size_t original_esize, const U128& a) {
+    switch (original_esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorNarrow16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorNarrow32, a);
+    case 64:
+        return Inst<U128>(Opcode::VectorNarrow64, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignedSaturatedNarrowToSigned(size_t original_esize, const U128& a) {
+    switch (original_esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSatNarrowS16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorSatNarrowS32, a);
+    case 64:
+        return Inst<U128>(Opcode::VectorSatNarrowS64, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorSignedSaturatedNarrowToUnsigned(size_t original_esize, const U128& a) {
+    switch (original_esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSatNarrowSU16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorSatNarrowSU32, a);
+    case 64:
+        return Inst<U128>(Opcode::VectorSatNarrowSU64, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorUnsignedSaturatedNarrow(size_t original_esize, const U128& a) {
+    switch (original_esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSatNarrowU16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorSatNarrowU32, a);
+    case 64:
+        return Inst<U128>(Opcode::VectorSatNarrowU64, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorExtract(const U128& a, const U128& b, size_t position) {
+    ASSERT(position % 8 == 0 && position < 128);
+    return Inst<U128>(Opcode::VectorExtract, a, b, Imm8(static_cast<u8>(position)));
+}
+
+U128 IREmitter::VectorExtractLower(const U128& a, const U128& b, size_t position) {
+    ASSERT(position % 8 == 0 && position < 64);
+    return Inst<U128>(Opcode::VectorExtractLower, a, b, Imm8(static_cast<u8>(position)));
+}
+
+U128 IREmitter::VectorTableLookup(const U128& table, const U128& indices) {
+    return Inst<U128>(Opcode::VectorTableLookup, table, indices);
+}
+
+U128 IREmitter::VectorReduceAdd(size_t esize, const U128& a) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorReduceAdd8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorReduceAdd16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorReduceAdd32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorReduceAddLongSigned(size_t esize, const U128& a) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorReduceAddLongS8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorReduceAddLongS16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorReduceAddLongS32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorReduceAddLongUnsigned(size_t esize, const U128& a) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorReduceAddLongU8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorReduceAddLongU16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorReduceAddLongU32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorReduceMaxSigned(size_t esize, const U128& a) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorReduceMaxS8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorReduceMaxS16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorReduceMaxS32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorReduceMaxUnsigned(size_t esize, const U128& a) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorReduceMaxU8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorReduceMaxU16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorReduceMaxU32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorReduceMinSigned(size_t esize, const U128& a) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorReduceMinS8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorReduceMinS16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorReduceMinS32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::VectorReduceMinUnsigned(size_t esize, const U128& a) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorReduceMinU8, a);
+    case 16:
+        return Inst<U128>(Opcode::VectorReduceMinU16, a);
+    case 32:
+        return Inst<U128>(Opcode::VectorReduceMinU32, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
 U32 IREmitter::FPAbs32(const U32& a) {
     return Inst<U32>(Opcode::FPAbs32, a);
 }
@@ -716,6 +1570,14 @@ U64 IREmitter::FPAbs64(const U64& a) {
     return Inst<U64>(Opcode::FPAbs64, a);
 }
 
+U32U64 IREmitter::FPAbs(const U32U64& a) {
+    if (a.GetType() == Type::U32) {
+        return FPAbs32(a);
+    } else {
+        return FPAbs64(a);
+    }
+}
+
 U32 IREmitter::FPAdd32(const U32& a, const U32& b, bool fpscr_controlled) {
     ASSERT(fpscr_controlled);
     return Inst<U32>(Opcode::FPAdd32, a, b);
@@ -726,14 +1588,32 @@ U64 IREmitter::FPAdd64(const U64& a, const U64& b, bool fpscr_controlled) {
     return Inst<U64>(Opcode::FPAdd64, a, b);
 }
 
-void IREmitter::FPCompare32(const U32& a, const U32& b, bool exc_on_qnan, bool fpscr_controlled) {
+U32U64 IREmitter::FPAdd(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPAdd32(a, b, fpscr_controlled);
+    } else {
+        return FPAdd64(a, b, fpscr_controlled);
+    }
+}
+
+NZCV IREmitter::FPCompare32(const U32& a, const U32& b, bool exc_on_qnan, bool fpscr_controlled) {
     ASSERT(fpscr_controlled);
-    Inst(Opcode::FPCompare32, a, b, Imm1(exc_on_qnan));
+    return Inst<NZCV>(Opcode::FPCompare32, a, b, Imm1(exc_on_qnan));
 }
 
-void IREmitter::FPCompare64(const U64& a, const U64& b, bool exc_on_qnan, bool fpscr_controlled) {
+NZCV IREmitter::FPCompare64(const U64& a, const U64& b, bool exc_on_qnan, bool fpscr_controlled) {
     ASSERT(fpscr_controlled);
-    Inst(Opcode::FPCompare64, a, b, Imm1(exc_on_qnan));
+    return Inst<NZCV>(Opcode::FPCompare64, a, b, Imm1(exc_on_qnan));
+}
+
+NZCV IREmitter::FPCompare(const U32U64& a, const U32U64& b, bool exc_on_qnan, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPCompare32(a, b, exc_on_qnan, fpscr_controlled);
+    } else {
+        return FPCompare64(a, b, exc_on_qnan, fpscr_controlled);
+    }
 }
 
 U32 IREmitter::FPDiv32(const U32& a, const U32& b, bool fpscr_controlled) {
@@ -746,6 +1626,91 @@ U64 IREmitter::FPDiv64(const U64& a, const U64& b, bool fpscr_controlled) {
     return Inst<U64>(Opcode::FPDiv64, a, b);
 }
 
+U32U64 IREmitter::FPDiv(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPDiv32(a, b, fpscr_controlled);
+    } else {
+        return FPDiv64(a, b, fpscr_controlled);
+    }
+}
+
+U32 IREmitter::FPMax32(const U32& a, const U32& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U32>(Opcode::FPMax32, a, b);
+}
+
+U64 IREmitter::FPMax64(const U64& a, const U64& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U64>(Opcode::FPMax64, a, b);
+}
+
+U32U64 IREmitter::FPMax(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPMax32(a, b, fpscr_controlled);
+    } else {
+        return FPMax64(a, b, fpscr_controlled);
+    }
+}
+
+U32 IREmitter::FPMaxNumeric32(const U32& a, const U32& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U32>(Opcode::FPMaxNumeric32, a, b);
+}
+
+U64 IREmitter::FPMaxNumeric64(const U64& a, const U64& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U64>(Opcode::FPMaxNumeric64, a, b);
+}
+
+U32U64 IREmitter::FPMaxNumeric(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPMaxNumeric32(a, b, fpscr_controlled);
+    } else {
+        return FPMaxNumeric64(a, b, fpscr_controlled);
+    }
+}
+
+U32 IREmitter::FPMin32(const U32& a, const U32& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U32>(Opcode::FPMin32, a, b);
+}
+
+U64 IREmitter::FPMin64(const U64& a, const U64& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U64>(Opcode::FPMin64, a, b);
+}
+
+U32U64 IREmitter::FPMin(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPMin32(a, b, fpscr_controlled);
+    } else {
+        return FPMin64(a, b, fpscr_controlled);
+    }
+}
+
+U32 IREmitter::FPMinNumeric32(const U32& a, const U32& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U32>(Opcode::FPMinNumeric32, a, b);
+}
+
+U64 IREmitter::FPMinNumeric64(const U64& a, const U64& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U64>(Opcode::FPMinNumeric64, a, b);
+}
+
+U32U64 IREmitter::FPMinNumeric(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPMinNumeric32(a, b, fpscr_controlled);
+    } else {
+        return FPMinNumeric64(a, b, fpscr_controlled);
+    }
+}
+
 U32 IREmitter::FPMul32(const U32& a, const U32& b, bool fpscr_controlled) {
     ASSERT(fpscr_controlled);
     return Inst<U32>(Opcode::FPMul32, a, b);
@@ -756,6 +1721,34 @@ U64 IREmitter::FPMul64(const U64& a, const U64& b, bool fpscr_controlled) {
     return Inst<U64>(Opcode::FPMul64, a, b);
 }
 
+U32U64 IREmitter::FPMul(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPMul32(a, b, fpscr_controlled);
+    } else {
+        return FPMul64(a, b, fpscr_controlled);
+    }
+}
+
+U32 IREmitter::FPMulAdd32(const U32& addend, const U32& op1, const U32& op2, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U32>(Opcode::FPMulAdd32, addend, op1, op2);
+}
+
+U64 IREmitter::FPMulAdd64(const U64& addend, const U64& op1, const U64& op2, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U64>(Opcode::FPMulAdd64, addend, op1, op2);
+}
+
+U32U64 IREmitter::FPMulAdd(const U32U64& addend, const U32U64& op1, const U32U64& op2, bool fpscr_controlled) {
+    ASSERT(addend.GetType() == op1.GetType() && addend.GetType() == op2.GetType());
+    if (addend.GetType() == Type::U32) {
+        return FPMulAdd32(addend, op1, op2, fpscr_controlled);
+    } else {
+        return FPMulAdd64(addend, op1, op2, fpscr_controlled);
+    }
+}
+
 U32 IREmitter::FPNeg32(const U32& a) {
     return Inst<U32>(Opcode::FPNeg32, a);
 }
@@ -764,6 +1757,14 @@ U64 IREmitter::FPNeg64(const U64& a) {
     return Inst<U64>(Opcode::FPNeg64, a);
 }
 
+U32U64 IREmitter::FPNeg(const U32U64& a) {
+    if (a.GetType() == Type::U32) {
+        return FPNeg32(a);
+    } else {
+        return FPNeg64(a);
+    }
+}
+
 U32 IREmitter::FPSqrt32(const U32& a) {
     return Inst<U32>(Opcode::FPSqrt32, a);
 }
@@ -772,6 +1773,14 @@ U64 IREmitter::FPSqrt64(const U64& a) {
     return Inst<U64>(Opcode::FPSqrt64, a);
 }
 
+U32U64 IREmitter::FPSqrt(const U32U64& a) {
+    if (a.GetType() == Type::U32) {
+        return FPSqrt32(a);
+    } else {
+        return FPSqrt64(a);
+    }
+}
+
 U32 IREmitter::FPSub32(const U32& a, const U32& b, bool fpscr_controlled) {
     ASSERT(fpscr_controlled);
     return Inst<U32>(Opcode::FPSub32, a, b);
@@ -782,6 +1791,15 @@ U64 IREmitter::FPSub64(const U64& a, const U64& b, bool fpscr_controlled) {
     return Inst<U64>(Opcode::FPSub64, a, b);
 }
 
+U32U64 IREmitter::FPSub(const U32U64& a, const U32U64& b, bool fpscr_controlled) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == Type::U32) {
+        return FPSub32(a, b, fpscr_controlled);
+    } else {
+        return FPSub64(a, b, fpscr_controlled);
+    }
+}
+
 U32 IREmitter::FPDoubleToSingle(const U64& a, bool fpscr_controlled) {
     ASSERT(fpscr_controlled);
     return Inst<U32>(Opcode::FPDoubleToSingle, a);
@@ -812,6 +1830,30 @@ U32 IREmitter::FPDoubleToU32(const U32& a, bool round_towards_zero, bool fpscr_c
     return Inst<U32>(Opcode::FPDoubleToU32, a, Imm1(round_towards_zero));
 }
 
+U32 IREmitter::FPToFixedS32(const U32U64& a, size_t fbits, FP::RoundingMode rounding) {
+    ASSERT(fbits <= 32);
+    const Opcode opcode = a.GetType() == Type::U32 ? Opcode::FPSingleToFixedS32 : Opcode::FPDoubleToFixedS32;
+    return Inst<U32>(opcode, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)));
+}
+
+U64 IREmitter::FPToFixedS64(const U32U64& a, size_t fbits, FP::RoundingMode rounding) {
+    ASSERT(fbits <= 64);
+    const Opcode opcode = a.GetType() == Type::U32 ? Opcode::FPSingleToFixedS64 : Opcode::FPDoubleToFixedS64;
+    return Inst<U64>(opcode, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)));
+}
+
+U32 IREmitter::FPToFixedU32(const U32U64& a, size_t fbits, FP::RoundingMode rounding) {
+    ASSERT(fbits <= 32);
+    const Opcode opcode = a.GetType() == Type::U32 ? Opcode::FPSingleToFixedU32 : Opcode::FPDoubleToFixedU32;
+    return Inst<U32>(opcode, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)));
+}
+
+U64 IREmitter::FPToFixedU64(const U32U64& a, size_t fbits, FP::RoundingMode rounding) {
+    ASSERT(fbits <= 64);
+    const Opcode opcode = a.GetType() == Type::U32 ? Opcode::FPSingleToFixedU64 : Opcode::FPDoubleToFixedU64;
+    return Inst<U64>(opcode, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)));
+}
+
 U32 IREmitter::FPS32ToSingle(const U32& a, bool round_to_nearest, bool fpscr_controlled) {
     ASSERT(fpscr_controlled);
     return Inst<U32>(Opcode::FPS32ToSingle, a, Imm1(round_to_nearest));
@@ -832,6 +1874,171 @@ U64 IREmitter::FPU32ToDouble(const U32& a, bool round_to_nearest, bool fpscr_con
     return Inst<U64>(Opcode::FPU32ToDouble, a, Imm1(round_to_nearest));
 }
 
+U32 IREmitter::FPS64ToSingle(const U64& a, bool round_to_nearest, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U32>(Opcode::FPS64ToSingle, a, Imm1(round_to_nearest));
+}
+
+U32 IREmitter::FPU64ToSingle(const U64& a, bool round_to_nearest, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U32>(Opcode::FPU64ToSingle, a, Imm1(round_to_nearest));
+}
+
+U64 IREmitter::FPS64ToDouble(const U64& a, bool round_to_nearest, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U64>(Opcode::FPS64ToDouble, a, Imm1(round_to_nearest));
+}
+
+U64 IREmitter::FPU64ToDouble(const U64& a, bool round_to_nearest, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    return Inst<U64>(Opcode::FPU64ToDouble, a, Imm1(round_to_nearest));
+}
+
+U128 IREmitter::FPVectorAbs(size_t esize, const U128& a) {
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorAbs32, a);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorAbs64, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::FPVectorAdd(size_t esize, const U128& a, const U128& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorAdd32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorAdd64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::FPVectorDiv(size_t esize, const U128& a, const U128& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorDiv32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorDiv64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::FPVectorMul(size_t esize, const U128& a, const U128& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorMul32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorMul64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::FPVectorMulAdd(size_t esize, const U128& addend, const U128& op1, const U128& op2, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorMulAdd32, addend, op1, op2);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorMulAdd64, addend, op1, op2);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::FPVectorNeg(size_t esize, const U128& a) {
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorNeg32, a);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorNeg64, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::FPVectorSqrt(size_t esize, const U128& a, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorSqrt32, a);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorSqrt64, a);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::FPVectorSub(size_t esize, const U128& a, const U128& b, bool fpscr_controlled) {
+    ASSERT(fpscr_controlled);
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorSub32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::FPVectorSub64, a, b);
+    }
+    UNREACHABLE();
+    return {};
+}
+
+U128 IREmitter::AESDecryptSingleRound(const U128& a) {
+    return Inst<U128>(Opcode::AESDecryptSingleRound, a);
+}
+
+U128 IREmitter::AESEncryptSingleRound(const U128& a) {
+    return Inst<U128>(Opcode::AESEncryptSingleRound, a);
+}
+
+U128 IREmitter::AESInverseMixColumns(const U128& a) {
+    return Inst<U128>(Opcode::AESInverseMixColumns, a);
+}
+
+U128 IREmitter::AESMixColumns(const U128& a) {
+    return Inst<U128>(Opcode::AESMixColumns, a);
+}
+
+U128 IREmitter::SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateChoose, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateMajority, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateParity, x, y, w);
+}
+
+U128 IREmitter::SHA1MessageSchedule0(const U128& a, const U128& b, const U128& c) {
+    return Inst<U128>(Opcode::SHA1MessageSchedule0, a, b, c);
+}
+
+U128 IREmitter::SHA1MessageSchedule1(const U128& a, const U128& b) {
+    return Inst<U128>(Opcode::SHA1MessageSchedule1, a, b);
+}
+
+U128 IREmitter::SHA256Hash(const U128& x, const U128& y, const U128& w, bool part1) {
+    if (part1) {
+        return Inst<U128>(Opcode::SHA256HashPart1, x, y, w);
+    }
+    return Inst<U128>(Opcode::SHA256HashPart2, x, y, w);
+}
+
+U128 IREmitter::SHA256MessageSchedule0(const U128& a, const U128& b) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule0, a, b);
+}
+
+U128 IREmitter::SHA256MessageSchedule1(const U128& a, const U128& b, const U128& c) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule1, a, b, c);
+}
+
 void IREmitter::Breakpoint() {
     Inst(Opcode::Breakpoint);
 }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "common/common_types.h"
+#include "common/fp_rounding_mode.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/location_descriptor.h"
 #include "frontend/ir/terminal.h"
@@ -80,9 +81,11 @@ public:
     U32 ConditionalSelect(Cond cond, const U32& a, const U32& b);
     U64 ConditionalSelect(Cond cond, const U64& a, const U64& b);
     U32U64 ConditionalSelect(Cond cond, const U32U64& a, const U32U64& b);
+    NZCV ConditionalSelect(Cond cond, const NZCV& a, const NZCV& b);
 
     // This pseudo-instruction may only be added to instructions that support it.
     NZCV NZCVFrom(const Value& value);
+    NZCV NZCVFromPackedFlags(const U32& a);
 
     ResultAndCarry<U32> LogicalShiftLeft(const U32& value_in, const U8& shift_amount, const U1& carry_in);
     ResultAndCarry<U32> LogicalShiftRight(const U32& value_in, const U8& shift_amount, const U1& carry_in);
@@ -110,6 +113,12 @@ public:
     U32 Mul(const U32& a, const U32& b);
     U64 Mul(const U64& a, const U64& b);
     U32U64 Mul(const U32U64& a, const U32U64& b);
+    U32 UnsignedDiv(const U32& a, const U32& b);
+    U64 UnsignedDiv(const U64& a, const U64& b);
+    U32U64 UnsignedDiv(const U32U64& a, const U32U64& b);
+    U32 SignedDiv(const U32& a, const U32& b);
+    U64 SignedDiv(const U64& a, const U64& b);
+    U32U64 SignedDiv(const U32U64& a, const U32U64& b);
     U32 And(const U32& a, const U32& b);
     U32U64 And(const U32U64& a, const U32U64& b);
     U32 Eor(const U32& a, const U32& b);
@@ -128,6 +137,8 @@ public:
     U32 ZeroExtendByteToWord(const U8& a);
     U32 ZeroExtendHalfToWord(const U16& a);
     U64 ZeroExtendWordToLong(const U32& a);
+    U128 ZeroExtendToQuad(const UAny& a);
+    U128 ZeroExtendLongToQuad(const U64& a);
     U32 IndeterminateExtendToWord(const UAny& a);
     U64 IndeterminateExtendToLong(const UAny& a);
     U32 ByteReverseWord(const U32& a);
@@ -137,6 +148,15 @@ public:
     U64 CountLeadingZeros(const U64& a);
     U32U64 CountLeadingZeros(const U32U64& a);
 
+    U32 CRC32Castagnoli8(const U32& a, const U32& b);
+    U32 CRC32Castagnoli16(const U32& a, const U32& b);
+    U32 CRC32Castagnoli32(const U32& a, const U32& b);
+    U32 CRC32Castagnoli64(const U32& a, const U64& b);
+    U32 CRC32ISO8(const U32& a, const U32& b);
+    U32 CRC32ISO16(const U32& a, const U32& b);
+    U32 CRC32ISO32(const U32& a, const U32& b);
+    U32 CRC32ISO64(const U32& a, const U64& b);
+
     ResultAndOverflow<U32> SignedSaturatedAdd(const U32& a, const U32& b);
     ResultAndOverflow<U32> SignedSaturatedSub(const U32& a, const U32& b);
     ResultAndOverflow<U32> UnsignedSaturation(const U32& a, size_t bit_size_to_saturate_to);
@@ -181,7 +201,12 @@ public:
     U128 VectorAdd16(const U128& a, const U128& b);
     U128 VectorAdd32(const U128& a, const U128& b);
     U128 VectorAdd64(const U128& a, const U128& b);
+    U128 VectorAdd(size_t esize, const U128& a, const U128& b);
+    U128 VectorSub(size_t esize, const U128& a, const U128& b);
     U128 VectorAnd(const U128& a, const U128& b);
+    U128 VectorAndNot(const U128& a, const U128& b);
+    U128 VectorOr(const U128& a, const U128& b);
+    U128 VectorEor(const U128& a, const U128& b);
     U128 VectorLowerBroadcast8(const U8& a);
     U128 VectorLowerBroadcast16(const U16& a);
     U128 VectorLowerBroadcast32(const U32& a);
@@ -189,6 +214,10 @@ public:
     U128 VectorBroadcast16(const U16& a);
     U128 VectorBroadcast32(const U32& a);
     U128 VectorBroadcast64(const U64& a);
+    U128 VectorBroadcastElement(size_t esize, const U128& a, size_t index);
+    UAny VectorGetElement(size_t esize, const U128& a, size_t index);
+    U128 VectorSetElement(size_t esize, const U128& a, size_t index, const UAny& elem);
+    U128 VectorNot(const U128& a);
     U128 VectorLowerPairedAdd8(const U128& a, const U128& b);
     U128 VectorLowerPairedAdd16(const U128& a, const U128& b);
     U128 VectorLowerPairedAdd32(const U128& a, const U128& b);
@@ -196,33 +225,138 @@ public:
     U128 VectorPairedAdd16(const U128& a, const U128& b);
     U128 VectorPairedAdd32(const U128& a, const U128& b);
     U128 VectorPairedAdd64(const U128& a, const U128& b);
+    U128 VectorPolynomialMultiplyLong(size_t esize, const U128& a, const U128& b);
+    U128 VectorMultiply(size_t esize, const U128& a, const U128& b);
+    U128 VectorPolynomialMultiply(const U128& a, const U128& b);
+    U128 VectorEqual(size_t esize, const U128& a, const U128& b);
+    U128 VectorGreaterSigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorMaxSigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorMaxUnsigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorMinSigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorMinUnsigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorHalvingAddSigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorHalvingAddUnsigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorHalvingSubSigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorHalvingSubUnsigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorRoundingHalvingAddSigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorRoundingHalvingAddUnsigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorSignedAbsoluteDifference(size_t esize, const U128& a, const U128& b);
+    U128 VectorUnsignedAbsoluteDifference(size_t esize, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedAdd(size_t esize, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedSub(size_t esize, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedDoublingMultiplyReturnHigh(size_t esize, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedRoundingDoublingMultiplyReturnHigh(size_t esize, const U128& a, const U128& b);
+    U128 VectorUnsignedSaturatedAdd(size_t esize, const U128& a, const U128& b);
+    U128 VectorUnsignedSaturatedSub(size_t esize, const U128& a, const U128& b);
+    U128 VectorArithmeticVShift(size_t esize, const U128& a, const U128& b);
+    U128 VectorLogicalVShift(size_t esize, const U128& a, const U128& b);
+    U128 VectorRoundingShiftLeftSigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorRoundingShiftLeftUnsigned(size_t esize, const U128& a, const U128& b);
+    U128 VectorUnzipEven(size_t esize, const U128& a, const U128& b);
+    U128 VectorUnzipOdd(size_t esize, const U128& a, const U128& b);
+    U128 VectorUnzipEvenLower(size_t esize, const U128& a, const U128& b);
+    U128 VectorUnzipOddLower(size_t esize, const U128& a, const U128& b);
+    U128 VectorInterleaveLower(size_t esize, const U128& a, const U128& b);
+    U128 VectorInterleaveUpper(size_t esize, const U128& a, const U128& b);
+    U128 VectorLogicalShiftLeft(size_t esize, const U128& a, u8 shift_amount);
+    U128 VectorLogicalShiftRight(size_t esize, const U128& a, u8 shift_amount);
+    U128 VectorArithmeticShiftRight(size_t esize, const U128& a, u8 shift_amount);
+    U128 VectorSignExtend(size_t original_esize, const U128& a);
+    U128 VectorZeroExtend(size_t original_esize, const U128& a);
+    U128 VectorNarrow(size_t original_esize, const U128& a);
+    U128 VectorSignedSaturatedNarrowToSigned(size_t original_esize, const U128& a);
+    U128 VectorSignedSaturatedNarrowToUnsigned(size_t original_esize, const U128& a);
+    U128 VectorUnsignedSaturatedNarrow(size_t original_esize, const U128& a);
+    U128 VectorExtract(const U128& a, const U128& b, size_t position);
+    U128 VectorExtractLower(const U128& a, const U128& b, size_t position);
+    U128 VectorTableLookup(const U128& table, const U128& indices);
+    U128 VectorReduceAdd(size_t esize, const U128& a);
+    U128 VectorReduceAddLongSigned(size_t esize, const U128& a);
+    U128 VectorReduceAddLongUnsigned(size_t esize, const U128& a);
+    U128 VectorReduceMaxSigned(size_t esize, const U128& a);
+    U128 VectorReduceMaxUnsigned(size_t esize, const U128& a);
+    U128 VectorReduceMinSigned(size_t esize, const U128& a);
+    U128 VectorReduceMinUnsigned(size_t esize, const U128& a);
 
     U32 FPAbs32(const U32& a);
     U64 FPAbs64(const U64& a);
+    U32U64 FPAbs(const U32U64& a);
     U32 FPAdd32(const U32& a, const U32& b, bool fpscr_controlled);
     U64 FPAdd64(const U64& a, const U64& b, bool fpscr_controlled);
-    void FPCompare32(const U32& a, const U32& b, bool exc_on_qnan, bool fpscr_controlled);
-    void FPCompare64(const U64& a, const U64& b, bool exc_on_qnan, bool fpscr_controlled);
+    U32U64 FPAdd(const U32U64& a, const U32U64& b, bool fpscr_controlled);
+    NZCV FPCompare32(const U32& a, const U32& b, bool exc_on_qnan, bool fpscr_controlled);
+    NZCV FPCompare64(const U64& a, const U64& b, bool exc_on_qnan, bool fpscr_controlled);
+    NZCV FPCompare(const U32U64& a, const U32U64& b, bool exc_on_qnan, bool fpscr_controlled);
     U32 FPDiv32(const U32& a, const U32& b, bool fpscr_controlled);
     U64 FPDiv64(const U64& a, const U64& b, bool fpscr_controlled);
+    U32U64 FPDiv(const U32U64& a, const U32U64& b, bool fpscr_controlled);
+    U32 FPMax32(const U32& a, const U32& b, bool fpscr_controlled);
+    U64 FPMax64(const U64& a, const U64& b, bool fpscr_controlled);
+    U32U64 FPMax(const U32U64& a, const U32U64& b, bool fpscr_controlled);
+    U32 FPMaxNumeric32(const U32& a, const U32& b, bool fpscr_controlled);
+    U64 FPMaxNumeric64(const U64& a, const U64& b, bool fpscr_controlled);
+    U32U64 FPMaxNumeric(const U32U64& a, const U32U64& b, bool fpscr_controlled);
+    U32 FPMin32(const U32& a, const U32& b, bool fpscr_controlled);
+    U64 FPMin64(const U64& a, const U64& b, bool fpscr_controlled);
+    U32U64 FPMin(const U32U64& a, const U32U64& b, bool fpscr_controlled);
+    U32 FPMinNumeric32(const U32& a, const U32& b, bool fpscr_controlled);
+    U64 FPMinNumeric64(const U64& a, const U64& b, bool fpscr_controlled);
+    U32U64 FPMinNumeric(const U32U64& a, const U32U64& b, bool fpscr_controlled);
     U32 FPMul32(const U32& a, const U32& b, bool fpscr_controlled);
     U64 FPMul64(const U64& a, const U64& b, bool fpscr_controlled);
+    U32U64 FPMul(const U32U64& a, const U32U64& b, bool fpscr_controlled);
+    U32 FPMulAdd32(const U32& addend, const U32& op1, const U32& op2, bool fpscr_controlled);
+    U64 FPMulAdd64(const U64& addend, const U64& op1, const U64& op2, bool fpscr_controlled);
+    U32U64 FPMulAdd(const U32U64& addend, const U32U64& op1, const U32U64& op2, bool fpscr_controlled);
     U32 FPNeg32(const U32& a);
     U64 FPNeg64(const U64& a);
+    U32U64 FPNeg(const U32U64& a);
     U32 FPSqrt32(const U32& a);
     U64 FPSqrt64(const U64& a);
+    U32U64 FPSqrt(const U32U64& a);
     U32 FPSub32(const U32& a, const U32& b, bool fpscr_controlled);
     U64 FPSub64(const U64& a, const U64& b, bool fpscr_controlled);
+    U32U64 FPSub(const U32U64& a, const U32U64& b, bool fpscr_controlled);
     U32 FPDoubleToSingle(const U64& a, bool fpscr_controlled);
     U64 FPSingleToDouble(const U32& a, bool fpscr_controlled);
     U32 FPSingleToS32(const U32& a, bool round_towards_zero, bool fpscr_controlled);
     U32 FPSingleToU32(const U32& a, bool round_towards_zero, bool fpscr_controlled);
     U32 FPDoubleToS32(const U32& a, bool round_towards_zero, bool fpscr_controlled);
     U32 FPDoubleToU32(const U32& a, bool round_towards_zero, bool fpscr_controlled);
+    U32 FPToFixedS32(const U32U64& a, size_t fbits, FP::RoundingMode rounding);
+    U64 FPToFixedS64(const U32U64& a, size_t fbits, FP::RoundingMode rounding);
+    U32 FPToFixedU32(const U32U64& a, size_t fbits, FP::RoundingMode rounding);
+    U64 FPToFixedU64(const U32U64& a, size_t fbits, FP::RoundingMode rounding);
     U32 FPS32ToSingle(const U32& a, bool round_to_nearest, bool fpscr_controlled);
     U32 FPU32ToSingle(const U32& a, bool round_to_nearest, bool fpscr_controlled);
     U64 FPS32ToDouble(const U32& a, bool round_to_nearest, bool fpscr_controlled);
     U64 FPU32ToDouble(const U32& a, bool round_to_nearest, bool fpscr_controlled);
+    U32 FPS64ToSingle(const U64& a, bool round_to_nearest, bool fpscr_controlled);
+    U32 FPU64ToSingle(const U64& a, bool round_to_nearest, bool fpscr_controlled);
+    U64 FPS64ToDouble(const U64& a, bool round_to_nearest, bool fpscr_controlled);
+    U64 FPU64ToDouble(const U64& a, bool round_to_nearest, bool fpscr_controlled);
+
+    U128 FPVectorAbs(size_t esize, const U128& a);
+    U128 FPVectorAdd(size_t esize, const U128& a, const U128& b, bool fpscr_controlled);
+    U128 FPVectorDiv(size_t esize, const U128& a, const U128& b, bool fpscr_controlled);
+    U128 FPVectorMul(size_t esize, const U128& a, const U128& b, bool fpscr_controlled);
+    U128 FPVectorMulAdd(size_t esize, const U128& addend, const U128& op1, const U128& op2, bool fpscr_controlled);
+    U128 FPVectorNeg(size_t esize, const U128& a);
+    U128 FPVectorSqrt(size_t esize, const U128& a, bool fpscr_controlled);
+    U128 FPVectorSub(size_t esize, const U128& a, const U128& b, bool fpscr_controlled);
+
+    U128 AESDecryptSingleRound(const U128& a);
+    U128 AESEncryptSingleRound(const U128& a);
+    U128 AESInverseMixColumns(const U128& a);
+    U128 AESMixColumns(const U128& a);
+    U128 SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w);
+    U128 SHA1MessageSchedule0(const U128& a, const U128& b, const U128& c);
+    U128 SHA1MessageSchedule1(const U128& a, const U128& b);
+    U128 SHA256Hash(const U128& x, const U128& y, const U128& w, bool part1);
+    U128 SHA256MessageSchedule0(const U128& a, const U128& b);
+    U128 SHA256MessageSchedule1(const U128& a, const U128& b, const U128& c);
 
     void Breakpoint();
 
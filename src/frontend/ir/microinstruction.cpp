@@ -52,6 +52,7 @@ bool Inst::IsSharedMemoryRead() const {
     case Opcode::A64ReadMemory16:
     case Opcode::A64ReadMemory32:
     case Opcode::A64ReadMemory64:
+    case Opcode::A64ReadMemory128:
         return true;
 
     default:
@@ -69,6 +70,7 @@ bool Inst::IsSharedMemoryWrite() const {
     case Opcode::A64WriteMemory16:
     case Opcode::A64WriteMemory32:
     case Opcode::A64WriteMemory64:
+    case Opcode::A64WriteMemory128:
         return true;
 
     default:
@@ -86,6 +88,43 @@ bool Inst::IsExclusiveMemoryWrite() const {
     case Opcode::A32ExclusiveWriteMemory16:
     case Opcode::A32ExclusiveWriteMemory32:
     case Opcode::A32ExclusiveWriteMemory64:
+    case Opcode::A64ExclusiveWriteMemory8:
+    case Opcode::A64ExclusiveWriteMemory16:
+    case Opcode::A64ExclusiveWriteMemory32:
+    case Opcode::A64ExclusiveWriteMemory64:
+    case Opcode::A64ExclusiveWriteMemory128:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool Inst::IsExclusiveMemoryRead() const {
+    switch (op) {
+    case Opcode::A64ExclusiveReadMemory8:
+    case Opcode::A64ExclusiveReadMemory16:
+    case Opcode::A64ExclusiveReadMemory32:
+    case Opcode::A64ExclusiveReadMemory64:
+    case Opcode::A64ExclusiveReadMemory128:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool Inst::IsAtomicMemoryReadWrite() const {
+    switch (op) {
+    case Opcode::A64AtomicMemory8:
+    case Opcode::A64AtomicMemory16:
+    case Opcode::A64AtomicMemory32:
+    case Opcode::A64AtomicMemory64:
+    case Opcode::A64CompareAndSwapMemory8:
+    case Opcode::A64CompareAndSwapMemory16:
+    case Opcode::A64CompareAndSwapMemory32:
+    case Opcode::A64CompareAndSwapMemory64:
+    case Opcode::A64CompareAndSwapMemory128:
         return true;
 
     default:
@@ -94,11 +133,11 @@ bool Inst::IsExclusiveMemoryWrite() const {
 }
 
 bool Inst::IsMemoryRead() const {
-    return IsSharedMemoryRead();
+    return IsSharedMemoryRead() || IsExclusiveMemoryRead() || IsAtomicMemoryReadWrite();
 }
 
 bool Inst::IsMemoryWrite() const {
-    return IsSharedMemoryWrite() || IsExclusiveMemoryWrite();
+    return IsSharedMemoryWrite() || IsExclusiveMemoryWrite() || IsAtomicMemoryReadWrite();
 }
 
 bool Inst::IsMemoryReadOrWrite() const {
@@ -115,6 +154,7 @@ bool Inst::ReadsFromCPSR() const {
     case Opcode::A32GetGEFlags:
     case Opcode::ConditionalSelect32:
     case Opcode::ConditionalSelect64:
+    case Opcode::ConditionalSelectNZCV:
         return true;
 
     default:
@@ -149,6 +189,7 @@ bool Inst::ReadsFromCoreRegister() const {
     case Opcode::A32GetExtendedRegister64:
     case Opcode::A64GetW:
     case Opcode::A64GetX:
+    case Opcode::A64GetS:
     case Opcode::A64GetD:
     case Opcode::A64GetQ:
     case Opcode::A64GetSP:
@@ -167,6 +208,7 @@ bool Inst::WritesToCoreRegister() const {
     case Opcode::A32BXWritePC:
     case Opcode::A64SetW:
     case Opcode::A64SetX:
+    case Opcode::A64SetS:
     case Opcode::A64SetD:
     case Opcode::A64SetQ:
     case Opcode::A64SetSP:
@@ -192,12 +234,26 @@ bool Inst::ReadsFromFPSCR() const {
     case Opcode::FPDiv64:
     case Opcode::FPMul32:
     case Opcode::FPMul64:
+    case Opcode::FPMulAdd32:
+    case Opcode::FPMulAdd64:
     case Opcode::FPNeg32:
     case Opcode::FPNeg64:
     case Opcode::FPSqrt32:
     case Opcode::FPSqrt64:
     case Opcode::FPSub32:
     case Opcode::FPSub64:
+    case Opcode::FPVectorAdd32:
+    case Opcode::FPVectorAdd64:
+    case Opcode::FPVectorDiv32:
+    case Opcode::FPVectorDiv64:
+    case Opcode::FPVectorMul32:
+    case Opcode::FPVectorMul64:
+    case Opcode::FPVectorMulAdd32:
+    case Opcode::FPVectorMulAdd64:
+    case Opcode::FPVectorSqrt32:
+    case Opcode::FPVectorSqrt64:
+    case Opcode::FPVectorSub32:
+    case Opcode::FPVectorSub64:
         return true;
 
     default:
@@ -219,12 +275,35 @@ bool Inst::WritesToFPSCR() const {
     case Opcode::FPDiv64:
     case Opcode::FPMul32:
     case Opcode::FPMul64:
+    case Opcode::FPMulAdd32:
+    case Opcode::FPMulAdd64:
     case Opcode::FPNeg32:
     case Opcode::FPNeg64:
     case Opcode::FPSqrt32:
     case Opcode::FPSqrt64:
     case Opcode::FPSub32:
     case Opcode::FPSub64:
+    case Opcode::FPVectorAdd32:
+    case Opcode::FPVectorAdd64:
+    case Opcode::FPVectorDiv32:
+    case Opcode::FPVectorDiv64:
+    case Opcode::FPVectorMul32:
+    case Opcode::FPVectorMul64:
+    case Opcode::FPVectorMulAdd32:
+    case Opcode::FPVectorMulAdd64:
+    case Opcode::FPVectorSqrt32:
+    case Opcode::FPVectorSqrt64:
+    case Opcode::FPVectorSub32:
+    case Opcode::FPVectorSub64:
+    case Opcode::VectorSatNarrowS16:
+    case Opcode::VectorSatNarrowS32:
+    case Opcode::VectorSatNarrowS64:
+    case Opcode::VectorSatNarrowSU16:
+    case Opcode::VectorSatNarrowSU32:
+    case Opcode::VectorSatNarrowSU64:
+    case Opcode::VectorSatNarrowU16:
+    case Opcode::VectorSatNarrowU32:
+    case Opcode::VectorSatNarrowU64:
         return true;
 
     default:
@@ -242,6 +321,8 @@ bool Inst::CausesCPUException() const {
 bool Inst::AltersExclusiveState() const {
     return op == Opcode::A32ClearExclusive ||
            op == Opcode::A32SetExclusive   ||
+           op == Opcode::A64ClearExclusive ||
+           IsExclusiveMemoryRead()         ||
            IsExclusiveMemoryWrite();
 }
 
@@ -262,14 +343,15 @@ bool Inst::IsCoprocessorInstruction() const {
 }
 
 bool Inst::MayHaveSideEffects() const {
-    return op == Opcode::PushRSB        ||
-           op == Opcode::A64SetCheckBit ||
-           CausesCPUException()         ||
-           WritesToCoreRegister()       ||
-           WritesToCPSR()               ||
-           WritesToFPSCR()              ||
-           AltersExclusiveState()       ||
-           IsMemoryWrite()              ||
+    return op == Opcode::PushRSB              ||
+           op == Opcode::A64SetCheckBit       ||
+           op == Opcode::A64DataMemoryBarrier ||
+           CausesCPUException()              ||
+           WritesToCoreRegister()            ||
+           WritesToCPSR()                    ||
+           WritesToFPSCR()                   ||
+           AltersExclusiveState()            ||
+           IsMemoryWrite()                   ||
            IsCoprocessorInstruction();
 }
 
@@ -39,8 +39,12 @@ public:
     bool IsSharedMemoryWrite() const;
     /// Determines whether or not this instruction performs a shared memory read or write.
     bool IsSharedMemoryReadOrWrite() const;
+    /// Determines whether or not this instruction performs an exclusive memory read.
+    bool IsExclusiveMemoryRead() const;
     /// Determines whether or not this instruction performs an atomic memory write.
     bool IsExclusiveMemoryWrite() const;
+    /// Determines whether or not this instruction performs an atomic read-modify-write of memory.
+    bool IsAtomicMemoryReadWrite() const;
 
     /// Determines whether or not this instruction performs any kind of memory read.
     bool IsMemoryRead() const;
@@ -0,0 +1,406 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "common/variant_util.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/serialization.h"
+
+namespace Dynarmic {
+namespace IR {
+
+namespace {
+
+// Terminals are identified by their index within the Terminal variant.
+enum class TerminalTag : u8 {
+    Invalid,
+    Interpret,
+    ReturnToDispatch,
+    LinkBlock,
+    LinkBlockFast,
+    PopRSBHint,
+    If,
+    CheckBit,
+    CheckHalt,
+};
+
+// Bounds recursion when reading untrusted data. Terminals produced by the frontends are far shallower.
+constexpr size_t MaxTerminalDepth = 16;
+
+class Writer {
+public:
+    explicit Writer(std::vector<u8>& out) : out(out) {}
+
+    template <typename T>
+    void Write(T value) {
+        static_assert(std::is_trivially_copyable<T>::value);
+        const size_t offset = out.size();
+        out.resize(offset + sizeof(T));
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+
+private:
+    std::vector<u8>& out;
+};
+
+class Reader {
+public:
+    Reader(const u8* data, const u8* end) : data(data), end(end) {}
+
+    template <typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value);
+        if (static_cast<size_t>(end - data) < sizeof(T))
+            return false;
+        std::memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        return true;
+    }
+
+    const u8* Position() const { return data; }
+
+private:
+    const u8* data;
+    const u8* end;
+};
+
+void SerializeTerminal(const Terminal& terminal, Writer& writer);
+
+void SerializeTerminalImpl(const Term::Invalid&, Writer& writer) {
+    writer.Write(TerminalTag::Invalid);
+}
+
+void SerializeTerminalImpl(const Term::Interpret& terminal, Writer& writer) {
+    writer.Write(TerminalTag::Interpret);
+    writer.Write(terminal.next.Value());
+    writer.Write(static_cast<u64>(terminal.num_instructions));
+}
+
+void SerializeTerminalImpl(const Term::ReturnToDispatch&, Writer& writer) {
+    writer.Write(TerminalTag::ReturnToDispatch);
+}
+
+void SerializeTerminalImpl(const Term::LinkBlock& terminal, Writer& writer) {
+    writer.Write(TerminalTag::LinkBlock);
+    writer.Write(terminal.next.Value());
+}
+
+void SerializeTerminalImpl(const Term::LinkBlockFast& terminal, Writer& writer) {
+    writer.Write(TerminalTag::LinkBlockFast);
+    writer.Write(terminal.next.Value());
+}
+
+void SerializeTerminalImpl(const Term::PopRSBHint&, Writer& writer) {
+    writer.Write(TerminalTag::PopRSBHint);
+}
+
+void SerializeTerminalImpl(const Term::If& terminal, Writer& writer) {
+    writer.Write(TerminalTag::If);
+    writer.Write(static_cast<u8>(terminal.if_));
+    SerializeTerminal(terminal.then_, writer);
+    SerializeTerminal(terminal.else_, writer);
+}
+
+void SerializeTerminalImpl(const Term::CheckBit& terminal, Writer& writer) {
+    writer.Write(TerminalTag::CheckBit);
+    SerializeTerminal(terminal.then_, writer);
+    SerializeTerminal(terminal.else_, writer);
+}
+
+void SerializeTerminalImpl(const Term::CheckHalt& terminal, Writer& writer) {
+    writer.Write(TerminalTag::CheckHalt);
+    SerializeTerminal(terminal.else_, writer);
+}
+
+void SerializeTerminal(const Terminal& terminal, Writer& writer) {
+    Common::VisitVariant<void>(terminal, [&writer](const auto& x) {
+        SerializeTerminalImpl(x, writer);
+    });
+}
+
+boost::optional<Terminal> DeserializeTerminal(Reader& reader, size_t depth) {
+    if (depth > MaxTerminalDepth)
+        return boost::none;
+
+    TerminalTag tag;
+    if (!reader.Read(tag))
+        return boost::none;
+
+    switch (tag) {
+    case TerminalTag::Invalid:
+        return Terminal{Term::Invalid{}};
+    case TerminalTag::Interpret: {
+        u64 next, num_instructions;
+        if (!reader.Read(next) || !reader.Read(num_instructions))
+            return boost::none;
+        Term::Interpret terminal{LocationDescriptor{next}};
+        terminal.num_instructions = static_cast<size_t>(num_instructions);
+        return Terminal{terminal};
+    }
+    case TerminalTag::ReturnToDispatch:
+        return Terminal{Term::ReturnToDispatch{}};
+    case TerminalTag::LinkBlock:
+    case TerminalTag::LinkBlockFast: {
+        u64 next;
+        if (!reader.Read(next))
+            return boost::none;
+        if (tag == TerminalTag::LinkBlock)
+            return Terminal{Term::LinkBlock{LocationDescriptor{next}}};
+        return Terminal{Term::LinkBlockFast{LocationDescriptor{next}}};
+    }
+    case TerminalTag::PopRSBHint:
+        return Terminal{Term::PopRSBHint{}};
+    case TerminalTag::If: {
+        u8 cond;
+        if (!reader.Read(cond) || cond > static_cast<u8>(Cond::NV))
+            return boost::none;
+        auto then_ = DeserializeTerminal(reader, depth + 1);
+        if (!then_)
+            return boost::none;
+        auto else_ = DeserializeTerminal(reader, depth + 1);
+        if (!else_)
+            return boost::none;
+        return Terminal{Term::If{static_cast<Cond>(cond), *then_, *else_}};
+    }
+    case TerminalTag::CheckBit: {
+        auto then_ = DeserializeTerminal(reader, depth + 1);
+        if (!then_)
+            return boost::none;
+        auto else_ = DeserializeTerminal(reader, depth + 1);
+        if (!else_)
+            return boost::none;
+        return Terminal{Term::CheckBit{*then_, *else_}};
+    }
+    case TerminalTag::CheckHalt: {
+        auto else_ = DeserializeTerminal(reader, depth + 1);
+        if (!else_)
+            return boost::none;
+        return Terminal{Term::CheckHalt{*else_}};
+    }
+    }
+
+    return boost::none;
+}
+
+/// Immediates are stored as their type followed by a 64-bit payload. References to instructions store the index of that instruction.
+void SerializeValue(const Value& value, const std::unordered_map<const Inst*, u32>& inst_indices, Writer& writer) {
+    if (!value.IsImmediate()) {
+        writer.Write(static_cast<u16>(Type::Opaque));
+        writer.Write(static_cast<u64>(inst_indices.at(value.GetInst())));
+        return;
+    }
+
+    const Type type = value.GetType();
+    u64 payload = 0;
+
+    switch (type) {
+    case Type::Void:
+        break;
+    case Type::A32Reg:
+        payload = static_cast<u64>(value.GetA32RegRef());
+        break;
+    case Type::A32ExtReg:
+        payload = static_cast<u64>(value.GetA32ExtRegRef());
+        break;
+    case Type::A64Reg:
+        payload = static_cast<u64>(value.GetA64RegRef());
+        break;
+    case Type::A64Vec:
+        payload = static_cast<u64>(value.GetA64VecRef());
+        break;
+    case Type::U1:
+        payload = value.GetU1() ? 1 : 0;
+        break;
+    case Type::U8:
+        payload = value.GetU8();
+        break;
+    case Type::U16:
+        payload = value.GetU16();
+        break;
+    case Type::U32:
+        payload = value.GetU32();
+        break;
+    case Type::U64:
+        payload = value.GetU64();
+        break;
+    case Type::CoprocInfo: {
+        const std::array<u8, 8> coproc_info = value.GetCoprocInfo();
+        std::memcpy(&payload, coproc_info.data(), sizeof(payload));
+        break;
+    }
+    case Type::Cond:
+        payload = static_cast<u64>(value.GetCond());
+        break;
+    default:
+        ASSERT_MSG(false, "Unserializable value type %s", GetNameOf(type));
+    }
+
+    writer.Write(static_cast<u16>(type));
+    writer.Write(payload);
+}
+
+boost::optional<Value> DeserializeValue(Reader& reader, const std::vector<Inst*>& insts) {
+    u16 raw_type;
+    u64 payload;
+    if (!reader.Read(raw_type) || !reader.Read(payload))
+        return boost::none;
+
+    switch (static_cast<Type>(raw_type)) {
+    case Type::Void:
+        return Value{};
+    case Type::Opaque:
+        if (payload >= insts.size())
+            return boost::none;
+        return Value{insts[payload]};
+    case Type::A32Reg:
+        if (payload > static_cast<u64>(A32::Reg::R15))
+            return boost::none;
+        return Value{static_cast<A32::Reg>(payload)};
+    case Type::A32ExtReg:
+        if (payload > static_cast<u64>(A32::ExtReg::D31))
+            return boost::none;
+        return Value{static_cast<A32::ExtReg>(payload)};
+    case Type::A64Reg:
+        if (payload > static_cast<u64>(A64::Reg::R31))
+            return boost::none;
+        return Value{static_cast<A64::Reg>(payload)};
+    case Type::A64Vec:
+        if (payload > static_cast<u64>(A64::Vec::V31))
+            return boost::none;
+        return Value{static_cast<A64::Vec>(payload)};
+    case Type::U1:
+        return Value{payload != 0};
+    case Type::U8:
+        return Value{static_cast<u8>(payload)};
+    case Type::U16:
+        return Value{static_cast<u16>(payload)};
+    case Type::U32:
+        return Value{static_cast<u32>(payload)};
+    case Type::U64:
+        return Value{payload};
+    case Type::CoprocInfo: {
+        std::array<u8, 8> coproc_info;
+        std::memcpy(coproc_info.data(), &payload, sizeof(payload));
+        return Value{coproc_info};
+    }
+    case Type::Cond:
+        if (payload > static_cast<u64>(Cond::NV))
+            return boost::none;
+        return Value{static_cast<Cond>(payload)};
+    default:
+        return boost::none;
+    }
+}
+
+} // anonymous namespace
+
+void SerializeBlock(const Block& block, std::vector<u8>& out) {
+    Writer writer{out};
+
+    writer.Write(block.Location().Value());
+    writer.Write(block.EndLocation().Value());
+    writer.Write(static_cast<u8>(block.GetCondition()));
+    writer.Write(static_cast<u8>(block.HasConditionFailedLocation()));
+    writer.Write(block.HasConditionFailedLocation() ? block.ConditionFailedLocation().Value() : u64(0));
+    writer.Write(static_cast<u64>(block.ConditionFailedCycleCount()));
+    writer.Write(static_cast<u64>(block.CycleCount()));
+
+    std::unordered_map<const Inst*, u32> inst_indices;
+    for (const auto& inst : block) {
+        if (inst.GetOpcode() == Opcode::Void)
+            continue;
+        inst_indices.emplace(&inst, static_cast<u32>(inst_indices.size()));
+    }
+
+    writer.Write(static_cast<u32>(inst_indices.size()));
+    for (const auto& inst : block) {
+        if (inst.GetOpcode() == Opcode::Void)
+            continue;
+        writer.Write(static_cast<u16>(inst.GetOpcode()));
+        for (size_t i = 0; i < inst.NumArgs(); i++) {
+            SerializeValue(inst.GetArg(i), inst_indices, writer);
+        }
+    }
+
+    SerializeTerminal(block.GetTerminal(), writer);
+}
+
+boost::optional<Block> DeserializeBlock(const u8*& data, const u8* end) {
+    Reader reader{data, end};
+
+    u64 location, end_location, cond_failed_location, cond_failed_cycle_count, cycle_count;
+    u8 cond, has_cond_failed_location;
+    if (!reader.Read(location) || !reader.Read(end_location) || !reader.Read(cond) || !reader.Read(has_cond_failed_location)
+        || !reader.Read(cond_failed_location) || !reader.Read(cond_failed_cycle_count) || !reader.Read(cycle_count)) {
+        return boost::none;
+    }
+    if (cond > static_cast<u8>(Cond::NV))
+        return boost::none;
+
+    Block block{LocationDescriptor{location}};
+    block.SetEndLocation(LocationDescriptor{end_location});
+    block.SetCondition(static_cast<Cond>(cond));
+    if (has_cond_failed_location)
+        block.SetConditionFailedLocation(LocationDescriptor{cond_failed_location});
+    block.ConditionFailedCycleCount() = static_cast<size_t>(cond_failed_cycle_count);
+    block.CycleCount() = static_cast<size_t>(cycle_count);
+
+    u32 num_insts;
+    if (!reader.Read(num_insts))
+        return boost::none;
+
+    std::vector<Inst*> insts;
+    for (u32 inst_index = 0; inst_index < num_insts; inst_index++) {
+        u16 raw_opcode;
+        if (!reader.Read(raw_opcode) || raw_opcode >= OpcodeCount)
+            return boost::none;
+        const Opcode opcode = static_cast<Opcode>(raw_opcode);
+
+        // Instructions may only refer to those which precede them.
+        std::array<Value, 3> args;
+        const size_t num_args = GetNumArgsOf(opcode);
+        ASSERT(num_args <= args.size());
+        for (size_t i = 0; i < num_args; i++) {
+            auto arg = DeserializeValue(reader, insts);
+            if (!arg || !AreTypesCompatible(arg->GetType(), GetArgTypeOf(opcode, i)))
+                return boost::none;
+            args[i] = *arg;
+        }
+
+        switch (num_args) {
+        case 0:
+            block.AppendNewInst(opcode, {});
+            break;
+        case 1:
+            block.AppendNewInst(opcode, {args[0]});
+            break;
+        case 2:
+            block.AppendNewInst(opcode, {args[0], args[1]});
+            break;
+        case 3:
+            block.AppendNewInst(opcode, {args[0], args[1], args[2]});
+            break;
+        }
+        insts.push_back(&block.back());
+    }
+
+    auto terminal = DeserializeTerminal(reader, 0);
+    if (!terminal)
+        return boost::none;
+    if (terminal->which() != 0)
+        block.SetTerminal(*terminal);
+
+    data = reader.Position();
+    return boost::optional<Block>{std::move(block)};
+}
+
+} // namespace IR
+} // namespace Dynarmic
@@ -0,0 +1,33 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+
+namespace Dynarmic {
+namespace IR {
+
+/**
+ * Appends a serialized representation of block to out.
+ * Invalidated instructions are omitted. The representation is only meaningful to the same version of this library.
+ */
+void SerializeBlock(const Block& block, std::vector<u8>& out);
+
+/**
+ * Reconstructs a block which was serialized by SerializeBlock from the bytes in [data, end).
+ * On success, data is advanced past the serialized block.
+ * @returns boost::none if the data is malformed.
+ */
+boost::optional<Block> DeserializeBlock(const u8*& data, const u8* end);
+
+} // namespace IR
+} // namespace Dynarmic
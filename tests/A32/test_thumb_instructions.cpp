@@ -14,6 +14,7 @@
 
 static u64 jit_num_ticks = 0;
 static std::array<u16, 1024> code_mem{};
+static size_t num_code_reads_at_0 = 0;
 
 static u64 GetTicksRemaining();
 static void AddTicks(u64 ticks);
@@ -37,6 +38,9 @@ static u32 MemoryRead32(u32 vaddr) {
     return vaddr;
 }
 static u32 MemoryReadCode(u32 vaddr) {
+    if (vaddr == 0) {
+        num_code_reads_at_0++;
+    }
     if (vaddr < code_mem.size() * sizeof(u16)) {
         size_t index = vaddr / sizeof(u16);
         return code_mem[index] | (code_mem[index+1] << 16);
@@ -197,3 +201,53 @@ TEST_CASE( "thumb: bl -#42", "[thumb]" ) {
     REQUIRE( jit.Regs()[15] == 0xFFFFFFD6 );
     REQUIRE( jit.Cpsr() == 0x00000030 ); // Thumb, User-mode
 }
+
+TEST_CASE( "thumb: tiered compilation", "[thumb]" ) {
+    Dynarmic::A32::UserCallbacks callbacks = GetUserCallbacks();
+    callbacks.tiered_compilation_threshold = 5;
+
+    Dynarmic::A32::Jit jit{callbacks};
+    code_mem.fill({});
+    code_mem[0] = 0x3001; // adds r0, #1
+    code_mem[1] = 0x3901; // subs r1, #1
+    code_mem[2] = 0xD1FC; // bne -#8
+    code_mem[3] = 0xE7FE; // b +#0
+
+    const auto run = [&jit](u32 iterations) {
+        jit.Regs()[0] = 0;
+        jit.Regs()[1] = iterations;
+        jit.Regs()[15] = 0; // PC = 0
+        jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+        jit_num_ticks = iterations * 3;
+        jit.Run();
+
+        REQUIRE( jit.Regs()[0] == iterations );
+        REQUIRE( jit.Regs()[1] == 0 );
+        REQUIRE( jit.Regs()[15] == 6 );
+        REQUIRE( jit.Cpsr() == 0x60000030 ); // Z, C flags, Thumb, User-mode
+    };
+
+    // Each translation of the loop reads the word at address 0 twice, once for each of its first two instructions.
+    const auto num_translations = []{ return num_code_reads_at_0 / 2; };
+    num_code_reads_at_0 = 0;
+
+    // The loop is entered fewer times than the threshold, so it remains in the first tier.
+    run(3);
+    REQUIRE( num_translations() == 1 );
+
+    // Crossing the threshold recompiles the loop exactly once.
+    run(100);
+    REQUIRE( num_translations() == 2 );
+
+    // The optimized block is used from then on.
+    run(100);
+    REQUIRE( num_translations() == 2 );
+
+    // Invalidation forgets that the loop was hot, so it starts again in the first tier.
+    jit.InvalidateCacheRange(0, 8);
+    run(3);
+    REQUIRE( num_translations() == 3 );
+    run(100);
+    REQUIRE( num_translations() == 4 );
+}
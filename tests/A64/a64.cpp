@@ -4,8 +4,23 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include <catch.hpp>
 
+#include "backend_x64/block_of_code.h"
 #include "testenv.h"
 
 TEST_CASE("A64: ADD", "[a64]") {
@@ -257,3 +272,2861 @@ TEST_CASE("A64: TBZ", "[a64]") {
         REQUIRE(jit.GetPC() == 16);
     }
 }
+
+TEST_CASE("A64: UDIV/SDIV", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x9ac10802; // UDIV X2, X0, X1
+    env.code_mem[1] = 0x1ac10803; // UDIV W3, W0, W1
+    env.code_mem[2] = 0x9ac10c04; // SDIV X4, X0, X1
+    env.code_mem[3] = 0x1ac10c05; // SDIV W5, W0, W1
+    env.code_mem[4] = 0x14000000; // B .
+
+    const auto test = [&](u64 n, u64 m, u64 udiv64, u64 udiv32, u64 sdiv64, u64 sdiv32) {
+        jit.SetRegister(0, n);
+        jit.SetRegister(1, m);
+        jit.SetPC(0);
+
+        env.ticks_left = 5;
+        jit.Run();
+
+        REQUIRE(jit.GetRegister(2) == udiv64);
+        REQUIRE(jit.GetRegister(3) == udiv32);
+        REQUIRE(jit.GetRegister(4) == sdiv64);
+        REQUIRE(jit.GetRegister(5) == sdiv32);
+        REQUIRE(jit.GetPC() == 16);
+    };
+
+    test(0xFFFFFFFFFFFFFFF9, 2, 0x7FFFFFFFFFFFFFFC, 0x7FFFFFFC, 0xFFFFFFFFFFFFFFFD, 0xFFFFFFFD);
+    test(0x00000000000000FF, 0x0000000100000007, 0, 0x24, 0, 0x24);
+
+    SECTION("Division by zero") {
+        test(0x0000011F71FB04CB, 0, 0, 0, 0, 0);
+    }
+
+    SECTION("Signed overflow") {
+        test(0x8000000000000000, 0xFFFFFFFFFFFFFFFF, 0, 0, 0x8000000000000000, 0);
+        test(0xFFFFFFFF80000000, 0xFFFFFFFFFFFFFFFF, 0, 0, 0x80000000, 0x80000000);
+    }
+}
+
+TEST_CASE("A64: CRC32/CRC32C", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x1ac14002; // CRC32B W2, W0, W1
+    env.code_mem[1] = 0x1ac14403; // CRC32H W3, W0, W1
+    env.code_mem[2] = 0x1ac14804; // CRC32W W4, W0, W1
+    env.code_mem[3] = 0x9ac14c05; // CRC32X W5, W0, X1
+    env.code_mem[4] = 0x1ac15006; // CRC32CB W6, W0, W1
+    env.code_mem[5] = 0x1ac15407; // CRC32CH W7, W0, W1
+    env.code_mem[6] = 0x1ac15808; // CRC32CW W8, W0, W1
+    env.code_mem[7] = 0x9ac15c09; // CRC32CX W9, W0, X1
+    env.code_mem[8] = 0x14000000; // B .
+
+    jit.SetRegister(0, 0xFFFFFFFF12345678);
+    jit.SetRegister(1, 0x0123456789ABCDEF);
+    jit.SetPC(0);
+
+    env.ticks_left = 9;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(2) == 0x6E7932B1);
+    REQUIRE(jit.GetRegister(3) == 0x59DD4425);
+    REQUIRE(jit.GetRegister(4) == 0x40D55215);
+    REQUIRE(jit.GetRegister(5) == 0x9B62EADF);
+    REQUIRE(jit.GetRegister(6) == 0x4670ACAA);
+    REQUIRE(jit.GetRegister(7) == 0xB54A8725);
+    REQUIRE(jit.GetRegister(8) == 0xA360621E);
+    REQUIRE(jit.GetRegister(9) == 0xA3D207BE);
+    REQUIRE(jit.GetPC() == 32);
+}
+
+TEST_CASE("A64: Scalar floating point data processing", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x1e222820; // FADD S0, S1, S2
+    env.code_mem[1] = 0x1e650883; // FMUL D3, D4, D5
+    env.code_mem[2] = 0x1e228826; // FNMUL S6, S1, S2
+    env.code_mem[3] = 0x1e61c087; // FSQRT D7, D4
+    env.code_mem[4] = 0x1e22c028; // FCVT D8, S1
+    env.code_mem[5] = 0x1e309009; // FMOV S9, #-2.5
+    env.code_mem[6] = 0x1e61408b; // FNEG D11, D4
+    env.code_mem[7] = 0x1e20c0cc; // FABS S12, S6
+    env.code_mem[8] = 0x1e65188d; // FDIV D13, D4, D5
+    env.code_mem[9] = 0x1e22382e; // FSUB S14, S1, S2
+    env.code_mem[10] = 0x14000000; // B .
+
+    for (size_t i = 0; i < 16; i++) {
+        jit.SetVector(i, {0xDEADBEEFDEADBEEF, 0xDEADBEEFDEADBEEF});
+    }
+    jit.SetVector(1, {0xDEADBEEF3FC00000, 0xDEADBEEFDEADBEEF}); // 1.5f
+    jit.SetVector(2, {0xDEADBEEF3E800000, 0xDEADBEEFDEADBEEF}); // 0.25f
+    jit.SetVector(4, {0x4022000000000000, 0xDEADBEEFDEADBEEF}); // 9.0
+    jit.SetVector(5, {0x4000000000000000, 0xDEADBEEFDEADBEEF}); // 2.0
+    jit.SetPC(0);
+
+    env.ticks_left = 11;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0x3FE00000, 0});
+    REQUIRE(jit.GetVector(3) == Dynarmic::A64::Jit::Vector{0x4032000000000000, 0});
+    REQUIRE(jit.GetVector(6) == Dynarmic::A64::Jit::Vector{0xBEC00000, 0});
+    REQUIRE(jit.GetVector(7) == Dynarmic::A64::Jit::Vector{0x4008000000000000, 0});
+    REQUIRE(jit.GetVector(8) == Dynarmic::A64::Jit::Vector{0x3FF8000000000000, 0});
+    REQUIRE(jit.GetVector(9) == Dynarmic::A64::Jit::Vector{0xC0200000, 0});
+    REQUIRE(jit.GetVector(11) == Dynarmic::A64::Jit::Vector{0xC022000000000000, 0});
+    REQUIRE(jit.GetVector(12) == Dynarmic::A64::Jit::Vector{0x3EC00000, 0});
+    REQUIRE(jit.GetVector(13) == Dynarmic::A64::Jit::Vector{0x4012000000000000, 0});
+    REQUIRE(jit.GetVector(14) == Dynarmic::A64::Jit::Vector{0x3FA00000, 0});
+    REQUIRE(jit.GetVector(15) == Dynarmic::A64::Jit::Vector{0xDEADBEEFDEADBEEF, 0xDEADBEEFDEADBEEF});
+    REQUIRE(jit.GetPC() == 40);
+}
+
+TEST_CASE("A64: FCMP", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x1e612000; // FCMP D0, D1
+    env.code_mem[1] = 0x14000000; // B .
+
+    const auto test_compare = [&](u64 a, u64 b, u32 expected_nzcv) {
+        jit.SetVector(0, {a, 0});
+        jit.SetVector(1, {b, 0});
+        jit.SetPstate(0);
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE(jit.GetPC() == 4);
+        REQUIRE((jit.GetPstate() & 0xF0000000) == expected_nzcv);
+    };
+
+    SECTION("Greater than") {
+        test_compare(0x4022000000000000, 0x4000000000000000, 0x20000000);
+    }
+
+    SECTION("Less than") {
+        test_compare(0xC022000000000000, 0x4000000000000000, 0x80000000);
+    }
+
+    SECTION("Equal") {
+        test_compare(0x0000000000000000, 0x8000000000000000, 0x60000000);
+    }
+
+    SECTION("Unordered") {
+        test_compare(0x7FF8000000000000, 0x4000000000000000, 0x30000000);
+    }
+}
+
+TEST_CASE("A64: FCCMP", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x1e210405; // FCCMP S0, S1, #0b0101, EQ
+    env.code_mem[1] = 0x14000000; // B .
+
+    jit.SetVector(0, {0x3E800000, 0}); // 0.25f
+    jit.SetVector(1, {0x3FC00000, 0}); // 1.5f
+    jit.SetPC(0);
+
+    SECTION("Condition passed") {
+        jit.SetPstate(0x40000000);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE((jit.GetPstate() & 0xF0000000) == 0x80000000);
+    }
+
+    SECTION("Condition failed") {
+        jit.SetPstate(0x00000000);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE((jit.GetPstate() & 0xF0000000) == 0x50000000);
+    }
+}
+
+TEST_CASE("A64: FPCR rounding mode", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x1e221820; // FDIV S0, S1, S2
+    env.code_mem[1] = 0x14000000; // B .
+
+    jit.SetVector(1, {0x3F800000, 0}); // 1.0f
+    jit.SetVector(2, {0x40400000, 0}); // 3.0f
+    jit.SetPC(0);
+
+    SECTION("Round to nearest") {
+        jit.SetFpcr(0x00000000);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0x3EAAAAAB, 0});
+    }
+
+    SECTION("Round towards zero") {
+        jit.SetFpcr(0x00C00000);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0x3EAAAAAA, 0});
+    }
+}
+
+TEST_CASE("A64: Saturating narrows set FPSR.QC", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector input;
+        u64 expected;
+        bool saturated;
+    };
+
+    const std::vector<TestCase> test_cases{
+        {0x0e214820, {0xFFFF000700060005, 0x0004000300020001}, 0x04030201FF070605, false}, // SQXTN V0.8B, V1.8H
+        {0x0e214820, {0x00010080FF7F0001, 0}, 0x00000000017F8001, true},   // SQXTN V0.8B, V1.8H
+        {0x0e614820, {0x00008000FFFF8000, 0}, 0x000000007FFF8000, true},   // SQXTN V0.4H, V1.4S
+        {0x2e614820, {0x000100000000FFFF, 0}, 0x00000000FFFFFFFF, true},   // UQXTN V0.4H, V1.4S
+        {0x2ea12820, {0x0000000000000005, 0x00000000FFFFFFFF}, 0xFFFFFFFF00000005, false}, // SQXTUN V0.2S, V1.2D
+        {0x2ea12820, {0xFFFFFFFFFFFFFFFF, 0x0000000012345678}, 0x1234567800000000, true},  // SQXTUN V0.2S, V1.2D
+    };
+
+    // Baseline host features force the non-SSE4.1 fallbacks.
+    for (bool baseline_host_features_only : {false, true}) {
+        for (const auto& test_case : test_cases) {
+            const Dynarmic::BackendX64::ScopedBaselineHostFeatures baseline{baseline_host_features_only};
+            TestEnv env;
+            Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+            env.code_mem[0] = test_case.instruction;
+            env.code_mem[1] = 0x14000000; // B .
+
+            jit.SetVector(1, test_case.input);
+            jit.SetFpsr(0);
+            jit.SetPC(0);
+
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("instruction: " << std::hex << test_case.instruction << ", baseline: " << baseline_host_features_only);
+            REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{test_case.expected, 0});
+            REQUIRE(((jit.GetFpsr() >> 27) & 1) == (test_case.saturated ? 1u : 0u));
+            REQUIRE(jit.GetPC() == 4);
+        }
+    }
+}
+
+TEST_CASE("A64: Floating point to integer conversion", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        u64 input;
+        u64 expected;
+    };
+
+    // The operand is the lower part of V1; single-precision operands have garbage in their upper 32 bits.
+    const std::vector<TestCase> test_cases {
+        {0x9e600020, 0x4004000000000000, 0x0000000000000002}, // FCVTNS X0, D1 (2.5)
+        {0x9e600020, 0xC004000000000000, 0xFFFFFFFFFFFFFFFE}, // FCVTNS X0, D1 (-2.5)
+        {0x9e600020, 0x400C000000000000, 0x0000000000000004}, // FCVTNS X0, D1 (3.5)
+        {0x9e600020, 0xBFE8000000000000, 0xFFFFFFFFFFFFFFFF}, // FCVTNS X0, D1 (-0.75)
+        {0x9e600020, 0x43E0000000000001, 0x7FFFFFFFFFFFFFFF}, // FCVTNS X0, D1 (9.223372036854778e+18)
+        {0x9e600020, 0x4415AF1D78B58C40, 0x7FFFFFFFFFFFFFFF}, // FCVTNS X0, D1 (1e+20)
+        {0x9e600020, 0xC415AF1D78B58C40, 0x8000000000000000}, // FCVTNS X0, D1 (-1e+20)
+        {0x9e600020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTNS X0, D1 (NaN)
+        {0x1e200020, 0xDEADBEEF40200000, 0x0000000000000002}, // FCVTNS W0, S1 (2.5)
+        {0x1e200020, 0xDEADBEEFC0200000, 0x00000000FFFFFFFE}, // FCVTNS W0, S1 (-2.5)
+        {0x1e200020, 0xDEADBEEFBF400000, 0x00000000FFFFFFFF}, // FCVTNS W0, S1 (-0.75)
+        {0x1e200020, 0xDEADBEEF501502F9, 0x000000007FFFFFFF}, // FCVTNS W0, S1 (10000000000.0)
+        {0x1e200020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTNS W0, S1 (NaN)
+        {0x1e600020, 0x41EFFFFFFFF80000, 0x000000007FFFFFFF}, // FCVTNS W0, D1 (4294967295.75)
+        {0x1e600020, 0xC415AF1D78B58C40, 0x0000000080000000}, // FCVTNS W0, D1 (-1e+20)
+        {0x9e200020, 0xDEADBEEF5F502AB5, 0x7FFFFFFFFFFFFFFF}, // FCVTNS X0, S1 (1.5000000520515486e+19)
+        {0x9e200020, 0xDEADBEEFC0600000, 0xFFFFFFFFFFFFFFFC}, // FCVTNS X0, S1 (-3.5)
+        {0x9e610020, 0x4004000000000000, 0x0000000000000002}, // FCVTNU X0, D1 (2.5)
+        {0x9e610020, 0xC004000000000000, 0x0000000000000000}, // FCVTNU X0, D1 (-2.5)
+        {0x9e610020, 0x400C000000000000, 0x0000000000000004}, // FCVTNU X0, D1 (3.5)
+        {0x9e610020, 0xBFE8000000000000, 0x0000000000000000}, // FCVTNU X0, D1 (-0.75)
+        {0x9e610020, 0x43E0000000000001, 0x8000000000000800}, // FCVTNU X0, D1 (9.223372036854778e+18)
+        {0x9e610020, 0x4415AF1D78B58C40, 0xFFFFFFFFFFFFFFFF}, // FCVTNU X0, D1 (1e+20)
+        {0x9e610020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTNU X0, D1 (-1e+20)
+        {0x9e610020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTNU X0, D1 (NaN)
+        {0x1e210020, 0xDEADBEEF40200000, 0x0000000000000002}, // FCVTNU W0, S1 (2.5)
+        {0x1e210020, 0xDEADBEEFC0200000, 0x0000000000000000}, // FCVTNU W0, S1 (-2.5)
+        {0x1e210020, 0xDEADBEEFBF400000, 0x0000000000000000}, // FCVTNU W0, S1 (-0.75)
+        {0x1e210020, 0xDEADBEEF501502F9, 0x00000000FFFFFFFF}, // FCVTNU W0, S1 (10000000000.0)
+        {0x1e210020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTNU W0, S1 (NaN)
+        {0x1e610020, 0x41EFFFFFFFF80000, 0x00000000FFFFFFFF}, // FCVTNU W0, D1 (4294967295.75)
+        {0x1e610020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTNU W0, D1 (-1e+20)
+        {0x9e210020, 0xDEADBEEF5F502AB5, 0xD02AB50000000000}, // FCVTNU X0, S1 (1.5000000520515486e+19)
+        {0x9e210020, 0xDEADBEEFC0600000, 0x0000000000000000}, // FCVTNU X0, S1 (-3.5)
+        {0x9e640020, 0x4004000000000000, 0x0000000000000003}, // FCVTAS X0, D1 (2.5)
+        {0x9e640020, 0xC004000000000000, 0xFFFFFFFFFFFFFFFD}, // FCVTAS X0, D1 (-2.5)
+        {0x9e640020, 0x400C000000000000, 0x0000000000000004}, // FCVTAS X0, D1 (3.5)
+        {0x9e640020, 0xBFE8000000000000, 0xFFFFFFFFFFFFFFFF}, // FCVTAS X0, D1 (-0.75)
+        {0x9e640020, 0x43E0000000000001, 0x7FFFFFFFFFFFFFFF}, // FCVTAS X0, D1 (9.223372036854778e+18)
+        {0x9e640020, 0x4415AF1D78B58C40, 0x7FFFFFFFFFFFFFFF}, // FCVTAS X0, D1 (1e+20)
+        {0x9e640020, 0xC415AF1D78B58C40, 0x8000000000000000}, // FCVTAS X0, D1 (-1e+20)
+        {0x9e640020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTAS X0, D1 (NaN)
+        {0x1e240020, 0xDEADBEEF40200000, 0x0000000000000003}, // FCVTAS W0, S1 (2.5)
+        {0x1e240020, 0xDEADBEEFC0200000, 0x00000000FFFFFFFD}, // FCVTAS W0, S1 (-2.5)
+        {0x1e240020, 0xDEADBEEFBF400000, 0x00000000FFFFFFFF}, // FCVTAS W0, S1 (-0.75)
+        {0x1e240020, 0xDEADBEEF501502F9, 0x000000007FFFFFFF}, // FCVTAS W0, S1 (10000000000.0)
+        {0x1e240020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTAS W0, S1 (NaN)
+        {0x1e640020, 0x41EFFFFFFFF80000, 0x000000007FFFFFFF}, // FCVTAS W0, D1 (4294967295.75)
+        {0x1e640020, 0xC415AF1D78B58C40, 0x0000000080000000}, // FCVTAS W0, D1 (-1e+20)
+        {0x9e240020, 0xDEADBEEF5F502AB5, 0x7FFFFFFFFFFFFFFF}, // FCVTAS X0, S1 (1.5000000520515486e+19)
+        {0x9e240020, 0xDEADBEEFC0600000, 0xFFFFFFFFFFFFFFFC}, // FCVTAS X0, S1 (-3.5)
+        {0x9e650020, 0x4004000000000000, 0x0000000000000003}, // FCVTAU X0, D1 (2.5)
+        {0x9e650020, 0xC004000000000000, 0x0000000000000000}, // FCVTAU X0, D1 (-2.5)
+        {0x9e650020, 0x400C000000000000, 0x0000000000000004}, // FCVTAU X0, D1 (3.5)
+        {0x9e650020, 0xBFE8000000000000, 0x0000000000000000}, // FCVTAU X0, D1 (-0.75)
+        {0x9e650020, 0x43E0000000000001, 0x8000000000000800}, // FCVTAU X0, D1 (9.223372036854778e+18)
+        {0x9e650020, 0x4415AF1D78B58C40, 0xFFFFFFFFFFFFFFFF}, // FCVTAU X0, D1 (1e+20)
+        {0x9e650020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTAU X0, D1 (-1e+20)
+        {0x9e650020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTAU X0, D1 (NaN)
+        {0x1e250020, 0xDEADBEEF40200000, 0x0000000000000003}, // FCVTAU W0, S1 (2.5)
+        {0x1e250020, 0xDEADBEEFC0200000, 0x0000000000000000}, // FCVTAU W0, S1 (-2.5)
+        {0x1e250020, 0xDEADBEEFBF400000, 0x0000000000000000}, // FCVTAU W0, S1 (-0.75)
+        {0x1e250020, 0xDEADBEEF501502F9, 0x00000000FFFFFFFF}, // FCVTAU W0, S1 (10000000000.0)
+        {0x1e250020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTAU W0, S1 (NaN)
+        {0x1e650020, 0x41EFFFFFFFF80000, 0x00000000FFFFFFFF}, // FCVTAU W0, D1 (4294967295.75)
+        {0x1e650020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTAU W0, D1 (-1e+20)
+        {0x9e250020, 0xDEADBEEF5F502AB5, 0xD02AB50000000000}, // FCVTAU X0, S1 (1.5000000520515486e+19)
+        {0x9e250020, 0xDEADBEEFC0600000, 0x0000000000000000}, // FCVTAU X0, S1 (-3.5)
+        {0x9e680020, 0x4004000000000000, 0x0000000000000003}, // FCVTPS X0, D1 (2.5)
+        {0x9e680020, 0xC004000000000000, 0xFFFFFFFFFFFFFFFE}, // FCVTPS X0, D1 (-2.5)
+        {0x9e680020, 0x400C000000000000, 0x0000000000000004}, // FCVTPS X0, D1 (3.5)
+        {0x9e680020, 0xBFE8000000000000, 0x0000000000000000}, // FCVTPS X0, D1 (-0.75)
+        {0x9e680020, 0x43E0000000000001, 0x7FFFFFFFFFFFFFFF}, // FCVTPS X0, D1 (9.223372036854778e+18)
+        {0x9e680020, 0x4415AF1D78B58C40, 0x7FFFFFFFFFFFFFFF}, // FCVTPS X0, D1 (1e+20)
+        {0x9e680020, 0xC415AF1D78B58C40, 0x8000000000000000}, // FCVTPS X0, D1 (-1e+20)
+        {0x9e680020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTPS X0, D1 (NaN)
+        {0x1e280020, 0xDEADBEEF40200000, 0x0000000000000003}, // FCVTPS W0, S1 (2.5)
+        {0x1e280020, 0xDEADBEEFC0200000, 0x00000000FFFFFFFE}, // FCVTPS W0, S1 (-2.5)
+        {0x1e280020, 0xDEADBEEFBF400000, 0x0000000000000000}, // FCVTPS W0, S1 (-0.75)
+        {0x1e280020, 0xDEADBEEF501502F9, 0x000000007FFFFFFF}, // FCVTPS W0, S1 (10000000000.0)
+        {0x1e280020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTPS W0, S1 (NaN)
+        {0x1e680020, 0x41EFFFFFFFF80000, 0x000000007FFFFFFF}, // FCVTPS W0, D1 (4294967295.75)
+        {0x1e680020, 0xC415AF1D78B58C40, 0x0000000080000000}, // FCVTPS W0, D1 (-1e+20)
+        {0x9e280020, 0xDEADBEEF5F502AB5, 0x7FFFFFFFFFFFFFFF}, // FCVTPS X0, S1 (1.5000000520515486e+19)
+        {0x9e280020, 0xDEADBEEFC0600000, 0xFFFFFFFFFFFFFFFD}, // FCVTPS X0, S1 (-3.5)
+        {0x9e690020, 0x4004000000000000, 0x0000000000000003}, // FCVTPU X0, D1 (2.5)
+        {0x9e690020, 0xC004000000000000, 0x0000000000000000}, // FCVTPU X0, D1 (-2.5)
+        {0x9e690020, 0x400C000000000000, 0x0000000000000004}, // FCVTPU X0, D1 (3.5)
+        {0x9e690020, 0xBFE8000000000000, 0x0000000000000000}, // FCVTPU X0, D1 (-0.75)
+        {0x9e690020, 0x43E0000000000001, 0x8000000000000800}, // FCVTPU X0, D1 (9.223372036854778e+18)
+        {0x9e690020, 0x4415AF1D78B58C40, 0xFFFFFFFFFFFFFFFF}, // FCVTPU X0, D1 (1e+20)
+        {0x9e690020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTPU X0, D1 (-1e+20)
+        {0x9e690020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTPU X0, D1 (NaN)
+        {0x1e290020, 0xDEADBEEF40200000, 0x0000000000000003}, // FCVTPU W0, S1 (2.5)
+        {0x1e290020, 0xDEADBEEFC0200000, 0x0000000000000000}, // FCVTPU W0, S1 (-2.5)
+        {0x1e290020, 0xDEADBEEFBF400000, 0x0000000000000000}, // FCVTPU W0, S1 (-0.75)
+        {0x1e290020, 0xDEADBEEF501502F9, 0x00000000FFFFFFFF}, // FCVTPU W0, S1 (10000000000.0)
+        {0x1e290020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTPU W0, S1 (NaN)
+        {0x1e690020, 0x41EFFFFFFFF80000, 0x00000000FFFFFFFF}, // FCVTPU W0, D1 (4294967295.75)
+        {0x1e690020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTPU W0, D1 (-1e+20)
+        {0x9e290020, 0xDEADBEEF5F502AB5, 0xD02AB50000000000}, // FCVTPU X0, S1 (1.5000000520515486e+19)
+        {0x9e290020, 0xDEADBEEFC0600000, 0x0000000000000000}, // FCVTPU X0, S1 (-3.5)
+        {0x9e700020, 0x4004000000000000, 0x0000000000000002}, // FCVTMS X0, D1 (2.5)
+        {0x9e700020, 0xC004000000000000, 0xFFFFFFFFFFFFFFFD}, // FCVTMS X0, D1 (-2.5)
+        {0x9e700020, 0x400C000000000000, 0x0000000000000003}, // FCVTMS X0, D1 (3.5)
+        {0x9e700020, 0xBFE8000000000000, 0xFFFFFFFFFFFFFFFF}, // FCVTMS X0, D1 (-0.75)
+        {0x9e700020, 0x43E0000000000001, 0x7FFFFFFFFFFFFFFF}, // FCVTMS X0, D1 (9.223372036854778e+18)
+        {0x9e700020, 0x4415AF1D78B58C40, 0x7FFFFFFFFFFFFFFF}, // FCVTMS X0, D1 (1e+20)
+        {0x9e700020, 0xC415AF1D78B58C40, 0x8000000000000000}, // FCVTMS X0, D1 (-1e+20)
+        {0x9e700020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTMS X0, D1 (NaN)
+        {0x1e300020, 0xDEADBEEF40200000, 0x0000000000000002}, // FCVTMS W0, S1 (2.5)
+        {0x1e300020, 0xDEADBEEFC0200000, 0x00000000FFFFFFFD}, // FCVTMS W0, S1 (-2.5)
+        {0x1e300020, 0xDEADBEEFBF400000, 0x00000000FFFFFFFF}, // FCVTMS W0, S1 (-0.75)
+        {0x1e300020, 0xDEADBEEF501502F9, 0x000000007FFFFFFF}, // FCVTMS W0, S1 (10000000000.0)
+        {0x1e300020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTMS W0, S1 (NaN)
+        {0x1e700020, 0x41EFFFFFFFF80000, 0x000000007FFFFFFF}, // FCVTMS W0, D1 (4294967295.75)
+        {0x1e700020, 0xC415AF1D78B58C40, 0x0000000080000000}, // FCVTMS W0, D1 (-1e+20)
+        {0x9e300020, 0xDEADBEEF5F502AB5, 0x7FFFFFFFFFFFFFFF}, // FCVTMS X0, S1 (1.5000000520515486e+19)
+        {0x9e300020, 0xDEADBEEFC0600000, 0xFFFFFFFFFFFFFFFC}, // FCVTMS X0, S1 (-3.5)
+        {0x9e710020, 0x4004000000000000, 0x0000000000000002}, // FCVTMU X0, D1 (2.5)
+        {0x9e710020, 0xC004000000000000, 0x0000000000000000}, // FCVTMU X0, D1 (-2.5)
+        {0x9e710020, 0x400C000000000000, 0x0000000000000003}, // FCVTMU X0, D1 (3.5)
+        {0x9e710020, 0xBFE8000000000000, 0x0000000000000000}, // FCVTMU X0, D1 (-0.75)
+        {0x9e710020, 0x43E0000000000001, 0x8000000000000800}, // FCVTMU X0, D1 (9.223372036854778e+18)
+        {0x9e710020, 0x4415AF1D78B58C40, 0xFFFFFFFFFFFFFFFF}, // FCVTMU X0, D1 (1e+20)
+        {0x9e710020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTMU X0, D1 (-1e+20)
+        {0x9e710020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTMU X0, D1 (NaN)
+        {0x1e310020, 0xDEADBEEF40200000, 0x0000000000000002}, // FCVTMU W0, S1 (2.5)
+        {0x1e310020, 0xDEADBEEFC0200000, 0x0000000000000000}, // FCVTMU W0, S1 (-2.5)
+        {0x1e310020, 0xDEADBEEFBF400000, 0x0000000000000000}, // FCVTMU W0, S1 (-0.75)
+        {0x1e310020, 0xDEADBEEF501502F9, 0x00000000FFFFFFFF}, // FCVTMU W0, S1 (10000000000.0)
+        {0x1e310020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTMU W0, S1 (NaN)
+        {0x1e710020, 0x41EFFFFFFFF80000, 0x00000000FFFFFFFF}, // FCVTMU W0, D1 (4294967295.75)
+        {0x1e710020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTMU W0, D1 (-1e+20)
+        {0x9e310020, 0xDEADBEEF5F502AB5, 0xD02AB50000000000}, // FCVTMU X0, S1 (1.5000000520515486e+19)
+        {0x9e310020, 0xDEADBEEFC0600000, 0x0000000000000000}, // FCVTMU X0, S1 (-3.5)
+        {0x9e780020, 0x4004000000000000, 0x0000000000000002}, // FCVTZS X0, D1 (2.5)
+        {0x9e780020, 0xC004000000000000, 0xFFFFFFFFFFFFFFFE}, // FCVTZS X0, D1 (-2.5)
+        {0x9e780020, 0x400C000000000000, 0x0000000000000003}, // FCVTZS X0, D1 (3.5)
+        {0x9e780020, 0xBFE8000000000000, 0x0000000000000000}, // FCVTZS X0, D1 (-0.75)
+        {0x9e780020, 0x43E0000000000001, 0x7FFFFFFFFFFFFFFF}, // FCVTZS X0, D1 (9.223372036854778e+18)
+        {0x9e780020, 0x4415AF1D78B58C40, 0x7FFFFFFFFFFFFFFF}, // FCVTZS X0, D1 (1e+20)
+        {0x9e780020, 0xC415AF1D78B58C40, 0x8000000000000000}, // FCVTZS X0, D1 (-1e+20)
+        {0x9e780020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTZS X0, D1 (NaN)
+        {0x1e380020, 0xDEADBEEF40200000, 0x0000000000000002}, // FCVTZS W0, S1 (2.5)
+        {0x1e380020, 0xDEADBEEFC0200000, 0x00000000FFFFFFFE}, // FCVTZS W0, S1 (-2.5)
+        {0x1e380020, 0xDEADBEEFBF400000, 0x0000000000000000}, // FCVTZS W0, S1 (-0.75)
+        {0x1e380020, 0xDEADBEEF501502F9, 0x000000007FFFFFFF}, // FCVTZS W0, S1 (10000000000.0)
+        {0x1e380020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTZS W0, S1 (NaN)
+        {0x1e780020, 0x41EFFFFFFFF80000, 0x000000007FFFFFFF}, // FCVTZS W0, D1 (4294967295.75)
+        {0x1e780020, 0xC415AF1D78B58C40, 0x0000000080000000}, // FCVTZS W0, D1 (-1e+20)
+        {0x9e380020, 0xDEADBEEF5F502AB5, 0x7FFFFFFFFFFFFFFF}, // FCVTZS X0, S1 (1.5000000520515486e+19)
+        {0x9e380020, 0xDEADBEEFC0600000, 0xFFFFFFFFFFFFFFFD}, // FCVTZS X0, S1 (-3.5)
+        {0x9e790020, 0x4004000000000000, 0x0000000000000002}, // FCVTZU X0, D1 (2.5)
+        {0x9e790020, 0xC004000000000000, 0x0000000000000000}, // FCVTZU X0, D1 (-2.5)
+        {0x9e790020, 0x400C000000000000, 0x0000000000000003}, // FCVTZU X0, D1 (3.5)
+        {0x9e790020, 0xBFE8000000000000, 0x0000000000000000}, // FCVTZU X0, D1 (-0.75)
+        {0x9e790020, 0x43E0000000000001, 0x8000000000000800}, // FCVTZU X0, D1 (9.223372036854778e+18)
+        {0x9e790020, 0x4415AF1D78B58C40, 0xFFFFFFFFFFFFFFFF}, // FCVTZU X0, D1 (1e+20)
+        {0x9e790020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTZU X0, D1 (-1e+20)
+        {0x9e790020, 0x7FF8000000000000, 0x0000000000000000}, // FCVTZU X0, D1 (NaN)
+        {0x1e390020, 0xDEADBEEF40200000, 0x0000000000000002}, // FCVTZU W0, S1 (2.5)
+        {0x1e390020, 0xDEADBEEFC0200000, 0x0000000000000000}, // FCVTZU W0, S1 (-2.5)
+        {0x1e390020, 0xDEADBEEFBF400000, 0x0000000000000000}, // FCVTZU W0, S1 (-0.75)
+        {0x1e390020, 0xDEADBEEF501502F9, 0x00000000FFFFFFFF}, // FCVTZU W0, S1 (10000000000.0)
+        {0x1e390020, 0xDEADBEEF7FC00000, 0x0000000000000000}, // FCVTZU W0, S1 (NaN)
+        {0x1e790020, 0x41EFFFFFFFF80000, 0x00000000FFFFFFFF}, // FCVTZU W0, D1 (4294967295.75)
+        {0x1e790020, 0xC415AF1D78B58C40, 0x0000000000000000}, // FCVTZU W0, D1 (-1e+20)
+        {0x9e390020, 0xDEADBEEF5F502AB5, 0xD02AB50000000000}, // FCVTZU X0, S1 (1.5000000520515486e+19)
+        {0x9e390020, 0xDEADBEEFC0600000, 0x0000000000000000}, // FCVTZU X0, S1 (-3.5)
+        {0x1e18f020, 0xDEADBEEFC02D70A4, 0x00000000FFFFFFD5}, // FCVTZS W0, S1, #4 (-2.7100000381469727)
+        {0x1e19f020, 0xDEADBEEF402D70A4, 0x000000000000002B}, // FCVTZU W0, S1, #4 (2.7100000381469727)
+        {0x9e588020, 0xC0C81CD6C8B43958, 0xFFFFCFC6526E978E}, // FCVTZS X0, D1, #32 (-12345.678)
+        {0x9e598020, 0x40C81CD6C8B43958, 0x00003039AD916872}, // FCVTZU X0, D1, #32 (12345.678)
+        {0x1e58b020, 0x40B3880000000000, 0x000000007FFFFFFF}, // FCVTZS W0, D1, #20 (5000.0)
+        {0x9e19fc20, 0xDEADBEEF5F502AB5, 0xFFFFFFFFFFFFFFFF}, // FCVTZU X0, S1, #1 (1.5000000520515486e+19)
+        {0x9e580020, 0xBFD0000000000000, 0xC000000000000000}, // FCVTZS X0, D1, #64 (-0.25)
+        {0x1e598020, 0x3FEFFFFFFF768FA1, 0x00000000FFFFFFFB}, // FCVTZU W0, D1, #32 (0.999999999)
+    };
+
+    // Baseline host features force the non-SSE4.1 rounding fallback and the non-AVX-512 unsigned 64-bit conversion.
+    for (bool baseline_host_features_only : {false, true}) {
+        for (const auto& test_case : test_cases) {
+            const Dynarmic::BackendX64::ScopedBaselineHostFeatures baseline{baseline_host_features_only};
+            TestEnv env;
+            Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+            env.code_mem[0] = test_case.instruction;
+            env.code_mem[1] = 0x14000000; // B .
+
+            jit.SetRegister(0, 0xDEADBEEFDEADBEEF);
+            jit.SetVector(1, {test_case.input, 0xDEADBEEFDEADBEEF});
+            jit.SetPC(0);
+
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("instruction: " << std::hex << test_case.instruction << ", input: " << test_case.input << ", baseline: " << baseline_host_features_only);
+            REQUIRE(jit.GetRegister(0) == test_case.expected);
+            REQUIRE(jit.GetPC() == 4);
+        }
+    }
+}
+
+TEST_CASE("A64: Integer to floating point conversion", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        u64 input;
+        u64 expected;
+    };
+
+    // The operand is X1 (or W1); the result is written to the lower part of V0 with the rest of the register cleared.
+    const std::vector<TestCase> test_cases {
+        {0x9e620020, 0xFFFFFFFFFFFFFFFF, 0xBFF0000000000000}, // SCVTF D0, X1 (0xFFFFFFFFFFFFFFFF)
+        {0x9e630020, 0xFFFFFFFFFFFFFFFF, 0x43F0000000000000}, // UCVTF D0, X1 (0xFFFFFFFFFFFFFFFF)
+        {0x9e630020, 0x8000000000000401, 0x43E0000000000001}, // UCVTF D0, X1 (0x8000000000000401)
+        {0x9e230020, 0x8000008000000001, 0x000000005F000001}, // UCVTF S0, X1 (0x8000008000000001)
+        {0x9e220020, 0x123456789ABCDEF1, 0x000000005D91A2B4}, // SCVTF S0, X1 (0x123456789ABCDEF1)
+        {0x9e230020, 0x123456789ABCDEF1, 0x000000005D91A2B4}, // UCVTF S0, X1 (0x123456789ABCDEF1)
+        {0x1e220020, 0xFFFFFFFF80000001, 0x00000000CF000000}, // SCVTF S0, W1 (0x80000001)
+        {0x1e230020, 0xFFFFFFFF80000001, 0x000000004F000000}, // UCVTF S0, W1 (0x80000001)
+        {0x1e620020, 0x0000000080000001, 0xC1DFFFFFFFC00000}, // SCVTF D0, W1 (0x80000001)
+        {0x1e630020, 0x0000000080000001, 0x41E0000000200000}, // UCVTF D0, W1 (0x80000001)
+        {0x9e620020, 0x8000000000000000, 0xC3E0000000000000}, // SCVTF D0, X1 (0x8000000000000000)
+        {0x1e02f020, 0xFFFFFFFFFFFFFFD5, 0x00000000C02C0000}, // SCVTF S0, W1, #4 (0xFFFFFFD5)
+        {0x9e430020, 0xC000000000000000, 0x3FE8000000000000}, // UCVTF D0, X1, #64 (0xC000000000000000)
+        {0x9e42c020, 0xFFFFFFFFFFFE8000, 0xBFF8000000000000}, // SCVTF D0, X1, #16 (0xFFFFFFFFFFFE8000)
+        {0x1e038020, 0x00000000FFFFFFFF, 0x000000003F800000}, // UCVTF S0, W1, #32 (0xFFFFFFFF)
+    };
+
+    // Baseline host features force the non-AVX-512 unsigned 64-bit conversion.
+    for (bool baseline_host_features_only : {false, true}) {
+        for (const auto& test_case : test_cases) {
+            const Dynarmic::BackendX64::ScopedBaselineHostFeatures baseline{baseline_host_features_only};
+            TestEnv env;
+            Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+            env.code_mem[0] = test_case.instruction;
+            env.code_mem[1] = 0x14000000; // B .
+
+            jit.SetRegister(1, test_case.input);
+            jit.SetVector(0, {0xDEADBEEFDEADBEEF, 0xDEADBEEFDEADBEEF});
+            jit.SetPC(0);
+
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("instruction: " << std::hex << test_case.instruction << ", input: " << test_case.input << ", baseline: " << baseline_host_features_only);
+            REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{test_case.expected, 0});
+            REQUIRE(jit.GetPC() == 4);
+        }
+    }
+}
+
+TEST_CASE("A64: Fused multiply-add", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x1f020c20; // FMADD S0, S1, S2, S3
+    env.code_mem[1] = 0x1f469ca4; // FMSUB D4, D5, D6, D7
+    env.code_mem[2] = 0x1f661ca8; // FNMADD D8, D5, D6, D7
+    env.code_mem[3] = 0x1f669ca9; // FNMSUB D9, D5, D6, D7
+    env.code_mem[4] = 0x14000000; // B .
+
+    jit.SetVector(1, {0x3F800001, 0}); // 1 + 2^-23
+    jit.SetVector(2, {0x3F800001, 0}); // 1 + 2^-23
+    jit.SetVector(3, {0xBF800002, 0}); // -(1 + 2^-22)
+    jit.SetVector(5, {0x4008000000000000, 0}); // 3.0
+    jit.SetVector(6, {0x4000000000000000, 0}); // 2.0
+    jit.SetVector(7, {0x4024000000000000, 0}); // 10.0
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    // The product is not rounded before the addition.
+    REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0x28800000, 0});
+    REQUIRE(jit.GetVector(4) == Dynarmic::A64::Jit::Vector{0x4010000000000000, 0});
+    REQUIRE(jit.GetVector(8) == Dynarmic::A64::Jit::Vector{0xC030000000000000, 0});
+    REQUIRE(jit.GetVector(9) == Dynarmic::A64::Jit::Vector{0xC010000000000000, 0});
+}
+
+TEST_CASE("A64: AES", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x4e284820; // AESE V0.16B, V1.16B
+    env.code_mem[1] = 0x4e285822; // AESD V2.16B, V1.16B
+    env.code_mem[2] = 0x4e286883; // AESMC V3.16B, V4.16B
+    env.code_mem[3] = 0x4e287885; // AESIMC V5.16B, V4.16B
+    env.code_mem[4] = 0x14000000; // B .
+
+    jit.SetVector(0, {0x3A0562D56ABD685A, 0x017F9EE6725ED09D});
+    jit.SetVector(1, {0x781EF86F5C8CC1AB, 0x48F165D57B00C7F4});
+    jit.SetVector(2, {0xDAA8B2A668D605D4, 0xB6043106A85F68B6});
+    jit.SetVector(4, {0x3CE44E27424458B6, 0x38F12D92A28F17D8});
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0x0519F0F43B58B8A1, 0x01AFD3C32CC70FF9});
+    REQUIRE(jit.GetVector(2) == Dynarmic::A64::Jit::Vector{0xA97788121A84FD6B, 0x28791BA90C465CF6});
+    REQUIRE(jit.GetVector(3) == Dynarmic::A64::Jit::Vector{0xBBFEB04459A08899, 0x010EF881B437DEBF});
+    REQUIRE(jit.GetVector(5) == Dynarmic::A64::Jit::Vector{0x97209C9A3044E17D, 0xC804318B07216DA9});
+    REQUIRE(jit.GetPC() == 16);
+}
+
+TEST_CASE("A64: SHA1 and SHA256", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x5e0800e6; // SHA1C Q6, S7, V8.4S
+    env.code_mem[1] = 0x5e0810e9; // SHA1P Q9, S7, V8.4S
+    env.code_mem[2] = 0x5e0820ea; // SHA1M Q10, S7, V8.4S
+    env.code_mem[3] = 0x5e0830eb; // SHA1SU0 V11.4S, V7.4S, V8.4S
+    env.code_mem[4] = 0x5e2818ec; // SHA1SU1 V12.4S, V7.4S
+    env.code_mem[5] = 0x5e2808ed; // SHA1H S13, S7
+    env.code_mem[6] = 0x5e0841ee; // SHA256H Q14, Q15, V8.4S
+    env.code_mem[7] = 0x5e085230; // SHA256H2 Q16, Q17, V8.4S
+    env.code_mem[8] = 0x5e2828f2; // SHA256SU0 V18.4S, V7.4S
+    env.code_mem[9] = 0x5e0860f3; // SHA256SU1 V19.4S, V7.4S, V8.4S
+    env.code_mem[10] = 0x14000000; // B .
+
+    jit.SetVector(6, {0x4BEDCE030297C5E5, 0xD09E04924D52BC61});
+    jit.SetVector(7, {0xAAADD6B855C6B62B, 0xF3A160712456DE76});
+    jit.SetVector(8, {0x9A23BEF7BE506564, 0x05ADB3FC4F634127});
+    jit.SetVector(9, {0x3868E6D9CA0BC36C, 0x9A508BB1F4C9DA65});
+    jit.SetVector(10, {0x05372EF440E5C51E, 0x2769E927E4BF1564});
+    jit.SetVector(11, {0x9B25F81FCEC1496E, 0xA1865506AADBF831});
+    jit.SetVector(12, {0x76F87A640701AD82, 0x994395A774F0147F});
+    jit.SetVector(14, {0xB41B5669A0729B23, 0xFC45228F4BD571B0});
+    jit.SetVector(15, {0xC85BD78D396E0D55, 0x5C9DC8B64F4E68E5});
+    jit.SetVector(16, {0x6B978D7D421BB123, 0x1600314AC9AEE9CF});
+    jit.SetVector(17, {0x7E89F91859082551, 0x844948A86C51CE92});
+    jit.SetVector(18, {0x2C199BD3A49D1CE2, 0x900977A9F2C94386});
+    jit.SetVector(19, {0x9429523C4B037D52, 0x486580790B44045F});
+    jit.SetPC(0);
+
+    env.ticks_left = 11;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(6) == Dynarmic::A64::Jit::Vector{0x4BAA13004DF038FD, 0x1018993071B87544});
+    REQUIRE(jit.GetVector(9) == Dynarmic::A64::Jit::Vector{0xC2D4E86A1B3BCDD4, 0x6B20500D0D5D1C87});
+    REQUIRE(jit.GetVector(10) == Dynarmic::A64::Jit::Vector{0xCF50D8E2C52FCD58, 0xD583BB2E31164131});
+    REQUIRE(jit.GetVector(11) == Dynarmic::A64::Jit::Vector{0xA08013EEDA4AD43B, 0x0E863042B07E0F3D});
+    REQUIRE(jit.GetVector(12) == Dynarmic::A64::Jit::Vector{0xA55D48245B58F675, 0x8436C7A50EA2E81D});
+    REQUIRE(jit.GetVector(13) == Dynarmic::A64::Jit::Vector{0x00000000D571AD8A, 0x0000000000000000});
+    REQUIRE(jit.GetVector(14) == Dynarmic::A64::Jit::Vector{0xAE8E45B09F30997E, 0x4E3D52253A893634});
+    REQUIRE(jit.GetVector(16) == Dynarmic::A64::Jit::Vector{0x3DF7DA595AAABCC2, 0xC90A6556A793C440});
+    REQUIRE(jit.GetVector(18) == Dynarmic::A64::Jit::Vector{0x6F76A21869CCE82D, 0x81A306810F949B9E});
+    REQUIRE(jit.GetVector(19) == Dynarmic::A64::Jit::Vector{0x280119C1BE55EA97, 0xB6889723471C226A});
+    REQUIRE(jit.GetPC() == 40);
+}
+
+TEST_CASE("A64: PMULL, EOR3, BCAX and RAX1", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x0e28e0f4; // PMULL V20.8H, V7.8B, V8.8B
+    env.code_mem[1] = 0x4e28e0f5; // PMULL2 V21.8H, V7.16B, V8.16B
+    env.code_mem[2] = 0x0ee8e0f6; // PMULL V22.1Q, V7.1D, V8.1D
+    env.code_mem[3] = 0x4ee8e0f7; // PMULL2 V23.1Q, V7.2D, V8.2D
+    env.code_mem[4] = 0xce0810f8; // EOR3 V24.16B, V7.16B, V8.16B, V4.16B
+    env.code_mem[5] = 0xce2810f9; // BCAX V25.16B, V7.16B, V8.16B, V4.16B
+    env.code_mem[6] = 0xce678d1a; // RAX1 V26.2D, V8.2D, V7.2D
+    env.code_mem[7] = 0x14000000; // B .
+
+    jit.SetVector(7, {0x156724D0F9507C87, 0xFFFC3436D523583B});
+    jit.SetVector(8, {0x01952061CA532551, 0x5F81639E85FBC058});
+    jit.SetVector(4, {0x7D6933B93C1BE0D0, 0x4F126160278DEDA9});
+    jit.SetPC(0);
+
+    env.ticks_left = 8;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(20) == Dynarmic::A64::Jit::Vector{0x44FA11F00E0C2937, 0x0015340B04802ED0});
+    REQUIRE(jit.GetVector(21) == Dynarmic::A64::Jit::Vector{0x69011E6D3A000CA8, 0x35357EFC0BDC1964});
+    REQUIRE(jit.GetVector(22) == Dynarmic::A64::Jit::Vector{0x7FCE34E73C6FEE37, 0x001EC09449A67A46});
+    REQUIRE(jit.GetVector(23) == Dynarmic::A64::Jit::Vector{0x41BEA9BB20EF0CA8, 0x357FFBF0CC8B88A1});
+    REQUIRE(jit.GetVector(24) == Dynarmic::A64::Jit::Vector{0x699B37080F18B906, 0xEF6F36C8775575CA});
+    REQUIRE(jit.GetVector(25) == Dynarmic::A64::Jit::Vector{0x15F324903B107986, 0xEF7D36A85551586B});
+    REQUIRE(jit.GetVector(26) == Dynarmic::A64::Jit::Vector{0x2B5B69C038F3DC5F, 0xA0790BF32FBD702F});
+    REQUIRE(jit.GetPC() == 28);
+}
+
+TEST_CASE("A64: SIMD three same", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    // Operands are V1 and V2; V0 holds the accumulator for MLA, SABA, BSL and friends.
+    const std::vector<TestCase> test_cases {
+        {0x6e228420, {0x01FF01FE15365374, 0xFFFE0101FDDAB718}}, // SUB V0.16B, V1.16B, V2.16B
+        {0x6e628420, {0x00FF01FE14365374, 0xFFFE0001FDDAB718}}, // SUB V0.8H, V1.8H, V2.8H
+        {0x6ea28420, {0x00FE01FE14365374, 0xFFFE0001FDDAB718}}, // SUB V0.4S, V1.4S, V2.4S
+        {0x6ee28420, {0x00FE01FD14365374, 0xFFFE0001FDDAB718}}, // SUB V0.2D, V1.2D, V2.2D
+        {0x2e228420, {0x01FF01FE15365374, 0x0000000000000000}}, // SUB V0.8B, V1.8B, V2.8B
+        {0x4e220c20, {0xFFFFFF000F32597C, 0xFF00FFFFFFDEBD80}}, // SQADD V0.16B, V1.16B, V2.16B
+        {0x4e620c20, {0xFFFF00001032597C, 0x0000FFFFFFDEBE18}}, // SQADD V0.8H, V1.8H, V2.8H
+        {0x4ea20c20, {0x000000001032597C, 0x0000FFFFFFDEBE18}}, // SQADD V0.4S, V1.4S, V2.4S
+        {0x4ee20c20, {0x000000011032597C, 0x0000FFFFFFDEBE18}}, // SQADD V0.2D, V1.2D, V2.2D
+        {0x0e220c20, {0xFFFFFF000F32597C, 0x0000000000000000}}, // SQADD V0.8B, V1.8B, V2.8B
+        {0x4e222c20, {0x807F01FE15365374, 0x7FFE8001FDDAB718}}, // SQSUB V0.16B, V1.16B, V2.16B
+        {0x4e622c20, {0x800001FE14365374, 0x7FFF8000FDDAB718}}, // SQSUB V0.8H, V1.8H, V2.8H
+        {0x4ea22c20, {0x8000000014365374, 0x7FFFFFFFFDDAB718}}, // SQSUB V0.4S, V1.4S, V2.4S
+        {0x4ee22c20, {0x8000000000000000, 0x7FFFFFFFFFFFFFFF}}, // SQSUB V0.2D, V1.2D, V2.2D
+        {0x0e222c20, {0x807F01FE15365374, 0x0000000000000000}}, // SQSUB V0.8B, V1.8B, V2.8B
+        {0x6e220c20, {0xFFFFFFFFFFFF597C, 0xFFFFFFFFFFDEBDFF}}, // UQADD V0.16B, V1.16B, V2.16B
+        {0x6e620c20, {0xFFFFFFFFFFFF597C, 0xFFFFFFFFFFDEBE18}}, // UQADD V0.8H, V1.8H, V2.8H
+        {0x6ea20c20, {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFDEBE18}}, // UQADD V0.4S, V1.4S, V2.4S
+        {0x6ee20c20, {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF}}, // UQADD V0.2D, V1.2D, V2.2D
+        {0x2e220c20, {0xFFFFFFFFFFFF597C, 0x0000000000000000}}, // UQADD V0.8B, V1.8B, V2.8B
+        {0x6e222c20, {0x010000FE00005374, 0x00FE0100FDDAB718}}, // UQSUB V0.16B, V1.16B, V2.16B
+        {0x6e622c20, {0x00FF000000005374, 0x00000001FDDAB718}}, // UQSUB V0.8H, V1.8H, V2.8H
+        {0x6ea22c20, {0x00FE01FE00000000, 0x00000000FDDAB718}}, // UQSUB V0.4S, V1.4S, V2.4S
+        {0x6ee22c20, {0x00FE01FD14365374, 0x0000000000000000}}, // UQSUB V0.2D, V1.2D, V2.2D
+        {0x2e222c20, {0x010000FE00005374, 0x0000000000000000}}, // UQSUB V0.8B, V1.8B, V2.8B
+        {0x6e228c20, {0x0000000000000000, 0x0000000000000000}}, // CMEQ V0.16B, V1.16B, V2.16B
+        {0x6e628c20, {0x0000000000000000, 0x0000000000000000}}, // CMEQ V0.8H, V1.8H, V2.8H
+        {0x6ea28c20, {0x0000000000000000, 0x0000000000000000}}, // CMEQ V0.4S, V1.4S, V2.4S
+        {0x6ee28c20, {0x0000000000000000, 0x0000000000000000}}, // CMEQ V0.2D, V1.2D, V2.2D
+        {0x2e228c20, {0x0000000000000000, 0x0000000000000000}}, // CMEQ V0.8B, V1.8B, V2.8B
+        {0x4e223420, {0x00FFFF00FFFFFFFF, 0xFF0000FF000000FF}}, // CMGT V0.16B, V1.16B, V2.16B
+        {0x4e623420, {0x0000FFFFFFFFFFFF, 0xFFFF000000000000}}, // CMGT V0.8H, V1.8H, V2.8H
+        {0x4ea23420, {0x00000000FFFFFFFF, 0xFFFFFFFF00000000}}, // CMGT V0.4S, V1.4S, V2.4S
+        {0x4ee23420, {0x0000000000000000, 0xFFFFFFFFFFFFFFFF}}, // CMGT V0.2D, V1.2D, V2.2D
+        {0x0e223420, {0x00FFFF00FFFFFFFF, 0x0000000000000000}}, // CMGT V0.8B, V1.8B, V2.8B
+        {0x4e223c20, {0x00FFFF00FFFFFFFF, 0xFF0000FF000000FF}}, // CMGE V0.16B, V1.16B, V2.16B
+        {0x4e623c20, {0x0000FFFFFFFFFFFF, 0xFFFF000000000000}}, // CMGE V0.8H, V1.8H, V2.8H
+        {0x4ea23c20, {0x00000000FFFFFFFF, 0xFFFFFFFF00000000}}, // CMGE V0.4S, V1.4S, V2.4S
+        {0x4ee23c20, {0x0000000000000000, 0xFFFFFFFFFFFFFFFF}}, // CMGE V0.2D, V1.2D, V2.2D
+        {0x0e223c20, {0x00FFFF00FFFFFFFF, 0x0000000000000000}}, // CMGE V0.8B, V1.8B, V2.8B
+        {0x6e223420, {0xFF0000FF0000FFFF, 0x00FFFF00FFFFFFFF}}, // CMHI V0.16B, V1.16B, V2.16B
+        {0x6e623420, {0xFFFF00000000FFFF, 0x0000FFFFFFFFFFFF}}, // CMHI V0.8H, V1.8H, V2.8H
+        {0x6ea23420, {0xFFFFFFFF00000000, 0x00000000FFFFFFFF}}, // CMHI V0.4S, V1.4S, V2.4S
+        {0x6ee23420, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMHI V0.2D, V1.2D, V2.2D
+        {0x2e223420, {0xFF0000FF0000FFFF, 0x0000000000000000}}, // CMHI V0.8B, V1.8B, V2.8B
+        {0x6e223c20, {0xFF0000FF0000FFFF, 0x00FFFF00FFFFFFFF}}, // CMHS V0.16B, V1.16B, V2.16B
+        {0x6e623c20, {0xFFFF00000000FFFF, 0x0000FFFFFFFFFFFF}}, // CMHS V0.8H, V1.8H, V2.8H
+        {0x6ea23c20, {0xFFFFFFFF00000000, 0x00000000FFFFFFFF}}, // CMHS V0.4S, V1.4S, V2.4S
+        {0x6ee23c20, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMHS V0.2D, V1.2D, V2.2D
+        {0x2e223c20, {0xFF0000FF0000FFFF, 0x0000000000000000}}, // CMHS V0.8B, V1.8B, V2.8B
+        {0x4e228c20, {0x000000FFFFFFFF00, 0x00FF00000000FFFF}}, // CMTST V0.16B, V1.16B, V2.16B
+        {0x4e628c20, {0x0000FFFFFFFFFFFF, 0xFFFF00000000FFFF}}, // CMTST V0.8H, V1.8H, V2.8H
+        {0x4ea28c20, {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF}}, // CMTST V0.4S, V1.4S, V2.4S
+        {0x4ee28c20, {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF}}, // CMTST V0.2D, V1.2D, V2.2D
+        {0x0e228c20, {0x000000FFFFFFFF00, 0x0000000000000000}}, // CMTST V0.8B, V1.8B, V2.8B
+        {0x4e224420, {0x000000FE020DB080, 0x00FE0000FC70D0FF}}, // SSHL V0.16B, V1.16B, V2.16B
+        {0x4e624420, {0xFFFF01FE048D6780, 0xFFFEC000FB70FFFF}}, // SSHL V0.8H, V1.8H, V2.8H
+        {0x4ea24420, {0x00FE01FE23456780, 0x3FFFC000FFFFFFFF}}, // SSHL V0.4S, V1.4S, V2.4S
+        {0x4ee24420, {0x07F00FF123456780, 0x0000000000000000}}, // SSHL V0.2D, V1.2D, V2.2D
+        {0x0e224420, {0x000000FE020DB080, 0x0000000000000000}}, // SSHL V0.8B, V1.8B, V2.8B
+        {0x6e224420, {0x000000FE020DB080, 0x00FE0000FC70D000}}, // USHL V0.16B, V1.16B, V2.16B
+        {0x6e624420, {0x000001FE048D6780, 0xFFFE4000FB700000}}, // USHL V0.8H, V1.8H, V2.8H
+        {0x6ea24420, {0x00FE01FE23456780, 0x3FFFC00000000000}}, // USHL V0.4S, V1.4S, V2.4S
+        {0x6ee24420, {0x07F00FF123456780, 0x0000000000000000}}, // USHL V0.2D, V1.2D, V2.2D
+        {0x2e224420, {0x000000FE020DB080, 0x0000000000000000}}, // USHL V0.8B, V1.8B, V2.8B
+        {0x4e225420, {0x000000FE020DB080, 0x00FE0000FC70D000}}, // SRSHL V0.16B, V1.16B, V2.16B
+        {0x4e625420, {0x000001FE048D6780, 0xFFFEC000FB700000}}, // SRSHL V0.8H, V1.8H, V2.8H
+        {0x4ea25420, {0x00FE01FE23456780, 0x3FFFC00000000000}}, // SRSHL V0.4S, V1.4S, V2.4S
+        {0x4ee25420, {0x07F00FF123456780, 0x0000000000000000}}, // SRSHL V0.2D, V1.2D, V2.2D
+        {0x0e225420, {0x000000FE020DB080, 0x0000000000000000}}, // SRSHL V0.8B, V1.8B, V2.8B
+        {0x6e225420, {0x000000FE020DB080, 0x00FE0000FC70D000}}, // URSHL V0.16B, V1.16B, V2.16B
+        {0x6e625420, {0x000001FE048D6780, 0xFFFE4000FB700000}}, // URSHL V0.8H, V1.8H, V2.8H
+        {0x6ea25420, {0x00FE01FE23456780, 0x3FFFC00000000000}}, // URSHL V0.4S, V1.4S, V2.4S
+        {0x6ee25420, {0x07F00FF123456780, 0x0000000000000000}}, // URSHL V0.2D, V1.2D, V2.2D
+        {0x2e225420, {0x000000FE020DB080, 0x0000000000000000}}, // URSHL V0.8B, V1.8B, V2.8B
+        {0x4e220420, {0xFFFFFF0007192C3E, 0xFF00FFFFFFEFDE8C}}, // SHADD V0.16B, V1.16B, V2.16B
+        {0x4e620420, {0xFFFF000008192CBE, 0x0000FFFFFFEFDF0C}}, // SHADD V0.8H, V1.8H, V2.8H
+        {0x4ea20420, {0x0000000008192CBE, 0x00007FFFFFEF5F0C}}, // SHADD V0.4S, V1.4S, V2.4S
+        {0x0e620420, {0xFFFF000008192CBE, 0x0000000000000000}}, // SHADD V0.4H, V1.4H, V2.4H
+        {0x6e220420, {0x7F7F7F8087992C3E, 0x7F807F7F7F6F5E8C}}, // UHADD V0.16B, V1.16B, V2.16B
+        {0x6e620420, {0x7FFF800088192CBE, 0x80007FFF7FEF5F0C}}, // UHADD V0.8H, V1.8H, V2.8H
+        {0x6ea20420, {0x8000000088192CBE, 0x80007FFF7FEF5F0C}}, // UHADD V0.4S, V1.4S, V2.4S
+        {0x2e620420, {0x7FFF800088192CBE, 0x0000000000000000}}, // UHADD V0.4H, V1.4H, V2.4H
+        {0x4e222420, {0x807F00FF0A1B293A, 0x7FFF8000FEEDDB0C}}, // SHSUB V0.16B, V1.16B, V2.16B
+        {0x4e622420, {0x807F00FF0A1B29BA, 0x7FFF8000FEEDDB8C}}, // SHSUB V0.8H, V1.8H, V2.8H
+        {0x4ea22420, {0x807F00FF0A1B29BA, 0x7FFF0000FEED5B8C}}, // SHSUB V0.4S, V1.4S, V2.4S
+        {0x0e622420, {0x807F00FF0A1B29BA, 0x0000000000000000}}, // SHSUB V0.4H, V1.4H, V2.4H
+        {0x6e222420, {0x00FF807F8A9B293A, 0xFF7F00807E6D5B0C}}, // UHSUB V0.16B, V1.16B, V2.16B
+        {0x6e622420, {0x007F80FF8A1B29BA, 0xFFFF00007EED5B8C}}, // UHSUB V0.8H, V1.8H, V2.8H
+        {0x6ea22420, {0x007F00FF8A1B29BA, 0xFFFF00007EED5B8C}}, // UHSUB V0.4S, V1.4S, V2.4S
+        {0x2e622420, {0x007F80FF8A1B29BA, 0x0000000000000000}}, // UHSUB V0.4H, V1.4H, V2.4H
+        {0x4e221420, {0x0000000008192D3E, 0x0000000000EFDF8C}}, // SRHADD V0.16B, V1.16B, V2.16B
+        {0x4e621420, {0x0000000008192CBE, 0x00000000FFEFDF0C}}, // SRHADD V0.8H, V1.8H, V2.8H
+        {0x4ea21420, {0x0000000008192CBE, 0x00008000FFEF5F0C}}, // SRHADD V0.4S, V1.4S, V2.4S
+        {0x0e621420, {0x0000000008192CBE, 0x0000000000000000}}, // SRHADD V0.4H, V1.4H, V2.4H
+        {0x6e221420, {0x8080808088992D3E, 0x80808080806F5F8C}}, // URHADD V0.16B, V1.16B, V2.16B
+        {0x6e621420, {0x8000800088192CBE, 0x800080007FEF5F0C}}, // URHADD V0.8H, V1.8H, V2.8H
+        {0x6ea21420, {0x8000000088192CBE, 0x800080007FEF5F0C}}, // URHADD V0.4S, V1.4S, V2.4S
+        {0x2e621420, {0x8000800088192CBE, 0x0000000000000000}}, // URHADD V0.4H, V1.4H, V2.4H
+        {0x4e226420, {0x7F7F000112345678, 0x7F017F0001020398}}, // SMAX V0.16B, V1.16B, V2.16B
+        {0x4e626420, {0x7F8000FF12345678, 0x7FFF7FFF01020380}}, // SMAX V0.8H, V1.8H, V2.8H
+        {0x4ea26420, {0x7F80FF0112345678, 0x7FFF800001020380}}, // SMAX V0.4S, V1.4S, V2.4S
+        {0x0e626420, {0x7F8000FF12345678, 0x0000000000000000}}, // SMAX V0.4H, V1.4H, V2.4H
+        {0x4e226c20, {0x8080FFFFFDFE0304, 0x80FF80FFFEDCBA80}}, // SMIN V0.16B, V1.16B, V2.16B
+        {0x4e626c20, {0x807FFF01FDFE0304, 0x80018000FEDCBA98}}, // SMIN V0.8H, V1.8H, V2.8H
+        {0x4ea26c20, {0x807F00FFFDFE0304, 0x80017FFFFEDCBA98}}, // SMIN V0.4S, V1.4S, V2.4S
+        {0x0e626c20, {0x807FFF01FDFE0304, 0x0000000000000000}}, // SMIN V0.4H, V1.4H, V2.4H
+        {0x6e226420, {0x8080FFFFFDFE5678, 0x80FF80FFFEDCBA98}}, // UMAX V0.16B, V1.16B, V2.16B
+        {0x6e626420, {0x807FFF01FDFE5678, 0x80018000FEDCBA98}}, // UMAX V0.8H, V1.8H, V2.8H
+        {0x6ea26420, {0x807F00FFFDFE0304, 0x80017FFFFEDCBA98}}, // UMAX V0.4S, V1.4S, V2.4S
+        {0x2e626420, {0x807FFF01FDFE5678, 0x0000000000000000}}, // UMAX V0.4H, V1.4H, V2.4H
+        {0x6e226c20, {0x7F7F000112340304, 0x7F017F0001020380}}, // UMIN V0.16B, V1.16B, V2.16B
+        {0x6e626c20, {0x7F8000FF12340304, 0x7FFF7FFF01020380}}, // UMIN V0.8H, V1.8H, V2.8H
+        {0x6ea26c20, {0x7F80FF0112345678, 0x7FFF800001020380}}, // UMIN V0.4S, V1.4S, V2.4S
+        {0x2e626c20, {0x7F8000FF12340304, 0x0000000000000000}}, // UMIN V0.4H, V1.4H, V2.4H
+        {0x4e22a420, {0x7F00FEBA7F003478, 0x017F02037F01FE04}}, // SMAXP V0.16B, V1.16B, V2.16B
+        {0x4e62a420, {0x7FFFFEDC00FF5678, 0x7FFF03807F800304}}, // SMAXP V0.8H, V1.8H, V2.8H
+        {0x4ea2a420, {0x7FFF800012345678, 0x010203807F80FF01}}, // SMAXP V0.4S, V1.4S, V2.4S
+        {0x0e22a420, {0x7F01FE047F003478, 0x0000000000000000}}, // SMAXP V0.8B, V1.8B, V2.8B
+        {0x0e62a420, {0x7F80030400FF5678, 0x0000000000000000}}, // SMAXP V0.4H, V1.4H, V2.4H
+        {0x0ea2a420, {0x7F80FF0112345678, 0x0000000000000000}}, // SMAXP V0.2S, V1.2S, V2.2S
+        {0x4e22ac20, {0xFF80DC9880FF1256, 0x80FF018080FFFD03}}, // SMINP V0.16B, V1.16B, V2.16B
+        {0x4e62ac20, {0x8000BA98807F1234, 0x80010102FF01FDFE}}, // SMINP V0.8H, V1.8H, V2.8H
+        {0x4ea2ac20, {0xFEDCBA98807F00FF, 0x80017FFFFDFE0304}}, // SMINP V0.4S, V1.4S, V2.4S
+        {0x0e22ac20, {0x80FFFD0380FF1256, 0x0000000000000000}}, // SMINP V0.8B, V1.8B, V2.8B
+        {0x0e62ac20, {0xFF01FDFE807F1234, 0x0000000000000000}}, // SMINP V0.4H, V1.4H, V2.4H
+        {0x0ea2ac20, {0xFDFE0304807F00FF, 0x0000000000000000}}, // SMINP V0.2S, V1.2S, V2.2S
+        {0x6e22a420, {0xFF80FEBA80FF3478, 0x80FF028080FFFE04}}, // UMAXP V0.16B, V1.16B, V2.16B
+        {0x6e62a420, {0x8000FEDC807F5678, 0x80010380FF01FDFE}}, // UMAXP V0.8H, V1.8H, V2.8H
+        {0x6ea2a420, {0xFEDCBA98807F00FF, 0x80017FFFFDFE0304}}, // UMAXP V0.4S, V1.4S, V2.4S
+        {0x2e22a420, {0x80FFFE0480FF3478, 0x0000000000000000}}, // UMAXP V0.8B, V1.8B, V2.8B
+        {0x2e62a420, {0xFF01FDFE807F5678, 0x0000000000000000}}, // UMAXP V0.4H, V1.4H, V2.4H
+        {0x2ea2a420, {0xFDFE0304807F00FF, 0x0000000000000000}}, // UMAXP V0.2S, V1.2S, V2.2S
+        {0x6e22ac20, {0x7F00DC987F001256, 0x017F01037F01FD03}}, // UMINP V0.16B, V1.16B, V2.16B
+        {0x6e62ac20, {0x7FFFBA9800FF1234, 0x7FFF01027F800304}}, // UMINP V0.8H, V1.8H, V2.8H
+        {0x6ea2ac20, {0x7FFF800012345678, 0x010203807F80FF01}}, // UMINP V0.4S, V1.4S, V2.4S
+        {0x2e22ac20, {0x7F01FD037F001256, 0x0000000000000000}}, // UMINP V0.8B, V1.8B, V2.8B
+        {0x2e62ac20, {0x7F80030400FF1234, 0x0000000000000000}}, // UMINP V0.4H, V1.4H, V2.4H
+        {0x2ea2ac20, {0x7F80FF0112345678, 0x0000000000000000}}, // UMINP V0.2S, V1.2S, V2.2S
+        {0x4e227420, {0xFFFF010215365374, 0xFF02FF0103264918}}, // SABD V0.16B, V1.16B, V2.16B
+        {0x4e627420, {0xFF0101FE14365374, 0xFFFEFFFF022648E8}}, // SABD V0.8H, V1.8H, V2.8H
+        {0x4ea27420, {0xFF01FE0214365374, 0xFFFE0001022548E8}}, // SABD V0.4S, V1.4S, V2.4S
+        {0x0e627420, {0xFF0101FE14365374, 0x0000000000000000}}, // SABD V0.4H, V1.4H, V2.4H
+        {0x6e227420, {0x0101FFFEEBCA5374, 0x01FE01FFFDDAB718}}, // UABD V0.16B, V1.16B, V2.16B
+        {0x6e627420, {0x00FFFE02EBCA5374, 0x00020001FDDAB718}}, // UABD V0.8H, V1.8H, V2.8H
+        {0x6ea27420, {0x00FE01FEEBC9AC8C, 0x0001FFFFFDDAB718}}, // UABD V0.4S, V1.4S, V2.4S
+        {0x2e627420, {0x00FFFE02EBCA5374, 0x0000000000000000}}, // UABD V0.4H, V1.4H, V2.4H
+        {0x4e227c20, {0x002246699EE12063, 0xEFF2EFF112355827}}, // SABA V0.16B, V1.16B, V2.16B
+        {0x4e627c20, {0x002447659DE12163, 0xF0EEF0EF113557F7}}, // SABA V0.8H, V1.8H, V2.8H
+        {0x4ea27c20, {0x002543699DE22163, 0xF0EEF0F1113457F7}}, // SABA V0.4S, V1.4S, V2.4S
+        {0x0e627c20, {0x002447659DE12163, 0x0000000000000000}}, // SABA V0.4H, V1.4H, V2.4H
+        {0x6e227c20, {0x0224446574752063, 0xF1EEF1EF0CE9C627}}, // UABA V0.16B, V1.16B, V2.16B
+        {0x6e627c20, {0x0222436975752163, 0xF0F2F0F10CE9C627}}, // UABA V0.8H, V1.8H, V2.8H
+        {0x6ea27c20, {0x0221476575757A7B, 0xF0F2F0EF0CE9C627}}, // UABA V0.4S, V1.4S, V2.4S
+        {0x2e627c20, {0x0222436975752163, 0x0000000000000000}}, // UABA V0.4H, V1.4H, V2.4H
+        {0x4e229c20, {0x808000FFCA9802E0, 0x80FF8000FEB82E00}}, // MUL V0.16B, V1.16B, V2.16B
+        {0x4e629c20, {0x408001FF7398C1E0, 0xFFFF8000D9B81400}}, // MUL V0.8H, V1.8H, V2.8H
+        {0x4ea29c20, {0x02FD01FF48E4C1E0, 0xC000800011BD1400}}, // MUL V0.4S, V1.4S, V2.4S
+        {0x0e629c20, {0x408001FF7398C1E0, 0x0000000000000000}}, // MUL V0.4H, V1.4H, V2.4H
+        {0x4e229420, {0x81A345665343CFCF, 0x70EF70F00DC73D0F}}, // MLA V0.16B, V1.16B, V2.16B
+        {0x4e629420, {0x41A34766FD438FCF, 0xF0EF70F0E8C7230F}}, // MLA V0.8H, V1.8H, V2.8H
+        {0x4ea29420, {0x04204766D2908FCF, 0xB0F170F020CC230F}}, // MLA V0.4S, V1.4S, V2.4S
+        {0x0e629420, {0x41A34766FD438FCF, 0x0000000000000000}}, // MLA V0.4H, V1.4H, V2.4H
+        {0x6e229420, {0x81A34568BF13CB0F, 0x70F170F01157E10F}}, // MLS V0.16B, V1.16B, V2.16B
+        {0x6e629420, {0xC0A3436816130C0F, 0xF0F170F03557FB0F}}, // MLS V0.8H, V1.8H, V2.8H
+        {0x6ea29420, {0xFE26436840C70C0F, 0x30F070F0FD51FB0F}}, // MLS V0.4S, V1.4S, V2.4S
+        {0x2e629420, {0xC0A3436816130C0F, 0x0000000000000000}}, // MLS V0.4H, V1.4H, V2.4H
+        {0x6e229c20, {0x808000FF2AD8FAE0, 0x80FF8000FEB8CE00}}, // PMUL V0.16B, V1.16B, V2.16B
+        {0x2e229c20, {0x808000FF2AD8FAE0, 0x0000000000000000}}, // PMUL V0.8B, V1.8B, V2.8B
+        {0x4e621c20, {0x807F00FE02005478, 0x7FFE8000FEDCB818}}, // BIC V0.16B, V1.16B, V2.16B
+        {0x0e621c20, {0x807F00FE02005478, 0x0000000000000000}}, // BIC V0.8B, V1.8B, V2.8B
+        {0x4ea21c20, {0xFFFFFFFFFFFE577C, 0xFFFFFFFFFFDEBB98}}, // ORR V0.16B, V1.16B, V2.16B
+        {0x0ea21c20, {0xFFFFFFFFFFFE577C, 0x0000000000000000}}, // ORR V0.8B, V1.8B, V2.8B
+        {0x4ee21c20, {0x807F00FF1235FEFB, 0x7FFF8000FEFDFEFF}}, // ORN V0.16B, V1.16B, V2.16B
+        {0x0ee21c20, {0x807F00FF1235FEFB, 0x0000000000000000}}, // ORN V0.8B, V1.8B, V2.8B
+        {0x6e221c20, {0xFFFFFFFEEFCA557C, 0xFFFEFFFFFFDEB918}}, // EOR V0.16B, V1.16B, V2.16B
+        {0x2e221c20, {0xFFFFFFFEEFCA557C, 0x0000000000000000}}, // EOR V0.8B, V1.8B, V2.8B
+        {0x6e621c20, {0x7EA3BA6774744668, 0x70F18F0F0E0C0A88}}, // BSL V0.16B, V1.16B, V2.16B
+        {0x2e621c20, {0x7EA3BA6774744668, 0x0000000000000000}}, // BSL V0.8B, V1.8B, V2.8B
+        {0x6ea21c20, {0x002300671035CEEB, 0x70F180000E0D0E8F}}, // BIT V0.16B, V1.16B, V2.16B
+        {0x2ea21c20, {0x002300671035CEEB, 0x0000000000000000}}, // BIT V0.8B, V1.8B, V2.8B
+        {0x6ee21c20, {0x817F45FF8BAA557C, 0xFFFEF0F0FFDEBB18}}, // BIF V0.16B, V1.16B, V2.16B
+        {0x2ee21c20, {0x817F45FF8BAA557C, 0x0000000000000000}}, // BIF V0.8B, V1.8B, V2.8B
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(0, {0x0123456789ABCDEF, 0xF0F0F0F00F0F0F0F});
+        jit.SetVector(1, {0x807F00FF12345678, 0x7FFF8000FEDCBA98});
+        jit.SetVector(2, {0x7F80FF01FDFE0304, 0x80017FFF01020380});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: SIMD floating point arithmetic", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        u32 fpcr;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    const auto run_test_cases = [](const Dynarmic::A64::Jit::Vector& accumulator, const Dynarmic::A64::Jit::Vector& operand1,
+                                   const Dynarmic::A64::Jit::Vector& operand2, const std::vector<TestCase>& test_cases) {
+        for (const auto& test_case : test_cases) {
+            TestEnv env;
+            Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+            env.code_mem[0] = test_case.instruction;
+            env.code_mem[1] = 0x14000000; // B .
+
+            jit.SetVector(0, accumulator);
+            jit.SetVector(1, operand1);
+            jit.SetVector(2, operand2);
+            jit.SetFpcr(test_case.fpcr);
+            jit.SetPC(0);
+
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("instruction: " << std::hex << test_case.instruction << " fpcr: " << test_case.fpcr);
+            REQUIRE(jit.GetVector(0) == test_case.expected);
+            REQUIRE(jit.GetPC() == 4);
+        }
+    };
+
+    // FPCR is 0 (NaN propagation), 0x02000000 (DN) or 0x01000000 (FZ).
+    SECTION("Single precision") {
+        // Lanes: {1.0 + 1.5 * 2.0, SNaN and QNaN operands, denormals, QNaN addend with infinity * 0}
+        run_test_cases({0x7FC004563F800000, 0x7FC007893F800000}, {0x7F8000013FC00000, 0x7F80000000400000}, {0x7FC0012340000000, 0x0000000080400000}, {
+            {0x4e22d420, 0x00000000, {0x7FC0000140600000, 0x7F80000000000000}}, // FADD V0.4S, V1.4S, V2.4S
+            {0x4ea2d420, 0x00000000, {0x7FC00001BF000000, 0x7F80000000800000}}, // FSUB V0.4S, V1.4S, V2.4S
+            {0x6e22dc20, 0x00000000, {0x7FC0000140400000, 0x7FC0000080000000}}, // FMUL V0.4S, V1.4S, V2.4S
+            {0x6e22fc20, 0x00000000, {0x7FC000013F400000, 0x7F800000BF800000}}, // FDIV V0.4S, V1.4S, V2.4S
+            {0x4e22cc20, 0x00000000, {0x7FC0000140800000, 0x7FC000003F800000}}, // FMLA V0.4S, V1.4S, V2.4S
+            {0x4ea2cc20, 0x00000000, {0xFFC00001C0000000, 0x7FC000003F800000}}, // FMLS V0.4S, V1.4S, V2.4S
+            {0x4ea0f820, 0x00000000, {0x7F8000013FC00000, 0x7F80000000400000}}, // FABS V0.4S, V1.4S
+            {0x6ea0f820, 0x00000000, {0xFF800001BFC00000, 0xFF80000080400000}}, // FNEG V0.4S, V1.4S
+            {0x6ea1f820, 0x00000000, {0x7FC000013F9CC471, 0x7F8000001FB504F3}}, // FSQRT V0.4S, V1.4S
+            {0x4e22d420, 0x02000000, {0x7FC0000040600000, 0x7F80000000000000}}, // FADD V0.4S, V1.4S, V2.4S
+            {0x4ea2d420, 0x02000000, {0x7FC00000BF000000, 0x7F80000000800000}}, // FSUB V0.4S, V1.4S, V2.4S
+            {0x6e22dc20, 0x02000000, {0x7FC0000040400000, 0x7FC0000080000000}}, // FMUL V0.4S, V1.4S, V2.4S
+            {0x6e22fc20, 0x02000000, {0x7FC000003F400000, 0x7F800000BF800000}}, // FDIV V0.4S, V1.4S, V2.4S
+            {0x4e22cc20, 0x02000000, {0x7FC0000040800000, 0x7FC000003F800000}}, // FMLA V0.4S, V1.4S, V2.4S
+            {0x4ea2cc20, 0x02000000, {0x7FC00000C0000000, 0x7FC000003F800000}}, // FMLS V0.4S, V1.4S, V2.4S
+            {0x6ea1f820, 0x02000000, {0x7FC000003F9CC471, 0x7F8000001FB504F3}}, // FSQRT V0.4S, V1.4S
+            {0x4e22d420, 0x01000000, {0x7FC0000140600000, 0x7F80000000000000}}, // FADD V0.4S, V1.4S, V2.4S
+            {0x4ea2d420, 0x01000000, {0x7FC00001BF000000, 0x7F80000000000000}}, // FSUB V0.4S, V1.4S, V2.4S
+            {0x6e22dc20, 0x01000000, {0x7FC0000140400000, 0x7FC0000080000000}}, // FMUL V0.4S, V1.4S, V2.4S
+            {0x6e22fc20, 0x01000000, {0x7FC000013F400000, 0x7F8000007FC00000}}, // FDIV V0.4S, V1.4S, V2.4S
+            {0x4e22cc20, 0x01000000, {0x7FC0000140800000, 0x7FC000003F800000}}, // FMLA V0.4S, V1.4S, V2.4S
+            {0x4ea2cc20, 0x01000000, {0xFFC00001C0000000, 0x7FC000003F800000}}, // FMLS V0.4S, V1.4S, V2.4S
+            {0x6ea1f820, 0x01000000, {0x7FC000013F9CC471, 0x7F80000000000000}}, // FSQRT V0.4S, V1.4S
+            {0x0e22d420, 0x00000000, {0x7FC0000140600000, 0x0000000000000000}}, // FADD V0.2S, V1.2S, V2.2S
+            {0x0ea2d420, 0x00000000, {0x7FC00001BF000000, 0x0000000000000000}}, // FSUB V0.2S, V1.2S, V2.2S
+            {0x2e22dc20, 0x00000000, {0x7FC0000140400000, 0x0000000000000000}}, // FMUL V0.2S, V1.2S, V2.2S
+            {0x2e22fc20, 0x00000000, {0x7FC000013F400000, 0x0000000000000000}}, // FDIV V0.2S, V1.2S, V2.2S
+            {0x0e22cc20, 0x00000000, {0x7FC0000140800000, 0x0000000000000000}}, // FMLA V0.2S, V1.2S, V2.2S
+            {0x0ea2cc20, 0x00000000, {0xFFC00001C0000000, 0x0000000000000000}}, // FMLS V0.2S, V1.2S, V2.2S
+            {0x0ea0f820, 0x00000000, {0x7F8000013FC00000, 0x0000000000000000}}, // FABS V0.2S, V1.2S
+            {0x2ea0f820, 0x00000000, {0xFF800001BFC00000, 0x0000000000000000}}, // FNEG V0.2S, V1.2S
+            {0x2ea1f820, 0x00000000, {0x7FC000013F9CC471, 0x0000000000000000}}, // FSQRT V0.2S, V1.2S
+        });
+    }
+
+    SECTION("Double precision") {
+        // Lanes: {SNaN operand, QNaN addend with denormal * infinity}
+        run_test_cases({0x4004000000000000, 0x7FF8000000000456}, {0x7FF0000000000001, 0x8000000000000001}, {0x3FF8000000000000, 0x7FF0000000000000}, {
+            {0x4e62d420, 0x00000000, {0x7FF8000000000001, 0x7FF0000000000000}}, // FADD V0.2D, V1.2D, V2.2D
+            {0x4ee2d420, 0x00000000, {0x7FF8000000000001, 0xFFF0000000000000}}, // FSUB V0.2D, V1.2D, V2.2D
+            {0x6e62dc20, 0x00000000, {0x7FF8000000000001, 0xFFF0000000000000}}, // FMUL V0.2D, V1.2D, V2.2D
+            {0x6e62fc20, 0x00000000, {0x7FF8000000000001, 0x8000000000000000}}, // FDIV V0.2D, V1.2D, V2.2D
+            {0x4e62cc20, 0x00000000, {0x7FF8000000000001, 0x7FF8000000000456}}, // FMLA V0.2D, V1.2D, V2.2D
+            {0x4ee2cc20, 0x00000000, {0xFFF8000000000001, 0x7FF8000000000456}}, // FMLS V0.2D, V1.2D, V2.2D
+            {0x4ee0f820, 0x00000000, {0x7FF0000000000001, 0x0000000000000001}}, // FABS V0.2D, V1.2D
+            {0x6ee0f820, 0x00000000, {0xFFF0000000000001, 0x0000000000000001}}, // FNEG V0.2D, V1.2D
+            {0x6ee1f820, 0x00000000, {0x7FF8000000000001, 0x7FF8000000000000}}, // FSQRT V0.2D, V1.2D
+            {0x4e62d420, 0x02000000, {0x7FF8000000000000, 0x7FF0000000000000}}, // FADD V0.2D, V1.2D, V2.2D
+            {0x4ee2d420, 0x02000000, {0x7FF8000000000000, 0xFFF0000000000000}}, // FSUB V0.2D, V1.2D, V2.2D
+            {0x6e62dc20, 0x02000000, {0x7FF8000000000000, 0xFFF0000000000000}}, // FMUL V0.2D, V1.2D, V2.2D
+            {0x6e62fc20, 0x02000000, {0x7FF8000000000000, 0x8000000000000000}}, // FDIV V0.2D, V1.2D, V2.2D
+            {0x4e62cc20, 0x02000000, {0x7FF8000000000000, 0x7FF8000000000000}}, // FMLA V0.2D, V1.2D, V2.2D
+            {0x4ee2cc20, 0x02000000, {0x7FF8000000000000, 0x7FF8000000000000}}, // FMLS V0.2D, V1.2D, V2.2D
+            {0x6ee1f820, 0x02000000, {0x7FF8000000000000, 0x7FF8000000000000}}, // FSQRT V0.2D, V1.2D
+            {0x4e62d420, 0x01000000, {0x7FF8000000000001, 0x7FF0000000000000}}, // FADD V0.2D, V1.2D, V2.2D
+            {0x4ee2d420, 0x01000000, {0x7FF8000000000001, 0xFFF0000000000000}}, // FSUB V0.2D, V1.2D, V2.2D
+            {0x6e62dc20, 0x01000000, {0x7FF8000000000001, 0x7FF8000000000000}}, // FMUL V0.2D, V1.2D, V2.2D
+            {0x6e62fc20, 0x01000000, {0x7FF8000000000001, 0x8000000000000000}}, // FDIV V0.2D, V1.2D, V2.2D
+            {0x4e62cc20, 0x01000000, {0x7FF8000000000001, 0x7FF8000000000000}}, // FMLA V0.2D, V1.2D, V2.2D
+            {0x4ee2cc20, 0x01000000, {0xFFF8000000000001, 0x7FF8000000000000}}, // FMLS V0.2D, V1.2D, V2.2D
+            {0x6ee1f820, 0x01000000, {0x7FF8000000000001, 0x8000000000000000}}, // FSQRT V0.2D, V1.2D
+        });
+    }
+}
+
+TEST_CASE("A64: SIMD permute and extract", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    const std::vector<TestCase> test_cases {
+        {0x4e023820, {0xFD12FE3403560478, 0x7F80807FFF0001FF}}, // ZIP1 V0.16B, V1.16B, V2.16B
+        {0x4e423820, {0xFDFE123403045678, 0x7F80807FFF0100FF}}, // ZIP1 V0.8H, V1.8H, V2.8H
+        {0x4e823820, {0xFDFE030412345678, 0x7F80FF01807F00FF}}, // ZIP1 V0.4S, V1.4S, V2.4S
+        {0x4ec23820, {0x807F00FF12345678, 0x7F80FF01FDFE0304}}, // ZIP1 V0.2D, V1.2D, V2.2D
+        {0x0e023820, {0xFD12FE3403560478, 0x0000000000000000}}, // ZIP1 V0.8B, V1.8B, V2.8B
+        {0x0e423820, {0xFDFE123403045678, 0x0000000000000000}}, // ZIP1 V0.4H, V1.4H, V2.4H
+        {0x0e823820, {0xFDFE030412345678, 0x0000000000000000}}, // ZIP1 V0.2S, V1.2S, V2.2S
+        {0x4e027820, {0x01FE02DC03BA8098, 0x807F01FF7F80FF00}}, // ZIP2 V0.16B, V1.16B, V2.16B
+        {0x4e427820, {0x0102FEDC0380BA98, 0x80017FFF7FFF8000}}, // ZIP2 V0.8H, V1.8H, V2.8H
+        {0x4e827820, {0x01020380FEDCBA98, 0x80017FFF7FFF8000}}, // ZIP2 V0.4S, V1.4S, V2.4S
+        {0x4ec27820, {0x7FFF8000FEDCBA98, 0x80017FFF01020380}}, // ZIP2 V0.2D, V1.2D, V2.2D
+        {0x0e027820, {0x7F80807FFF0001FF, 0x0000000000000000}}, // ZIP2 V0.8B, V1.8B, V2.8B
+        {0x0e427820, {0x7F80807FFF0100FF, 0x0000000000000000}}, // ZIP2 V0.4H, V1.4H, V2.4H
+        {0x0e827820, {0x7F80FF01807F00FF, 0x0000000000000000}}, // ZIP2 V0.2S, V1.2S, V2.2S
+        {0x4e021820, {0xFF00DC987FFF3478, 0x01FF02808001FE04}}, // UZP1 V0.16B, V1.16B, V2.16B
+        {0x4e421820, {0x8000BA9800FF5678, 0x7FFF0380FF010304}}, // UZP1 V0.8H, V1.8H, V2.8H
+        {0x4e821820, {0xFEDCBA9812345678, 0x01020380FDFE0304}}, // UZP1 V0.4S, V1.4S, V2.4S
+        {0x4ec21820, {0x807F00FF12345678, 0x7F80FF01FDFE0304}}, // UZP1 V0.2D, V1.2D, V2.2D
+        {0x0e021820, {0x8001FE047FFF3478, 0x0000000000000000}}, // UZP1 V0.8B, V1.8B, V2.8B
+        {0x0e421820, {0xFF01030400FF5678, 0x0000000000000000}}, // UZP1 V0.4H, V1.4H, V2.4H
+        {0x0e821820, {0xFDFE030412345678, 0x0000000000000000}}, // UZP1 V0.2S, V1.2S, V2.2S
+        {0x4e025820, {0x7F80FEBA80001256, 0x807F01037FFFFD03}}, // UZP2 V0.16B, V1.16B, V2.16B
+        {0x4e425820, {0x7FFFFEDC807F1234, 0x800101027F80FDFE}}, // UZP2 V0.8H, V1.8H, V2.8H
+        {0x4e825820, {0x7FFF8000807F00FF, 0x80017FFF7F80FF01}}, // UZP2 V0.4S, V1.4S, V2.4S
+        {0x4ec25820, {0x7FFF8000FEDCBA98, 0x80017FFF01020380}}, // UZP2 V0.2D, V1.2D, V2.2D
+        {0x0e025820, {0x7FFFFD0380001256, 0x0000000000000000}}, // UZP2 V0.8B, V1.8B, V2.8B
+        {0x0e425820, {0x7F80FDFE807F1234, 0x0000000000000000}}, // UZP2 V0.4H, V1.4H, V2.4H
+        {0x0e825820, {0x7F80FF01807F00FF, 0x0000000000000000}}, // UZP2 V0.2S, V1.2S, V2.2S
+        {0x4e022820, {0x807F01FFFE340478, 0x01FFFF0002DC8098}}, // TRN1 V0.16B, V1.16B, V2.16B
+        {0x4e422820, {0xFF0100FF03045678, 0x7FFF80000380BA98}}, // TRN1 V0.8H, V1.8H, V2.8H
+        {0x4e822820, {0xFDFE030412345678, 0x01020380FEDCBA98}}, // TRN1 V0.4S, V1.4S, V2.4S
+        {0x4ec22820, {0x807F00FF12345678, 0x7F80FF01FDFE0304}}, // TRN1 V0.2D, V1.2D, V2.2D
+        {0x0e022820, {0x807F01FFFE340478, 0x0000000000000000}}, // TRN1 V0.8B, V1.8B, V2.8B
+        {0x0e422820, {0xFF0100FF03045678, 0x0000000000000000}}, // TRN1 V0.4H, V1.4H, V2.4H
+        {0x0e822820, {0xFDFE030412345678, 0x0000000000000000}}, // TRN1 V0.2S, V1.2S, V2.2S
+        {0x4e026820, {0x7F80FF00FD120356, 0x807F7F8001FE03BA}}, // TRN2 V0.16B, V1.16B, V2.16B
+        {0x4e426820, {0x7F80807FFDFE1234, 0x80017FFF0102FEDC}}, // TRN2 V0.8H, V1.8H, V2.8H
+        {0x4e826820, {0x7F80FF01807F00FF, 0x80017FFF7FFF8000}}, // TRN2 V0.4S, V1.4S, V2.4S
+        {0x4ec26820, {0x7FFF8000FEDCBA98, 0x80017FFF01020380}}, // TRN2 V0.2D, V1.2D, V2.2D
+        {0x0e026820, {0x7F80FF00FD120356, 0x0000000000000000}}, // TRN2 V0.8B, V1.8B, V2.8B
+        {0x0e426820, {0x7F80807FFDFE1234, 0x0000000000000000}}, // TRN2 V0.4H, V1.4H, V2.4H
+        {0x0e826820, {0x7F80FF01807F00FF, 0x0000000000000000}}, // TRN2 V0.2S, V1.2S, V2.2S
+        {0x6e020020, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}}, // EXT V0.16B, V1.16B, V2.16B, #0
+        {0x6e020820, {0x98807F00FF123456, 0x047FFF8000FEDCBA}}, // EXT V0.16B, V1.16B, V2.16B, #1
+        {0x6e024020, {0x7FFF8000FEDCBA98, 0x7F80FF01FDFE0304}}, // EXT V0.16B, V1.16B, V2.16B, #8
+        {0x6e027820, {0x80FF01FDFE03047F, 0x017FFF010203807F}}, // EXT V0.16B, V1.16B, V2.16B, #15
+        {0x2e020020, {0x807F00FF12345678, 0x0000000000000000}}, // EXT V0.8B, V1.8B, V2.8B, #0
+        {0x2e021820, {0xFE0304807F00FF12, 0x0000000000000000}}, // EXT V0.8B, V1.8B, V2.8B, #3
+        {0x2e023820, {0x80FF01FDFE030480, 0x0000000000000000}}, // EXT V0.8B, V1.8B, V2.8B, #7
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(1, {0x807F00FF12345678, 0x7FFF8000FEDCBA98});
+        jit.SetVector(2, {0x7F80FF01FDFE0304, 0x80017FFF01020380});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: TBL/TBX", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    // The four-register table wraps around from V31 to V0.
+    const std::vector<TestCase> test_cases {
+        {0x4e0503ca, {0x0000000000AFA5A0, 0xA200000000000000}}, // TBL V10.16B, {V30.16B}, V5.16B
+        {0x4e0523ca, {0x000000BFB0AFA5A0, 0xA20000B100000000}}, // TBL V10.16B, {V30.16B, V31.16B}, V5.16B
+        {0x4e0543ca, {0x00CFC0BFB0AFA5A0, 0xA200C1B100000000}}, // TBL V10.16B, {V30.16B, V31.16B, V0.16B}, V5.16B
+        {0x4e0563ca, {0xD0CFC0BFB0AFA5A0, 0xA2D1C1B1000000DF}}, // TBL V10.16B, {V30.16B, V31.16B, V0.16B, V1.16B}, V5.16B
+        {0x0e0563ca, {0xD0CFC0BFB0AFA5A0, 0x0000000000000000}}, // TBL V10.8B, {V30.16B, V31.16B, V0.16B, V1.16B}, V5.8B
+        {0x4e0513ca, {0x0123456789AFA5A0, 0xA2F0F0F00F0F0F0F}}, // TBX V10.16B, {V30.16B}, V5.16B
+        {0x4e0553ca, {0x01CFC0BFB0AFA5A0, 0xA2F0C1B10F0F0F0F}}, // TBX V10.16B, {V30.16B, V31.16B, V0.16B}, V5.16B
+        {0x0e0533ca, {0x012345BFB0AFA5A0, 0x0000000000000000}}, // TBX V10.8B, {V30.16B, V31.16B}, V5.8B
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(30, {0xA7A6A5A4A3A2A1A0, 0xAFAEADACABAAA9A8});
+        jit.SetVector(31, {0xB7B6B5B4B3B2B1B0, 0xBFBEBDBCBBBAB9B8});
+        jit.SetVector(0, {0xC7C6C5C4C3C2C1C0, 0xCFCECDCCCBCAC9C8});
+        jit.SetVector(1, {0xD7D6D5D4D3D2D1D0, 0xDFDEDDDCDBDAD9D8});
+        jit.SetVector(5, {0x302F201F100F0500, 0x02312111FF80403F});
+        jit.SetVector(10, {0x0123456789ABCDEF, 0xF0F0F0F00F0F0F0F});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(10) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: SIMD reductions", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector input;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    const std::vector<TestCase> test_cases {
+        {0x4e31b820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000003C, 0}}, // ADDV B0, V1.16B
+        {0x4e31b820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000036, 0}}, // ADDV B0, V1.16B
+        {0x4e31b820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000000BA, 0}}, // ADDV B0, V1.16B
+        {0x0e31b820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000000012, 0}}, // ADDV B0, V1.8B
+        {0x0e31b820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000001A, 0}}, // ADDV B0, V1.8B
+        {0x0e31b820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000000DE, 0}}, // ADDV B0, V1.8B
+        {0x4e71b820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000A39D, 0}}, // ADDV H0, V1.8H
+        {0x4e71b820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000008BAC, 0}}, // ADDV H0, V1.8H
+        {0x4e71b820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000744C, 0}}, // ADDV H0, V1.8H
+        {0x0e71b820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000EA2A, 0}}, // ADDV H0, V1.4H
+        {0x0e71b820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000516, 0}}, // ADDV H0, V1.4H
+        {0x0e71b820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000FAE6, 0}}, // ADDV H0, V1.4H
+        {0x4eb1b820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000118F920F, 0}}, // ADDV S0, V1.4S
+        {0x4eb1b820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000073BD17F0, 0}}, // ADDV S0, V1.4S
+        {0x4eb1b820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000008C42E80C, 0}}, // ADDV S0, V1.4S
+        {0x4e303820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000003C, 0}}, // SADDLV H0, V1.16B
+        {0x4e303820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000436, 0}}, // SADDLV H0, V1.16B
+        {0x4e303820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000FBBA, 0}}, // SADDLV H0, V1.16B
+        {0x0e303820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000000112, 0}}, // SADDLV H0, V1.8B
+        {0x0e303820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000021A, 0}}, // SADDLV H0, V1.8B
+        {0x0e303820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000FDDE, 0}}, // SADDLV H0, V1.8B
+        {0x4e703820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000FFFFA39D, 0}}, // SADDLV S0, V1.8H
+        {0x4e703820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000028BAC, 0}}, // SADDLV S0, V1.8H
+        {0x4e703820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000FFFD744C, 0}}, // SADDLV S0, V1.8H
+        {0x0e703820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000FFFFEA2A, 0}}, // SADDLV S0, V1.4H
+        {0x0e703820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000010516, 0}}, // SADDLV S0, V1.4H
+        {0x0e703820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000FFFEFAE6, 0}}, // SADDLV S0, V1.4H
+        {0x4eb03820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000118F920F, 0}}, // SADDLV D0, V1.4S
+        {0x4eb03820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000173BD17F0, 0}}, // SADDLV D0, V1.4S
+        {0x4eb03820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0xFFFFFFFE8C42E80C, 0}}, // SADDLV D0, V1.4S
+        {0x6e303820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000083C, 0}}, // UADDLV H0, V1.16B
+        {0x6e303820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000436, 0}}, // UADDLV H0, V1.16B
+        {0x6e303820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x0000000000000BBA, 0}}, // UADDLV H0, V1.16B
+        {0x2e303820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000000312, 0}}, // UADDLV H0, V1.8B
+        {0x2e303820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000021A, 0}}, // UADDLV H0, V1.8B
+        {0x2e303820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000005DE, 0}}, // UADDLV H0, V1.8B
+        {0x6e703820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000003A39D, 0}}, // UADDLV S0, V1.8H
+        {0x6e703820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000028BAC, 0}}, // UADDLV S0, V1.8H
+        {0x6e703820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000005744C, 0}}, // UADDLV S0, V1.8H
+        {0x2e703820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000EA2A, 0}}, // UADDLV S0, V1.4H
+        {0x2e703820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000010516, 0}}, // UADDLV S0, V1.4H
+        {0x2e703820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000002FAE6, 0}}, // UADDLV S0, V1.4H
+        {0x6eb03820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000002118F920F, 0}}, // UADDLV D0, V1.4S
+        {0x6eb03820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000173BD17F0, 0}}, // UADDLV D0, V1.4S
+        {0x6eb03820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000028C42E80C, 0}}, // UADDLV D0, V1.4S
+        {0x4e30a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000007F, 0}}, // SMAXV B0, V1.16B
+        {0x4e30a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000007C, 0}}, // SMAXV B0, V1.16B
+        {0x4e30a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000000F4, 0}}, // SMAXV B0, V1.16B
+        {0x0e30a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000007F, 0}}, // SMAXV B0, V1.8B
+        {0x0e30a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000071, 0}}, // SMAXV B0, V1.8B
+        {0x0e30a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000000F0, 0}}, // SMAXV B0, V1.8B
+        {0x4e70a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000007FFF, 0}}, // SMAXV H0, V1.8H
+        {0x4e70a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000007C19, 0}}, // SMAXV H0, V1.8H
+        {0x4e70a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000F0E1, 0}}, // SMAXV H0, V1.8H
+        {0x0e70a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000005678, 0}}, // SMAXV H0, V1.4H
+        {0x0e70a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000006B2D, 0}}, // SMAXV H0, V1.4H
+        {0x0e70a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000F0E1, 0}}, // SMAXV H0, V1.4H
+        {0x4eb0a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000007FFF8000, 0}}, // SMAXV S0, V1.4S
+        {0x4eb0a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000006D0B3E48, 0}}, // SMAXV S0, V1.4S
+        {0x4eb0a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000C3A5F0E1, 0}}, // SMAXV S0, V1.4S
+        {0x4e31a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000000080, 0}}, // SMINV B0, V1.16B
+        {0x4e31a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000000B, 0}}, // SMINV B0, V1.16B
+        {0x4e31a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x0000000000000083, 0}}, // SMINV B0, V1.16B
+        {0x0e31a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000000080, 0}}, // SMINV B0, V1.8B
+        {0x0e31a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000000F, 0}}, // SMINV B0, V1.8B
+        {0x0e31a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000008E, 0}}, // SMINV B0, V1.8B
+        {0x4e71a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000008000, 0}}, // SMINV H0, V1.8H
+        {0x4e71a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000F1E, 0}}, // SMINV H0, V1.8H
+        {0x4e71a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000083E6, 0}}, // SMINV H0, V1.8H
+        {0x0e71a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000807F, 0}}, // SMINV H0, V1.4H
+        {0x0e71a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000F1E, 0}}, // SMINV H0, V1.4H
+        {0x0e71a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000094D2, 0}}, // SMINV H0, V1.4H
+        {0x4eb1a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000807F00FF, 0}}, // SMINV S0, V1.4S
+        {0x4eb1a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000003C5A0F1E, 0}}, // SMINV S0, V1.4S
+        {0x4eb1a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x0000000092F4C1B7, 0}}, // SMINV S0, V1.4S
+        {0x6e30a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000000000FF, 0}}, // UMAXV B0, V1.16B
+        {0x6e30a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000007C, 0}}, // UMAXV B0, V1.16B
+        {0x6e30a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000000F4, 0}}, // UMAXV B0, V1.16B
+        {0x2e30a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000000000FF, 0}}, // UMAXV B0, V1.8B
+        {0x2e30a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000071, 0}}, // UMAXV B0, V1.8B
+        {0x2e30a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000000F0, 0}}, // UMAXV B0, V1.8B
+        {0x6e70a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000FEDC, 0}}, // UMAXV H0, V1.8H
+        {0x6e70a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000007C19, 0}}, // UMAXV H0, V1.8H
+        {0x6e70a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000F0E1, 0}}, // UMAXV H0, V1.8H
+        {0x2e70a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x000000000000807F, 0}}, // UMAXV H0, V1.4H
+        {0x2e70a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000006B2D, 0}}, // UMAXV H0, V1.4H
+        {0x2e70a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000F0E1, 0}}, // UMAXV H0, V1.4H
+        {0x6eb0a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000FEDCBA98, 0}}, // UMAXV S0, V1.4S
+        {0x6eb0a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000006D0B3E48, 0}}, // UMAXV S0, V1.4S
+        {0x6eb0a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000C3A5F0E1, 0}}, // UMAXV S0, V1.4S
+        {0x6e31a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000000000, 0}}, // UMINV B0, V1.16B
+        {0x6e31a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000000B, 0}}, // UMINV B0, V1.16B
+        {0x6e31a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x0000000000000083, 0}}, // UMINV B0, V1.16B
+        {0x2e31a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000000000000, 0}}, // UMINV B0, V1.8B
+        {0x2e31a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000000000000F, 0}}, // UMINV B0, V1.8B
+        {0x2e31a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x000000000000008E, 0}}, // UMINV B0, V1.8B
+        {0x6e71a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000000000FF, 0}}, // UMINV H0, V1.8H
+        {0x6e71a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000F1E, 0}}, // UMINV H0, V1.8H
+        {0x6e71a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000083E6, 0}}, // UMINV H0, V1.8H
+        {0x2e71a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x00000000000000FF, 0}}, // UMINV H0, V1.4H
+        {0x2e71a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x0000000000000F1E, 0}}, // UMINV H0, V1.4H
+        {0x2e71a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x00000000000094D2, 0}}, // UMINV H0, V1.4H
+        {0x6eb1a820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x0000000012345678, 0}}, // UMINV S0, V1.4S
+        {0x6eb1a820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x000000003C5A0F1E, 0}}, // UMINV S0, V1.4S
+        {0x6eb1a820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x0000000092F4C1B7, 0}}, // UMINV S0, V1.4S
+        {0x5ef1b820, {0x807F00FF12345678, 0x7FFF8000FEDCBA98}, {0x007E810011111110, 0}}, // ADDP D0, V1.2D
+        {0x5ef1b820, {0x3C5A0F1E6B2D4E71, 0x5F2A7C196D0B3E48}, {0x9B848B37D8388CB9, 0}}, // ADDP D0, V1.2D
+        {0x5ef1b820, {0xC3A5F0E194D2B18E, 0xA0D583E692F4C1B7}, {0x647B74C827C77345, 0}}, // ADDP D0, V1.2D
+        {0x6e30f820, {0xC00000003F800000, 0x3F00000040600000}, {0x0000000040600000, 0}}, // FMAXV S0, V1.4S
+        {0x6e30f820, {0x8000000000000000, 0x0000000080000000}, {0x0000000000000000, 0}}, // FMAXV S0, V1.4S
+        {0x6e30f820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000007FC00001, 0}}, // FMAXV S0, V1.4S
+        {0x6e30f820, {0x3F8000007F800001, 0x4040000040000000}, {0x000000007FC00001, 0}}, // FMAXV S0, V1.4S
+        {0x6e30f820, {0x0000000080000000, 0xC10000007FC00002}, {0x000000007FC00002, 0}}, // FMAXV S0, V1.4S
+        {0x6eb0f820, {0xC00000003F800000, 0x3F00000040600000}, {0x00000000C0000000, 0}}, // FMINV S0, V1.4S
+        {0x6eb0f820, {0x8000000000000000, 0x0000000080000000}, {0x0000000080000000, 0}}, // FMINV S0, V1.4S
+        {0x6eb0f820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000007FC00001, 0}}, // FMINV S0, V1.4S
+        {0x6eb0f820, {0x3F8000007F800001, 0x4040000040000000}, {0x000000007FC00001, 0}}, // FMINV S0, V1.4S
+        {0x6eb0f820, {0x0000000080000000, 0xC10000007FC00002}, {0x000000007FC00002, 0}}, // FMINV S0, V1.4S
+        {0x6e30c820, {0xC00000003F800000, 0x3F00000040600000}, {0x0000000040600000, 0}}, // FMAXNMV S0, V1.4S
+        {0x6e30c820, {0x8000000000000000, 0x0000000080000000}, {0x0000000000000000, 0}}, // FMAXNMV S0, V1.4S
+        {0x6e30c820, {0x7FC000013F800000, 0x3E80000040000000}, {0x0000000040000000, 0}}, // FMAXNMV S0, V1.4S
+        {0x6e30c820, {0x3F8000007F800001, 0x4040000040000000}, {0x0000000040400000, 0}}, // FMAXNMV S0, V1.4S
+        {0x6e30c820, {0x0000000080000000, 0xC10000007FC00002}, {0x0000000000000000, 0}}, // FMAXNMV S0, V1.4S
+        {0x6eb0c820, {0xC00000003F800000, 0x3F00000040600000}, {0x00000000C0000000, 0}}, // FMINNMV S0, V1.4S
+        {0x6eb0c820, {0x8000000000000000, 0x0000000080000000}, {0x0000000080000000, 0}}, // FMINNMV S0, V1.4S
+        {0x6eb0c820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000003E800000, 0}}, // FMINNMV S0, V1.4S
+        {0x6eb0c820, {0x3F8000007F800001, 0x4040000040000000}, {0x0000000040000000, 0}}, // FMINNMV S0, V1.4S
+        {0x6eb0c820, {0x0000000080000000, 0xC10000007FC00002}, {0x00000000C1000000, 0}}, // FMINNMV S0, V1.4S
+        {0x7e30d820, {0x8000000000000000, 0x0000000080000000}, {0x0000000000000000, 0}}, // FADDP S0, V1.2S
+        {0x7e30d820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000007FC00001, 0}}, // FADDP S0, V1.2S
+        {0x7e30d820, {0x3F8000007F800001, 0x4040000040000000}, {0x000000007FC00001, 0}}, // FADDP S0, V1.2S
+        {0x7e70d820, {0x3FF8000000000000, 0x7FF8000000000001}, {0x7FF8000000000001, 0}}, // FADDP D0, V1.2D
+        {0x7e70d820, {0xC008000000000000, 0x4002000000000000}, {0xBFE8000000000000, 0}}, // FADDP D0, V1.2D
+        {0x7e70d820, {0x0000000000000000, 0x8000000000000000}, {0x0000000000000000, 0}}, // FADDP D0, V1.2D
+        {0x7e30f820, {0x8000000000000000, 0x0000000080000000}, {0x0000000000000000, 0}}, // FMAXP S0, V1.2S
+        {0x7e30f820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000007FC00001, 0}}, // FMAXP S0, V1.2S
+        {0x7e30f820, {0x3F8000007F800001, 0x4040000040000000}, {0x000000007FC00001, 0}}, // FMAXP S0, V1.2S
+        {0x7e70f820, {0x3FF8000000000000, 0x7FF8000000000001}, {0x7FF8000000000001, 0}}, // FMAXP D0, V1.2D
+        {0x7e70f820, {0xC008000000000000, 0x4002000000000000}, {0x4002000000000000, 0}}, // FMAXP D0, V1.2D
+        {0x7e70f820, {0x0000000000000000, 0x8000000000000000}, {0x0000000000000000, 0}}, // FMAXP D0, V1.2D
+        {0x7eb0f820, {0x8000000000000000, 0x0000000080000000}, {0x0000000080000000, 0}}, // FMINP S0, V1.2S
+        {0x7eb0f820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000007FC00001, 0}}, // FMINP S0, V1.2S
+        {0x7eb0f820, {0x3F8000007F800001, 0x4040000040000000}, {0x000000007FC00001, 0}}, // FMINP S0, V1.2S
+        {0x7ef0f820, {0x3FF8000000000000, 0x7FF8000000000001}, {0x7FF8000000000001, 0}}, // FMINP D0, V1.2D
+        {0x7ef0f820, {0xC008000000000000, 0x4002000000000000}, {0xC008000000000000, 0}}, // FMINP D0, V1.2D
+        {0x7ef0f820, {0x0000000000000000, 0x8000000000000000}, {0x8000000000000000, 0}}, // FMINP D0, V1.2D
+        {0x7e30c820, {0x8000000000000000, 0x0000000080000000}, {0x0000000000000000, 0}}, // FMAXNMP S0, V1.2S
+        {0x7e30c820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000003F800000, 0}}, // FMAXNMP S0, V1.2S
+        {0x7e30c820, {0x3F8000007F800001, 0x4040000040000000}, {0x000000007FC00001, 0}}, // FMAXNMP S0, V1.2S
+        {0x7e70c820, {0x3FF8000000000000, 0x7FF8000000000001}, {0x3FF8000000000000, 0}}, // FMAXNMP D0, V1.2D
+        {0x7e70c820, {0xC008000000000000, 0x4002000000000000}, {0x4002000000000000, 0}}, // FMAXNMP D0, V1.2D
+        {0x7e70c820, {0x0000000000000000, 0x8000000000000000}, {0x0000000000000000, 0}}, // FMAXNMP D0, V1.2D
+        {0x7eb0c820, {0x8000000000000000, 0x0000000080000000}, {0x0000000080000000, 0}}, // FMINNMP S0, V1.2S
+        {0x7eb0c820, {0x7FC000013F800000, 0x3E80000040000000}, {0x000000003F800000, 0}}, // FMINNMP S0, V1.2S
+        {0x7eb0c820, {0x3F8000007F800001, 0x4040000040000000}, {0x000000007FC00001, 0}}, // FMINNMP S0, V1.2S
+        {0x7ef0c820, {0x3FF8000000000000, 0x7FF8000000000001}, {0x3FF8000000000000, 0}}, // FMINNMP D0, V1.2D
+        {0x7ef0c820, {0xC008000000000000, 0x4002000000000000}, {0xC008000000000000, 0}}, // FMINNMP D0, V1.2D
+        {0x7ef0c820, {0x0000000000000000, 0x8000000000000000}, {0x8000000000000000, 0}}, // FMINNMP D0, V1.2D
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(0, {0xDEADBEEFDEADBEEF, 0xDEADBEEFDEADBEEF});
+        jit.SetVector(1, test_case.input);
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: SIMD shift by immediate, widen and narrow", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    // The operand is V1; V0 holds the accumulator for SSRA and friends, the destination for SLI and SRI, and the lower half kept by the narrowing *2 forms.
+    const std::vector<TestCase> test_cases {
+        {0x4f0d0420, {0xF00F00FF02060A0F, 0x0FFFF000FFFBF7F3}}, // SSHR V0.16B, V1.16B, #3
+        {0x4f170420, {0xFFC000000009002B, 0x003FFFC0FFFFFFDD}}, // SSHR V0.8H, V1.8H, #9
+        {0x4f2f0420, {0xFFFFC03F0000091A, 0x00003FFFFFFFFF6E}}, // SSHR V0.4S, V1.4S, #17
+        {0x4f5f0420, {0xFFFFFFFFC03F807F, 0x000000003FFFC000}}, // SSHR V0.2D, V1.2D, #33
+        {0x0f080420, {0xFF0000FF00000000, 0x0000000000000000}}, // SSHR V0.8B, V1.8B, #8
+        {0x0f100420, {0xFFFF000000000000, 0x0000000000000000}}, // SSHR V0.4H, V1.4H, #16
+        {0x4f400420, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // SSHR V0.2D, V1.2D, #64
+        {0x6f0d0420, {0x100F001F02060A0F, 0x0F1F10001F1B1713}}, // USHR V0.16B, V1.16B, #3
+        {0x6f170420, {0x004000000009002B, 0x003F0040007F005D}}, // USHR V0.8H, V1.8H, #9
+        {0x6f2f0420, {0x0000403F0000091A, 0x00003FFF00007F6E}}, // USHR V0.4S, V1.4S, #17
+        {0x6f5f0420, {0x00000000403F807F, 0x000000003FFFC000}}, // USHR V0.2D, V1.2D, #33
+        {0x2f080420, {0x0000000000000000, 0x0000000000000000}}, // USHR V0.8B, V1.8B, #8
+        {0x2f100420, {0x0000000000000000, 0x0000000000000000}}, // USHR V0.4H, V1.4H, #16
+        {0x6f400420, {0x0000000000000000, 0x0000000000000000}}, // USHR V0.2D, V1.2D, #64
+        {0x4f0d2420, {0xF010000002070B0F, 0x1000F00000FCF7F3}}, // SRSHR V0.16B, V1.16B, #3
+        {0x4f172420, {0xFFC000000009002B, 0x0040FFC0FFFFFFDD}}, // SRSHR V0.8H, V1.8H, #9
+        {0x4f2f2420, {0xFFFFC0400000091A, 0x00004000FFFFFF6E}}, // SRSHR V0.4S, V1.4S, #17
+        {0x4f5f2420, {0xFFFFFFFFC03F8080, 0x000000003FFFC000}}, // SRSHR V0.2D, V1.2D, #33
+        {0x0f082420, {0x0000000000000000, 0x0000000000000000}}, // SRSHR V0.8B, V1.8B, #8
+        {0x0f102420, {0x0000000000000000, 0x0000000000000000}}, // SRSHR V0.4H, V1.4H, #16
+        {0x4f402420, {0x0000000000000000, 0x0000000000000000}}, // SRSHR V0.2D, V1.2D, #64
+        {0x6f0d2420, {0x1010002002070B0F, 0x10201000201C1713}}, // URSHR V0.16B, V1.16B, #3
+        {0x6f172420, {0x004000000009002B, 0x00400040007F005D}}, // URSHR V0.8H, V1.8H, #9
+        {0x6f2f2420, {0x000040400000091A, 0x0000400000007F6E}}, // URSHR V0.4S, V1.4S, #17
+        {0x6f5f2420, {0x00000000403F8080, 0x000000003FFFC000}}, // URSHR V0.2D, V1.2D, #33
+        {0x2f082420, {0x0100000100000000, 0x0000000000000000}}, // URSHR V0.8B, V1.8B, #8
+        {0x2f102420, {0x0001000000000000, 0x0000000000000000}}, // URSHR V0.4H, V1.4H, #16
+        {0x6f402420, {0x0000000000000001, 0x0000000000000000}}, // URSHR V0.2D, V1.2D, #64
+        {0x4f0d1420, {0xF13245668BB1D7FE, 0xFFEFE0F00E0A0602}}, // SSRA V0.16B, V1.16B, #3
+        {0x4f171420, {0x00E3456789B4CE1A, 0xF12FF0B00F0E0EEC}}, // SSRA V0.8H, V1.8H, #9
+        {0x4f2f1420, {0x012305A689ABD709, 0xF0F130EF0F0F0E7D}}, // SSRA V0.4S, V1.4S, #17
+        {0x4f5f1420, {0x0123456749EB4E6E, 0xF0F0F0F04F0ECF0F}}, // SSRA V0.2D, V1.2D, #33
+        {0x0f081420, {0x0023456689ABCDEF, 0x0000000000000000}}, // SSRA V0.8B, V1.8B, #8
+        {0x0f101420, {0x0122456789ABCDEF, 0x0000000000000000}}, // SSRA V0.4H, V1.4H, #16
+        {0x4f401420, {0x0123456789ABCDEE, 0xF0F0F0F00F0F0F0F}}, // SSRA V0.2D, V1.2D, #64
+        {0x6f0d1420, {0x113245868BB1D7FE, 0xFF0F00F02E2A2622}}, // USRA V0.16B, V1.16B, #3
+        {0x6f171420, {0x0163456789B4CE1A, 0xF12FF1300F8E0F6C}}, // USRA V0.8H, V1.8H, #9
+        {0x6f2f1420, {0x012385A689ABD709, 0xF0F130EF0F0F8E7D}}, // USRA V0.4S, V1.4S, #17
+        {0x6f5f1420, {0x01234567C9EB4E6E, 0xF0F0F0F04F0ECF0F}}, // USRA V0.2D, V1.2D, #33
+        {0x2f081420, {0x0123456789ABCDEF, 0x0000000000000000}}, // USRA V0.8B, V1.8B, #8
+        {0x2f101420, {0x0123456789ABCDEF, 0x0000000000000000}}, // USRA V0.4H, V1.4H, #16
+        {0x6f401420, {0x0123456789ABCDEF, 0xF0F0F0F00F0F0F0F}}, // USRA V0.2D, V1.2D, #64
+        {0x4f0d3420, {0xF13345678BB2D8FE, 0x00F0E0F00F0B0602}}, // SRSRA V0.16B, V1.16B, #3
+        {0x4f173420, {0x00E3456789B4CE1A, 0xF130F0B00F0E0EEC}}, // SRSRA V0.8H, V1.8H, #9
+        {0x4f2f3420, {0x012305A789ABD709, 0xF0F130F00F0F0E7D}}, // SRSRA V0.4S, V1.4S, #17
+        {0x4f5f3420, {0x0123456749EB4E6F, 0xF0F0F0F04F0ECF0F}}, // SRSRA V0.2D, V1.2D, #33
+        {0x0f083420, {0x0123456789ABCDEF, 0x0000000000000000}}, // SRSRA V0.8B, V1.8B, #8
+        {0x0f103420, {0x0123456789ABCDEF, 0x0000000000000000}}, // SRSRA V0.4H, V1.4H, #16
+        {0x4f403420, {0x0123456789ABCDEF, 0xF0F0F0F00F0F0F0F}}, // SRSRA V0.2D, V1.2D, #64
+        {0x6f0d3420, {0x113345878BB2D8FE, 0x001000F02F2B2622}}, // URSRA V0.16B, V1.16B, #3
+        {0x6f173420, {0x0163456789B4CE1A, 0xF130F1300F8E0F6C}}, // URSRA V0.8H, V1.8H, #9
+        {0x6f2f3420, {0x012385A789ABD709, 0xF0F130F00F0F8E7D}}, // URSRA V0.4S, V1.4S, #17
+        {0x6f5f3420, {0x01234567C9EB4E6F, 0xF0F0F0F04F0ECF0F}}, // URSRA V0.2D, V1.2D, #33
+        {0x2f083420, {0x0223456889ABCDEF, 0x0000000000000000}}, // URSRA V0.8B, V1.8B, #8
+        {0x2f103420, {0x0124456789ABCDEF, 0x0000000000000000}}, // URSRA V0.4H, V1.4H, #16
+        {0x6f403420, {0x0123456789ABCDF0, 0xF0F0F0F00F0F0F0F}}, // URSRA V0.2D, V1.2D, #64
+        {0x6f0d4420, {0x102F407F82A6CAEF, 0xEFFFF0E01F1B1713}}, // SRI V0.16B, V1.16B, #3
+        {0x6f174420, {0x014045008989CDAB, 0xF0BFF0C00F7F0F5D}}, // SRI V0.8H, V1.8H, #9
+        {0x6f2f4420, {0x0123403F89AB891A, 0xF0F0BFFF0F0F7F6E}}, // SRI V0.4S, V1.4S, #17
+        {0x6f5f4420, {0x01234567C03F807F, 0xF0F0F0F03FFFC000}}, // SRI V0.2D, V1.2D, #33
+        {0x2f084420, {0x0123456789ABCDEF, 0x0000000000000000}}, // SRI V0.8B, V1.8B, #8
+        {0x2f104420, {0x0123456789ABCDEF, 0x0000000000000000}}, // SRI V0.4H, V1.4H, #16
+        {0x6f404420, {0x0123456789ABCDEF, 0xF0F0F0F00F0F0F0F}}, // SRI V0.2D, V1.2D, #64
+        {0x4f0b5420, {0x00F800F890A0B0C0, 0xF8F80000F0E0D0C0}}, // SHL V0.16B, V1.16B, #3
+        {0x4f195420, {0xFE00FE006800F000, 0xFE000000B8003000}}, // SHL V0.8H, V1.8H, #9
+        {0x4f315420, {0x01FE0000ACF00000, 0x0000000075300000}}, // SHL V0.4S, V1.4S, #17
+        {0x4f615420, {0x2468ACF000000000, 0xFDB9753000000000}}, // SHL V0.2D, V1.2D, #33
+        {0x0f085420, {0x807F00FF12345678, 0x0000000000000000}}, // SHL V0.8B, V1.8B, #0
+        {0x0f3f5420, {0x8000000000000000, 0x0000000000000000}}, // SHL V0.2S, V1.2S, #31
+        {0x6f0b5420, {0x01FB05FF91A3B5C7, 0xF8F80000F7E7D7C7}}, // SLI V0.16B, V1.16B, #3
+        {0x6f195420, {0xFF23FF6769ABF1EF, 0xFEF000F0B90F310F}}, // SLI V0.8H, V1.8H, #9
+        {0x6f315420, {0x01FF4567ACF1CDEF, 0x0000F0F075310F0F}}, // SLI V0.4S, V1.4S, #17
+        {0x6f615420, {0x2468ACF189ABCDEF, 0xFDB975300F0F0F0F}}, // SLI V0.2D, V1.2D, #33
+        {0x2f085420, {0x807F00FF12345678, 0x0000000000000000}}, // SLI V0.8B, V1.8B, #0
+        {0x2f3f5420, {0x8123456709ABCDEF, 0x0000000000000000}}, // SLI V0.2S, V1.2S, #31
+        {0x0f0d8420, {0xFF00DB530F1F46CF, 0x0000000000000000}}, // SHRN V0.8B, V1.8H, #3
+        {0x4f088420, {0x0123456789ABCDEF, 0x7F80FEBA80001256}}, // SHRN2 V0.16B, V1.8H, #8
+        {0x0f1f8420, {0xC0005D4C807F2B3C, 0x0000000000000000}}, // SHRN V0.4H, V1.4S, #1
+        {0x4f108420, {0x0123456789ABCDEF, 0x7FFFFEDC807F1234}}, // SHRN2 V0.8H, V1.4S, #16
+        {0x0f398420, {0x01FDB975FE2468AC, 0x0000000000000000}}, // SHRN V0.2S, V1.2D, #7
+        {0x4f208420, {0x0123456789ABCDEF, 0x7FFF8000807F00FF}}, // SHRN2 V0.4S, V1.2D, #32
+        {0x0f0d8c20, {0x0000DC53102047CF, 0x0000000000000000}}, // RSHRN V0.8B, V1.8H, #3
+        {0x4f088c20, {0x0123456789ABCDEF, 0x8080FFBB80011256}}, // RSHRN2 V0.16B, V1.8H, #8
+        {0x0f1f8c20, {0xC0005D4C80802B3C, 0x0000000000000000}}, // RSHRN V0.4H, V1.4S, #1
+        {0x4f108c20, {0x0123456789ABCDEF, 0x8000FEDD807F1234}}, // RSHRN2 V0.8H, V1.4S, #16
+        {0x0f398c20, {0x01FDB975FE2468AD, 0x0000000000000000}}, // RSHRN V0.2S, V1.2D, #7
+        {0x4f208c20, {0x0123456789ABCDEF, 0x7FFF8001807F00FF}}, // RSHRN2 V0.4S, V1.2D, #32
+        {0x0f0d9420, {0x7F80DB80801F7F7F, 0x0000000000000000}}, // SQSHRN V0.8B, V1.8H, #3
+        {0x4f089420, {0x0123456789ABCDEF, 0x7F80FEBA80001256}}, // SQSHRN2 V0.16B, V1.8H, #8
+        {0x0f1f9420, {0x7FFF800080007FFF, 0x0000000000000000}}, // SQSHRN V0.4H, V1.4S, #1
+        {0x4f109420, {0x0123456789ABCDEF, 0x7FFFFEDC807F1234}}, // SQSHRN2 V0.8H, V1.4S, #16
+        {0x0f399420, {0x7FFFFFFF80000000, 0x0000000000000000}}, // SQSHRN V0.2S, V1.2D, #7
+        {0x4f209420, {0x0123456789ABCDEF, 0x7FFF8000807F00FF}}, // SQSHRN2 V0.4S, V1.2D, #32
+        {0x0f0d9c20, {0x7F80DC8080207F7F, 0x0000000000000000}}, // SQRSHRN V0.8B, V1.8H, #3
+        {0x4f089c20, {0x0123456789ABCDEF, 0x7F80FFBB80011256}}, // SQRSHRN2 V0.16B, V1.8H, #8
+        {0x0f1f9c20, {0x7FFF800080007FFF, 0x0000000000000000}}, // SQRSHRN V0.4H, V1.4S, #1
+        {0x4f109c20, {0x0123456789ABCDEF, 0x7FFFFEDD807F1234}}, // SQRSHRN2 V0.8H, V1.4S, #16
+        {0x0f399c20, {0x7FFFFFFF80000000, 0x0000000000000000}}, // SQRSHRN V0.2S, V1.2D, #7
+        {0x4f209c20, {0x0123456789ABCDEF, 0x7FFF8001807F00FF}}, // SQRSHRN2 V0.4S, V1.2D, #32
+        {0x2f0d8420, {0xFF000000001FFFFF, 0x0000000000000000}}, // SQSHRUN V0.8B, V1.8H, #3
+        {0x6f088420, {0x0123456789ABCDEF, 0x7F00000000001256}}, // SQSHRUN2 V0.16B, V1.8H, #8
+        {0x2f1f8420, {0xFFFF00000000FFFF, 0x0000000000000000}}, // SQSHRUN V0.4H, V1.4S, #1
+        {0x6f108420, {0x0123456789ABCDEF, 0x7FFF000000001234}}, // SQSHRUN2 V0.8H, V1.4S, #16
+        {0x2f398420, {0xFFFFFFFF00000000, 0x0000000000000000}}, // SQSHRUN V0.2S, V1.2D, #7
+        {0x6f208420, {0x0123456789ABCDEF, 0x7FFF800000000000}}, // SQSHRUN2 V0.4S, V1.2D, #32
+        {0x2f0d8c20, {0xFF0000000020FFFF, 0x0000000000000000}}, // SQRSHRUN V0.8B, V1.8H, #3
+        {0x6f088c20, {0x0123456789ABCDEF, 0x8000000000011256}}, // SQRSHRUN2 V0.16B, V1.8H, #8
+        {0x2f1f8c20, {0xFFFF00000000FFFF, 0x0000000000000000}}, // SQRSHRUN V0.4H, V1.4S, #1
+        {0x6f108c20, {0x0123456789ABCDEF, 0x8000000000001234}}, // SQRSHRUN2 V0.8H, V1.4S, #16
+        {0x2f398c20, {0xFFFFFFFF00000000, 0x0000000000000000}}, // SQRSHRUN V0.2S, V1.2D, #7
+        {0x6f208c20, {0x0123456789ABCDEF, 0x7FFF800100000000}}, // SQRSHRUN2 V0.4S, V1.2D, #32
+        {0x2f0d9420, {0xFFFFFFFFFF1FFFFF, 0x0000000000000000}}, // UQSHRN V0.8B, V1.8H, #3
+        {0x6f089420, {0x0123456789ABCDEF, 0x7F80FEBA80001256}}, // UQSHRN2 V0.16B, V1.8H, #8
+        {0x2f1f9420, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // UQSHRN V0.4H, V1.4S, #1
+        {0x6f109420, {0x0123456789ABCDEF, 0x7FFFFEDC807F1234}}, // UQSHRN2 V0.8H, V1.4S, #16
+        {0x2f399420, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // UQSHRN V0.2S, V1.2D, #7
+        {0x6f209420, {0x0123456789ABCDEF, 0x7FFF8000807F00FF}}, // UQSHRN2 V0.4S, V1.2D, #32
+        {0x2f0d9c20, {0xFFFFFFFFFF20FFFF, 0x0000000000000000}}, // UQRSHRN V0.8B, V1.8H, #3
+        {0x6f089c20, {0x0123456789ABCDEF, 0x8080FFBB80011256}}, // UQRSHRN2 V0.16B, V1.8H, #8
+        {0x2f1f9c20, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // UQRSHRN V0.4H, V1.4S, #1
+        {0x6f109c20, {0x0123456789ABCDEF, 0x8000FEDD807F1234}}, // UQRSHRN2 V0.8H, V1.4S, #16
+        {0x2f399c20, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // UQRSHRN V0.2S, V1.2D, #7
+        {0x6f209c20, {0x0123456789ABCDEF, 0x7FFF8001807F00FF}}, // UQRSHRN2 V0.4S, V1.2D, #32
+        {0x0f08a420, {0x0012003400560078, 0xFF80007F0000FFFF}}, // SSHLL V0.8H, V1.8B, #0
+        {0x4f0fa420, {0xFF00EE00DD00CC00, 0x3F80FF80C0000000}}, // SSHLL2 V0.8H, V1.16B, #7
+        {0x0f13a420, {0x000091A00002B3C0, 0xFFFC03F8000007F8}}, // SSHLL V0.4S, V1.4H, #3
+        {0x4f1fa420, {0xFF6E0000DD4C0000, 0x3FFF8000C0000000}}, // SSHLL2 V0.4S, V1.8H, #15
+        {0x0f20a420, {0x0000000012345678, 0xFFFFFFFF807F00FF}}, // SSHLL V0.2D, V1.2S, #0
+        {0x4f3fa420, {0xFF6E5D4C00000000, 0x3FFFC00000000000}}, // SSHLL2 V0.2D, V1.4S, #31
+        {0x2f08a420, {0x0012003400560078, 0x0080007F000000FF}}, // USHLL V0.8H, V1.8B, #0
+        {0x6f0fa420, {0x7F006E005D004C00, 0x3F807F8040000000}}, // USHLL2 V0.8H, V1.16B, #7
+        {0x2f13a420, {0x000091A00002B3C0, 0x000403F8000007F8}}, // USHLL V0.4S, V1.4H, #3
+        {0x6f1fa420, {0x7F6E00005D4C0000, 0x3FFF800040000000}}, // USHLL2 V0.4S, V1.8H, #15
+        {0x2f20a420, {0x0000000012345678, 0x00000000807F00FF}}, // USHLL V0.2D, V1.2S, #0
+        {0x6f3fa420, {0x7F6E5D4C00000000, 0x3FFFC00000000000}}, // USHLL2 V0.2D, V1.4S, #31
+        {0x0e212820, {0xFF00DC987FFF3478, 0x0000000000000000}}, // XTN V0.8B, V1.8H
+        {0x4e212820, {0x0123456789ABCDEF, 0xFF00DC987FFF3478}}, // XTN2 V0.16B, V1.8H
+        {0x0e612820, {0x8000BA9800FF5678, 0x0000000000000000}}, // XTN V0.4H, V1.4S
+        {0x4e612820, {0x0123456789ABCDEF, 0x8000BA9800FF5678}}, // XTN2 V0.8H, V1.4S
+        {0x0ea12820, {0xFEDCBA9812345678, 0x0000000000000000}}, // XTN V0.2S, V1.2D
+        {0x4ea12820, {0x0123456789ABCDEF, 0xFEDCBA9812345678}}, // XTN2 V0.4S, V1.2D
+        {0x0e214820, {0x7F808080807F7F7F, 0x0000000000000000}}, // SQXTN V0.8B, V1.8H
+        {0x4e214820, {0x0123456789ABCDEF, 0x7F808080807F7F7F}}, // SQXTN2 V0.16B, V1.8H
+        {0x0e614820, {0x7FFF800080007FFF, 0x0000000000000000}}, // SQXTN V0.4H, V1.4S
+        {0x4e614820, {0x0123456789ABCDEF, 0x7FFF800080007FFF}}, // SQXTN2 V0.8H, V1.4S
+        {0x0ea14820, {0x7FFFFFFF80000000, 0x0000000000000000}}, // SQXTN V0.2S, V1.2D
+        {0x4ea14820, {0x0123456789ABCDEF, 0x7FFFFFFF80000000}}, // SQXTN2 V0.4S, V1.2D
+        {0x2e212820, {0xFF00000000FFFFFF, 0x0000000000000000}}, // SQXTUN V0.8B, V1.8H
+        {0x6e212820, {0x0123456789ABCDEF, 0xFF00000000FFFFFF}}, // SQXTUN2 V0.16B, V1.8H
+        {0x2e612820, {0xFFFF00000000FFFF, 0x0000000000000000}}, // SQXTUN V0.4H, V1.4S
+        {0x6e612820, {0x0123456789ABCDEF, 0xFFFF00000000FFFF}}, // SQXTUN2 V0.8H, V1.4S
+        {0x2ea12820, {0xFFFFFFFF00000000, 0x0000000000000000}}, // SQXTUN V0.2S, V1.2D
+        {0x6ea12820, {0x0123456789ABCDEF, 0xFFFFFFFF00000000}}, // SQXTUN2 V0.4S, V1.2D
+        {0x2e214820, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // UQXTN V0.8B, V1.8H
+        {0x6e214820, {0x0123456789ABCDEF, 0xFFFFFFFFFFFFFFFF}}, // UQXTN2 V0.16B, V1.8H
+        {0x2e614820, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // UQXTN V0.4H, V1.4S
+        {0x6e614820, {0x0123456789ABCDEF, 0xFFFFFFFFFFFFFFFF}}, // UQXTN2 V0.8H, V1.4S
+        {0x2ea14820, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // UQXTN V0.2S, V1.2D
+        {0x6ea14820, {0x0123456789ABCDEF, 0xFFFFFFFFFFFFFFFF}}, // UQXTN2 V0.4S, V1.2D
+        {0x2e213820, {0x1200340056007800, 0x80007F000000FF00}}, // SHLL V0.8H, V1.8B, #8
+        {0x6e213820, {0xFE00DC00BA009800, 0x7F00FF0080000000}}, // SHLL2 V0.8H, V1.16B, #8
+        {0x2e613820, {0x1234000056780000, 0x807F000000FF0000}}, // SHLL V0.4S, V1.4H, #16
+        {0x6e613820, {0xFEDC0000BA980000, 0x7FFF000080000000}}, // SHLL2 V0.4S, V1.8H, #16
+        {0x2ea13820, {0x1234567800000000, 0x807F00FF00000000}}, // SHLL V0.2D, V1.2S, #32
+        {0x6ea13820, {0xFEDCBA9800000000, 0x7FFF800000000000}}, // SHLL2 V0.2D, V1.4S, #32
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(0, {0x0123456789ABCDEF, 0xF0F0F0F00F0F0F0F});
+        jit.SetVector(1, {0x807F00FF12345678, 0x7FFF8000FEDCBA98});
+        jit.SetVector(2, {0x7F80FF01FDFE0304, 0x80017FFF01020380});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: SIMD three different", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    // Operands are V1 and V2; V0 holds the accumulator for SABAL, SMLAL and friends.
+    const std::vector<TestCase> test_cases {
+        {0x0e220020, {0x000F00320059007C, 0xFFFFFFFFFFFF0000}}, // SADDL V0.8H, V1.8B, V2.8B
+        {0x4e220020, {0xFFFFFFDEFFBDFF18, 0xFFFF0000FFFFFFFF}}, // SADDL2 V0.8H, V1.16B, V2.16B
+        {0x0e620020, {0x000010320000597C, 0xFFFFFFFF00000000}}, // SADDL V0.4S, V1.4H, V2.4H
+        {0x4e620020, {0xFFFFFFDEFFFFBE18, 0x00000000FFFFFFFF}}, // SADDL2 V0.4S, V1.8H, V2.8H
+        {0x0ea20020, {0x000000001032597C, 0x0000000000000000}}, // SADDL V0.2D, V1.2S, V2.2S
+        {0x4ea20020, {0xFFFFFFFFFFDEBE18, 0x000000000000FFFF}}, // SADDL2 V0.2D, V1.4S, V2.4S
+        {0x2e220020, {0x010F01320059007C, 0x00FF00FF00FF0100}}, // UADDL V0.8H, V1.8B, V2.8B
+        {0x6e220020, {0x00FF00DE00BD0118, 0x00FF010000FF00FF}}, // UADDL2 V0.8H, V1.16B, V2.16B
+        {0x2e620020, {0x000110320000597C, 0x0000FFFF00010000}}, // UADDL V0.4S, V1.4H, V2.4H
+        {0x6e620020, {0x0000FFDE0000BE18, 0x000100000000FFFF}}, // UADDL2 V0.4S, V1.8H, V2.8H
+        {0x2ea20020, {0x000000011032597C, 0x0000000100000000}}, // UADDL V0.2D, V1.2S, V2.2S
+        {0x6ea20020, {0x00000000FFDEBE18, 0x000000010000FFFF}}, // UADDL2 V0.2D, V1.4S, V2.4S
+        {0x0e222020, {0x0015003600530074, 0xFF0100FF0001FFFE}}, // SSUBL V0.8H, V1.8B, V2.8B
+        {0x4e222020, {0xFFFDFFDAFFB70018, 0x00FFFFFEFF010001}}, // SSUBL2 V0.8H, V1.16B, V2.16B
+        {0x0e622020, {0x0000143600005374, 0xFFFF00FF000001FE}}, // SSUBL V0.4S, V1.4H, V2.4H
+        {0x4e622020, {0xFFFFFDDAFFFFB718, 0x0000FFFEFFFF0001}}, // SSUBL2 V0.4S, V1.8H, V2.8H
+        {0x0ea22020, {0x0000000014365374, 0xFFFFFFFF00FE01FE}}, // SSUBL V0.2D, V1.2S, V2.2S
+        {0x4ea22020, {0xFFFFFFFFFDDAB718, 0x00000000FFFE0001}}, // SSUBL2 V0.2D, V1.4S, V2.4S
+        {0x2e222020, {0xFF15FF3600530074, 0x0001FFFFFF0100FE}}, // USUBL V0.8H, V1.8B, V2.8B
+        {0x6e222020, {0x00FD00DA00B70018, 0xFFFF00FE0001FF01}}, // USUBL2 V0.8H, V1.16B, V2.16B
+        {0x2e622020, {0xFFFF143600005374, 0x000000FFFFFF01FE}}, // USUBL V0.4S, V1.4H, V2.4H
+        {0x6e622020, {0x0000FDDA0000B718, 0xFFFFFFFE00000001}}, // USUBL2 V0.4S, V1.8H, V2.8H
+        {0x2ea22020, {0xFFFFFFFF14365374, 0x0000000000FE01FE}}, // USUBL V0.2D, V1.2S, V2.2S
+        {0x6ea22020, {0x00000000FDDAB718, 0xFFFFFFFFFFFE0001}}, // USUBL2 V0.2D, V1.4S, V2.4S
+        {0x0e227020, {0x0015003600530074, 0x00FF00FF00010002}}, // SABDL V0.8H, V1.8B, V2.8B
+        {0x4e227020, {0x0003002600490018, 0x00FF000200FF0001}}, // SABDL2 V0.8H, V1.16B, V2.16B
+        {0x0e627020, {0x0000143600005374, 0x0000FF01000001FE}}, // SABDL V0.4S, V1.4H, V2.4H
+        {0x4e627020, {0x00000226000048E8, 0x0000FFFE0000FFFF}}, // SABDL2 V0.4S, V1.8H, V2.8H
+        {0x0ea27020, {0x0000000014365374, 0x00000000FF01FE02}}, // SABDL V0.2D, V1.2S, V2.2S
+        {0x4ea27020, {0x00000000022548E8, 0x00000000FFFE0001}}, // SABDL2 V0.2D, V1.4S, V2.4S
+        {0x2e227020, {0x00EB00CA00530074, 0x0001000100FF00FE}}, // UABDL V0.8H, V1.8B, V2.8B
+        {0x6e227020, {0x00FD00DA00B70018, 0x000100FE000100FF}}, // UABDL2 V0.8H, V1.16B, V2.16B
+        {0x2e627020, {0x0000EBCA00005374, 0x000000FF0000FE02}}, // UABDL V0.4S, V1.4H, V2.4H
+        {0x6e627020, {0x0000FDDA0000B718, 0x0000000200000001}}, // UABDL2 V0.4S, V1.8H, V2.8H
+        {0x2ea27020, {0x00000000EBC9AC8C, 0x0000000000FE01FE}}, // UABDL V0.2D, V1.2S, V2.2S
+        {0x6ea27020, {0x00000000FDDAB718, 0x000000000001FFFF}}, // UABDL2 V0.2D, V1.4S, V2.4S
+        {0x0e225020, {0x0138459D89FECE63, 0xF1EFF1EF0F100F11}}, // SABAL V0.8H, V1.8B, V2.8B
+        {0x4e225020, {0x0126458D89F4CE07, 0xF1EFF0F2100E0F10}}, // SABAL2 V0.8H, V1.16B, V2.16B
+        {0x0e625020, {0x0123599D89AC2163, 0xF0F1EFF10F0F110D}}, // SABAL V0.4S, V1.4H, V2.4H
+        {0x4e625020, {0x0123478D89AC16D7, 0xF0F1F0EE0F100F0E}}, // SABAL2 V0.4S, V1.8H, V2.8H
+        {0x0ea25020, {0x012345679DE22163, 0xF0F0F0F10E110D11}}, // SABAL V0.2D, V1.2S, V2.2S
+        {0x4ea25020, {0x012345678BD116D7, 0xF0F0F0F10F0D0F10}}, // SABAL2 V0.2D, V1.4S, V2.4S
+        {0x2e225020, {0x020E463189FECE63, 0xF0F1F0F1100E100D}}, // UABAL V0.8H, V1.8B, V2.8B
+        {0x6e225020, {0x022046418A62CE07, 0xF0F1F1EE0F10100E}}, // UABAL2 V0.8H, V1.16B, V2.16B
+        {0x2e625020, {0x0124313189AC2163, 0xF0F0F1EF0F100D11}}, // UABAL V0.4S, V1.4H, V2.4H
+        {0x6e625020, {0x0124434189AC8507, 0xF0F0F0F20F0F0F10}}, // UABAL2 V0.4S, V1.8H, V2.8H
+        {0x2ea25020, {0x0123456875757A7B, 0xF0F0F0F0100D110D}}, // UABAL V0.2D, V1.2S, V2.2S
+        {0x6ea25020, {0x0123456887868507, 0xF0F0F0F00F110F0E}}, // UABAL2 V0.2D, V1.4S, V2.4S
+        {0x0e22c020, {0xFFCAFF98010201E0, 0xC080C0800000FFFF}}, // SMULL V0.8H, V1.8B, V2.8B
+        {0x4e22c020, {0xFFFEFFB8FF2E3400, 0xC080FFFFC0800000}}, // SMULL2 V0.8H, V1.16B, V2.16B
+        {0x0e62c020, {0xFFDB73980104C1E0, 0xC07F4080FFFF01FF}}, // SMULL V0.4S, V1.4H, V2.4H
+        {0x4e62c020, {0xFFFED9B8FF0D1400, 0xC000FFFFC0008000}}, // SMULL2 V0.4S, V1.8H, V2.8H
+        {0x0ea2c020, {0xFFDB732148E4C1E0, 0xC07EC1FD02FD01FF}}, // SMULL V0.2D, V1.2S, V2.2S
+        {0x4ea2c020, {0xFFFEDA7011BD1400, 0xC000FFFEC0008000}}, // SMULL2 V0.2D, V1.4S, V2.4S
+        {0x2e22c020, {0x11CA3398010201E0, 0x3F803F80000000FF}}, // UMULL V0.8H, V1.8B, V2.8B
+        {0x6e22c020, {0x00FE01B8022E4C00, 0x3F8000FF3F800000}}, // UMULL2 V0.8H, V1.16B, V2.16B
+        {0x2e62c020, {0x120F73980104C1E0, 0x3FFF408000FE01FF}}, // UMULL V0.4S, V1.4H, V2.4H
+        {0x6e62c020, {0x0100D9B8028D1400, 0x3FFFFFFF3FFF8000}}, // UMULL2 V0.4S, V1.8H, V2.8H
+        {0x2ea2c020, {0x120FC99948E4C1E0, 0x3FFFC0FE02FD01FF}}, // UMULL V0.2D, V1.2S, V2.2S
+        {0x6ea2c020, {0x0100DDF011BD1400, 0x40007FFEC0008000}}, // UMULL2 V0.2D, V1.4S, V2.4S
+        {0x0e228020, {0x00ED44FF8AADCFCF, 0xB170B1700F0F0F0E}}, // SMLAL V0.8H, V1.8B, V2.8B
+        {0x4e228020, {0x0121451F88D901EF, 0xB170F0EFCF8F0F0F}}, // SMLAL2 V0.8H, V1.16B, V2.16B
+        {0x0e628020, {0x00FEB8FF8AB08FCF, 0xB17031700F0E110E}}, // SMLAL V0.4S, V1.4H, V2.4H
+        {0x4e628020, {0x01221F1F88B8E1EF, 0xB0F1F0EFCF0F8F0F}}, // SMLAL2 V0.4S, V1.8H, V2.8H
+        {0x0ea28020, {0x00FEB888D2908FCF, 0xB16FB2ED120C110E}}, // SMLAL V0.2D, V1.2S, V2.2S
+        {0x4ea28020, {0x01221FD79B68E1EF, 0xB0F1F0EECF0F8F0F}}, // SMLAL2 V0.2D, V1.4S, V2.4S
+        {0x2e228020, {0x12ED78FF8AADCFCF, 0x307030700F0F100E}}, // UMLAL V0.8H, V1.8B, V2.8B
+        {0x6e228020, {0x0221471F8BD919EF, 0x3070F1EF4E8F0F0F}}, // UMLAL2 V0.8H, V1.16B, V2.16B
+        {0x2e628020, {0x1332B8FF8AB08FCF, 0x30F03170100D110E}}, // UMLAL V0.4S, V1.4H, V2.4H
+        {0x6e628020, {0x02241F1F8C38E1EF, 0x30F0F0EF4F0E8F0F}}, // UMLAL2 V0.4S, V1.8H, V2.8H
+        {0x2ea28020, {0x13330F00D2908FCF, 0x30F0B1EE120C110E}}, // UMLAL V0.2D, V1.2S, V2.2S
+        {0x6ea28020, {0x022423579B68E1EF, 0x30F170EECF0F8F0F}}, // UMLAL2 V0.2D, V1.4S, V2.4S
+        {0x0e22a020, {0x015945CF88A9CC0F, 0x307030700F0F0F10}}, // SMLSL V0.8H, V1.8B, V2.8B
+        {0x4e22a020, {0x012545AF8A7D99EF, 0x3070F0F14E8F0F0F}}, // SMLSL2 V0.8H, V1.16B, V2.16B
+        {0x0e62a020, {0x0147D1CF88A70C0F, 0x3071B0700F100D10}}, // SMLSL V0.4S, V1.4H, V2.4H
+        {0x4e62a020, {0x01246BAF8A9EB9EF, 0x30EFF0F14F0E8F0F}}, // SMLSL2 V0.4S, V1.8H, V2.8H
+        {0x0ea2a020, {0x0147D24640C70C0F, 0x30722EF30C120D10}}, // SMLSL V0.2D, V1.2S, V2.2S
+        {0x4ea2a020, {0x01246AF777EEB9EF, 0x30EFF0F14F0E8F0F}}, // SMLSL2 V0.2D, V1.4S, V2.4S
+        {0x2e22a020, {0xEF5911CF88A9CC0F, 0xB170B1700F0F0E10}}, // UMLSL V0.8H, V1.8B, V2.8B
+        {0x6e22a020, {0x002543AF877D81EF, 0xB170EFF1CF8F0F0F}}, // UMLSL2 V0.8H, V1.16B, V2.16B
+        {0x2e62a020, {0xEF13D1CF88A70C0F, 0xB0F1B0700E110D10}}, // UMLSL V0.4S, V1.4H, V2.4H
+        {0x6e62a020, {0x00226BAF871EB9EF, 0xB0F0F0F1CF0F8F0F}}, // UMLSL2 V0.4S, V1.8H, V2.8H
+        {0x2ea2a020, {0xEF137BCE40C70C0F, 0xB0F12FF20C120D10}}, // UMLSL V0.2D, V1.2S, V2.2S
+        {0x6ea2a020, {0x0022677777EEB9EF, 0xB0F070F14F0E8F0F}}, // UMLSL2 V0.2D, V1.4S, V2.4S
+        {0x0e221020, {0x807C00FD1237567C, 0x807E7F80FEDBBA99}}, // SADDW V0.8H, V1.8H, V2.8B
+        {0x4e221020, {0x80800101123755F8, 0x7F7F8001FF5BBA97}}, // SADDW2 V0.8H, V1.8H, V2.16B
+        {0x0e621020, {0x807EFEFD1234597C, 0x7FFFFF80FEDCB999}}, // SADDW V0.4S, V1.4S, V2.4H
+        {0x4e621020, {0x807F0201123459F8, 0x7FFF0001FEDD3A97}}, // SADDW2 V0.4S, V1.4S, V2.8H
+        {0x0ea21020, {0x807F00FF1032597C, 0x7FFF80017E5DB999}}, // SADDW V0.2D, V1.2D, V2.2S
+        {0x4ea21020, {0x807F00FF133659F8, 0x7FFF80007EDE3A97}}, // SADDW2 V0.2D, V1.2D, V2.4S
+        {0x2e221020, {0x817C01FD1237567C, 0x807E8080FFDBBA99}}, // UADDW V0.8H, V1.8H, V2.8B
+        {0x6e221020, {0x80800101123756F8, 0x807F8001FF5BBB97}}, // UADDW2 V0.8H, V1.8H, V2.16B
+        {0x2e621020, {0x807FFEFD1234597C, 0x7FFFFF80FEDDB999}}, // UADDW V0.4S, V1.4S, V2.4H
+        {0x6e621020, {0x807F0201123459F8, 0x80000001FEDD3A97}}, // UADDW2 V0.4S, V1.4S, V2.8H
+        {0x2ea21020, {0x807F01001032597C, 0x7FFF80017E5DB999}}, // UADDW V0.2D, V1.2D, V2.2S
+        {0x6ea21020, {0x807F00FF133659F8, 0x7FFF80017EDE3A97}}, // UADDW2 V0.2D, V1.2D, V2.4S
+        {0x0e223020, {0x8082010112315674, 0x7F808080FEDDBA97}}, // SSUBW V0.8H, V1.8H, V2.8B
+        {0x4e223020, {0x807E00FD123156F8, 0x807F7FFFFE5DBA99}}, // SSUBW2 V0.8H, V1.8H, V2.16B
+        {0x0e623020, {0x807F030112345374, 0x7FFF0080FEDCBB97}}, // SSUBW V0.4S, V1.4S, V2.4H
+        {0x4e623020, {0x807EFFFD123452F8, 0x7FFFFFFFFEDC3A99}}, // SSUBW2 V0.4S, V1.4S, V2.8H
+        {0x0ea23020, {0x807F00FF14365374, 0x7FFF80007F5BBB97}}, // SSUBW V0.2D, V1.2D, V2.2S
+        {0x4ea23020, {0x807F00FF113252F8, 0x7FFF80017EDB3A99}}, // SSUBW2 V0.2D, V1.2D, V2.4S
+        {0x2e223020, {0x7F82000112315674, 0x7F807F80FDDDBA97}}, // USUBW V0.8H, V1.8H, V2.8B
+        {0x6e223020, {0x807E00FD123155F8, 0x7F7F7FFFFE5DB999}}, // USUBW2 V0.8H, V1.8H, V2.16B
+        {0x2e623020, {0x807E030112345374, 0x7FFF0080FEDBBB97}}, // USUBW V0.4S, V1.4S, V2.4H
+        {0x6e623020, {0x807EFFFD123452F8, 0x7FFEFFFFFEDC3A99}}, // USUBW2 V0.4S, V1.4S, V2.8H
+        {0x2ea23020, {0x807F00FE14365374, 0x7FFF80007F5BBB97}}, // USUBW V0.2D, V1.2D, V2.2S
+        {0x6ea23020, {0x807F00FF113252F8, 0x7FFF80007EDB3A99}}, // USUBW2 V0.2D, V1.2D, V2.4S
+        {0x0e224020, {0x00FFFFBEFF001059, 0x0000000000000000}}, // ADDHN V0.8B, V1.8H, V2.8H
+        {0x4e224020, {0x0123456789ABCDEF, 0x00FFFFBEFF001059}}, // ADDHN2 V0.16B, V1.8H, V2.8H
+        {0x0e624020, {0x0000FFDE00001032, 0x0000000000000000}}, // ADDHN V0.4H, V1.4S, V2.4S
+        {0x4e624020, {0x0123456789ABCDEF, 0x0000FFDE00001032}}, // ADDHN2 V0.8H, V1.4S, V2.4S
+        {0x0ea24020, {0x0000FFFF00000001, 0x0000000000000000}}, // ADDHN V0.2S, V1.2D, V2.2D
+        {0x4ea24020, {0x0123456789ABCDEF, 0x0000FFFF00000001}}, // ADDHN2 V0.4S, V1.2D, V2.2D
+        {0x0e226020, {0xFF00FDB700011453, 0x0000000000000000}}, // SUBHN V0.8B, V1.8H, V2.8H
+        {0x4e226020, {0x0123456789ABCDEF, 0xFF00FDB700011453}}, // SUBHN2 V0.16B, V1.8H, V2.8H
+        {0x0e626020, {0xFFFEFDDA00FE1436, 0x0000000000000000}}, // SUBHN V0.4H, V1.4S, V2.4S
+        {0x4e626020, {0x0123456789ABCDEF, 0xFFFEFDDA00FE1436}}, // SUBHN2 V0.8H, V1.4S, V2.4S
+        {0x0ea26020, {0xFFFE000100FE01FD, 0x0000000000000000}}, // SUBHN V0.2S, V1.2D, V2.2D
+        {0x4ea26020, {0x0123456789ABCDEF, 0xFFFE000100FE01FD}}, // SUBHN2 V0.4S, V1.2D, V2.2D
+        {0x2e224020, {0x000000BE00001059, 0x0000000000000000}}, // RADDHN V0.8B, V1.8H, V2.8H
+        {0x6e224020, {0x0123456789ABCDEF, 0x000000BE00001059}}, // RADDHN2 V0.16B, V1.8H, V2.8H
+        {0x2e624020, {0x0001FFDF00001032, 0x0000000000000000}}, // RADDHN V0.4H, V1.4S, V2.4S
+        {0x6e624020, {0x0123456789ABCDEF, 0x0001FFDF00001032}}, // RADDHN2 V0.8H, V1.4S, V2.4S
+        {0x2ea24020, {0x0001000000000001, 0x0000000000000000}}, // RADDHN V0.2S, V1.2D, V2.2D
+        {0x6ea24020, {0x0123456789ABCDEF, 0x0001000000000001}}, // RADDHN2 V0.4S, V1.2D, V2.2D
+        {0x2e226020, {0x0000FEB701021453, 0x0000000000000000}}, // RSUBHN V0.8B, V1.8H, V2.8H
+        {0x6e226020, {0x0123456789ABCDEF, 0x0000FEB701021453}}, // RSUBHN2 V0.16B, V1.8H, V2.8H
+        {0x2e626020, {0xFFFEFDDB00FE1436, 0x0000000000000000}}, // RSUBHN V0.4H, V1.4S, V2.4S
+        {0x6e626020, {0x0123456789ABCDEF, 0xFFFEFDDB00FE1436}}, // RSUBHN2 V0.8H, V1.4S, V2.4S
+        {0x2ea26020, {0xFFFE000200FE01FD, 0x0000000000000000}}, // RSUBHN V0.2S, V1.2D, V2.2D
+        {0x6ea26020, {0x0123456789ABCDEF, 0xFFFE000200FE01FD}}, // RSUBHN2 V0.4S, V1.2D, V2.2D
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(0, {0x0123456789ABCDEF, 0xF0F0F0F00F0F0F0F});
+        jit.SetVector(1, {0x807F00FF12345678, 0x7FFF8000FEDCBA98});
+        jit.SetVector(2, {0x7F80FF01FDFE0304, 0x80017FFF01020380});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: SIMD multiply by element", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    // Integer operands are V1, V2 and V18, floating point operands are V4 and V5; V0 holds the accumulator.
+    const std::vector<TestCase> test_cases {
+        {0x4f728820, {0x7EDD0369FDBA8000, 0xB11C80004A072300}}, // MUL V0.8H, V1.8H, V2.H[7]
+        {0x0f628020, {0x00017FFD00028000, 0x0000000000000000}}, // MUL V0.4H, V1.4H, V2.H[2]
+        {0x4fa28020, {0x00087FFD40018000, 0x2DCB8000D6B2FF00}}, // MUL V0.4S, V1.4S, V2.S[1]
+        {0x4fb28820, {0x7FFF0003FFFE8000, 0x12348000ABCD0100}}, // MUL V0.4S, V1.4S, V18.S[3]
+        {0x0f928820, {0x4000000000000000, 0x0000000000000000}}, // MUL V0.2S, V1.2S, V18.S[2]
+        {0x6f520820, {0xAE6F33331DDE8000, 0xE9648000059D1100}}, // MLA V0.8H, V1.8H, V2.H[5]
+        {0x6fa20820, {0xC2ECFFFD40018000, 0x2DBB80007832FF00}}, // MLA V0.4S, V1.4S, V2.S[3]
+        {0x6f424820, {0xFF80C000C0000000, 0x3FF0000040000000}}, // MLS V0.8H, V1.8H, V2.H[4]
+        {0x2fb24020, {0x3F7F00033FFE8000, 0x0000000000000000}}, // MLS V0.2S, V1.2S, V18.S[1]
+        {0x0f62a820, {0x0000000200008000, 0xFFFF8001FFFFFFFD}}, // SMULL V0.4S, V1.4H, V2.H[6]
+        {0x4f92a020, {0x2A197F8000000000, 0xF6E5C00000000000}}, // SMULL2 V0.2D, V1.4S, V18.S[0]
+        {0x2f62a820, {0xFFFD00027FFF8000, 0x7FFE80010002FFFD}}, // UMULL V0.4S, V1.4H, V2.H[6]
+        {0x6f52a020, {0x2AF3400000400000, 0x048D000020000000}}, // UMULL2 V0.4S, V1.8H, V2.H[1]
+        {0x0f722020, {0x3F7FFFFC3FFF0000, 0x3FF0FFFE00000006}}, // SMLAL V0.4S, V1.4H, V2.H[3]
+        {0x4f826820, {0x451D39786E400000, 0x3EB9405C20000000}}, // SMLSL2 V0.2D, V1.4S, V2.S[2]
+        {0x6fb22820, {0x3F800000EBCD0100, 0x3FF0000012348000}}, // UMLAL2 V0.2D, V1.4S, V18.S[3]
+        {0x2f426020, {0xBF81000000000000, 0xFFF08000FFFE8000}}, // UMLSL V0.4S, V1.4H, V2.H[0]
+        {0x4f42c020, {0x8001FFFD00027FFF, 0xEDCC7FFF5433FF00}}, // SQDMULH V0.8H, V1.8H, V2.H[0]
+        {0x0f72c820, {0x01220000FFFFFEDD, 0x0000000000000000}}, // SQDMULH V0.4H, V1.4H, V2.H[7]
+        {0x4fa2c820, {0x0123FDB7FFFFFC94, 0x002987C3FF3FEBAA}}, // SQDMULH V0.4S, V1.4S, V2.S[3]
+        {0x4f92c240, {0x800000017FFFFFFF, 0xFFFFFFFF40000000}}, // SQDMULH V0.4S, V18.4S, V18.S[0]
+        {0x4f42d020, {0x8001FFFD00027FFF, 0xEDCC7FFF5433FF00}}, // SQRDMULH V0.8H, V1.8H, V2.H[0]
+        {0x4f52d020, {0x40000002FFFFC000, 0x091AC000D5E70080}}, // SQRDMULH V0.8H, V1.8H, V2.H[1]
+        {0x4fa2d020, {0x00027FFAFFFFFFF9, 0x00005B06FFFE5B02}}, // SQRDMULH V0.4S, V1.4S, V2.S[1]
+        {0x0f92d240, {0x800000017FFFFFFF, 0x0000000000000000}}, // SQRDMULH V0.2S, V18.2S, V18.S[0]
+        {0x5f42c020, {0x0000000000007FFF, 0x0000000000000000}}, // SQDMULH H0, H1, V2.H[0]
+        {0x5fa2c020, {0x00000000FFFFFFF8, 0x0000000000000000}}, // SQDMULH S0, S1, V2.S[1]
+        {0x5f72d820, {0x000000000000FEDD, 0x0000000000000000}}, // SQRDMULH H0, H1, V2.H[7]
+        {0x5f92d240, {0x000000007FFFFFFF, 0x0000000000000000}}, // SQRDMULH S0, S18, V18.S[0]
+        {0x4fa59080, {0xC0D8000040900000, 0x40CC000000000000}}, // FMUL V0.4S, V4.4S, V5.S[1]
+        {0x0f859080, {0xC134000040F00000, 0x0000000000000000}}, // FMUL V0.2S, V4.2S, V5.S[0]
+        {0x4fc59880, {0x401800005FA00000, 0xC012000000000000}}, // FMUL V0.2D, V4.2D, V5.D[1]
+        {0x4f851080, {0xC124000041180000, 0x4148000000000000}}, // FMLA V0.4S, V4.4S, V5.S[0]
+        {0x4fc51880, {0x401808005FC00000, 0xC00C000000000000}}, // FMLA V0.2D, V4.2D, V5.D[1]
+        {0x4fa55880, {0xC0570000409D0000, 0x40BFC00000000000}}, // FMLS V0.4S, V4.4S, V5.S[3]
+        {0x4fc55080, {0x4060004080610101, 0xC057C00060F00000}}, // FMLS V0.2D, V4.2D, V5.D[0]
+        {0x5fa59880, {0x00000000C03A0000, 0x0000000000000000}}, // FMUL S0, S4, V5.S[3]
+        {0x5fc59880, {0x401800005FA00000, 0x0000000000000000}}, // FMUL D0, D4, V5.D[1]
+        {0x5fa51080, {0x0000000040D00000, 0x0000000000000000}}, // FMLA S0, S4, V5.S[1]
+        {0x5fc51880, {0x401808005FC00000, 0x0000000000000000}}, // FMLA D0, D4, V5.D[1]
+        {0x5f855080, {0x00000000C0B00000, 0x0000000000000000}}, // FMLS S0, S4, V5.S[0]
+        {0x5fc55880, {0xC017F8005F800000, 0x0000000000000000}}, // FMLS D0, D4, V5.D[1]
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(0, {0x3F80000040000000, 0x3FF0000000000000});
+        jit.SetVector(1, {0x7FFF0003FFFE8000, 0x12348000ABCD0100});
+        jit.SetVector(2, {0x00027FFF40008000, 0x0123FFFF1111C000});
+        jit.SetVector(4, {0xC01000003FC00000, 0x4008000000000000});
+        jit.SetVector(5, {0x4040000040A00000, 0xBFF8000000000000});
+        jit.SetVector(18, {0x7FFFFFFF80000000, 0x00000001C0000000});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: SIMD modified immediate", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    // ORR and BIC operate on the initial value of V0.
+    const std::vector<TestCase> test_cases {
+        {0x4f002640, {0x0000120000001200, 0x0000120000001200}}, // MOVI V0.4S, #0x12, LSL #8
+        {0x0f056560, {0xAB000000AB000000, 0x0000000000000000}}, // MOVI V0.2S, #0xAB, LSL #24
+        {0x4f03a7e0, {0x7F007F007F007F00, 0x7F007F007F007F00}}, // MOVI V0.8H, #0x7F, LSL #8
+        {0x4f05e4a0, {0xA5A5A5A5A5A5A5A5, 0xA5A5A5A5A5A5A5A5}}, // MOVI V0.16B, #0xA5
+        {0x0f01e780, {0x3C3C3C3C3C3C3C3C, 0x0000000000000000}}, // MOVI V0.8B, #0x3C
+        {0x4f02c6c0, {0x000056FF000056FF, 0x000056FF000056FF}}, // MOVI V0.4S, #0x56, MSL #8
+        {0x0f02d6c0, {0x0056FFFF0056FFFF, 0x0000000000000000}}, // MOVI V0.2S, #0x56, MSL #16
+        {0x6f05e4a0, {0xFF00FF0000FF00FF, 0xFF00FF0000FF00FF}}, // MOVI V0.2D, #0xFF00FF0000FF00FF
+        {0x2f04e420, {0xFF000000000000FF, 0x0000000000000000}}, // MOVI D0, #0xFF000000000000FF
+        {0x6f00e400, {0x0000000000000000, 0x0000000000000000}}, // MOVI V0.2D, #0
+        {0x6f004640, {0xFFEDFFFFFFEDFFFF, 0xFFEDFFFFFFEDFFFF}}, // MVNI V0.4S, #0x12, LSL #16
+        {0x2f048400, {0xFF7FFF7FFF7FFF7F, 0x0000000000000000}}, // MVNI V0.4H, #0x80
+        {0x6f01d680, {0xFFCB0000FFCB0000, 0xFFCB0000FFCB0000}}, // MVNI V0.4S, #0x34, MSL #16
+        {0x4f047400, {0x8123456789ABCDEF, 0xFEDCBA98F6543210}}, // ORR V0.4S, #0x80, LSL #24
+        {0x0f07b600, {0xF123F567F9ABFDEF, 0x0000000000000000}}, // ORR V0.4H, #0xF0, LSL #8
+        {0x6f0797e0, {0x010045008900CD00, 0xFE00BA0076003200}}, // BIC V0.8H, #0xFF
+        {0x2f0035e0, {0x0123406789ABC0EF, 0x0000000000000000}}, // BIC V0.2S, #0x0F, LSL #8
+        {0x4f03f600, {0x3F8000003F800000, 0x3F8000003F800000}}, // FMOV V0.4S, #1.0
+        {0x0f07f400, {0xBF000000BF000000, 0x0000000000000000}}, // FMOV V0.2S, #-0.5
+        {0x6f00f500, {0x4008000000000000, 0x4008000000000000}}, // FMOV V0.2D, #3.0
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(0, {0x0123456789ABCDEF, 0xFEDCBA9876543210});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: SIMD scalar three same and two-register misc", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Dynarmic::A64::Jit::Vector expected;
+    };
+
+    // Scalar results must clear the upper bits of V0.
+    const std::vector<TestCase> test_cases {
+        {0x5ee28420, {0x80000000000001FE, 0x0000000000000000}}, // ADD D0, D1, D2
+        {0x7ee18440, {0x8000000000000000, 0x0000000000000000}}, // SUB D0, D2, D1
+        {0x7ee28c40, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMEQ D0, D2, D2
+        {0x7ee28c20, {0x0000000000000000, 0x0000000000000000}}, // CMEQ D0, D1, D2
+        {0x5ee13440, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMGT D0, D2, D1
+        {0x5ee23420, {0x0000000000000000, 0x0000000000000000}}, // CMGT D0, D1, D2
+        {0x5ee33c60, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMGE D0, D3, D3
+        {0x7ee23420, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMHI D0, D1, D2
+        {0x7ee13c40, {0x0000000000000000, 0x0000000000000000}}, // CMHS D0, D2, D1
+        {0x5ee28c20, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMTST D0, D1, D2
+        {0x5ee34420, {0xF80000000000000F, 0x0000000000000000}}, // SSHL D0, D1, D3
+        {0x7ee34420, {0x080000000000000F, 0x0000000000000000}}, // USHL D0, D1, D3
+        {0x5ee24440, {0x000000000000007F, 0x0000000000000000}}, // SSHL D0, D2, D2
+        {0x5ee35440, {0x0000000000000010, 0x0000000000000000}}, // SRSHL D0, D2, D3
+        {0x7ee35420, {0x0800000000000010, 0x0000000000000000}}, // URSHL D0, D1, D3
+        {0x5e250c80, {0x0000000000000080, 0x0000000000000000}}, // SQADD B0, B4, B5
+        {0x5e650c80, {0x0000000000000001, 0x0000000000000000}}, // SQADD H0, H4, H5
+        {0x5ea50c80, {0x0000000000010001, 0x0000000000000000}}, // SQADD S0, S4, S5
+        {0x5ee30c20, {0x80000000000000FB, 0x0000000000000000}}, // SQADD D0, D1, D3
+        {0x5ee22c20, {0x8000000000000000, 0x0000000000000000}}, // SQSUB D0, D1, D2
+        {0x5ee42c20, {0x8000000000000000, 0x0000000000000000}}, // SQSUB D0, D1, D4
+        {0x7e250c80, {0x00000000000000FF, 0x0000000000000000}}, // UQADD B0, B4, B5
+        {0x7e650c80, {0x000000000000FFFF, 0x0000000000000000}}, // UQADD H0, H4, H5
+        {0x7ea42ca0, {0x0000000000020101, 0x0000000000000000}}, // UQSUB S0, S5, S4
+        {0x7ee12c40, {0x0000000000000000, 0x0000000000000000}}, // UQSUB D0, D2, D1
+        {0x5ee08840, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMGT D0, D2, #0
+        {0x5ee08820, {0x0000000000000000, 0x0000000000000000}}, // CMGT D0, D1, #0
+        {0x5ee09820, {0x0000000000000000, 0x0000000000000000}}, // CMEQ D0, D1, #0
+        {0x5ee098c0, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMEQ D0, D6, #0
+        {0x5ee0a820, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMLT D0, D1, #0
+        {0x7ee088c0, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMGE D0, D6, #0
+        {0x7ee08860, {0x0000000000000000, 0x0000000000000000}}, // CMGE D0, D3, #0
+        {0x7ee09860, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMLE D0, D3, #0
+        {0x7ee09840, {0x0000000000000000, 0x0000000000000000}}, // CMLE D0, D2, #0
+        {0x5ee0b860, {0x0000000000000004, 0x0000000000000000}}, // ABS D0, D3
+        {0x5ee0b820, {0x7FFFFFFFFFFFFF01, 0x0000000000000000}}, // ABS D0, D1
+        {0x7ee0b840, {0xFFFFFFFFFFFFFF01, 0x0000000000000000}}, // NEG D0, D2
+        {0x4e208820, {0x0000000000000000, 0xFFFFFFFF00000000}}, // CMGT V0.16B, V1.16B, #0
+        {0x4e609880, {0x0000000000000000, 0x000000000000FFFF}}, // CMEQ V0.8H, V4.8H, #0
+        {0x4ea0a8a0, {0x00000000FFFFFFFF, 0x0000000000000000}}, // CMLT V0.4S, V5.4S, #0
+        {0x6ee08860, {0x0000000000000000, 0xFFFFFFFFFFFFFFFF}}, // CMGE V0.2D, V3.2D, #0
+        {0x2e209840, {0xFFFFFFFFFFFFFFFF, 0x0000000000000000}}, // CMLE V0.8B, V2.8B, #0
+        {0x4e20b880, {0x7F0101017F017F80, 0x8000000180010000}}, // ABS V0.16B, V4.16B
+        {0x4ee0b820, {0x7FFFFFFFFFFFFF01, 0x0123456789ABCDEF}}, // ABS V0.2D, V1.2D
+        {0x6ea0b8a0, {0xFFFFFFFF7FFE7F7F, 0x80807F8080008000}}, // NEG V0.4S, V5.4S
+        {0x2e60b820, {0x800000000000FF01, 0x0000000000000000}}, // NEG V0.4H, V1.4H
+    };
+
+    for (const auto& test_case : test_cases) {
+        TestEnv env;
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+        env.code_mem[0] = test_case.instruction;
+        env.code_mem[1] = 0x14000000; // B .
+
+        jit.SetVector(0, {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF});
+        jit.SetVector(1, {0x80000000000000FF, 0x0123456789ABCDEF});
+        jit.SetVector(2, {0x00000000000000FF, 0xFEDCBA9876543210});
+        jit.SetVector(3, {0xFFFFFFFFFFFFFFFC, 0x5555AAAA5555AAAA});
+        jit.SetVector(4, {0x7FFFFFFF7FFF7F80, 0x8000000180010000});
+        jit.SetVector(5, {0x0000000180018081, 0x7F7F80807FFF8000});
+        jit.SetVector(6, {0x0000000000000000, 0x0000000012345678});
+        jit.SetPC(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetPC() == 4);
+    }
+}
+
+TEST_CASE("A64: LD1-LD4/ST1-ST4 (multiple structures)", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x4c407000; // LD1 {V0.16B}, [X0]
+    env.code_mem[1] = 0x0cdfa001; // LD1 {V1.8B, V2.8B}, [X0], #16
+    env.code_mem[2] = 0x4c408823; // LD2 {V3.4S, V4.4S}, [X1]
+    env.code_mem[3] = 0x0c400045; // LD4 {V5.8B, V6.8B, V7.8B, V8.8B}, [X2]
+    env.code_mem[4] = 0x0cc44469; // LD3 {V9.4H, V10.4H, V11.4H}, [X3], X4
+    env.code_mem[5] = 0x4cdf6ff7; // LD1 {V23.2D, V24.2D, V25.2D}, [SP], #48
+    env.code_mem[6] = 0x4c0070a0; // ST1 {V0.16B}, [X5]
+    env.code_mem[7] = 0x4c0088c3; // ST2 {V3.4S, V4.4S}, [X6]
+    env.code_mem[8] = 0x0c9f00e5; // ST4 {V5.8B, V6.8B, V7.8B, V8.8B}, [X7], #32
+    env.code_mem[9] = 0x0c00ae21; // ST1 {V1.1D, V2.1D}, [X17]
+    env.code_mem[10] = 0x14000000; // B .
+
+    jit.SetRegister(0, 0x2000);
+    jit.SetRegister(1, 0x3000);
+    jit.SetRegister(2, 0x4000);
+    jit.SetRegister(3, 0x5000);
+    jit.SetRegister(4, 0x100);
+    jit.SetRegister(5, 0x6080);
+    jit.SetRegister(6, 0x7040);
+    jit.SetRegister(7, 0x8060);
+    jit.SetRegister(17, 0xA0C0);
+    jit.SetSP(0x9000);
+    jit.SetPC(0);
+
+    env.ticks_left = 11;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0x0706050403020100, 0x0F0E0D0C0B0A0908});
+    REQUIRE(jit.GetVector(1) == Dynarmic::A64::Jit::Vector{0x0706050403020100, 0x0000000000000000});
+    REQUIRE(jit.GetVector(2) == Dynarmic::A64::Jit::Vector{0x0F0E0D0C0B0A0908, 0x0000000000000000});
+    REQUIRE(jit.GetVector(3) == Dynarmic::A64::Jit::Vector{0x0B0A090803020100, 0x1B1A191813121110});
+    REQUIRE(jit.GetVector(4) == Dynarmic::A64::Jit::Vector{0x0F0E0D0C07060504, 0x1F1E1D1C17161514});
+    REQUIRE(jit.GetVector(5) == Dynarmic::A64::Jit::Vector{0x1C1814100C080400, 0x0000000000000000});
+    REQUIRE(jit.GetVector(6) == Dynarmic::A64::Jit::Vector{0x1D1915110D090501, 0x0000000000000000});
+    REQUIRE(jit.GetVector(7) == Dynarmic::A64::Jit::Vector{0x1E1A16120E0A0602, 0x0000000000000000});
+    REQUIRE(jit.GetVector(8) == Dynarmic::A64::Jit::Vector{0x1F1B17130F0B0703, 0x0000000000000000});
+    REQUIRE(jit.GetVector(9) == Dynarmic::A64::Jit::Vector{0x13120D0C07060100, 0x0000000000000000});
+    REQUIRE(jit.GetVector(10) == Dynarmic::A64::Jit::Vector{0x15140F0E09080302, 0x0000000000000000});
+    REQUIRE(jit.GetVector(11) == Dynarmic::A64::Jit::Vector{0x171611100B0A0504, 0x0000000000000000});
+    REQUIRE(jit.GetVector(23) == Dynarmic::A64::Jit::Vector{0x0706050403020100, 0x0F0E0D0C0B0A0908});
+    REQUIRE(jit.GetVector(24) == Dynarmic::A64::Jit::Vector{0x1716151413121110, 0x1F1E1D1C1B1A1918});
+    REQUIRE(jit.GetVector(25) == Dynarmic::A64::Jit::Vector{0x2726252423222120, 0x2F2E2D2C2B2A2928});
+    REQUIRE(jit.GetRegister(0) == 0x2010);
+    REQUIRE(jit.GetRegister(3) == 0x5100);
+    REQUIRE(jit.GetRegister(7) == 0x8080);
+    REQUIRE(jit.GetSP() == 0x9030);
+    REQUIRE(env.MemoryRead64(0x6080) == 0x0706050403020100);
+    REQUIRE(env.MemoryRead64(0x6088) == 0x0F0E0D0C0B0A0908);
+    REQUIRE(env.MemoryRead64(0x7040) == 0x0706050403020100);
+    REQUIRE(env.MemoryRead64(0x7048) == 0x0F0E0D0C0B0A0908);
+    REQUIRE(env.MemoryRead64(0x7050) == 0x1716151413121110);
+    REQUIRE(env.MemoryRead64(0x7058) == 0x1F1E1D1C1B1A1918);
+    REQUIRE(env.MemoryRead64(0x8060) == 0x0706050403020100);
+    REQUIRE(env.MemoryRead64(0x8068) == 0x0F0E0D0C0B0A0908);
+    REQUIRE(env.MemoryRead64(0x8070) == 0x1716151413121110);
+    REQUIRE(env.MemoryRead64(0x8078) == 0x1F1E1D1C1B1A1918);
+    REQUIRE(env.MemoryRead64(0xA0C0) == 0x0706050403020100);
+    REQUIRE(env.MemoryRead64(0xA0C8) == 0x0F0E0D0C0B0A0908);
+    REQUIRE(env.modified_memory.size() == 96);
+    REQUIRE(jit.GetPC() == 40);
+}
+
+TEST_CASE("A64: LD1-LD4/ST1-ST4 (single structure)", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0x0d40910c; // LD1 {V12.S}[1], [X8]
+    env.code_mem[1] = 0x4d40c52d; // LD1R {V13.8H}, [X9]
+    env.code_mem[2] = 0x4d60c94e; // LD2R {V14.4S, V15.4S}, [X10]
+    env.code_mem[3] = 0x0d602d70; // LD4 {V16.B, V17.B, V18.B, V19.B}[3], [X11]
+    env.code_mem[4] = 0x4ddfa594; // LD3 {V20.D, V21.D, V22.D}[1], [X12], #24
+    env.code_mem[5] = 0x0d40c93a; // LD1R {V26.2S}, [X9]
+    env.code_mem[6] = 0x4d0049a0; // ST1 {V0.H}[5], [X13]
+    env.code_mem[7] = 0x4d00a1c3; // ST3 {V3.S, V4.S, V5.S}[2], [X14]
+    env.code_mem[8] = 0x4db085e0; // ST2 {V0.D, V1.D}[1], [X15], X16
+    env.code_mem[9] = 0x14000000; // B .
+
+    jit.SetVector(0, {0x6A06E9AB85A0BCC1, 0x4DAD2986CE834960});
+    jit.SetVector(1, {0x5D998017F5E2FC57, 0x2CB85F3F4A24E39A});
+    jit.SetVector(3, {0xB48438B5C41F9DFD, 0x8A4996EFB447C0CE});
+    jit.SetVector(4, {0x473D212BA950666D, 0xEAE0D2C11C339464});
+    jit.SetVector(5, {0x3FB81D2706E55426, 0xD0B0090D62590992});
+    jit.SetVector(12, {0x6B68B48EBF13C171, 0xDC159E6A409C38F2});
+    jit.SetVector(13, {0xCD68615C80690847, 0xA3F96F0E51436D1F});
+    jit.SetVector(14, {0xAF371D87D8A8F065, 0xB969EC07F1F83A79});
+    jit.SetVector(15, {0x2335E9E266CEA9FA, 0x8D1A6BFFFF9A3914});
+    jit.SetVector(16, {0x23CF493F0FEBDDF8, 0xCAA7E9BFD00724A1});
+    jit.SetVector(17, {0x32521553E014BE00, 0xE1FF83AB26A2658F});
+    jit.SetVector(18, {0x8869510DB4A02517, 0xCD425EC38F138999});
+    jit.SetVector(19, {0xAF929A91F4873115, 0x54BEC7D835C33744});
+    jit.SetVector(20, {0x1F9DB8DD8A3B09DD, 0xB730D88FE1E8A4AA});
+    jit.SetVector(21, {0x11B5AECDA386A3A0, 0x68E06B0C4F27B35C});
+    jit.SetVector(22, {0x81DDA9DA14F50791, 0xDBD5F6D2F09529AF});
+    jit.SetVector(26, {0xA3E2889C795E846B, 0x9995D8AAFF0F3B81});
+    jit.SetRegister(8, 0x2100);
+    jit.SetRegister(9, 0x2202);
+    jit.SetRegister(10, 0x2304);
+    jit.SetRegister(11, 0x2400);
+    jit.SetRegister(12, 0x2500);
+    jit.SetRegister(13, 0x6000);
+    jit.SetRegister(14, 0x7000);
+    jit.SetRegister(15, 0x8000);
+    jit.SetRegister(16, 0x40);
+    jit.SetPC(0);
+
+    env.ticks_left = 10;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(12) == Dynarmic::A64::Jit::Vector{0x03020100BF13C171, 0xDC159E6A409C38F2});
+    REQUIRE(jit.GetVector(13) == Dynarmic::A64::Jit::Vector{0x0302030203020302, 0x0302030203020302});
+    REQUIRE(jit.GetVector(14) == Dynarmic::A64::Jit::Vector{0x0706050407060504, 0x0706050407060504});
+    REQUIRE(jit.GetVector(15) == Dynarmic::A64::Jit::Vector{0x0B0A09080B0A0908, 0x0B0A09080B0A0908});
+    REQUIRE(jit.GetVector(16) == Dynarmic::A64::Jit::Vector{0x23CF493F00EBDDF8, 0xCAA7E9BFD00724A1});
+    REQUIRE(jit.GetVector(17) == Dynarmic::A64::Jit::Vector{0x325215530114BE00, 0xE1FF83AB26A2658F});
+    REQUIRE(jit.GetVector(18) == Dynarmic::A64::Jit::Vector{0x8869510D02A02517, 0xCD425EC38F138999});
+    REQUIRE(jit.GetVector(19) == Dynarmic::A64::Jit::Vector{0xAF929A9103873115, 0x54BEC7D835C33744});
+    REQUIRE(jit.GetVector(20) == Dynarmic::A64::Jit::Vector{0x1F9DB8DD8A3B09DD, 0x0706050403020100});
+    REQUIRE(jit.GetVector(21) == Dynarmic::A64::Jit::Vector{0x11B5AECDA386A3A0, 0x0F0E0D0C0B0A0908});
+    REQUIRE(jit.GetVector(22) == Dynarmic::A64::Jit::Vector{0x81DDA9DA14F50791, 0x1716151413121110});
+    REQUIRE(jit.GetVector(26) == Dynarmic::A64::Jit::Vector{0x0504030205040302, 0x0000000000000000});
+    REQUIRE(jit.GetRegister(12) == 0x2518);
+    REQUIRE(jit.GetRegister(15) == 0x8040);
+    REQUIRE(env.MemoryRead16(0x6000) == 0xCE83);
+    REQUIRE(env.MemoryRead32(0x7000) == 0xB447C0CE);
+    REQUIRE(env.MemoryRead32(0x7004) == 0x1C339464);
+    REQUIRE(env.MemoryRead32(0x7008) == 0x62590992);
+    REQUIRE(env.MemoryRead64(0x8000) == 0x4DAD2986CE834960);
+    REQUIRE(env.MemoryRead64(0x8008) == 0x2CB85F3F4A24E39A);
+    REQUIRE(env.modified_memory.size() == 30);
+    REQUIRE(jit.GetPC() == 36);
+}
+
+TEST_CASE("A64: Load/store exclusive", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0xc85f7c20;  // LDXR X0, [X1]
+    env.code_mem[1] = 0x91000400;  // ADD X0, X0, #1
+    env.code_mem[2] = 0xc8027c20;  // STXR W2, X0, [X1]
+    env.code_mem[3] = 0x885ffc23;  // LDAXR W3, [X1]
+    env.code_mem[4] = 0xd5033f5f;  // CLREX
+    env.code_mem[5] = 0x8804fc23;  // STLXR W4, W3, [X1]
+    env.code_mem[6] = 0x085f7c26;  // LDXRB W6, [X1]
+    env.code_mem[7] = 0x08077c26;  // STXRB W7, W6, [X1]
+    env.code_mem[8] = 0x485f7c28;  // LDXRH W8, [X1]
+    env.code_mem[9] = 0x4809fc28;  // STLXRH W9, W8, [X1]
+    env.code_mem[10] = 0x887f2c2a; // LDXP W10, W11, [X1]
+    env.code_mem[11] = 0x882c282b; // STXP W12, W11, W10, [X1]
+    env.code_mem[12] = 0xc8dffc2d; // LDAR X13, [X1]
+    env.code_mem[13] = 0xc89ffcad; // STLR X13, [X5]
+    env.code_mem[14] = 0x14000000; // B .
+
+    jit.SetRegister(1, 0x1000);
+    jit.SetRegister(4, 0xFF);
+    jit.SetRegister(5, 0x2000);
+    jit.SetPC(0);
+
+    env.ticks_left = 15;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x0706050403020101);
+    REQUIRE(jit.GetRegister(2) == 0);
+    REQUIRE(jit.GetRegister(3) == 0x03020101);
+    REQUIRE(jit.GetRegister(4) == 1);
+    REQUIRE(jit.GetRegister(6) == 0x01);
+    REQUIRE(jit.GetRegister(7) == 0);
+    REQUIRE(jit.GetRegister(8) == 0x0101);
+    REQUIRE(jit.GetRegister(9) == 0);
+    REQUIRE(jit.GetRegister(10) == 0x03020101);
+    REQUIRE(jit.GetRegister(11) == 0x07060504);
+    REQUIRE(jit.GetRegister(12) == 0);
+    REQUIRE(jit.GetRegister(13) == 0x0302010107060504);
+    REQUIRE(env.MemoryRead64(0x1000) == 0x0302010107060504);
+    REQUIRE(env.MemoryRead64(0x2000) == 0x0302010107060504);
+}
+
+TEST_CASE("A64: Load/store exclusive with page table", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+
+    std::array<void*, 256> page_table{};
+    std::array<u8, 4096> page{};
+    page_table[1] = page.data();
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 20;
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0xc85f7c20; // LDXR X0, [X1]
+    env.code_mem[1] = 0x14000001; // B #4
+    env.code_mem[2] = 0xc8027c25; // STXR W2, X5, [X1]
+    env.code_mem[3] = 0x14000000; // B .
+
+    const u64 initial_value = 0x1122334455667788;
+    const u64 other_value = 0x8877665544332211;
+    std::memcpy(page.data() + 8, &initial_value, sizeof(u64));
+
+    jit.SetRegister(1, 0x1008);
+    jit.SetRegister(5, 0xDEADBEEFCAFEF00D);
+    jit.SetPC(0);
+
+    // Stop between the exclusive load and the exclusive store.
+    env.ticks_left = 2;
+    jit.Run();
+    REQUIRE(jit.GetRegister(0) == initial_value);
+    REQUIRE(jit.GetPC() == 8);
+
+    u64 expected_memory = 0;
+    u64 expected_status = 0;
+    SECTION("Uncontended") {
+        expected_memory = 0xDEADBEEFCAFEF00D;
+        expected_status = 0;
+    }
+    SECTION("Memory written by another agent") {
+        std::memcpy(page.data() + 8, &other_value, sizeof(u64));
+        expected_memory = other_value;
+        expected_status = 1;
+    }
+    SECTION("Monitor cleared by the host") {
+        jit.ClearExclusiveState();
+        expected_memory = initial_value;
+        expected_status = 1;
+    }
+
+    env.ticks_left = 2;
+    jit.Run();
+
+    u64 memory;
+    std::memcpy(&memory, page.data() + 8, sizeof(u64));
+    REQUIRE(jit.GetRegister(2) == expected_status);
+    REQUIRE(memory == expected_memory);
+    REQUIRE(env.modified_memory.empty());
+}
+
+TEST_CASE("A64: Atomic memory operations", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+
+    std::array<void*, 256> page_table{};
+    std::array<u8, 4096> page{};
+    for (size_t i = 0; i < page.size(); i++) {
+        page[i] = static_cast<u8>(i);
+    }
+
+    bool use_page_table = false;
+    SECTION("Memory callbacks") {
+        use_page_table = false;
+    }
+    SECTION("Page table") {
+        use_page_table = true;
+        page_table[1] = page.data();
+        conf.page_table = page_table.data();
+        conf.page_table_address_space_bits = 20;
+    }
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0xf8220023;  // LDADD X2, X3, [X1]
+    env.code_mem[1] = 0xb8e41025;  // LDCLRAL W4, W5, [X1]
+    env.code_mem[2] = 0x78262027;  // LDEORH W6, W7, [X1]
+    env.code_mem[3] = 0x38283029;  // LDSETB W8, W9, [X1]
+    env.code_mem[4] = 0xf82a402b;  // LDSMAX X10, X11, [X1]
+    env.code_mem[5] = 0x382c502d;  // LDSMINB W12, W13, [X1]
+    env.code_mem[6] = 0xb82e602f;  // LDUMAX W14, W15, [X1]
+    env.code_mem[7] = 0x78307031;  // LDUMINH W16, W17, [X1]
+    env.code_mem[8] = 0xf8f28033;  // SWPAL X18, X19, [X1]
+    env.code_mem[9] = 0xc8b47c35;  // CAS X20, X21, [X1]
+    env.code_mem[10] = 0x08b67c37; // CASB W22, W23, [X1]
+    env.code_mem[11] = 0x08387c3a; // CASP W24, W25, W26, W27, [X1]
+    env.code_mem[12] = 0x38bfc03c; // LDAPRB W28, [X1]
+    env.code_mem[13] = 0x14000000; // B .
+
+    jit.SetRegister(1, 0x1010);
+    jit.SetRegister(2, 0x1111111111111111);
+    jit.SetRegister(4, 0xFF00);
+    jit.SetRegister(6, 0xFFFF);
+    jit.SetRegister(8, 0x80);
+    jit.SetRegister(10, 0x7000000000000000);
+    jit.SetRegister(12, 0x80);
+    jit.SetRegister(14, 0xFFFFFFF0);
+    jit.SetRegister(16, 0x1);
+    jit.SetRegister(18, 0x0123456789ABCDEF);
+    jit.SetRegister(20, 0x0123456789ABCDEF);
+    jit.SetRegister(21, 0xFEDCBA9876543210);
+    jit.SetRegister(22, 0x00);
+    jit.SetRegister(23, 0xFF);
+    jit.SetRegister(24, 0x76543210);
+    jit.SetRegister(25, 0xFEDCBA98);
+    jit.SetRegister(26, 0xAAAAAAAA);
+    jit.SetRegister(27, 0xBBBBBBBB);
+    jit.SetPC(0);
+
+    env.ticks_left = 14;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(3) == 0x1716151413121110);
+    REQUIRE(jit.GetRegister(5) == 0x24232221);
+    REQUIRE(jit.GetRegister(7) == 0x0021);
+    REQUIRE(jit.GetRegister(9) == 0xDE);
+    REQUIRE(jit.GetRegister(11) == 0x282726252423FFDE);
+    REQUIRE(jit.GetRegister(13) == 0x00);
+    REQUIRE(jit.GetRegister(15) == 0x00000080);
+    REQUIRE(jit.GetRegister(17) == 0xFFF0);
+    REQUIRE(jit.GetRegister(19) == 0x70000000FFFF0001);
+    REQUIRE(jit.GetRegister(20) == 0x0123456789ABCDEF);
+    REQUIRE(jit.GetRegister(22) == 0x10);
+    REQUIRE(jit.GetRegister(24) == 0x76543210);
+    REQUIRE(jit.GetRegister(25) == 0xFEDCBA98);
+    REQUIRE(jit.GetRegister(28) == 0xAA);
+
+    u64 memory;
+    if (use_page_table) {
+        std::memcpy(&memory, page.data() + 0x10, sizeof(u64));
+        REQUIRE(env.modified_memory.empty());
+    } else {
+        memory = env.MemoryRead64(0x1010);
+    }
+    REQUIRE(memory == 0xBBBBBBBBAAAAAAAA);
+}
+
+TEST_CASE("A64: 128-bit exclusives and compare and swap", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+
+    std::array<void*, 256> page_table{};
+    alignas(16) std::array<u8, 0x2000> memory{};
+    for (size_t i = 0; i < memory.size(); i++) {
+        memory[i] = static_cast<u8>(i);
+    }
+
+    bool uses_host_memory = false;
+    SECTION("Memory callbacks") {
+        uses_host_memory = false;
+    }
+    SECTION("Page table") {
+        uses_host_memory = true;
+        page_table[1] = memory.data() + 0x1000;
+        conf.page_table = page_table.data();
+        conf.page_table_address_space_bits = 20;
+    }
+#ifdef __linux__
+    SECTION("Fastmem") {
+        uses_host_memory = true;
+        conf.fastmem_pointer = memory.data();
+        conf.fastmem_address_space_bits = 13;
+    }
+#endif
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0xc87f0440; // LDXP X0, X1, [X2]
+    env.code_mem[1] = 0xc8231444; // STXP W3, X4, X5, [X2]
+    env.code_mem[2] = 0x48267c48; // CASP X6, X7, X8, X9, [X2]
+    env.code_mem[3] = 0x482a7c4c; // CASP X10, X11, X12, X13, [X2]
+    env.code_mem[4] = 0xc87f3c4e; // LDXP X14, X15, [X2]
+    env.code_mem[5] = 0xd5033f5f; // CLREX
+    env.code_mem[6] = 0xc8301444; // STXP W16, X4, X5, [X2]
+    env.code_mem[7] = 0x14000000; // B .
+
+    jit.SetRegister(2, 0x1010);
+    jit.SetRegister(4, 0xAAAAAAAAAAAAAAAA);
+    jit.SetRegister(5, 0xBBBBBBBBBBBBBBBB);
+    jit.SetRegister(6, 0xAAAAAAAAAAAAAAAA);
+    jit.SetRegister(7, 0xBBBBBBBBBBBBBBBB);
+    jit.SetRegister(8, 0xCCCCCCCCCCCCCCCC);
+    jit.SetRegister(9, 0xDDDDDDDDDDDDDDDD);
+    jit.SetRegister(10, 0);
+    jit.SetRegister(11, 0);
+    jit.SetRegister(12, 0xEEEEEEEEEEEEEEEE);
+    jit.SetRegister(13, 0xFFFFFFFFFFFFFFFF);
+    jit.SetPC(0);
+
+    env.ticks_left = 8;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x1716151413121110);
+    REQUIRE(jit.GetRegister(1) == 0x1F1E1D1C1B1A1918);
+    REQUIRE(jit.GetRegister(3) == 0);
+    REQUIRE(jit.GetRegister(6) == 0xAAAAAAAAAAAAAAAA);
+    REQUIRE(jit.GetRegister(7) == 0xBBBBBBBBBBBBBBBB);
+    REQUIRE(jit.GetRegister(10) == 0xCCCCCCCCCCCCCCCC);
+    REQUIRE(jit.GetRegister(11) == 0xDDDDDDDDDDDDDDDD);
+    REQUIRE(jit.GetRegister(14) == 0xCCCCCCCCCCCCCCCC);
+    REQUIRE(jit.GetRegister(15) == 0xDDDDDDDDDDDDDDDD);
+    REQUIRE(jit.GetRegister(16) == 1);
+
+    std::array<u64, 2> result;
+    if (uses_host_memory) {
+        std::memcpy(result.data(), memory.data() + 0x1010, sizeof(result));
+        REQUIRE(env.modified_memory.empty());
+    } else {
+        result = {env.MemoryRead64(0x1010), env.MemoryRead64(0x1018)};
+    }
+    REQUIRE(result[0] == 0xCCCCCCCCCCCCCCCC);
+    REQUIRE(result[1] == 0xDDDDDDDDDDDDDDDD);
+}
+
+TEST_CASE("A64: Page table", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+
+    std::array<void*, 256> page_table{};
+    std::array<u8, 4096> page{};
+    page_table[1] = page.data();
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 20;
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0xf9400020; // LDR X0, [X1]
+    env.code_mem[1] = 0xf9000420; // STR X0, [X1, #8]
+    env.code_mem[2] = 0xf9400062; // LDR X2, [X3]
+    env.code_mem[3] = 0xf9400085; // LDR X5, [X4]
+    env.code_mem[4] = 0x14000000; // B .
+
+    for (size_t i = 0; i < 8; i++) {
+        page[i] = static_cast<u8>(0xA0 + i);
+    }
+
+    jit.SetRegister(1, 0x1000);
+    jit.SetRegister(3, 0x2000);        // Unmapped page
+    jit.SetRegister(4, 0x100000010);   // Outside of page table
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0xA7A6A5A4A3A2A1A0);
+    REQUIRE(jit.GetRegister(2) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(5) == 0x1716151413121110);
+    REQUIRE(std::equal(page.begin(), page.begin() + 8, page.begin() + 8));
+    REQUIRE(env.modified_memory.empty());
+    REQUIRE(jit.GetPC() == 16);
+}
+
+TEST_CASE("A64: Page table (128-bit)", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+
+    std::array<void*, 256> page_table{};
+    std::array<u8, 4096> page{};
+    page_table[1] = page.data();
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 20;
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0x4c407020; // LD1 {V0.16B}, [X1]
+    env.code_mem[1] = 0x4c0070c0; // ST1 {V0.16B}, [X6]
+    env.code_mem[2] = 0x4c407062; // LD1 {V2.16B}, [X3]
+    env.code_mem[3] = 0x4c407085; // LD1 {V5.16B}, [X4]
+    env.code_mem[4] = 0x14000000; // B .
+
+    for (size_t i = 0; i < 16; i++) {
+        page[i] = static_cast<u8>(0xA0 + i);
+    }
+
+    jit.SetRegister(1, 0x1000);
+    jit.SetRegister(6, 0x1010);
+    jit.SetRegister(3, 0x2000);        // Unmapped page
+    jit.SetRegister(4, 0x100000010);   // Outside of page table
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0xA7A6A5A4A3A2A1A0, 0xAFAEADACABAAA9A8});
+    REQUIRE(jit.GetVector(2) == Dynarmic::A64::Jit::Vector{0x0706050403020100, 0x0F0E0D0C0B0A0908});
+    REQUIRE(jit.GetVector(5) == Dynarmic::A64::Jit::Vector{0x1716151413121110, 0x1F1E1D1C1B1A1918});
+    REQUIRE(std::equal(page.begin(), page.begin() + 16, page.begin() + 16));
+    REQUIRE(env.modified_memory.empty());
+    REQUIRE(jit.GetPC() == 16);
+}
+
+#ifdef __linux__
+TEST_CASE("A64: Fastmem", "[a64]") {
+    constexpr size_t arena_size = 0x10000;
+    void* arena = mmap(nullptr, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(arena != MAP_FAILED);
+    REQUIRE(mprotect(static_cast<u8*>(arena) + 0x2000, 0x1000, PROT_NONE) == 0); // Faulting page
+
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.fastmem_pointer = arena;
+    conf.fastmem_address_space_bits = 16;
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0xf9400020; // LDR X0, [X1]
+    env.code_mem[1] = 0xf9000420; // STR X0, [X1, #8]
+    env.code_mem[2] = 0xf9400062; // LDR X2, [X3]
+    env.code_mem[3] = 0xf9000060; // STR X0, [X3]
+    env.code_mem[4] = 0xf9400085; // LDR X5, [X4]
+    env.code_mem[5] = 0x14000000; // B .
+
+    u8* const page = static_cast<u8*>(arena) + 0x1000;
+    for (size_t i = 0; i < 8; i++) {
+        page[i] = static_cast<u8>(0xA0 + i);
+    }
+
+    // The second iteration executes the patched accesses.
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        env.modified_memory.clear();
+
+        jit.SetRegister(1, 0x1000);
+        jit.SetRegister(3, 0x2010);   // Faulting page
+        jit.SetRegister(4, 0x10010);  // Outside of fastmem region
+        jit.SetPC(0);
+
+        env.ticks_left = 6;
+        jit.Run();
+
+        REQUIRE(jit.GetRegister(0) == 0xA7A6A5A4A3A2A1A0);
+        REQUIRE(jit.GetRegister(2) == 0x1716151413121110);
+        REQUIRE(jit.GetRegister(5) == 0x1716151413121110);
+        REQUIRE(std::equal(page, page + 8, page + 8));
+        REQUIRE(env.modified_memory.size() == 8);
+        REQUIRE(env.modified_memory[0x2010] == 0xA0);
+        REQUIRE(jit.GetPC() == 20);
+    }
+
+    munmap(arena, arena_size);
+}
+
+TEST_CASE("A64: Fastmem (128-bit)", "[a64]") {
+    constexpr size_t arena_size = 0x10000;
+    void* arena = mmap(nullptr, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(arena != MAP_FAILED);
+    REQUIRE(mprotect(static_cast<u8*>(arena) + 0x2000, 0x1000, PROT_NONE) == 0); // Faulting page
+
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.fastmem_pointer = arena;
+    conf.fastmem_address_space_bits = 16;
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0x4c407020; // LD1 {V0.16B}, [X1]
+    env.code_mem[1] = 0x4c0070c0; // ST1 {V0.16B}, [X6]
+    env.code_mem[2] = 0x4c407062; // LD1 {V2.16B}, [X3]
+    env.code_mem[3] = 0x4c007060; // ST1 {V0.16B}, [X3]
+    env.code_mem[4] = 0x4c407085; // LD1 {V5.16B}, [X4]
+    env.code_mem[5] = 0x14000000; // B .
+
+    u8* const page = static_cast<u8*>(arena) + 0x1000;
+    for (size_t i = 0; i < 16; i++) {
+        page[i] = static_cast<u8>(0xA0 + i);
+    }
+
+    // The second iteration executes the patched accesses.
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        env.modified_memory.clear();
+
+        jit.SetRegister(1, 0x1000);
+        jit.SetRegister(6, 0x1010);
+        jit.SetRegister(3, 0x2010);   // Faulting page
+        jit.SetRegister(4, 0x10010);  // Outside of fastmem region
+        jit.SetPC(0);
+
+        env.ticks_left = 6;
+        jit.Run();
+
+        REQUIRE(jit.GetVector(0) == Dynarmic::A64::Jit::Vector{0xA7A6A5A4A3A2A1A0, 0xAFAEADACABAAA9A8});
+        REQUIRE(jit.GetVector(2) == Dynarmic::A64::Jit::Vector{0x1716151413121110, 0x1F1E1D1C1B1A1918});
+        REQUIRE(jit.GetVector(5) == Dynarmic::A64::Jit::Vector{0x1716151413121110, 0x1F1E1D1C1B1A1918});
+        REQUIRE(std::equal(page, page + 16, page + 16));
+        REQUIRE(env.modified_memory.size() == 16);
+        REQUIRE(env.modified_memory[0x2010] == 0xA0);
+        REQUIRE(env.modified_memory[0x201F] == 0xAF);
+        REQUIRE(jit.GetPC() == 20);
+    }
+
+    munmap(arena, arena_size);
+}
+
+TEST_CASE("A64: Fastmem atomics", "[a64]") {
+    constexpr size_t arena_size = 0x10000;
+    void* arena = mmap(nullptr, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(arena != MAP_FAILED);
+    REQUIRE(mprotect(static_cast<u8*>(arena) + 0x2000, 0x1000, PROT_NONE) == 0); // Faulting page
+    REQUIRE(mprotect(static_cast<u8*>(arena) + 0x3000, 0x1000, PROT_READ) == 0); // Faulting on write only
+
+    TestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.fastmem_pointer = arena;
+    conf.fastmem_address_space_bits = 16;
+
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem[0] = 0xf8220023; // LDADD X2, X3, [X1]
+    env.code_mem[1] = 0xf8220086; // LDADD X2, X6, [X4]
+    env.code_mem[2] = 0xf82230a7; // LDSET X2, X7, [X5]
+    env.code_mem[3] = 0xc8a87c29; // CAS X8, X9, [X1]
+    env.code_mem[4] = 0xc85f7c8a; // LDXR X10, [X4]
+    env.code_mem[5] = 0xc80b7c8c; // STXR W11, X12, [X4]
+    env.code_mem[6] = 0x482e7c90; // CASP X14, X15, X16, X17, [X4]
+    env.code_mem[7] = 0x14000000; // B .
+
+    u8* const page = static_cast<u8*>(arena) + 0x1000;
+
+    // The second iteration executes the patched accesses.
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        env.modified_memory.clear();
+        const u64 initial_value = 5;
+        std::memcpy(page, &initial_value, sizeof(u64));
+
+        jit.SetRegister(1, 0x1000);
+        jit.SetRegister(2, 3);
+        jit.SetRegister(4, 0x2010);   // Faulting page
+        jit.SetRegister(5, 0x3010);   // Read-only page
+        jit.SetRegister(8, 8);
+        jit.SetRegister(9, 0x42);
+        jit.SetRegister(12, 0x99);
+        jit.SetRegister(14, 0x99);
+        jit.SetRegister(15, 0x1F1E1D1C1B1A1918);
+        jit.SetRegister(16, 1);
+        jit.SetRegister(17, 2);
+        jit.SetPC(0);
+
+        env.ticks_left = 8;
+        jit.Run();
+
+        u64 memory;
+        std::memcpy(&memory, page, sizeof(u64));
+        REQUIRE(memory == 0x42);
+        REQUIRE(jit.GetRegister(3) == 5);
+        REQUIRE(jit.GetRegister(6) == 0x1716151413121110);
+        REQUIRE(jit.GetRegister(7) == 0x1716151413121110);
+        REQUIRE(jit.GetRegister(8) == 8);
+        REQUIRE(jit.GetRegister(10) == 0x1716151413121113);
+        REQUIRE(jit.GetRegister(11) == 0);
+        REQUIRE(jit.GetRegister(14) == 0x99);
+        REQUIRE(jit.GetRegister(15) == 0x1F1E1D1C1B1A1918);
+        REQUIRE(env.MemoryRead64(0x2010) == 1);
+        REQUIRE(env.MemoryRead64(0x2018) == 2);
+        REQUIRE(env.MemoryRead64(0x3010) == 0x1716151413121113);
+        REQUIRE(jit.GetPC() == 28);
+    }
+
+    munmap(arena, arena_size);
+}
+#endif
+
+TEST_CASE("A64: Shared cache", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::SharedCache cache{Dynarmic::A64::UserConfig{&env}};
+    Dynarmic::A64::Jit jit0{cache};
+    Dynarmic::A64::Jit jit1{cache};
+
+    env.code_mem[0] = 0x8b020020; // ADD X0, X1, X2
+    env.code_mem[1] = 0x14000000; // B .
+
+    jit0.SetRegister(1, 1);
+    jit0.SetRegister(2, 2);
+    jit0.SetPC(0);
+    jit1.SetRegister(1, 10);
+    jit1.SetRegister(2, 20);
+    jit1.SetPC(0);
+
+    env.ticks_left = 2;
+    jit0.Run();
+    env.ticks_left = 2;
+    jit1.Run();
+
+    REQUIRE(jit0.GetRegister(0) == 3);
+    REQUIRE(jit0.GetPC() == 4);
+    REQUIRE(jit1.GetRegister(0) == 30);
+    REQUIRE(jit1.GetPC() == 4);
+
+    // Invalidation through one Jit applies to all Jits sharing the cache.
+    env.code_mem[0] = 0xcb020020; // SUB X0, X1, X2
+    jit0.InvalidateCacheRange(0, 4);
+
+    jit1.SetPC(0);
+    env.ticks_left = 2;
+    jit1.Run();
+
+    REQUIRE(jit1.GetRegister(0) == static_cast<u64>(-10));
+    REQUIRE(jit1.GetPC() == 4);
+}
+
+TEST_CASE("A64: Shared cache links blocks", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::SharedCache cache{Dynarmic::A64::UserConfig{&env}};
+    Dynarmic::A64::Jit jit0{cache};
+    Dynarmic::A64::Jit jit1{cache};
+
+    env.code_mem[0] = 0x8b010000; // ADD X0, X0, X1
+    env.code_mem[1] = 0xf1000442; // SUBS X2, X2, #1
+    env.code_mem[2] = 0x54ffffc1; // B.NE .-8
+    env.code_mem[3] = 0x14000000; // B .
+
+    // The loop links to itself, and is then relinked and unlinked as blocks are emitted and invalidated.
+    for (u64 i = 0; i < 3; i++) {
+        for (Dynarmic::A64::Jit* jit : {&jit0, &jit1}) {
+            jit->SetRegister(0, 0);
+            jit->SetRegister(1, i + 1);
+            jit->SetRegister(2, 5);
+            jit->SetPC(0);
+
+            env.ticks_left = 15;
+            jit->Run();
+
+            REQUIRE(jit->GetRegister(0) == 5 * (i + 1));
+            REQUIRE(jit->GetRegister(2) == 0);
+            REQUIRE(jit->GetPC() == 12);
+        }
+        jit0.InvalidateCacheRange(12, 4);
+    }
+}
+
+namespace {
+class ThreadedTestEnv final : public Dynarmic::A64::UserCallbacks {
+public:
+    u64 ticks_left = 0;
+    std::atomic<size_t> num_svcs{0};
+    u32 last_svc = 0;
+    std::array<u32, 4> code_mem;
+
+    ThreadedTestEnv() { code_mem.fill(0x14000000); } // B .
+
+    std::uint32_t MemoryReadCode(u64 vaddr) override {
+        return vaddr < code_mem.size() * sizeof(u32) ? code_mem[vaddr / sizeof(u32)] : 0x14000000; // B .
+    }
+
+    std::uint8_t MemoryRead8(u64) override { return 0; }
+    std::uint16_t MemoryRead16(u64) override { return 0; }
+    std::uint32_t MemoryRead32(u64 vaddr) override { return MemoryReadCode(vaddr); }
+    std::uint64_t MemoryRead64(u64) override { return 0; }
+
+    void MemoryWrite8(u64, std::uint8_t) override {}
+    void MemoryWrite16(u64, std::uint16_t) override {}
+    void MemoryWrite32(u64, std::uint32_t) override {}
+    void MemoryWrite64(u64, std::uint64_t) override {}
+
+    void InterpreterFallback(u64 pc, size_t num_instructions) override { ASSERT_MSG(false, "InterpreterFallback(%" PRIx64 ", %zu)", pc, num_instructions); }
+    void CallSVC(std::uint32_t swi) override { last_svc = swi; num_svcs++; }
+    void ExceptionRaised(u64 pc, Dynarmic::A64::Exception) override { ASSERT_MSG(false, "ExceptionRaised(%" PRIx64 ")", pc); }
+
+    void AddTicks(std::uint64_t ticks) override { ticks_left = ticks > ticks_left ? 0 : ticks_left - ticks; }
+    std::uint64_t GetTicksRemaining() override { return ticks_left; }
+};
+} // anonymous namespace
+
+TEST_CASE("A64: Shared cache with concurrent execution", "[a64]") {
+    constexpr size_t num_threads = 4;
+    constexpr u64 num_iterations = 2000;
+
+    std::array<ThreadedTestEnv, num_threads> envs;
+    for (auto& env : envs) {
+        env.code_mem[0] = 0x8b020020; // ADD X0, X1, X2
+        env.code_mem[1] = 0x14000000; // B .
+    }
+
+    Dynarmic::A64::SharedCache cache{Dynarmic::A64::UserConfig{&envs[0]}};
+
+    std::atomic<size_t> num_mismatches{0};
+    std::atomic<size_t> num_finished{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            ThreadedTestEnv& env = envs[t];
+            Dynarmic::A64::Jit jit{cache, &env};
+            for (u64 i = 0; i < num_iterations; i++) {
+                jit.SetRegister(1, i);
+                jit.SetRegister(2, t << 32);
+                jit.SetPC(0);
+
+                env.ticks_left = 2;
+                jit.Run();
+
+                if (jit.GetRegister(0) != (i | (u64(t) << 32)) || jit.GetPC() != 4) {
+                    num_mismatches++;
+                }
+            }
+            num_finished++;
+        });
+    }
+
+    // Invalidate while the Jits are executing.
+    while (num_finished != num_threads) {
+        cache.ClearCache();
+        cache.InvalidateCacheRange(0, 4);
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(num_mismatches == 0);
+}
+
+TEST_CASE("A64: Shared cache with per-Jit callbacks", "[a64]") {
+    std::array<ThreadedTestEnv, 2> envs;
+    for (auto& env : envs) {
+        env.code_mem[0] = 0xd4000021; // SVC #1
+        env.code_mem[1] = 0xd4000041; // SVC #2
+        env.code_mem[2] = 0x14000000; // B .
+    }
+
+    Dynarmic::A64::SharedCache cache{Dynarmic::A64::UserConfig{&envs[0]}};
+    Dynarmic::A64::Jit jit0{cache, &envs[0]};
+    Dynarmic::A64::Jit jit1{cache, &envs[1]};
+
+    envs[0].ticks_left = 1;
+    jit0.SetPC(0);
+    jit0.Run();
+    envs[1].ticks_left = 3;
+    jit1.SetPC(0);
+    jit1.Run();
+
+    // Each Jit calls its own callbacks, including for code emitted while the other Jit was running.
+    REQUIRE(envs[0].num_svcs == 1);
+    REQUIRE(envs[0].last_svc == 1);
+    REQUIRE(envs[1].num_svcs == 2);
+    REQUIRE(envs[1].last_svc == 2);
+    REQUIRE(envs[0].ticks_left == 0);
+    REQUIRE(envs[1].ticks_left == 0);
+}
+
+TEST_CASE("A64: HaltExecution from another thread", "[a64]") {
+    constexpr size_t num_threads = 4;
+
+    std::array<ThreadedTestEnv, num_threads> envs;
+    for (auto& env : envs) {
+        env.code_mem[0] = 0xd4000001; // SVC #0
+        env.code_mem[1] = 0x17ffffff; // B .-4
+        env.ticks_left = u64(1) << 62;
+    }
+
+    Dynarmic::A64::SharedCache cache{Dynarmic::A64::UserConfig{&envs[0]}};
+    std::vector<std::unique_ptr<Dynarmic::A64::Jit>> jits;
+    for (auto& env : envs) {
+        jits.push_back(std::make_unique<Dynarmic::A64::Jit>(cache, &env));
+        jits.back()->SetPC(0);
+    }
+
+    std::vector<std::thread> threads;
+    for (auto& jit : jits) {
+        threads.emplace_back([&jit] { jit->Run(); });
+    }
+
+    // Halts requested while the Jits are halted and resumed for cache maintenance must not be lost.
+    for (size_t i = 0; i < num_threads; i++) {
+        while (envs[i].num_svcs == 0) {
+            std::this_thread::yield();
+        }
+        cache.InvalidateCacheRange(0, 8);
+        jits[i]->HaltExecution();
+        cache.ClearCache();
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& env : envs) {
+        REQUIRE(env.ticks_left != 0);
+    }
+}
+
+TEST_CASE("A64: Background compilation", "[a64]") {
+    // Interprets the program below, which repeatedly increments X0.
+    class InterpretingTestEnv final : public Dynarmic::A64::UserCallbacks {
+    public:
+        Dynarmic::A64::Jit* jit = nullptr;
+        u64 ticks_left = 0;
+        size_t num_interpreted = 0;
+        std::array<u32, 2> code_mem{
+            0x91000400, // ADD X0, X0, #1
+            0x17ffffff, // B .-4
+        };
+
+        std::uint32_t MemoryReadCode(u64 vaddr) override { return code_mem.at(vaddr / sizeof(u32)); }
+
+        std::uint8_t MemoryRead8(u64) override { return 0; }
+        std::uint16_t MemoryRead16(u64) override { return 0; }
+        std::uint32_t MemoryRead32(u64 vaddr) override { return MemoryReadCode(vaddr); }
+        std::uint64_t MemoryRead64(u64) override { return 0; }
+
+        void MemoryWrite8(u64, std::uint8_t) override {}
+        void MemoryWrite16(u64, std::uint16_t) override {}
+        void MemoryWrite32(u64, std::uint32_t) override {}
+        void MemoryWrite64(u64, std::uint64_t) override {}
+
+        void InterpreterFallback(u64 pc, size_t num_instructions) override {
+            for (size_t i = 0; i < num_instructions; i++, num_interpreted++) {
+                if (pc == 0) {
+                    jit->SetRegister(0, jit->GetRegister(0) + 1);
+                    pc = 4;
+                } else {
+                    pc = 0;
+                }
+            }
+            jit->SetPC(pc);
+        }
+
+        void CallSVC(std::uint32_t swi) override { ASSERT_MSG(false, "CallSVC(%u)", swi); }
+        void ExceptionRaised(u64 pc, Dynarmic::A64::Exception) override { ASSERT_MSG(false, "ExceptionRaised(%" PRIx64 ")", pc); }
+
+        void AddTicks(std::uint64_t ticks) override { ticks_left = ticks > ticks_left ? 0 : ticks_left - ticks; total_ticks += ticks; }
+        std::uint64_t GetTicksRemaining() override { return ticks_left; }
+
+        u64 total_ticks = 0;
+    };
+
+    InterpretingTestEnv env;
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.enable_background_compilation = true;
+    Dynarmic::A64::Jit jit{conf};
+    env.jit = &jit;
+
+    jit.SetPC(0);
+
+    // Code is interpreted until it has been compiled.
+    env.ticks_left = 100;
+    jit.Run();
+    REQUIRE(env.num_interpreted > 0);
+
+    bool compiled = false;
+    for (size_t attempt = 0; attempt < 1000 && !compiled; attempt++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        const size_t num_interpreted = env.num_interpreted;
+        env.ticks_left = 100;
+        jit.Run();
+        compiled = env.num_interpreted == num_interpreted;
+    }
+    REQUIRE(compiled);
+
+    // Each executed instruction takes one tick. Results must be consistent regardless of how they were executed.
+    const u64 expected_x0 = (env.total_ticks + 1) / 2;
+    REQUIRE(jit.GetRegister(0) == expected_x0);
+    REQUIRE(jit.GetPC() == (env.total_ticks % 2) * 4);
+}
+
+TEST_CASE("A64: Translation cache", "[a64]") {
+    TestEnv env;
+    env.code_mem[0] = 0x8b010000; // ADD X0, X0, X1
+    env.code_mem[1] = 0xf1000442; // SUBS X2, X2, #1
+    env.code_mem[2] = 0x54ffffc1; // B.NE .-8
+    env.code_mem[3] = 0x14000000; // B .
+
+    const auto run = [&env](Dynarmic::A64::Jit& jit) {
+        jit.SetRegister(0, 0);
+        jit.SetRegister(1, 3);
+        jit.SetRegister(2, 5);
+        jit.SetPC(0);
+
+        env.ticks_left = 15;
+        jit.Run();
+
+        REQUIRE(jit.GetRegister(2) == 0);
+        REQUIRE(jit.GetPC() == 12);
+        return jit.GetRegister(0);
+    };
+
+    std::vector<u8> data;
+    {
+        Dynarmic::A64::UserConfig config{&env};
+        config.enable_translation_cache = true;
+        Dynarmic::A64::Jit jit{config};
+        REQUIRE(run(jit) == 15);
+        data = jit.SaveTranslationCache();
+    }
+
+    {
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+        REQUIRE(jit.LoadTranslationCache(data));
+        REQUIRE(run(jit) == 15);
+    }
+
+    // Loaded blocks are not used if the guest code they were translated from has changed.
+    env.code_mem[0] = 0xcb010000; // SUB X0, X0, X1
+    {
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+        REQUIRE(jit.LoadTranslationCache(data));
+        REQUIRE(run(jit) == static_cast<u64>(-15));
+    }
+
+    // Invalid data is rejected.
+    {
+        Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+        std::vector<u8> corrupt_data = data;
+        corrupt_data.back() ^= 1;
+        REQUIRE(!jit.LoadTranslationCache(corrupt_data));
+        std::vector<u8> truncated_data = data;
+        truncated_data.resize(truncated_data.size() - 1);
+        REQUIRE(!jit.LoadTranslationCache(truncated_data));
+    }
+}
+
+TEST_CASE("A64: Dispatch table is invalidated with the cache", "[a64]") {
+    TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem[0] = 0xd2800020; // MOVZ X0, #1
+    env.code_mem[1] = 0x14000000; // B .
+
+    jit.SetPC(0);
+    env.ticks_left = 2;
+    jit.Run();
+    REQUIRE(jit.GetRegister(0) == 1);
+
+    // A stale dispatch table entry would re-enter the old block for PC 0.
+    env.code_mem[0] = 0xd2800040; // MOVZ X0, #2
+
+    SECTION("InvalidateCacheRange") {
+        jit.InvalidateCacheRange(0, 4);
+    }
+
+    SECTION("ClearCache") {
+        jit.ClearCache();
+    }
+
+    jit.SetPC(0);
+    env.ticks_left = 2;
+    jit.Run();
+    REQUIRE(jit.GetRegister(0) == 2);
+    REQUIRE(jit.GetPC() == 4);
+}
@@ -0,0 +1,271 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <catch.hpp>
+
+#include "A64/testenv.h"
+#include "backend_x64/a64_jitstate.h"
+#include "backend_x64/block_of_code.h"
+#include "backend_x64/callback.h"
+#include "backend_x64/dispatch_table.h"
+#include "backend_x64/fastmem_patch_table.h"
+#include "common/common_types.h"
+
+using namespace Dynarmic;
+using namespace Dynarmic::BackendX64;
+
+TEST_CASE("x64: Dispatch table", "[backend_x64]") {
+    struct DispatchTestEnv {
+        size_t lookups = 0;
+        u64 ticks_executed = 0;
+        CodePtr entrypoint = nullptr;
+    } test_env;
+
+    const auto lookup_block = +[](DispatchTestEnv* test_env, A64JitState*) -> CodePtr {
+        test_env->lookups++;
+        return test_env->entrypoint;
+    };
+    const auto add_ticks = +[](DispatchTestEnv* test_env, u64 ticks) {
+        test_env->ticks_executed += ticks;
+    };
+    const auto get_ticks_remaining = +[](DispatchTestEnv*) -> u64 {
+        return 3;
+    };
+
+    const u64 arg = reinterpret_cast<u64>(&test_env);
+    RunCodeCallbacks cb{
+        std::make_unique<ArgCallback>(lookup_block, arg),
+        std::make_unique<ArgCallback>(add_ticks, arg),
+        std::make_unique<ArgCallback>(get_ticks_remaining, arg),
+    };
+
+    constexpr size_t far_code_offset = 16 * 1024 * 1024;
+    BlockOfCode code{std::move(cb), JitStateInfo{A64JitState{}}, 2 * far_code_offset, far_code_offset};
+    code.PreludeComplete();
+
+    // A block that consumes one tick and returns to the dispatcher.
+    // Entrypoints are aligned, as the dispatcher reserves the low bit to mark uncacheable blocks.
+    code.align();
+    test_env.entrypoint = code.getCurr();
+    code.sub(code.qword[code.r15 + offsetof(A64JitState, cycles_remaining)], 1);
+    code.ReturnFromRunCode();
+
+    DispatchTable dispatch_table;
+    A64JitState jit_state;
+    jit_state.dispatch_table = &dispatch_table;
+    jit_state.pc = 0x1000;
+
+    // Only the first of the three entries into the block misses the table.
+    code.RunCode(&jit_state);
+    REQUIRE(test_env.ticks_executed == 3);
+    REQUIRE(test_env.lookups == 1);
+
+    code.RunCode(&jit_state);
+    REQUIRE(test_env.ticks_executed == 6);
+    REQUIRE(test_env.lookups == 1);
+
+    // A different location misses.
+    jit_state.pc = 0x2000;
+    code.RunCode(&jit_state);
+    REQUIRE(test_env.lookups == 2);
+
+    // A cleared table misses.
+    dispatch_table.Clear();
+    jit_state.pc = 0x1000;
+    code.RunCode(&jit_state);
+    REQUIRE(test_env.ticks_executed == 12);
+    REQUIRE(test_env.lookups == 3);
+}
+
+TEST_CASE("x64: Constant pool overflow", "[backend_x64]") {
+    const auto noop = +[](u64) -> u64 { return 0; };
+    RunCodeCallbacks cb{
+        std::make_unique<ArgCallback>(noop, 0),
+        std::make_unique<ArgCallback>(noop, 0),
+        std::make_unique<ArgCallback>(noop, 0),
+    };
+
+    constexpr size_t far_code_offset = 16 * 1024 * 1024;
+    BlockOfCode code{std::move(cb), JitStateInfo{A64JitState{}}, 2 * far_code_offset, far_code_offset};
+    code.PreludeComplete();
+    code.EnsureMemoryCommitted(2 * 1024 * 1024);
+
+    // Far more distinct constants than fit in the pool, in each of the shapes that are built differently once it is full.
+    constexpr size_t constants_per_shape = 8000;
+    std::vector<std::array<u64, 2>> expected;
+    for (u64 i = 0; i < constants_per_shape; i++) {
+        const u64 value = 0x0123456789ABCDEF * (i + 1);
+        expected.push_back({value, 0});
+        expected.push_back({value, value});
+        expected.push_back({value, ~value});
+    }
+
+    // Stores each constant to consecutive 16-byte slots of the buffer passed as the first argument.
+    const auto store_constants = code.getCurr<void(*)(std::array<u64, 2>*)>();
+    for (size_t i = 0; i < expected.size(); i++) {
+        code.LoadConstant(code.xmm0, expected[i][0], expected[i][1]);
+        code.movups(code.xword[code.ABI_PARAM1 + i * 16], code.xmm0);
+    }
+    // Space is still available for constants that the emitter itself needs.
+    code.movaps(code.xmm0, code.MConst(0xFEDCBA9876543210, 0x0F1E2D3C4B5A6978));
+    code.movups(code.xword[code.ABI_PARAM1 + expected.size() * 16], code.xmm0);
+    code.ret();
+    expected.push_back({0xFEDCBA9876543210, 0x0F1E2D3C4B5A6978});
+
+    std::vector<std::array<u64, 2>> actual(expected.size());
+    store_constants(actual.data());
+    REQUIRE(actual == expected);
+}
+
+TEST_CASE("x64: Code cache region eviction", "[backend_x64]") {
+    TestEnv env;
+    Dynarmic::A64::UserConfig config{&env};
+    // The smallest permitted cache, so that its regions are filled and evicted quickly.
+    config.code_cache_size = 32 * 1024 * 1024;
+    config.far_code_offset = 16 * 1024 * 1024;
+    Dynarmic::A64::Jit jit{config};
+
+    constexpr size_t block_count = 511;
+    for (size_t i = 0; i < block_count; i++) {
+        env.code_mem[2 * i + 0] = 0x91000400; // ADD X0, X0, #1
+        env.code_mem[2 * i + 1] = 0x14000001; // B .+4
+    }
+    env.code_mem[2 * block_count + 1] = 0x14000000; // B .
+
+    // Invalidating retranslates every block without reclaiming the space they used, so the cache
+    // wraps around and evicts regions which still hold earlier translations.
+    for (u32 iteration = 0; iteration < 250; iteration++) {
+        env.code_mem[2 * block_count] = 0xd2800001 | ((iteration & 0xFFFF) << 5); // MOVZ X1, #iteration
+        jit.InvalidateCacheRange(0, env.code_mem.size() * sizeof(u32));
+
+        jit.SetRegister(0, 0);
+        jit.SetRegister(1, 0);
+        jit.SetPC(0);
+
+        env.ticks_left = 2 * block_count + 2;
+        jit.Run();
+
+        REQUIRE(jit.GetRegister(0) == block_count);
+        REQUIRE(jit.GetRegister(1) == iteration);
+        REQUIRE(jit.GetPC() == 8 * block_count + 4);
+    }
+}
+
+TEST_CASE("x64: Configured code cache size", "[backend_x64]") {
+    constexpr size_t code_cache_size = 56 * 1024 * 1024;
+    constexpr size_t far_code_offset = 24 * 1024 * 1024;
+
+    SECTION("Regions partition the configured near and far code") {
+        const auto noop = +[](u64) -> u64 { return 0; };
+        RunCodeCallbacks cb{
+            std::make_unique<ArgCallback>(noop, 0),
+            std::make_unique<ArgCallback>(noop, 0),
+            std::make_unique<ArgCallback>(noop, 0),
+        };
+        BlockOfCode code{std::move(cb), JitStateInfo{A64JitState{}}, code_cache_size, far_code_offset};
+        code.PreludeComplete();
+
+        const u8* const near_code_end = code.getCode() + far_code_offset;
+        const u8* const far_code_end = code.getCode() + code_cache_size;
+
+        std::vector<CodeRegion> regions{code.AdvanceRegion()};
+        while (true) {
+            const CodeRegion region = code.AdvanceRegion();
+            if (region.near_begin == regions.front().near_begin) {
+                break;
+            }
+            regions.push_back(region);
+        }
+
+        // The first region returned is the second region of the cache; the last region is followed by the first.
+        REQUIRE(regions.size() >= 2);
+        for (size_t i = 1; i < regions.size() - 1; i++) {
+            REQUIRE(regions[i].near_begin == regions[i - 1].near_end);
+            REQUIRE(regions[i].far_begin == regions[i - 1].far_end);
+        }
+        const CodeRegion& last_region = regions[regions.size() - 2];
+        REQUIRE(last_region.near_end == near_code_end);
+        REQUIRE(last_region.far_end == far_code_end);
+        REQUIRE(regions.back().near_end == regions.front().near_begin);
+        REQUIRE(regions.back().far_end == regions.front().far_begin);
+        REQUIRE(regions.back().far_begin >= near_code_end);
+
+        // Emission continues from the start of the region most recently advanced to.
+        REQUIRE(code.getCurr() == regions.front().near_begin);
+        REQUIRE(code.SpaceRemaining() == std::min<size_t>(regions.front().near_end - regions.front().near_begin,
+                                                          regions.front().far_end - regions.front().far_begin));
+    }
+
+    SECTION("Code executes from a configured cache") {
+        TestEnv env;
+        Dynarmic::A64::UserConfig config{&env};
+        config.code_cache_size = code_cache_size;
+        config.far_code_offset = far_code_offset;
+        Dynarmic::A64::Jit jit{config};
+
+        env.code_mem[0] = 0x8b010000; // ADD X0, X0, X1
+        env.code_mem[1] = 0xf1000442; // SUBS X2, X2, #1
+        env.code_mem[2] = 0x54ffffc1; // B.NE .-8
+        env.code_mem[3] = 0x14000000; // B .
+
+        jit.SetRegister(0, 0);
+        jit.SetRegister(1, 3);
+        jit.SetRegister(2, 5);
+        jit.SetPC(0);
+
+        env.ticks_left = 15;
+        jit.Run();
+
+        REQUIRE(jit.GetRegister(0) == 15);
+        REQUIRE(jit.GetRegister(2) == 0);
+        REQUIRE(jit.GetPC() == 12);
+    }
+}
+
+TEST_CASE("x64: Fastmem patch table", "[backend_x64]") {
+    FastmemPatchTable table;
+
+    const auto info_for = [](u64 location) {
+        return FastmemPatchInfo{reinterpret_cast<CodePtr>(location + 1), reinterpret_cast<CodePtr>(location + 2), location % 16};
+    };
+    const auto check = [&](u64 location, bool present) {
+        const auto info = table.Lookup(location);
+        REQUIRE(static_cast<bool>(info) == present);
+        if (info) {
+            REQUIRE(info->callback == info_for(location).callback);
+            REQUIRE(info->resume_rip == info_for(location).resume_rip);
+            REQUIRE(info->size == info_for(location).size);
+        }
+    };
+
+    // Enough entries for the table to grow several times.
+    constexpr u64 base = 0x7F0000000000;
+    constexpr u64 count = 10000;
+    for (u64 i = 0; i < count; i++) {
+        table.Insert(base + i * 8, info_for(base + i * 8));
+    }
+    for (u64 i = 0; i < count; i++) {
+        check(base + i * 8, true);
+        check(base + i * 8 + 4, false);
+    }
+
+    table.EraseIf([](u64 location) { return location >= base + count * 4; });
+    for (u64 i = 0; i < count; i++) {
+        check(base + i * 8, i < count / 2);
+    }
+
+    table.Insert(base + count * 8, info_for(base + count * 8));
+    check(base + count * 8, true);
+
+    table.Clear();
+    check(base, false);
+    check(base + count * 8, false);
+}
@@ -0,0 +1,202 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <array>
+
+#include <catch.hpp>
+
+#include "common/aes.h"
+#include "common/common_types.h"
+#include "common/polynomial_multiply.h"
+#include "common/sha.h"
+#include "rand_int.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+using SHAVector = Common::SHA::Vector;
+
+Common::AES::State RandomAESState() {
+    Common::AES::State state;
+    for (auto& byte : state) {
+        byte = static_cast<u8>(RandInt<u32>(0, 0xFF));
+    }
+    return state;
+}
+
+SHAVector AddVectors(const SHAVector& a, const SHAVector& b) {
+    return {a[0] + b[0], a[1] + b[1], a[2] + b[2], a[3] + b[3]};
+}
+
+SHAVector Broadcast(u32 value) {
+    return {value, value, value, value};
+}
+
+// The message block for "abc", padded as specified in section 5.1.1 of FIPS 180-4.
+constexpr std::array<SHAVector, 4> abc_message_block{{
+    {0x61626380, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0x00000018},
+}};
+
+} // anonymous namespace
+
+// Intermediate values are from the first round of the cipher example in Appendix B of FIPS 197.
+TEST_CASE("AES: Single round", "[crypto]") {
+    const Common::AES::State round_input{{0x19, 0x3d, 0xe3, 0xbe, 0xa0, 0xf4, 0xe2, 0x2b, 0x9a, 0xc6, 0x8d, 0x2a, 0xe9, 0xf8, 0x48, 0x08}};
+    const Common::AES::State after_shift_rows{{0xd4, 0xbf, 0x5d, 0x30, 0xe0, 0xb4, 0x52, 0xae, 0xb8, 0x41, 0x11, 0xf1, 0x1e, 0x27, 0x98, 0xe5}};
+    const Common::AES::State after_mix_columns{{0x04, 0x66, 0x81, 0xe5, 0xe0, 0xcb, 0x19, 0x9a, 0x48, 0xf8, 0xd3, 0x7a, 0x28, 0x06, 0x26, 0x4c}};
+
+    Common::AES::State result;
+
+    Common::AES::EncryptSingleRound(result, round_input);
+    REQUIRE(result == after_shift_rows);
+
+    Common::AES::MixColumns(result, after_shift_rows);
+    REQUIRE(result == after_mix_columns);
+
+    Common::AES::InverseMixColumns(result, after_mix_columns);
+    REQUIRE(result == after_shift_rows);
+
+    Common::AES::DecryptSingleRound(result, after_shift_rows);
+    REQUIRE(result == round_input);
+}
+
+TEST_CASE("AES: MixColumns", "[crypto]") {
+    const Common::AES::State input{{0xdb, 0x13, 0x53, 0x45, 0xf2, 0x0a, 0x22, 0x5c, 0xc6, 0xc6, 0xc6, 0xc6, 0x2d, 0x26, 0x31, 0x4c}};
+    const Common::AES::State expected{{0x8e, 0x4d, 0xa1, 0xbc, 0x9f, 0xdc, 0x58, 0x9d, 0xc6, 0xc6, 0xc6, 0xc6, 0x4d, 0x7e, 0xbd, 0xf8}};
+
+    Common::AES::State result;
+    Common::AES::MixColumns(result, input);
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("AES: Inverse operations round-trip", "[crypto]") {
+    for (size_t i = 0; i < 1000; i++) {
+        const Common::AES::State state = RandomAESState();
+        Common::AES::State intermediate;
+        Common::AES::State result;
+
+        Common::AES::EncryptSingleRound(intermediate, state);
+        Common::AES::DecryptSingleRound(result, intermediate);
+        REQUIRE(result == state);
+
+        Common::AES::MixColumns(intermediate, state);
+        Common::AES::InverseMixColumns(result, intermediate);
+        REQUIRE(result == state);
+    }
+}
+
+// Runs the SHA-1 compression function the way AArch64 code does with SHA1C/SHA1P/SHA1M/SHA1SU0/SHA1SU1.
+TEST_CASE("SHA: SHA-1 compression", "[crypto]") {
+    constexpr std::array<u32, 4> round_constants{{0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6}};
+    const std::array<u32, 5> initial_hash{{0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0}};
+
+    std::array<SHAVector, 4> message = abc_message_block;
+    SHAVector abcd{{initial_hash[0], initial_hash[1], initial_hash[2], initial_hash[3]}};
+    u32 e = initial_hash[4];
+
+    for (size_t group = 0; group < 20; group++) {
+        const size_t stage = group / 5;
+        const SHAVector wk = AddVectors(message[group % 4], Broadcast(round_constants[stage]));
+        const SHAVector y{{e, 0, 0, 0}};
+        // SHA1H
+        const u32 next_e = (abcd[0] << 30) | (abcd[0] >> 2);
+
+        SHAVector result;
+        if (stage == 0) {
+            Common::SHA::SHA1HashUpdateChoose(result, abcd, y, wk);
+        } else if (stage == 2) {
+            Common::SHA::SHA1HashUpdateMajority(result, abcd, y, wk);
+        } else {
+            Common::SHA::SHA1HashUpdateParity(result, abcd, y, wk);
+        }
+        abcd = result;
+        e = next_e;
+
+        if (group < 16) {
+            const SHAVector& a = message[group % 4];
+            const SHAVector& b = message[(group + 1) % 4];
+            const SHAVector& c = message[(group + 2) % 4];
+            // SHA1SU0
+            const SHAVector schedule0{{a[2] ^ a[0] ^ c[0], a[3] ^ a[1] ^ c[1], b[0] ^ a[2] ^ c[2], b[1] ^ a[3] ^ c[3]}};
+            Common::SHA::SHA1MessageSchedule1(message[group % 4], schedule0, message[(group + 3) % 4]);
+        }
+    }
+
+    REQUIRE(abcd[0] + initial_hash[0] == 0xA9993E36);
+    REQUIRE(abcd[1] + initial_hash[1] == 0x4706816A);
+    REQUIRE(abcd[2] + initial_hash[2] == 0xBA3E2571);
+    REQUIRE(abcd[3] + initial_hash[3] == 0x7850C26C);
+    REQUIRE(e + initial_hash[4] == 0x9CD0D89D);
+}
+
+// Runs the SHA-256 compression function the way AArch64 code does with SHA256H/SHA256H2/SHA256SU0/SHA256SU1.
+TEST_CASE("SHA: SHA-256 compression", "[crypto]") {
+    constexpr std::array<u32, 64> round_constants{{
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    }};
+    const SHAVector initial_abcd{{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a}};
+    const SHAVector initial_efgh{{0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}};
+
+    std::array<SHAVector, 4> message = abc_message_block;
+    SHAVector abcd = initial_abcd;
+    SHAVector efgh = initial_efgh;
+
+    for (size_t group = 0; group < 16; group++) {
+        const SHAVector k{{round_constants[group * 4 + 0], round_constants[group * 4 + 1], round_constants[group * 4 + 2], round_constants[group * 4 + 3]}};
+        const SHAVector wk = AddVectors(message[group % 4], k);
+
+        SHAVector new_abcd;
+        SHAVector new_efgh;
+        Common::SHA::SHA256HashPart1(new_abcd, abcd, efgh, wk);
+        Common::SHA::SHA256HashPart2(new_efgh, abcd, efgh, wk);
+        abcd = new_abcd;
+        efgh = new_efgh;
+
+        if (group < 12) {
+            SHAVector schedule0;
+            Common::SHA::SHA256MessageSchedule0(schedule0, message[group % 4], message[(group + 1) % 4]);
+            Common::SHA::SHA256MessageSchedule1(message[group % 4], schedule0, message[(group + 2) % 4], message[(group + 3) % 4]);
+        }
+    }
+
+    REQUIRE(AddVectors(abcd, initial_abcd) == SHAVector{{0xba7816bf, 0x8f01cfea, 0x414140de, 0x5dae2223}});
+    REQUIRE(AddVectors(efgh, initial_efgh) == SHAVector{{0xb00361a3, 0x96177a9c, 0xb410ff61, 0xf20015ad}});
+}
+
+TEST_CASE("PMULL: 64-bit polynomial multiplication", "[crypto]") {
+    struct TestCase {
+        u64 a;
+        u64 b;
+        std::array<u64, 2> expected;
+    };
+
+    const std::array<TestCase, 7> test_cases{{
+        {0x0000000000000000, 0x156724D0F9507C87, {{0x0000000000000000, 0x0000000000000000}}},
+        {0x0000000000000001, 0x156724D0F9507C87, {{0x156724D0F9507C87, 0x0000000000000000}}},
+        {0x0000000000000003, 0x0000000000000003, {{0x0000000000000005, 0x0000000000000000}}},
+        {0x8000000000000000, 0x8000000000000000, {{0x0000000000000000, 0x4000000000000000}}},
+        {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, {{0x5555555555555555, 0x5555555555555555}}},
+        {0x156724D0F9507C87, 0x01952061CA532551, {{0x7FCE34E73C6FEE37, 0x001EC09449A67A46}}},
+        {0xFFFC3436D523583B, 0x5F81639E85FBC058, {{0x41BEA9BB20EF0CA8, 0x357FFBF0CC8B88A1}}},
+    }};
+
+    for (const auto& test_case : test_cases) {
+        INFO("a: " << std::hex << test_case.a << ", b: " << test_case.b);
+        REQUIRE(Common::PolynomialMultiplyLong64(test_case.a, test_case.b) == test_case.expected);
+        REQUIRE(Common::PolynomialMultiplyLong64(test_case.b, test_case.a) == test_case.expected);
+    }
+}
@@ -0,0 +1,73 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <catch.hpp>
+
+#include "common/common_types.h"
+#include "frontend/A32/decoder/arm.h"
+#include "frontend/A32/decoder/vfp2.h"
+#include "frontend/A32/translate/translate_arm/translate_arm.h"
+#include "frontend/A64/decoder/a64.h"
+#include "frontend/A64/translate/impl/impl.h"
+#include "rand_int.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+/// Checks that decode returns the same matcher as a linear scan of table for a sample of instructions.
+/// The sample contains random instructions which each matcher accepts, as well as entirely random instructions.
+/// Instructions for which is_excluded returns true are expected not to decode at all.
+template <typename MatcherT, typename DecodeFn>
+void CheckAgainstLinearScan(const std::vector<MatcherT>& table, DecodeFn decode, bool (*is_excluded)(u32) = [](u32) { return false; }) {
+    const auto check = [&](u32 instruction) {
+        const auto matches = [instruction](const auto& matcher) { return matcher.Matches(instruction); };
+        const auto expected = is_excluded(instruction) ? table.end() : std::find_if(table.begin(), table.end(), matches);
+        const auto actual = decode(instruction);
+        const bool decoded = static_cast<bool>(actual);
+
+        INFO("Instruction: " << std::hex << instruction);
+        REQUIRE(decoded == (expected != table.end()));
+        if (!decoded) {
+            return;
+        }
+        INFO("Expected: " << expected->GetName() << ", actual: " << actual->GetName());
+        REQUIRE(actual->GetMask() == expected->GetMask());
+        REQUIRE(actual->GetExpected() == expected->GetExpected());
+    };
+
+    for (const auto& matcher : table) {
+        for (size_t i = 0; i < 16; i++) {
+            check(matcher.GetExpected() | (RandInt<u32>(0, 0xFFFFFFFF) & ~matcher.GetMask()));
+        }
+    }
+
+    for (size_t i = 0; i < 100000; i++) {
+        check(RandInt<u32>(0, 0xFFFFFFFF));
+    }
+}
+
+} // anonymous namespace
+
+TEST_CASE("Decoder lookup table: A64", "[decoder]") {
+    using Visitor = A64::TranslatorVisitor;
+    CheckAgainstLinearScan(A64::GetDecodeTable<Visitor>(), &A64::Decode<Visitor>);
+}
+
+TEST_CASE("Decoder lookup table: Arm", "[decoder]") {
+    using Visitor = A32::ArmTranslatorVisitor;
+    CheckAgainstLinearScan(A32::GetArmDecodeTable<Visitor>(), &A32::DecodeArm<Visitor>);
+}
+
+TEST_CASE("Decoder lookup table: VFP2", "[decoder]") {
+    using Visitor = A32::ArmTranslatorVisitor;
+    // Unconditional instructions are never decoded as VFP instructions.
+    const auto is_unconditional = [](u32 instruction) { return (instruction & 0xF0000000) == 0xF0000000; };
+    CheckAgainstLinearScan(A32::GetVFP2DecodeTable<Visitor>(), &A32::DecodeVFP2<Visitor>, is_unconditional);
+}